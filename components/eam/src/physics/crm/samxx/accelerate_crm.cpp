@@ -22,16 +22,17 @@ void accelerate_crm(int nstep, int nstop, bool &ceaseflag) {
   real tmin = 50.0;  // should never get below 50K in crm, following UP-CAM implementation
   int idx_qt = index_water_vapor;
 
-  real2d ubaccel("ubaccel", nzm, ncrms);
-  real2d vbaccel("vbaccel", nzm, ncrms);
-  real2d tbaccel("tbaccel", nzm, ncrms);
-  real2d qtbaccel("qtbaccel", nzm, ncrms);
-  real2d ttend_acc("ttend_acc", nzm, ncrms);
-  real2d qtend_acc("qtend_acc", nzm, ncrms);
-  real2d utend_acc("utend_acc", nzm, ncrms);
-  real2d vtend_acc("vtend_acc", nzm, ncrms);
-  real2d qpoz("qpoz", nzm, ncrms);
-  real2d qneg("qneg", nzm, ncrms);
+  ScratchScope scratch;
+  real2d ubaccel = scratch.get<real2d>("ubaccel", nzm, ncrms);
+  real2d vbaccel = scratch.get<real2d>("vbaccel", nzm, ncrms);
+  real2d tbaccel = scratch.get<real2d>("tbaccel", nzm, ncrms);
+  real2d qtbaccel = scratch.get<real2d>("qtbaccel", nzm, ncrms);
+  real2d ttend_acc = scratch.get<real2d>("ttend_acc", nzm, ncrms);
+  real2d qtend_acc = scratch.get<real2d>("qtend_acc", nzm, ncrms);
+  real2d utend_acc = scratch.get<real2d>("utend_acc", nzm, ncrms);
+  real2d vtend_acc = scratch.get<real2d>("vtend_acc", nzm, ncrms);
+  real2d qpoz = scratch.get<real2d>("qpoz", nzm, ncrms);
+  real2d qneg = scratch.get<real2d>("qneg", nzm, ncrms);
 
   // !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
   // Compute the average among horizontal columns for each variable
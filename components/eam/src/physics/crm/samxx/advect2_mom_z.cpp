@@ -18,9 +18,10 @@ void advect2_mom_z() {
   YAKL_SCOPE( adzw           , :: adzw);
   YAKL_SCOPE( ncrms          , :: ncrms);
 
-  real4d fuz("fuz",nz ,ny,nx,ncrms);
-  real4d fvz("fvz",nz ,ny,nx,ncrms);
-  real4d fwz("fwz",nzm,ny,nx,ncrms);
+  ScratchScope scratch;
+  real4d fuz = scratch.get<real4d>("fuz",nz ,ny,nx,ncrms);
+  real4d fvz = scratch.get<real4d>("fvz",nz ,ny,nx,ncrms);
+  real4d fwz = scratch.get<real4d>("fwz",nzm,ny,nx,ncrms);
 
   // for (int k=0; k<nzm; k++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
@@ -1,30 +1,121 @@
 #include "advect_all_scalars.h"
 
+#ifdef SAMXX_CHECK_ADVECT_BATCH
+#include <iostream>
+#include <string>
+
+// Advects the fields ind_f_host(0:nfld-1) of f one at a time, into copies of f, fadv
+// and flux, and checks that the result matches advecting them all in one batch.
+// Only enabled in the standalone tests.
+class AdvectBatchCheck {
+public:
+  // f is dimensioned (nf,nzm,dimy_s,dimx_s,ncrms), fadv and flux (nf,nz,ncrms)
+  AdvectBatchCheck(real5d &f, int nf, intHost1d &ind_f_host, int nfld, real3d &fadv, real3d &flux, bool do_flux)
+   : f(f), ind_f_host(ind_f_host), nfld(nfld), fadv(fadv), flux(flux), do_flux(do_flux)
+  {
+    f1 = real5d("f1", nf, nzm, dimy_s, dimx_s, ncrms);
+    f.deep_copy_to(f1);
+    if (do_flux) {
+      fadv1 = real3d("fadv1", nf, nz, ncrms);
+      flux1 = real3d("flux1", nf, nz, ncrms);
+      fadv.deep_copy_to(fadv1);
+      flux.deep_copy_to(flux1);
+    }
+    ScratchScope scratch;
+    int1d ind_f = scratch.get<int1d>("ind_f",1);
+    for (int l=0; l<nfld; l++) {
+      yakl::memset(ind_f,ind_f_host(l));
+      advect_scalar_batch(f1,ind_f,1,fadv1,flux1,do_flux);
+    }
+  }
+
+  // Call after advecting the fields in f in one batch
+  void check() const {
+    // The fields must match bit for bit. fadv and flux are sums over the columns
+    // computed with atomics, so they may only match up to roundoff on GPUs.
+    check_same("f"   , f.createHostCopy()   , f1.createHostCopy()   , nzm*dimy_s*dimx_s*ncrms, 0);
+    if (do_flux) {
+      check_same("fadv", fadv.createHostCopy(), fadv1.createHostCopy(), nz*ncrms, 1.e-12);
+      check_same("flux", flux.createHostCopy(), flux1.createHostCopy(), nz*ncrms, 1.e-12);
+    }
+  }
+
+protected:
+  template <class ARR>
+  void check_same(std::string const &name, ARR const &batch, ARR const &single, int n, real tol) const {
+    for (int l=0; l<nfld; l++) {
+      int const ind = ind_f_host(l);
+      for (int i=0; i<n; i++) {
+        real const a = batch.data()[ind*n+i];
+        real const b = single.data()[ind*n+i];
+        if (abs(a-b) > tol*max(abs(a),abs(b))) {
+          std::cerr << "ERROR: batched and per-field advection of " << name << " differ for field "
+                    << ind << ": " << a << " vs " << b << std::endl;
+          exit(-1);
+        }
+      }
+    }
+  }
+
+  real5d    f, f1;
+  intHost1d ind_f_host;
+  int       nfld;
+  real3d    fadv, flux, fadv1, flux1;
+  bool      do_flux;
+};
+#endif
+
 void advect_all_scalars() {
 
-  real2d dummy("dummy",nz,ncrms);
-  real1d esmt_offset("esmt_offset", ncrms);
+  ScratchScope scratch;
+  real2d dummy = scratch.get<real2d>("dummy",nz,ncrms);
+  real1d esmt_offset = scratch.get<real1d>("esmt_offset", ncrms);
   YAKL_SCOPE( u_esmt  , :: u_esmt);
   YAKL_SCOPE( v_esmt  , :: v_esmt);
   YAKL_SCOPE( use_ESMT, :: use_ESMT );
-  real1d esmt_min("esmt_min",ncrms);
+  real1d esmt_min = scratch.get<real1d>("esmt_min",ncrms);
   yakl::memset(esmt_min,1.0e20);
 
   // advection of scalars :
   advect_scalar(t,dummy,dummy);
 
-  // Advection of microphysics prognostics:
+  // Advection of microphysics prognostics, all advected fields at once:
+  intHost1d micro_ind_host("micro_ind_host",nmicro_fields);
+  int nmicro_adv = 0;
   for (int k=0; k<nmicro_fields; k++) {
     if ( k==index_water_vapor || (docloud && flag_precip(k)!=1) || (doprecip && flag_precip(k)==1) ) {
-      advect_scalar(micro_field,k,mkadv,k,mkwle,k);  
+      micro_ind_host(nmicro_adv) = k;
+      nmicro_adv++;
     }
   }
+  if (nmicro_adv > 0) {
+    int1d micro_ind = scratch.get<int1d>("micro_ind",nmicro_fields);
+    micro_ind_host.deep_copy_to(micro_ind);
+#ifdef SAMXX_CHECK_ADVECT_BATCH
+    AdvectBatchCheck micro_check(micro_field,nmicro_fields,micro_ind_host,nmicro_adv,mkadv,mkwle,true);
+#endif
+    advect_scalar_batch(micro_field,micro_ind,nmicro_adv,mkadv,mkwle,true);
+#ifdef SAMXX_CHECK_ADVECT_BATCH
+    micro_check.check();
+#endif
+  }
 
-  // Advection of sgs prognostics:
+  // Advection of sgs prognostics, all fields at once:
   if (dosgs && advect_sgs) {
+    intHost1d sgs_ind_host("sgs_ind_host",nsgs_fields);
     for (int k=0; k<nsgs_fields; k++) {
-      advect_scalar(sgs_field,k,dummy,dummy);
+      sgs_ind_host(k) = k;
     }
+    int1d sgs_ind = scratch.get<int1d>("sgs_ind",nsgs_fields);
+    sgs_ind_host.deep_copy_to(sgs_ind);
+#ifdef SAMXX_CHECK_ADVECT_BATCH
+    real3d none;
+    AdvectBatchCheck sgs_check(sgs_field,nsgs_fields,sgs_ind_host,nsgs_fields,none,none,false);
+#endif
+    advect_scalar_batch(sgs_field,sgs_ind,nsgs_fields);
+#ifdef SAMXX_CHECK_ADVECT_BATCH
+    sgs_check.check();
+#endif
   }
 
   micro_precip_fall();
@@ -1,144 +1,84 @@
 #include "advect_scalar.h"
 
+// A single field is advected as a batch of one field, so that all scalars go through
+// the same MPDATA kernels (see advect_scalar_batch).
 void advect_scalar(real4d &f, real2d &fadv, real2d &flux) {
   YAKL_SCOPE( ncrms  , ::ncrms);
 
-  real4d f0("f0", nzm, dimy_s, dimx_s, ncrms);
-
-  // for (int k=0; k<nzm; k++) {
-  //  for (int icrm=0; icrm<ncrms; icrm++) {
-  if (docolumn) {
-
-    parallel_for( SimpleBounds<2>(nz,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-      flux(k,icrm) = 0.0;
-    });
-
-  } else {
-
-    // for (int k=0; k<nzm; k++) {
-    //   for (int j=0; j<dimy_s; j++) {
-    //     for (int i=0; i<dimx_s; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      f0(k,j,i,icrm) = f(k,j,i,icrm);
-    });
-
-    if (RUN3D) {
-      advect_scalar3D(f,flux);
-    } else {
-      advect_scalar2D(f,flux);
-    }
-
-    // for (int k=0; k<nzm; k++) {
-    //  for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-      fadv(k,icrm)=0.0;
-    });
-    
-    // for (int k=0; k<nzm; k++) {
-    //   for (int j=0; j<ny; j++) {
-    //     for (int i=0; i<nx; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      real tmp = f(k,j+offy_s,i+offx_s,icrm)-f0(k,j+offy_s,i+offx_s,icrm);
-      yakl::atomicAdd(fadv(k,icrm),tmp);
-    });
-
-  }  
+  ScratchScope scratch;
+  real5d f1    ("f1"   , f.data()   , 1, nzm, dimy_s, dimx_s, ncrms);
+  real3d fadv1 ("fadv1", fadv.data(), 1, nzm, ncrms);
+  real3d flux1 ("flux1", flux.data(), 1, nz , ncrms);
+  int1d  ind_f = scratch.get<int1d>("ind_f", 1);
+  yakl::memset(ind_f,0);
 
+  advect_scalar_batch(f1,ind_f,1,fadv1,flux1,true);
 }
 
-void advect_scalar(real5d &f, int ind_f, real2d &fadv, real2d &flux) {
+// Advects the fields ind_f(0:nfld-1) of f together, with a tracer dimension in all kernels.
+// If do_flux is true, fadv and flux are computed for each field, at index ind_f(l).
+void advect_scalar_batch(real5d &f, int1d &ind_f, int nfld, real3d &fadv, real3d &flux, bool do_flux) {
   YAKL_SCOPE( ncrms          , :: ncrms);
 
-  real4d f0("f0", nzm, dimy_s, dimx_s, ncrms);
-
-  // for (int k=0; k<nzm; k++) {
-  //  for (int icrm=0; icrm<ncrms; icrm++) {
-  if(docolumn) {
+  ScratchScope scratch;
 
-    parallel_for( SimpleBounds<2>(nz,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-      flux(k,icrm) = 0.0;
-    });
+  // for (int l=0; l<nfld; l++) {
+  //   for (int k=0; k<nz; k++) {
+  //     for (int icrm=0; icrm<ncrms; icrm++) {
+  if (docolumn) {
+    if (do_flux) {
+      parallel_for( SimpleBounds<3>(nfld,nz,ncrms) , YAKL_LAMBDA (int l, int k, int icrm) {
+        flux(ind_f(l),k,icrm) = 0.0;
+      });
+    }
 
   } else {
 
-    // for (int k=0; k<nzm; k++) {
-    //   for (int j=0; j<dimy_s; j++) {
-    //     for (int i=0; i<dimx_s; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      f0(k,j,i,icrm) = f(ind_f,k,j,i,icrm);
-    });
+    // for (int l=0; l<nfld; l++) {
+    //   for (int k=0; k<nzm; k++) {
+    //     for (int j=0; j<dimy_s; j++) {
+    //       for (int i=0; i<dimx_s; i++) {
+    //         for (int icrm=0; icrm<ncrms; icrm++) {
+    real5d f0;
+    if (do_flux) {
+      f0 = scratch.get<real5d>("f0", nfld, nzm, dimy_s, dimx_s, ncrms);
+      parallel_for( SimpleBounds<5>(nfld,nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int l, int k, int j, int i, int icrm) {
+        f0(l,k,j,i,icrm) = f(ind_f(l),k,j,i,icrm);
+      });
+    }
 
     if(RUN3D) {
-      advect_scalar3D(f,ind_f,flux);
+      advect_scalar3D_batch(f,ind_f,nfld,flux,do_flux);
     } else {
-      advect_scalar2D(f,ind_f,flux);
+      advect_scalar2D_batch(f,ind_f,nfld,flux,do_flux);
     }
 
-    // for (int k=0; k<nzm; k++) {
-    //  for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-      fadv(k,icrm)=0.0;
-    });
-    
-    // for (int k=0; k<nzm; k++) {
-    //   for (int j=0; j<ny; j++) {
-    //     for (int i=0; i<nx; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      real tmp = f(ind_f,k,j+offy_s,i+offx_s,icrm)-f0(k,j+offy_s,i+offx_s,icrm);
-      yakl::atomicAdd(fadv(k,icrm),tmp);
-    });
-
-  }  
-
-}
-
-void advect_scalar(real5d &f, int ind_f, real3d &fadv, int ind_fadv, real3d &flux, int ind_flux) {
-  YAKL_SCOPE( ncrms          , :: ncrms);
-
-  real4d f0("f0", nzm, dimy_s, dimx_s, ncrms);
-
-  // for (int k=0; k<nzm; k++) {
-  //  for (int icrm=0; icrm<ncrms; icrm++) {
-  if (docolumn) {
-    parallel_for( SimpleBounds<2>(nz,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-      flux(ind_flux,k,icrm) = 0.0;
-    });
-
-  } else {
-
-    // for (int k=0; k<nzm; k++) {
-    //   for (int j=0; j<dimy_s; j++) {
-    //     for (int i=0; i<dimx_s; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      f0(k,j,i,icrm) = f(ind_f,k,j,i,icrm);
-    });
-
-    if(RUN3D) {
-      advect_scalar3D(f,ind_f,flux,ind_flux);
-    } else {
-      advect_scalar2D(f,ind_f,flux,ind_flux);
+    if (do_flux) {
+      // for (int l=0; l<nfld; l++) {
+      //   for (int k=0; k<nzm; k++) {
+      //     for (int icrm=0; icrm<ncrms; icrm++) {
+      parallel_for( SimpleBounds<3>(nfld,nzm,ncrms) , YAKL_LAMBDA (int l, int k, int icrm) {
+        fadv(ind_f(l),k,icrm)=0.0;
+      });
+
+      // for (int l=0; l<nfld; l++) {
+      //   for (int k=0; k<nzm; k++) {
+      //     for (int j=0; j<ny; j++) {
+      //       for (int i=0; i<nx; i++) {
+      //         for (int icrm=0; icrm<ncrms; icrm++) {
+      parallel_for( SimpleBounds<5>(nfld,nzm,ny,nx,ncrms) , YAKL_LAMBDA (int l, int k, int j, int i, int icrm) {
+        int ind = ind_f(l);
+        real tmp = f(ind,k,j+offy_s,i+offx_s,icrm)-f0(l,k,j+offy_s,i+offx_s,icrm);
+        yakl::atomicAdd(fadv(ind,k,icrm),tmp);
+      });
     }
 
-    // for (int k=0; k<nzm; k++) {
-    //  for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-      fadv(ind_fadv,k,icrm)=0.0;
-    });
-    
-    // for (int k=0; k<nzm; k++) {
-    //   for (int j=0; j<ny; j++) {
-    //     for (int i=0; i<nx; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      real tmp = f(ind_f,k,j+offy_s,i+offx_s,icrm)-f0(k,j+offy_s,i+offx_s,icrm);
-      yakl::atomicAdd(fadv(ind_fadv,k,icrm),tmp);
-    });
+  }
 
-  }  
+}
 
+void advect_scalar_batch(real5d &f, int1d &ind_f, int nfld) {
+  real3d fadv;
+  real3d flux;
+  advect_scalar_batch(f,ind_f,nfld,fadv,flux,false);
 }
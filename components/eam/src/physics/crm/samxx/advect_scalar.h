@@ -8,7 +8,7 @@
 
 void advect_scalar(real4d &f, real2d &fadv, real2d &flux);
 
-void advect_scalar(real5d &f, int ind_f, real2d &fadv, real2d &flux);
+void advect_scalar_batch(real5d &f, int1d &ind_f, int nfld, real3d &fadv, real3d &flux, bool do_flux);
 
-void advect_scalar(real5d &f, int ind_f, real3d &fadv, int ind_fadv, real3d &flux, int ind_flux);
+void advect_scalar_batch(real5d &f, int1d &ind_f, int nfld);
 
@@ -1,397 +1,12 @@
 #include "advect_scalar2D.h"
 
-void advect_scalar2D(real4d &f, real2d &flux) {
-  YAKL_SCOPE( dowallx        , :: dowallx);
-  YAKL_SCOPE( rank           , :: rank);
-  YAKL_SCOPE( u              , :: u);
-  YAKL_SCOPE( w              , :: w);
-  YAKL_SCOPE( rho            , :: rho);
-  YAKL_SCOPE( adz            , :: adz);
-  YAKL_SCOPE( rhow           , :: rhow);
-  YAKL_SCOPE( ncrms          , :: ncrms);
-
-  bool constexpr nonos    = true;
-  real constexpr eps      = 1.0e-10;
-  int  constexpr offx_m   = 1;
-  int  constexpr offx_uuu = 2;
-  int  constexpr offx_www = 2;
-  int  constexpr j        = 0;
-
-  real4d mx   ("mx"   ,nzm,1,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,1,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,1,nx+5,ncrms);
-  real4d www  ("www"  ,nz,1,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
-
-  // for (int i=0; i<nx+4; i++) {
-  //  for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nx+4,ncrms) , YAKL_LAMBDA (int i, int icrm) {
-    www(nz-1,j,i,icrm)=0.0;
-  });
-
-  if (dowallx) {
-    if (rank%nsubdomains_x == 0) {
-      // for (int k=0; k<nzm; k++) {
-      //  for (int i=0; i<1-dimx1_u+1; i++) {
-      //    for (int icrm=0; icrm<ncrms; icrm++) {
-      parallel_for( SimpleBounds<3>(nzm,nx,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
-        u(k,j,i,icrm) = 0.0;
-      });
-    }
-    if (rank%nsubdomains_x==nsubdomains_x-1) {
-      // for (int k=0; k<nzm; k++) {
-      //  for (int i=0; i<dimx2_u-(nx+1)+1; i++) {
-      //    for (int icrm=0; icrm<ncrms; icrm++) {
-      parallel_for( SimpleBounds<3>(nzm,nx,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
-        int iInd = i+ (nx+2);
-        u(k,j,iInd,icrm) = 0.0;
-      });
-    }
-  }
-
-  if (nonos) {
-    // for (int k=0; k<nzm; k++) {
-    //  for (int i=0; i<nx+2; i++) {
-    //    for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<3>(nzm,nx+2,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
-      int kc=min(nzm-1,k+1);
-      int kb=max(0,k-1);
-      int ib=i-1;
-      int ic=i+1;
-      mx(k,j,i,icrm)=max(f(k,j,ib+offx_s-1,icrm),max(f(k,j,ic+offx_s-1,icrm),max(f(kb,j,i+offx_s-1,icrm),
-                     max(f(kc,j,i+offx_s-1,icrm),f(k,j,i+offx_s-1,icrm)))));
-      mn(k,j,i,icrm)=min(f(k,j,ib+offx_s-1,icrm),min(f(k,j,ic+offx_s-1,icrm),min(f(kb,j,i+offx_s-1,icrm),
-                     min(f(kc,j,i+offx_s-1,icrm),f(k,j,i+offx_s-1,icrm)))));
-    });
-  }// nonos
-
-  // for (int k=0; k<nzm; k++) {
-  //  for (int i=0; i<nx+5; i++) {
-  //    for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<3>(nzm,nx+5,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
-    int kb=max(0,k-1);
-    uuu(k,j,i,icrm)=max(0.0,u(k,j,i,icrm))*f(k,j,i-1+offx_s-2,icrm)+
-                    min(0.0,u(k,j,i,icrm))*f(k,j,i+offx_s-2,icrm);
-    if (i <= nx+3) {
-      www(k,j,i,icrm)=max(0.0,w(k,j,i,icrm))*f(kb,j,i+offx_s-2,icrm)+min(0.0,w(k,j,i,icrm))*f(k,j,i+offx_s-2,icrm);
-    }
-    if (i == 1) {
-      flux(k,icrm) = 0.0;
-    }
-  });
-
-
-  // for (int k=0; k<nzm; k++) {
-  //  for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-    irho(k,icrm) = 1.0/rho(k,icrm);
-    iadz(k,icrm) = 1.0/adz(k,icrm);
-    irhow(k,icrm) = 1.0/(rhow(k,icrm)*adz(k,icrm));
-  });
-
-  // for (int k=0; k<nzm; k++) {
-  //  for (int i=0; i<nx+4; i++) {
-  //    for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<3>(nzm,nx+4,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
-    if (i >= 2 && i <= nx+1) {
-      yakl::atomicAdd(flux(k,icrm),www(k,j,i,icrm));
-    }
-    f(k,j,i+offx_s-2,icrm) = f(k,j,i+offx_s-2,icrm) - (uuu(k,j,i+1,icrm)-uuu(k,j,i,icrm) +
-                                                      (www(k+1,j,i,icrm)-www(k,j,i,icrm))*iadz(k,icrm))*irho(k,icrm);
-  });
-
-  // for (int k=0; k<nzm; k++) {
-  //  for (int i=0; i<nx+3; i++) {
-  //    for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<3>(nzm,nx+3,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
-    int kc=min(nzm-1,k+1);
-    int kb=max(0,k-1);
-    real dd=2.0/(kc-kb)/adz(k,icrm);
-    int ib=i-1;
-    uuu(k,j,i+offx_uuu-1,icrm) = 
-         andiff2(f(k,j,ib+offx_s-1,icrm),f(k,j,i+offx_s-1,icrm),u(k,j,i+offx_u-1,icrm),irho(k,icrm)) - 
-         across2(dd*(f(kc,j,ib+offx_s-1,icrm)+f(kc,j,i+offx_s-1,icrm)-f(kb,j,ib+offx_s-1,icrm)-f(kb,j,i+offx_s-1,icrm)),
-                 u(k,j,i+offx_u-1,icrm), w(k,j,ib+offx_w-1,icrm)+w(kc,j,ib+offx_w-1,icrm)+w(k,j,i+offx_w-1,icrm)+
-                 w(kc,j,i+offx_w-1,icrm)) *irho(k,icrm);
-    if (i <= nxp1) {
-      int ic=i+1;
-      www(k,j,i+offx_www-1,icrm) = 
-         andiff2(f(kb,j,i+offx_s-1,icrm),f(k,j,i+offx_s-1,icrm),w(k,j,i+offx_w-1,icrm),irhow(k,icrm)) -
-         across2(f(kb,j,ic+offx_s-1,icrm)+f(k,j,ic+offx_s-1,icrm)-f(kb,j,ib+offx_s-1,icrm)-f(k,j,ib+offx_s-1,icrm),
-                 w(k,j,i+offx_w-1,icrm), u(kb,j,i+offx_u-1,icrm)+u(k,j,i+offx_u-1,icrm)+u(k,j,ic+offx_u-1,icrm)+
-                 u(kb,j,ic+offx_u-1,icrm)) *irho(k,icrm);
-    }
-  });
-
-  //  for (int i=0; i<nx+4; i++) {
-  //    for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nx+4,ncrms) , YAKL_LAMBDA (int i, int icrm) {
-    www(0,j,i,icrm) = 0.0;
-  });
-
-  if (nonos) {
-    // for (int k=0; k<nzm; k++) {
-    //  for (int i=0; i<nx+2; i++) {
-    //    for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<3>(nzm,nx+2,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
-      int kc=min(nzm-1,k+1);
-      int kb=max(0,k-1);
-      int ib=i-1;
-      int ic=i+1;
-      mx(k,j,i,icrm)=max(f(k,j,ib+offx_s-1,icrm),max(f(k,j,ic+offx_s-1,icrm),max(f(kb,j,i+offx_s-1,icrm),
-                     max(f(kc,j,i+offx_s-1,icrm),max(f(k,j,i+offx_s-1,icrm),mx(k,j,i,icrm))))));
-      mn(k,j,i,icrm)=min(f(k,j,ib+offx_s-1,icrm),min(f(k,j,ic+offx_s-1,icrm),min(f(kb,j,i+offx_s-1,icrm),
-                     min(f(kc,j,i+offx_s-1,icrm),min(f(k,j,i+offx_s-1,icrm),mn(k,j,i,icrm))))));
-    });
-
-    // for (int k=0; k<nzm; k++) {
-    //  for (int i=0; i<nx+2; i++) {
-    //    for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<3>(nzm,nx+2,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
-      int kc=min(nzm-1,k+1);
-      int ic=i+1;
-      mx(k,j,i,icrm)=rho(k,icrm)*(mx(k,j,i,icrm)-f(k,j,i+offx_s-1,icrm))/(pn2(uuu(k,j,ic+offx_uuu-1,icrm)) +
-                     pp2(uuu(k,j,i+offx_uuu-1,icrm))+iadz(k,icrm)*(pn2(www(kc,j,i+offx_www-1,icrm)) +
-                     pp2(www(k,j,i+offx_www-1,icrm)))+eps);
-      mn(k,j,i,icrm)=rho(k,icrm)*(f(k,j,i+offx_s-1,icrm)-mn(k,j,i,icrm))/(pp2(uuu(k,j,ic+offx_uuu-1,icrm)) +
-                     pn2(uuu(k,j,i+offx_uuu-1,icrm))+iadz(k,icrm)*(pp2(www(kc,j,i+offx_www-1,icrm)) +
-                     pn2(www(k,j,i+offx_www-1,icrm)))+eps);
-    });
-
-    // for (int k=0; k<nzm; k++) {
-    //  for (int i=0; i<nx+1; i++) {
-    //    for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<3>(nzm,nx+1,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
-      int ib=i-1;
-      uuu(k,j,i+offx_uuu,icrm) =
-            pp2(uuu(k,j,i+offx_uuu,icrm))*min(1.0,min(mx(k,j,i+offx_m,icrm), mn(k,j,ib+offx_m,icrm))) -
-            pn2(uuu(k,j,i+offx_uuu,icrm))*min(1.0,min(mx(k,j,ib+offx_m,icrm),mn(k,j,i+offx_m,icrm)));
-      if (i <= nx-1) {
-        int kb=max(0,k-1);
-        www(k,j,i+offx_www,icrm) =
-            pp2(www(k,j,i+offx_www,icrm))*min(1.0,min(mx(k,j,i+offx_m,icrm), mn(kb,j,i+offx_m,icrm))) -
-            pn2(www(k,j,i+offx_www,icrm))*min(1.0,min(mx(kb,j,i+offx_m,icrm),mn(k,j,i+offx_m,icrm)));
-        yakl::atomicAdd(flux(k,icrm), www(k,j,i+offx_www,icrm));
-      }
-    });
-  } // nonos
-
-  // for (int k=0; k<nzm; k++) {
-  //     for (int i=0; i<nx; i++) {
-  //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<3>(nzm,nx,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
-    int kc=k+1;
-    // MK: added fix for very small negative values (relative to positive values)
-    //     especially  when such large numbers as
-    //     hydrometeor concentrations are advected. The reason for negative values is
-    //     most likely truncation error.
-    f(k,j,i+offx_s,icrm)= max(0.0, f(k,j,i+offx_s,icrm) - (uuu(k,j,i+1+offx_uuu,icrm)-uuu(k,j,i+offx_uuu,icrm) +
-                         (www(k+1,j,i+offx_www,icrm)-www(k,j,i+offx_www,icrm))*iadz(k,icrm))*irho(k,icrm));
-  });
-
-}
-
-
-
-void advect_scalar2D(real5d &f, int ind_f, real2d &flux) {
-  YAKL_SCOPE( dowallx        , :: dowallx);
-  YAKL_SCOPE( rank           , :: rank);
-  YAKL_SCOPE( u              , :: u);
-  YAKL_SCOPE( w              , :: w);
-  YAKL_SCOPE( rho            , :: rho);
-  YAKL_SCOPE( adz            , :: adz);
-  YAKL_SCOPE( rhow           , :: rhow);
-  YAKL_SCOPE( ncrms          , :: ncrms);
-
-  bool constexpr nonos = true;
-  real constexpr eps = 1.0e-10;
-  int  constexpr offx_m = 1;
-  int  constexpr offx_uuu = 2;
-  int  constexpr offx_www = 2;
-  int  constexpr j = 0;
-
-  real4d mx   ("mx"   ,nzm,1,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,1,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,1,nx+5,ncrms);
-  real4d www  ("www"  ,nz,1,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
-
-  // for (int i=0; i<nx+4; i++) {
-  //  for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nx+4,ncrms) , YAKL_LAMBDA (int i, int icrm) {
-    www(nz-1,j,i,icrm)=0.0;
-  });
-
-  if (dowallx) {
-    if (rank%nsubdomains_x == 0) {
-      // for (int k=0; k<nzm; k++) {
-      //  for (int i=0; i<1-dimx1_u+1; i++) {
-      //    for (int icrm=0; icrm<ncrms; icrm++) {
-      parallel_for( SimpleBounds<3>(nzm,nx,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
-        u(k,j,i,icrm) = 0.0;
-      });
-    }
-    if (rank%nsubdomains_x==nsubdomains_x-1) {
-      // for (int k=0; k<nzm; k++) {
-      //  for (int i=0; i<dimx2_u-(nx+1)+1; i++) {
-      //    for (int icrm=0; icrm<ncrms; icrm++) {
-      parallel_for( SimpleBounds<3>(nzm,nx,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
-        int iInd = i+ (nx+2);
-        u(k,j,iInd,icrm) = 0.0;
-      });
-    }
-  }
-
-  if (nonos) {
-    // for (int k=0; k<nzm; k++) {
-    //  for (int i=0; i<nx+2; i++) {
-    //    for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<3>(nzm,nx+2,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
-      int kc=min(nzm-1,k+1);
-      int kb=max(0,k-1);
-      int ib=i-1;
-      int ic=i+1;
-      mx(k,j,i,icrm)=max(f(ind_f,k,j,ib+offx_s-1,icrm),max(f(ind_f,k,j,ic+offx_s-1,icrm),
-                     max(f(ind_f,kb,j,i+offx_s-1,icrm),max(f(ind_f,kc,j,i+offx_s-1,icrm),f(ind_f,k,j,i+offx_s-1,icrm)))));
-      mn(k,j,i,icrm)=min(f(ind_f,k,j,ib+offx_s-1,icrm),min(f(ind_f,k,j,ic+offx_s-1,icrm),
-                     min(f(ind_f,kb,j,i+offx_s-1,icrm),min(f(ind_f,kc,j,i+offx_s-1,icrm),f(ind_f,k,j,i+offx_s-1,icrm)))));
-    });
-  }// nonos
-
-  // for (int k=0; k<nzm; k++) {
-  //  for (int i=0; i<nx+5; i++) {
-  //    for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<3>(nzm,nx+5,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
-    int kb=max(0,k-1);
-    uuu(k,j,i,icrm)=max(0.0,u(k,j,i,icrm))*f(ind_f,k,j,i-1+offx_s-2,icrm)+
-                    min(0.0,u(k,j,i,icrm))*f(ind_f,k,j,i+offx_s-2,icrm);
-    if (i <= nx+3) {
-      www(k,j,i,icrm) = max(0.0,w(k,j,i,icrm))*f(ind_f,kb,j,i+offx_s-2,icrm)+
-                        min(0.0,w(k,j,i,icrm))*f(ind_f,k,j,i+offx_s-2,icrm);
-    }
-    if (i == 1) {
-      flux(k,icrm) = 0.0;
-    }
-  });
-
-
-  // for (int k=0; k<nzm; k++) {
-  //  for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-    irho(k,icrm) = 1.0/rho(k,icrm);
-    iadz(k,icrm) = 1.0/adz(k,icrm);
-    irhow(k,icrm) = 1.0/(rhow(k,icrm)*adz(k,icrm));
-  });
-
-  // for (int k=0; k<nzm; k++) {
-  //  for (int i=0; i<nx+4; i++) {
-  //    for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<3>(nzm,nx+4,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
-    if (i >= 2 && i <= nx+1) {
-      yakl::atomicAdd(flux(k,icrm),www(k,j,i,icrm));
-    }
-    f(ind_f,k,j,i+offx_s-2,icrm) = f(ind_f,k,j,i+offx_s-2,icrm) -
-                                   (uuu(k,j,i+1,icrm)-uuu(k,j,i,icrm) +
-                                   (www(k+1,j,i,icrm)-www(k,j,i,icrm))*iadz(k,icrm))*irho(k,icrm);
-  });
-
-  // for (int k=0; k<nzm; k++) {
-  //  for (int i=0; i<nx+3; i++) {
-  //    for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<3>(nzm,nx+3,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
-    int kc=min(nzm-1,k+1);
-    int kb=max(0,k-1);
-    real dd=2.0/(kc-kb)/adz(k,icrm);
-    int ib=i-1;
-    uuu(k,j,i+offx_uuu-1,icrm) = 
-          andiff2(f(ind_f,k,j,ib+offx_s-1,icrm),f(ind_f,k,j,i+offx_s-1,icrm),u(k,j,i+offx_u-1,icrm),irho(k,icrm)) - 
-          across2(dd*(f(ind_f,kc,j,ib+offx_s-1,icrm)+f(ind_f,kc,j,i+offx_s-1,icrm)-
-                  f(ind_f,kb,j,ib+offx_s-1,icrm)-f(ind_f,kb,j,i+offx_s-1,icrm)),
-                  u(k,j,i+offx_u-1,icrm), w(k,j,ib+offx_w-1,icrm)+w(kc,j,ib+offx_w-1,icrm)+
-                  w(k,j,i+offx_w-1,icrm)+w(kc,j,i+offx_w-1,icrm)) *irho(k,icrm);
-    if (i <= nxp1) {
-      int ic=i+1;
-      www(k,j,i+offx_www-1,icrm) = 
-          andiff2(f(ind_f,kb,j,i+offx_s-1,icrm),f(ind_f,k,j,i+offx_s-1,icrm),w(k,j,i+offx_w-1,icrm),irhow(k,icrm)) - 
-          across2(f(ind_f,kb,j,ic+offx_s-1,icrm)+f(ind_f,k,j,ic+offx_s-1,icrm)-
-                  f(ind_f,kb,j,ib+offx_s-1,icrm)-f(ind_f,k,j,ib+offx_s-1,icrm),
-                  w(k,j,i+offx_w-1,icrm), u(kb,j,i+offx_u-1,icrm)+u(k,j,i+offx_u-1,icrm)+
-                  u(k,j,ic+offx_u-1,icrm)+u(kb,j,ic+offx_u-1,icrm)) *irho(k,icrm);
-    }
-  });
-
-  //  for (int i=0; i<nx+4; i++) {
-  //    for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nx+4,ncrms) , YAKL_LAMBDA (int i, int icrm) {
-    www(0,j,i,icrm) = 0.0;
-  });
-
-  if (nonos) {
-    // for (int k=0; k<nzm; k++) {
-    //  for (int i=0; i<nx+2; i++) {
-    //    for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<3>(nzm,nx+2,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
-      int kc=min(nzm-1,k+1);
-      int kb=max(0,k-1);
-      int ib=i-1;
-      int ic=i+1;
-      mx(k,j,i,icrm)=max(f(ind_f,k,j,ib+offx_s-1,icrm),max(f(ind_f,k,j,ic+offx_s-1,icrm),max(f(ind_f,kb,j,i+offx_s-1,icrm),
-                     max(f(ind_f,kc,j,i+offx_s-1,icrm),max(f(ind_f,k,j,i+offx_s-1,icrm),mx(k,j,i,icrm))))));
-      mn(k,j,i,icrm)=min(f(ind_f,k,j,ib+offx_s-1,icrm),min(f(ind_f,k,j,ic+offx_s-1,icrm),min(f(ind_f,kb,j,i+offx_s-1,icrm),
-                     min(f(ind_f,kc,j,i+offx_s-1,icrm),min(f(ind_f,k,j,i+offx_s-1,icrm),mn(k,j,i,icrm))))));
-    });
-
-    // for (int k=0; k<nzm; k++) {
-    //  for (int i=0; i<nx+2; i++) {
-    //    for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<3>(nzm,nx+2,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
-      int kc=min(nzm-1,k+1);
-      int ic=i+1;
-      mx(k,j,i,icrm)=rho(k,icrm)*(mx(k,j,i,icrm)-f(ind_f,k,j,i+offx_s-1,icrm))/(pn2(uuu(k,j,ic+offx_uuu-1,icrm)) +
-                     pp2(uuu(k,j,i+offx_uuu-1,icrm))+iadz(k,icrm)*(pn2(www(kc,j,i+offx_www-1,icrm)) +
-                     pp2(www(k,j,i+offx_www-1,icrm)))+eps);
-      mn(k,j,i,icrm)=rho(k,icrm)*(f(ind_f,k,j,i+offx_s-1,icrm)-mn(k,j,i,icrm))/(pp2(uuu(k,j,ic+offx_uuu-1,icrm)) +
-                     pn2(uuu(k,j,i+offx_uuu-1,icrm))+iadz(k,icrm)*(pp2(www(kc,j,i+offx_www-1,icrm)) +
-                     pn2(www(k,j,i+offx_www-1,icrm)))+eps);
-    });
-
-    // for (int k=0; k<nzm; k++) {
-    //  for (int i=0; i<nx+1; i++) {
-    //    for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<3>(nzm,nx+1,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
-      int ib=i-1;
-      uuu(k,j,i+offx_uuu,icrm)= pp2(uuu(k,j,i+offx_uuu,icrm))*min(1.0,min(mx(k,j,i+offx_m,icrm), mn(k,j,ib+offx_m,icrm))) -
-                       pn2(uuu(k,j,i+offx_uuu,icrm))*min(1.0,min(mx(k,j,ib+offx_m,icrm),mn(k,j,i+offx_m,icrm)));
-      if (i <= nx-1) {
-        int kb=max(0,k-1);
-        www(k,j,i+offx_www,icrm)= pp2(www(k,j,i+offx_www,icrm))*min(1.0,min(mx(k,j,i+offx_m,icrm), mn(kb,j,i+offx_m,icrm))) -
-                         pn2(www(k,j,i+offx_www,icrm))*min(1.0,min(mx(kb,j,i+offx_m,icrm),mn(k,j,i+offx_m,icrm)));
-
-        yakl::atomicAdd(flux(k,icrm), www(k,j,i+offx_www,icrm));
-      }
-    });
-  } // nonos
-
-  // for (int k=0; k<nzm; k++) {
-  //     for (int i=0; i<nx; i++) {
-  //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<3>(nzm,nx,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
-    int kc=k+1;
-    // MK: added fix for very small negative values (relative to positive values)
-    //     especially  when such large numbers as
-    //     hydrometeor concentrations are advected. The reason for negative values is
-    //     most likely truncation error.
-    f(ind_f,k,j,i+offx_s,icrm)= max(0.0, f(ind_f,k,j,i+offx_s,icrm) - (uuu(k,j,i+1+offx_uuu,icrm)-uuu(k,j,i+offx_uuu,icrm) +
-                   (www(k+1,j,i+offx_www,icrm)-www(k,j,i+offx_www,icrm))*iadz(k,icrm))*irho(k,icrm));
-  });
-
-}
-
-void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
+// MPDATA advection of the fields ind_f(0:nfld-1) of f at once. The kernels that
+// use the velocities loop over the fields inside each thread, so that u and w are
+// loaded once for all fields; the others have a tracer dimension. Since the stages
+// are separate kernels, the temporaries (mx, mn, uuu, www) hold all fields, and are
+// nfld times larger than in the single field case. The flux is only computed if
+// do_flux is true.
+void advect_scalar2D_batch(real5d &f, int1d &ind_f, int nfld, real3d &flux, bool do_flux) {
   YAKL_SCOPE( dowallx        , :: dowallx);
   YAKL_SCOPE( rank           , :: rank);
   YAKL_SCOPE( u              , :: u);
@@ -408,18 +23,19 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
   int  constexpr offx_www = 2;
   int  constexpr j = 0;
 
-  real4d mx   ("mx"   ,nzm,1,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,1,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,1,nx+5,ncrms);
-  real4d www  ("www"  ,nz,1,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
+  ScratchScope scratch;
+  real5d mx   = scratch.get<real5d>("mx"   ,nfld,nzm,1,nx+2,ncrms);
+  real5d mn   = scratch.get<real5d>("mn"   ,nfld,nzm,1,nx+2,ncrms);
+  real5d uuu  = scratch.get<real5d>("uuu"  ,nfld,nzm,1,nx+5,ncrms);
+  real5d www  = scratch.get<real5d>("www"  ,nfld,nz,1,nx+4,ncrms);
+  real2d iadz = scratch.get<real2d>("iadz" ,nzm,ncrms);
+  real2d irho = scratch.get<real2d>("irho" ,nzm,ncrms);
+  real2d irhow = scratch.get<real2d>("irhow",nzm,ncrms);
 
   // for (int i=0; i<nx+4; i++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nx+4,ncrms) , YAKL_LAMBDA (int i, int icrm) {
-    www(nz-1,j,i,icrm)=0.0;
+  parallel_for( SimpleBounds<3>(nfld,nx+4,ncrms) , YAKL_LAMBDA (int l, int i, int icrm) {
+    www(l,nz-1,j,i,icrm)=0.0;
   });
 
   if (dowallx) {
@@ -447,15 +63,16 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
     // for (int k=0; k<nzm; k++) {
     //  for (int i=0; i<nx+2; i++) {
     //    for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<3>(nzm,nx+2,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+    parallel_for( SimpleBounds<4>(nfld,nzm,nx+2,ncrms) , YAKL_LAMBDA (int l, int k, int i, int icrm) {
+      int ind = ind_f(l);
       int kc=min(nzm-1,k+1);
       int kb=max(0,k-1);
       int ib=i-1;
       int ic=i+1;
-      mx(k,j,i,icrm)=max(f(ind_f,k,j,ib+offx_s-1,icrm),max(f(ind_f,k,j,ic+offx_s-1,icrm),max(f(ind_f,kb,j,i+offx_s-1,icrm),
-                     max(f(ind_f,kc,j,i+offx_s-1,icrm),f(ind_f,k,j,i+offx_s-1,icrm)))));
-      mn(k,j,i,icrm)=min(f(ind_f,k,j,ib+offx_s-1,icrm),min(f(ind_f,k,j,ic+offx_s-1,icrm),min(f(ind_f,kb,j,i+offx_s-1,icrm),
-                     min(f(ind_f,kc,j,i+offx_s-1,icrm),f(ind_f,k,j,i+offx_s-1,icrm)))));
+      mx(l,k,j,i,icrm)=max(f(ind,k,j,ib+offx_s-1,icrm),max(f(ind,k,j,ic+offx_s-1,icrm),max(f(ind,kb,j,i+offx_s-1,icrm),
+                     max(f(ind,kc,j,i+offx_s-1,icrm),f(ind,k,j,i+offx_s-1,icrm)))));
+      mn(l,k,j,i,icrm)=min(f(ind,k,j,ib+offx_s-1,icrm),min(f(ind,k,j,ic+offx_s-1,icrm),min(f(ind,kb,j,i+offx_s-1,icrm),
+                     min(f(ind,kc,j,i+offx_s-1,icrm),f(ind,k,j,i+offx_s-1,icrm)))));
     });
   }// nonos
 
@@ -464,13 +81,26 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
   //    for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<3>(nzm,nx+5,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
     int kb=max(0,k-1);
-    uuu(k,j,i,icrm)=max(0.0,u(k,j,i,icrm))*f(ind_f,k,j,i-1+offx_s-2,icrm)+
-                    min(0.0,u(k,j,i,icrm))*f(ind_f,k,j,i+offx_s-2,icrm);
+    // Velocities are loaded once, and used for all the fields
+    real up = max(0.0,u(k,j,i,icrm));
+    real un = min(0.0,u(k,j,i,icrm));
+    for (int l=0; l<nfld; l++) {
+      int ind = ind_f(l);
+      uuu(l,k,j,i,icrm)=up*f(ind,k,j,i-1+offx_s-2,icrm)+
+                        un*f(ind,k,j,i+offx_s-2,icrm);
+    }
     if (i <= nx+3) {
-      www(k,j,i,icrm)=max(0.0,w(k,j,i,icrm))*f(ind_f,kb,j,i+offx_s-2,icrm)+min(0.0,w(k,j,i,icrm))*f(ind_f,k,j,i+offx_s-2,icrm);
+      real wp = max(0.0,w(k,j,i,icrm));
+      real wn = min(0.0,w(k,j,i,icrm));
+      for (int l=0; l<nfld; l++) {
+        int ind = ind_f(l);
+        www(l,k,j,i,icrm)=wp*f(ind,kb,j,i+offx_s-2,icrm)+wn*f(ind,k,j,i+offx_s-2,icrm);
+      }
     }
-    if (i == 1) {
-      flux(ind_flux,k,icrm) = 0.0;
+    if (do_flux && i == 1) {
+      for (int l=0; l<nfld; l++) {
+        flux(ind_f(l),k,icrm) = 0.0;
+      }
     }
   });
 
@@ -486,12 +116,13 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
   // for (int k=0; k<nzm; k++) {
   //  for (int i=0; i<nx+4; i++) {
   //    for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<3>(nzm,nx+4,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
-    if (i >= 2 && i <= nx+1) {
-      yakl::atomicAdd(flux(ind_flux,k,icrm),www(k,j,i,icrm));
+  parallel_for( SimpleBounds<4>(nfld,nzm,nx+4,ncrms) , YAKL_LAMBDA (int l, int k, int i, int icrm) {
+    int ind = ind_f(l);
+    if (do_flux && i >= 2 && i <= nx+1) {
+      yakl::atomicAdd(flux(ind,k,icrm),www(l,k,j,i,icrm));
     }
-    f(ind_f,k,j,i+offx_s-2,icrm) = f(ind_f,k,j,i+offx_s-2,icrm) - (uuu(k,j,i+1,icrm)-uuu(k,j,i,icrm) +
-                                   (www(k+1,j,i,icrm)-www(k,j,i,icrm))*iadz(k,icrm))*irho(k,icrm);
+    f(ind,k,j,i+offx_s-2,icrm) = f(ind,k,j,i+offx_s-2,icrm) - (uuu(l,k,j,i+1,icrm)-uuu(l,k,j,i,icrm) +
+                                   (www(l,k+1,j,i,icrm)-www(l,k,j,i,icrm))*iadz(k,icrm))*irho(k,icrm);
   });
 
   // for (int k=0; k<nzm; k++) {
@@ -502,71 +133,85 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
     int kb=max(0,k-1);
     real dd=2.0/(kc-kb)/adz(k,icrm);
     int ib=i-1;
-    uuu(k,j,i+offx_uuu-1,icrm) = 
-         andiff2(f(ind_f,k,j,ib+offx_s-1,icrm),f(ind_f,k,j,i+offx_s-1,icrm),u(k,j,i+offx_u-1,icrm),irho(k,icrm)) - 
-         across2(dd*(f(ind_f,kc,j,ib+offx_s-1,icrm)+f(ind_f,kc,j,i+offx_s-1,icrm)-
-                 f(ind_f,kb,j,ib+offx_s-1,icrm)-f(ind_f,kb,j,i+offx_s-1,icrm)),
-                 u(k,j,i+offx_u-1,icrm), w(k,j,ib+offx_w-1,icrm)+w(kc,j,ib+offx_w-1,icrm)+
-                 w(k,j,i+offx_w-1,icrm)+w(kc,j,i+offx_w-1,icrm)) *irho(k,icrm);
+    // Velocities are loaded once, and used for all the fields
+    real uc = u(k,j,i+offx_u-1,icrm);
+    real ws = w(k,j,ib+offx_w-1,icrm)+w(kc,j,ib+offx_w-1,icrm)+
+              w(k,j,i+offx_w-1,icrm)+w(kc,j,i+offx_w-1,icrm);
+    for (int l=0; l<nfld; l++) {
+      int ind = ind_f(l);
+      uuu(l,k,j,i+offx_uuu-1,icrm) = 
+           andiff2(f(ind,k,j,ib+offx_s-1,icrm),f(ind,k,j,i+offx_s-1,icrm),uc,irho(k,icrm)) - 
+           across2(dd*(f(ind,kc,j,ib+offx_s-1,icrm)+f(ind,kc,j,i+offx_s-1,icrm)-
+                   f(ind,kb,j,ib+offx_s-1,icrm)-f(ind,kb,j,i+offx_s-1,icrm)),
+                   uc, ws) *irho(k,icrm);
+    }
     if (i <= nxp1) {
       int ic=i+1;
-      www(k,j,i+offx_www-1,icrm) = 
-         andiff2(f(ind_f,kb,j,i+offx_s-1,icrm),f(ind_f,k,j,i+offx_s-1,icrm),w(k,j,i+offx_w-1,icrm),irhow(k,icrm)) - 
-         across2(f(ind_f,kb,j,ic+offx_s-1,icrm)+f(ind_f,k,j,ic+offx_s-1,icrm)-
-                 f(ind_f,kb,j,ib+offx_s-1,icrm)-f(ind_f,k,j,ib+offx_s-1,icrm),
-                 w(k,j,i+offx_w-1,icrm), u(kb,j,i+offx_u-1,icrm)+u(k,j,i+offx_u-1,icrm)+
-                 u(k,j,ic+offx_u-1,icrm)+u(kb,j,ic+offx_u-1,icrm)) *irho(k,icrm);
+      real wc = w(k,j,i+offx_w-1,icrm);
+      real us = u(kb,j,i+offx_u-1,icrm)+u(k,j,i+offx_u-1,icrm)+
+                u(k,j,ic+offx_u-1,icrm)+u(kb,j,ic+offx_u-1,icrm);
+      for (int l=0; l<nfld; l++) {
+        int ind = ind_f(l);
+        www(l,k,j,i+offx_www-1,icrm) = 
+           andiff2(f(ind,kb,j,i+offx_s-1,icrm),f(ind,k,j,i+offx_s-1,icrm),wc,irhow(k,icrm)) - 
+           across2(f(ind,kb,j,ic+offx_s-1,icrm)+f(ind,k,j,ic+offx_s-1,icrm)-
+                   f(ind,kb,j,ib+offx_s-1,icrm)-f(ind,k,j,ib+offx_s-1,icrm),
+                   wc, us) *irho(k,icrm);
+      }
     }
   });
 
   //  for (int i=0; i<nx+4; i++) {
   //    for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nx+4,ncrms) , YAKL_LAMBDA (int i, int icrm) {
-    www(0,j,i,icrm) = 0.0;
+  parallel_for( SimpleBounds<3>(nfld,nx+4,ncrms) , YAKL_LAMBDA (int l, int i, int icrm) {
+    www(l,0,j,i,icrm) = 0.0;
   });
 
   if (nonos) {
     // for (int k=0; k<nzm; k++) {
     //  for (int i=0; i<nx+2; i++) {
     //    for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<3>(nzm,nx+2,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+    parallel_for( SimpleBounds<4>(nfld,nzm,nx+2,ncrms) , YAKL_LAMBDA (int l, int k, int i, int icrm) {
+      int ind = ind_f(l);
       int kc=min(nzm-1,k+1);
       int kb=max(0,k-1);
       int ib=i-1;
       int ic=i+1;
-      mx(k,j,i,icrm)=max(f(ind_f,k,j,ib+offx_s-1,icrm),max(f(ind_f,k,j,ic+offx_s-1,icrm),max(f(ind_f,kb,j,i+offx_s-1,icrm),
-                     max(f(ind_f,kc,j,i+offx_s-1,icrm),max(f(ind_f,k,j,i+offx_s-1,icrm),mx(k,j,i,icrm))))));
-      mn(k,j,i,icrm)=min(f(ind_f,k,j,ib+offx_s-1,icrm),min(f(ind_f,k,j,ic+offx_s-1,icrm),min(f(ind_f,kb,j,i+offx_s-1,icrm),
-                     min(f(ind_f,kc,j,i+offx_s-1,icrm),min(f(ind_f,k,j,i+offx_s-1,icrm),mn(k,j,i,icrm))))));
+      mx(l,k,j,i,icrm)=max(f(ind,k,j,ib+offx_s-1,icrm),max(f(ind,k,j,ic+offx_s-1,icrm),max(f(ind,kb,j,i+offx_s-1,icrm),
+                     max(f(ind,kc,j,i+offx_s-1,icrm),max(f(ind,k,j,i+offx_s-1,icrm),mx(l,k,j,i,icrm))))));
+      mn(l,k,j,i,icrm)=min(f(ind,k,j,ib+offx_s-1,icrm),min(f(ind,k,j,ic+offx_s-1,icrm),min(f(ind,kb,j,i+offx_s-1,icrm),
+                     min(f(ind,kc,j,i+offx_s-1,icrm),min(f(ind,k,j,i+offx_s-1,icrm),mn(l,k,j,i,icrm))))));
     });
 
     // for (int k=0; k<nzm; k++) {
     //  for (int i=0; i<nx+2; i++) {
     //    for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<3>(nzm,nx+2,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+    parallel_for( SimpleBounds<4>(nfld,nzm,nx+2,ncrms) , YAKL_LAMBDA (int l, int k, int i, int icrm) {
+      int ind = ind_f(l);
       int kc=min(nzm-1,k+1);
       int ic=i+1;
-      mx(k,j,i,icrm)=rho(k,icrm)*(mx(k,j,i,icrm)-f(ind_f,k,j,i+offx_s-1,icrm))/(pn2(uuu(k,j,ic+offx_uuu-1,icrm)) +
-                     pp2(uuu(k,j,i+offx_uuu-1,icrm))+iadz(k,icrm)*(pn2(www(kc,j,i+offx_www-1,icrm)) +
-                     pp2(www(k,j,i+offx_www-1,icrm)))+eps);
-      mn(k,j,i,icrm)=rho(k,icrm)*(f(ind_f,k,j,i+offx_s-1,icrm)-mn(k,j,i,icrm))/(pp2(uuu(k,j,ic+offx_uuu-1,icrm)) +
-                     pn2(uuu(k,j,i+offx_uuu-1,icrm))+iadz(k,icrm)*(pp2(www(kc,j,i+offx_www-1,icrm)) +
-                     pn2(www(k,j,i+offx_www-1,icrm)))+eps);
+      mx(l,k,j,i,icrm)=rho(k,icrm)*(mx(l,k,j,i,icrm)-f(ind,k,j,i+offx_s-1,icrm))/(pn2(uuu(l,k,j,ic+offx_uuu-1,icrm)) +
+                     pp2(uuu(l,k,j,i+offx_uuu-1,icrm))+iadz(k,icrm)*(pn2(www(l,kc,j,i+offx_www-1,icrm)) +
+                     pp2(www(l,k,j,i+offx_www-1,icrm)))+eps);
+      mn(l,k,j,i,icrm)=rho(k,icrm)*(f(ind,k,j,i+offx_s-1,icrm)-mn(l,k,j,i,icrm))/(pp2(uuu(l,k,j,ic+offx_uuu-1,icrm)) +
+                     pn2(uuu(l,k,j,i+offx_uuu-1,icrm))+iadz(k,icrm)*(pp2(www(l,kc,j,i+offx_www-1,icrm)) +
+                     pn2(www(l,k,j,i+offx_www-1,icrm)))+eps);
     });
 
     // for (int k=0; k<nzm; k++) {
     //  for (int i=0; i<nx+1; i++) {
     //    for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<3>(nzm,nx+1,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+    parallel_for( SimpleBounds<4>(nfld,nzm,nx+1,ncrms) , YAKL_LAMBDA (int l, int k, int i, int icrm) {
+      int ind = ind_f(l);
       int ib=i-1;
-      uuu(k,j,i+offx_uuu,icrm)= pp2(uuu(k,j,i+offx_uuu,icrm))*min(1.0,min(mx(k,j,i+offx_m,icrm), mn(k,j,ib+offx_m,icrm))) -
-                                pn2(uuu(k,j,i+offx_uuu,icrm))*min(1.0,min(mx(k,j,ib+offx_m,icrm),mn(k,j,i+offx_m,icrm)));
+      uuu(l,k,j,i+offx_uuu,icrm)= pp2(uuu(l,k,j,i+offx_uuu,icrm))*min(1.0,min(mx(l,k,j,i+offx_m,icrm), mn(l,k,j,ib+offx_m,icrm))) -
+                                pn2(uuu(l,k,j,i+offx_uuu,icrm))*min(1.0,min(mx(l,k,j,ib+offx_m,icrm),mn(l,k,j,i+offx_m,icrm)));
       if (i <= nx-1) {
         int kb=max(0,k-1);
-        www(k,j,i+offx_www,icrm)= pp2(www(k,j,i+offx_www,icrm))*min(1.0,min(mx(k,j,i+offx_m,icrm), mn(kb,j,i+offx_m,icrm))) -
-                                  pn2(www(k,j,i+offx_www,icrm))*min(1.0,min(mx(kb,j,i+offx_m,icrm),mn(k,j,i+offx_m,icrm)));
+        www(l,k,j,i+offx_www,icrm)= pp2(www(l,k,j,i+offx_www,icrm))*min(1.0,min(mx(l,k,j,i+offx_m,icrm), mn(l,kb,j,i+offx_m,icrm))) -
+                                  pn2(www(l,k,j,i+offx_www,icrm))*min(1.0,min(mx(l,kb,j,i+offx_m,icrm),mn(l,k,j,i+offx_m,icrm)));
 
-        yakl::atomicAdd(flux(ind_flux,k,icrm), www(k,j,i+offx_www,icrm));
+        if (do_flux) { yakl::atomicAdd(flux(ind,k,icrm), www(l,k,j,i+offx_www,icrm)); }
       }
     });
   } // nonos
@@ -574,14 +219,15 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
   // for (int k=0; k<nzm; k++) {
   //     for (int i=0; i<nx; i++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<3>(nzm,nx,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+  parallel_for( SimpleBounds<4>(nfld,nzm,nx,ncrms) , YAKL_LAMBDA (int l, int k, int i, int icrm) {
+    int ind = ind_f(l);
     int kc=k+1;
     // MK: added fix for very small negative values (relative to positive values)
     //     especially  when such large numbers as
     //     hydrometeor concentrations are advected. The reason for negative values is
     //     most likely truncation error.
-    f(ind_f,k,j,i+offx_s,icrm)= max(0.0, f(ind_f,k,j,i+offx_s,icrm) - (uuu(k,j,i+1+offx_uuu,icrm)-uuu(k,j,i+offx_uuu,icrm) +
-                                (www(k+1,j,i+offx_www,icrm)-www(k,j,i+offx_www,icrm))*iadz(k,icrm))*irho(k,icrm));
+    f(ind,k,j,i+offx_s,icrm)= max(0.0, f(ind,k,j,i+offx_s,icrm) - (uuu(l,k,j,i+1+offx_uuu,icrm)-uuu(l,k,j,i+offx_uuu,icrm) +
+                                (www(l,k+1,j,i+offx_www,icrm)-www(l,k,j,i+offx_www,icrm))*iadz(k,icrm))*irho(k,icrm));
   });
 
 }
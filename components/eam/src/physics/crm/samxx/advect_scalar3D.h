@@ -4,11 +4,7 @@
 #include "samxx_const.h"
 #include "vars.h"
 
-void advect_scalar3D(real4d &f, real2d &flux);
-
-void advect_scalar3D(real5d &f, int ind_f, real2d &flux);
-
-void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux);
+void advect_scalar3D_batch(real5d &f, int1d &ind_f, int nfld, real3d &flux, bool do_flux);
 
 YAKL_INLINE real andiff(real x1, real x2, real a, real b) {
   return (abs(a)-a*a*b)*0.5*(x2-x1);
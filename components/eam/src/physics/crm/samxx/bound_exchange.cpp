@@ -3,7 +3,8 @@
 void bound_exchange(real4d &f, int dimz, int i_1, int i_2, int j_1, int j_2, int id) {
   YAKL_SCOPE( ncrms  , ::ncrms);
 
-  real1d buffer("buffer", (nx+ny)*3*nz*ncrms);
+  ScratchScope scratch;
+  real1d buffer = scratch.get<real1d>("buffer", (nx+ny)*3*nz*ncrms);
   int i1  = i_1-1;
   int i2  = i_2-1;
   int j1  = j_1-1;
@@ -283,7 +284,8 @@ void bound_exchange(real4d &f, int dimz, int i_1, int i_2, int j_1, int j_2, int
 void bound_exchange(real5d &f, int offL,int dimz, int i_1, int i_2, int j_1, int j_2, int id) {
   YAKL_SCOPE( ncrms  , ::ncrms);
 
-  real1d buffer("buffer", (nx+ny)*3*nz*ncrms);
+  ScratchScope scratch;
+  real1d buffer = scratch.get<real1d>("buffer", (nx+ny)*3*nz*ncrms);
   int i1  = i_1-1;
   int i2  = i_2-1;
   int j1  = j_1-1;
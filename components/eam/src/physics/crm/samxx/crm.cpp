@@ -101,6 +101,9 @@ extern "C" void crm(int ncrms_in, int pcols_in, real dt_gl, int plev, real *crm_
 
   allocate();
 
+  // Temporaries of the CRM routines are taken from the scratch pool
+  crm_scratch_pool.reserve(ncrms);
+
   init_values();
 
   pre_timeloop();
@@ -7,7 +7,8 @@ void VT_filter(int filter_wn_max, real4d &f_in, real4d &f_out) {
   // local variables
   int nx2 = nx+2;
   int ny2 = ny+2*YES3D;
-  real4d fft_out ("fft_out" , nzm, ny2, nx2, ncrms);
+  ScratchScope scratch;
+  real4d fft_out = scratch.get<real4d>("fft_out" , nzm, ny2, nx2, ncrms);
 
   int constexpr fftySize = ny > 4 ? ny : 4;
   
@@ -76,9 +77,10 @@ void VT_diagnose() {
   YAKL_SCOPE( u_vt          , :: u_vt);
 
   // local variables
-  real2d t_mean("t_mean", nzm, ncrms);
-  real2d q_mean("q_mean", nzm, ncrms);
-  real2d u_mean("u_mean", nzm, ncrms);
+  ScratchScope scratch;
+  real2d t_mean = scratch.get<real2d>("t_mean", nzm, ncrms);
+  real2d q_mean = scratch.get<real2d>("q_mean", nzm, ncrms);
+  real2d u_mean = scratch.get<real2d>("u_mean", nzm, ncrms);
 
   int idx_qt = index_water_vapor;
 
@@ -120,9 +122,9 @@ void VT_diagnose() {
   if (VT_wn_max>0) { // use filtered state for fluctuations
   
 
-    real4d tmp_t("tmp_t", nzm, ny, nx, ncrms);
-    real4d tmp_q("tmp_q", nzm, ny, nx, ncrms);
-    real4d tmp_u("tmp_u", nzm, ny, nx, ncrms);
+    real4d tmp_t = scratch.get<real4d>("tmp_t", nzm, ny, nx, ncrms);
+    real4d tmp_q = scratch.get<real4d>("tmp_q", nzm, ny, nx, ncrms);
+    real4d tmp_u = scratch.get<real4d>("tmp_u", nzm, ny, nx, ncrms);
 
     // do k = 1,nzm
     //   do j = 1,ny
@@ -202,9 +204,10 @@ void VT_forcing() {
   YAKL_SCOPE( u_vt_tend    , :: u_vt_tend);
 
   // local variables
-  real2d t_pert_scale("t_pert_scale", nzm, ncrms);
-  real2d q_pert_scale("q_pert_scale", nzm, ncrms);
-  real2d u_pert_scale("u_pert_scale", nzm, ncrms);
+  ScratchScope scratch;
+  real2d t_pert_scale = scratch.get<real2d>("t_pert_scale", nzm, ncrms);
+  real2d q_pert_scale = scratch.get<real2d>("q_pert_scale", nzm, ncrms);
+  real2d u_pert_scale = scratch.get<real2d>("u_pert_scale", nzm, ncrms);
 
   int idx_qt = index_water_vapor;
 
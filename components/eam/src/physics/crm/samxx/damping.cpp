@@ -21,12 +21,13 @@ void damping() {
   real constexpr tau_max    = 450.0;
   real constexpr fractional_damp_depth = 0.4;
 
-  int1d  n_damp    ("n_damp",ncrms);
-  int2d  do_damping("n_damp",nzm,ncrms);
-  real2d t0loc     ("t0loc" ,nzm,ncrms);
-  real2d u0loc     ("u0loc" ,nzm,ncrms);
-  real2d v0loc     ("v0loc" ,nzm,ncrms);
-  real2d tau       ("tau"   ,nzm,ncrms);
+  ScratchScope scratch;
+  int1d  n_damp    = scratch.get<int1d>("n_damp",ncrms);
+  int2d  do_damping = scratch.get<int2d>("n_damp",nzm,ncrms);
+  real2d t0loc     = scratch.get<real2d>("t0loc" ,nzm,ncrms);
+  real2d u0loc     = scratch.get<real2d>("u0loc" ,nzm,ncrms);
+  real2d v0loc     = scratch.get<real2d>("v0loc" ,nzm,ncrms);
+  real2d tau       = scratch.get<real2d>("tau"   ,nzm,ncrms);
 
   if (tau_min < 2.0*dt) { 
     std::cout << "Error: in damping() tau_min is too small!";
@@ -26,9 +26,10 @@ void diffuse_mom3D(real5d &tk) {
   YAKL_SCOPE( adz           , :: adz );
   YAKL_SCOPE( ncrms         , :: ncrms );
 
-  real4d fu("fu",nz,ny+1,nx+1,ncrms);
-  real4d fv("fv",nz,ny+1,nx+1,ncrms);
-  real4d fw("fw",nz,ny+1,nx+1,ncrms);
+  ScratchScope scratch;
+  real4d fu = scratch.get<real4d>("fu",nz,ny+1,nx+1,ncrms);
+  real4d fv = scratch.get<real4d>("fv",nz,ny+1,nx+1,ncrms);
+  real4d fw = scratch.get<real4d>("fw",nz,ny+1,nx+1,ncrms);
 
   real rdx2=1.0/(dx*dx);
   real rdy2=1.0/(dy*dy);
@@ -3,7 +3,8 @@
 
 void diffuse_scalar(real5d &tkh, int ind_tkh, real4d &f, real3d &fluxb, real3d &fluxt, real2d &fdiff, real2d &flux) {
   YAKL_SCOPE( ncrms , ::ncrms );
-  real4d df("df", nzm, dimy_s, dimx_s, ncrms);
+  ScratchScope scratch;
+  real4d df = scratch.get<real4d>("df", nzm, dimy_s, dimx_s, ncrms);
   
   // for (int k=0; k<nzm; k++) {
   //   for (int j=0; j<dimy_s; j++) {
@@ -38,7 +39,8 @@ void diffuse_scalar(real5d &tkh, int ind_tkh, real4d &f, real3d &fluxb, real3d &
 void diffuse_scalar(real5d &tkh, int ind_tkh, real5d &f, int ind_f, real3d &fluxb,
                     real3d &fluxt, real2d &fdiff, real2d &flux) {
   YAKL_SCOPE( ncrms , ::ncrms );
-  real4d df("df", nzm, dimy_s, dimx_s, ncrms);
+  ScratchScope scratch;
+  real4d df = scratch.get<real4d>("df", nzm, dimy_s, dimx_s, ncrms);
   
   // for (int k=0; k<nzm; k++) {
   //   for (int j=0; j<dimy_s; j++) {
@@ -73,7 +75,8 @@ void diffuse_scalar(real5d &tkh, int ind_tkh, real5d &f, int ind_f, real3d &flux
 void diffuse_scalar(real5d &tkh, int ind_tkh, real5d &f, int ind_f, real4d &fluxb, int ind_fluxb,
                     real4d &fluxt, int ind_fluxt, real3d &fdiff, int ind_fdiff, real3d &flux, int ind_flux) {
   YAKL_SCOPE( ncrms , ::ncrms );
-  real4d df("df", nzm, dimy_s, dimx_s, ncrms);
+  ScratchScope scratch;
+  real4d df = scratch.get<real4d>("df", nzm, dimy_s, dimx_s, ncrms);
   
   // for (int k=0; k<nzm; k++) {
   //   for (int j=0; j<dimy_s; j++) {
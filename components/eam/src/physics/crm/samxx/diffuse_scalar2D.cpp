@@ -20,8 +20,9 @@ void diffuse_scalar2D(real4d &field, real3d &fluxb, real3d &fluxt, real5d &tkh,
     int constexpr offx_flx = 1;
     int constexpr offz_flx = 1;
 
-    real4d flx("flx", nzm+1, 1, nx+1, ncrms);
-    real4d dfdt("dfdt", nzm, ny, nx, ncrms);
+    ScratchScope scratch;
+    real4d flx = scratch.get<real4d>("flx", nzm+1, 1, nx+1, ncrms);
+    real4d dfdt = scratch.get<real4d>("dfdt", nzm, ny, nx, ncrms);
 
     // for (int k=0; k<nzm; k++) {
     //  for (int i=0; i<nx; i++) {
@@ -109,8 +110,9 @@ void diffuse_scalar2D(real5d &field, int ind_field, real3d &fluxb, real3d &fluxt
     int constexpr offx_flx = 1;
     int constexpr offz_flx = 1;
 
-    real4d flx("flx", nzm+1, 1, nx+1, ncrms);
-    real4d dfdt("dfdt", nzm, ny, nx, ncrms);
+    ScratchScope scratch;
+    real4d flx = scratch.get<real4d>("flx", nzm+1, 1, nx+1, ncrms);
+    real4d dfdt = scratch.get<real4d>("dfdt", nzm, ny, nx, ncrms);
 
     // for (int k=0; k<nzm; k++) {
     //  for (int i=0; i<nx; i++) {
@@ -198,8 +200,9 @@ void diffuse_scalar2D(real5d &field, int ind_field, real4d &fluxb, int ind_fluxb
     int constexpr offx_flx = 1;
     int constexpr offz_flx = 1;
 
-    real4d flx("flx", nzm+1, 1, nx+1, ncrms);
-    real4d dfdt("dfdt", nzm, ny, nx, ncrms);
+    ScratchScope scratch;
+    real4d flx = scratch.get<real4d>("flx", nzm+1, 1, nx+1, ncrms);
+    real4d dfdt = scratch.get<real4d>("dfdt", nzm, ny, nx, ncrms);
 
     // for (int k=0; k<nzm; k++) {
     //  for (int i=0; i<nx; i++) {
@@ -17,9 +17,10 @@ void ice_fall() {
   YAKL_SCOPE( precsfc       , :: precsfc );
   YAKL_SCOPE( precssfc      , :: precssfc );
 
-  int1d  kmax("kmax",ncrms);
-  int1d  kmin("kmin",ncrms);
-  real4d fz  ("fz"  ,nz,ny,nx,ncrms);
+  ScratchScope scratch;
+  int1d  kmax = scratch.get<int1d>("kmax",ncrms);
+  int1d  kmin = scratch.get<int1d>("kmin",ncrms);
+  real4d fz  = scratch.get<real4d>("fz"  ,nz,ny,nx,ncrms);
 
   // for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
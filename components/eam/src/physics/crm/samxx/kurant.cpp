@@ -16,9 +16,10 @@ void kurant () {
   int constexpr max_ncycle = 4;
   real cfl;
 
-  real2d wm    ("wm"   ,nz ,ncrms);
-  real2d uhm   ("uhm"  ,nz ,ncrms);
-  real2d tmpMax("uhMax",nzm,ncrms);
+  ScratchScope scratch;
+  real2d wm    = scratch.get<real2d>("wm"   ,nz ,ncrms);
+  real2d uhm   = scratch.get<real2d>("uhm"  ,nz ,ncrms);
+  real2d tmpMax = scratch.get<real2d>("uhMax",nzm,ncrms);
 
   ncycle = 1;
   parallel_for( SimpleBounds<2>(nz,ncrms) , YAKL_LAMBDA (int k, int icrm) {
@@ -28,16 +28,17 @@ void precip_fall(int hydro_type, real4d &omega) {
   real constexpr eps = 1.e-10;
   bool constexpr nonos = true;
 
-  real4d mx("mx",nzm,ny,nx,ncrms);
-  real4d mn("mn",nzm,ny,nx,ncrms);
-  real4d lfac("lfac",nz,ny,nx,ncrms);
-  real4d www("www",nz,ny,nx,ncrms);
-  real4d fz("fz",nz,ny,nx,ncrms);
-  real4d wp("wp",nzm,ny,nx,ncrms);
-  real4d tmp_qp("tmp_qp",nzm,ny,nx,ncrms);
-  real2d irhoadz("irhoadz",nzm,ncrms);
-  real2d iwmax("iwmax",nzm,ncrms);
-  real2d rhofac("rhofac",nzm,ncrms);
+  ScratchScope scratch;
+  real4d mx = scratch.get<real4d>("mx",nzm,ny,nx,ncrms);
+  real4d mn = scratch.get<real4d>("mn",nzm,ny,nx,ncrms);
+  real4d lfac = scratch.get<real4d>("lfac",nz,ny,nx,ncrms);
+  real4d www = scratch.get<real4d>("www",nz,ny,nx,ncrms);
+  real4d fz = scratch.get<real4d>("fz",nz,ny,nx,ncrms);
+  real4d wp = scratch.get<real4d>("wp",nzm,ny,nx,ncrms);
+  real4d tmp_qp = scratch.get<real4d>("tmp_qp",nzm,ny,nx,ncrms);
+  real2d irhoadz = scratch.get<real2d>("irhoadz",nzm,ncrms);
+  real2d iwmax = scratch.get<real2d>("iwmax",nzm,ncrms);
+  real2d rhofac = scratch.get<real2d>("rhofac",nzm,ncrms);
 
   // for (int k=0; k<nzm; k++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
@@ -51,7 +52,7 @@ void precip_fall(int hydro_type, real4d &omega) {
 
   //  Add sedimentation of precipitation field to the vert. vel.
   real prec_cfl = 0.0;
-  real4d prec_cfl_arr("prec_cfl_arr",nzm,ny,nx,ncrms);
+  real4d prec_cfl_arr = scratch.get<real4d>("prec_cfl_arr",nzm,ny,nx,ncrms);
 
   // for (int k=0; k<nzm; k++) {
   //   for (int j=0; j<ny; j++) {
@@ -255,7 +256,8 @@ void micro_precip_fall() {
   YAKL_SCOPE( a_pr  , ::a_pr );
   YAKL_SCOPE( ncrms , ::ncrms );
 
-  real4d omega("omega", nzm, ny, nx, ncrms);
+  ScratchScope scratch;
+  real4d omega = scratch.get<real4d>("omega", nzm, ny, nx, ncrms);
 
   crain = b_rain / 4.0;
   csnow = b_snow / 4.0;
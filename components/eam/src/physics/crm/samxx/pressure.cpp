@@ -20,10 +20,11 @@ void pressure() {
   int constexpr n3j=3*ny_gl/2+1;
   int constexpr fftySize = ny > 4 ? ny : 4;
 
-  real4d f ("f" , nzslab, ny2, nx2, ncrms);
-  real4d ff("ff", nzm,ny2,nx+1,ncrms);
-  real2d a ("a" , nzm, ncrms);
-  real2d c ("c" , nzm, ncrms);
+  ScratchScope scratch;
+  real4d f = scratch.get<real4d>("f" , nzslab, ny2, nx2, ncrms);
+  real4d ff = scratch.get<real4d>("ff", nzm,ny2,nx+1,ncrms);
+  real2d a = scratch.get<real2d>("a" , nzm, ncrms);
+  real2d c = scratch.get<real2d>("c" , nzm, ncrms);
 
   int iwall = 0;
   int nypp, jwall;
@@ -35,7 +36,7 @@ void pressure() {
     nypp = ny+2;
   }
 
-  real2d eign("eign",nypp,nx+1);
+  real2d eign = scratch.get<real2d>("eign",nypp,nx+1);
 
   press_rhs();
 
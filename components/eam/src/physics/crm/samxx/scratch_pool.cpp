@@ -0,0 +1,100 @@
+
+#include "scratch_pool.h"
+#include <algorithm>
+
+ScratchPool crm_scratch_pool;
+
+
+void ScratchPool::reserve(int ncrms) {
+  if (ncrms == reserved_ncrms) { return; }
+  clear();
+
+  // Blocks for the largest temporaries of a CRM step: 3D fields without and with halos,
+  // and column fields. Anything beyond this is allocated (once) at the first use.
+  add_blocks( sizeof(real) * nz   *ny    *nx    *ncrms , 9  );
+  add_blocks( sizeof(real) * nz   *dimy_s*dimx_s*ncrms , 4  );
+  add_blocks( sizeof(real) *(nz+1)                *ncrms , 12 );
+
+  reserved_ncrms = ncrms;
+}
+
+
+void *ScratchPool::acquire(size_t bytes) {
+  size_t size = bucket_size(bytes);
+  auto &avail = free_list[size];
+  if (avail.empty()) {
+    add_blocks(size,1);
+    if (reserved_ncrms > 0) { stats.num_misses++; }
+  }
+  char *ptr = avail.back();
+  avail.pop_back();
+  in_use[ptr] = size;
+
+  stats.num_acquires++;
+  stats.bytes_in_use += size;
+  stats.bytes_high_water = std::max(stats.bytes_high_water,stats.bytes_in_use);
+  return ptr;
+}
+
+
+void ScratchPool::release(void *ptr) {
+  auto it = in_use.find(static_cast<char *>(ptr));
+  if (it == in_use.end()) {
+    std::cout << "ScratchPool::release: pointer was not acquired from the pool\n";
+    exit(-1);
+  }
+  free_list[it->second].push_back(it->first);
+  stats.bytes_in_use -= it->second;
+  in_use.erase(it);
+}
+
+
+void ScratchPool::clear() {
+  if (! in_use.empty()) {
+    std::cout << "ScratchPool::clear: " << in_use.size() << " blocks are still in use\n";
+    exit(-1);
+  }
+  yakl::fence();
+  blocks.clear();
+  free_list.clear();
+  stats.bytes_reserved = 0;
+  reserved_ncrms = -1;
+}
+
+
+void ScratchPool::print_stats() const {
+  std::cout << "CRM scratch pool:\n"
+            << "  blocks handed out        : " << stats.num_acquires      << "\n"
+            << "  device allocations       : " << stats.num_device_allocs << "\n"
+            << "  allocations past reserve : " << stats.num_misses        << "\n"
+            << "  bytes reserved           : " << stats.bytes_reserved    << "\n"
+            << "  bytes high water         : " << stats.bytes_high_water  << "\n";
+  for (auto const &b : blocks) {
+    std::cout << "    bucket " << b.first << " bytes: " << b.second.size() << " blocks\n";
+  }
+}
+
+
+size_t ScratchPool::bucket_size(size_t bytes) {
+  // Smallest bucket is 1 KB, so that tiny arrays share the same few blocks
+  size_t size = 1024;
+  while (size < bytes) { size *= 2; }
+  return size;
+}
+
+
+void ScratchPool::add_blocks(size_t bytes, int count) {
+  size_t size = bucket_size(bytes);
+  for (int n=0; n<count; n++) {
+    blocks[size].push_back(block1d("crm_scratch_block",size));
+    free_list[size].push_back(blocks[size].back().data());
+  }
+  stats.num_device_allocs += count;
+  stats.bytes_reserved    += size*count;
+}
+
+
+extern "C" void crm_scratch_finalize(bool print_stats) {
+  if (print_stats) { crm_scratch_pool.print_stats(); }
+  crm_scratch_pool.clear();
+}
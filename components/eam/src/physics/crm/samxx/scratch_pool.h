@@ -0,0 +1,98 @@
+
+#pragma once
+
+#include "samxx_const.h"
+#include <map>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+// Persistent pool of device memory for the temporary arrays of the CRM routines.
+//
+// Memory is handed out in blocks whose size is a power of two, and each block
+// size has its own free list. Blocks are never returned to the device allocator
+// until crm_scratch_finalize() is called, so after the first CRM step (or right
+// away, if reserve() anticipated all the needs) CRM steps do not allocate or free
+// any device memory.
+//
+// Blocks released while kernels using them are still in flight can be reused
+// right away: all CRM kernels run on the same stream, so the next user of the
+// block only touches it after those kernels are done.
+//////////////////////////////////////////////////////////////////////////////////
+class ScratchPool {
+public:
+  struct Stats {
+    long long num_acquires      = 0;  // Number of blocks handed out
+    long long num_device_allocs = 0;  // Number of blocks allocated on device
+    long long num_misses        = 0;  // Device allocations after reserve()
+    long long bytes_reserved    = 0;  // Total size of the blocks owned by the pool
+    long long bytes_in_use      = 0;  // Size of the blocks currently handed out
+    long long bytes_high_water  = 0;  // Max of bytes_in_use
+  };
+
+  // Pre-allocate blocks for the temporaries of a CRM step with ncrms CRMs.
+  // Does nothing if the pool was already reserved for the same ncrms.
+  void reserve(int ncrms);
+
+  void *acquire(size_t bytes);
+  void release(void *ptr);
+
+  // Free all blocks. No block can be in use.
+  void clear();
+
+  Stats const &get_stats() const { return stats; }
+  void print_stats() const;
+
+protected:
+  typedef yakl::Array<char,1,yakl::memDevice,yakl::styleC> block1d;
+
+  static size_t bucket_size(size_t bytes);
+
+  void add_blocks(size_t bytes, int count);
+
+  std::map<size_t,std::vector<block1d>> blocks;     // All blocks, per bucket size
+  std::map<size_t,std::vector<char *>>  free_list;  // Available blocks, per bucket size
+  std::map<char *,size_t>               in_use;     // Bucket size of the blocks handed out
+  int   reserved_ncrms = -1;
+  Stats stats;
+};
+
+
+extern ScratchPool crm_scratch_pool;
+
+
+//////////////////////////////////////////////////////////////////////////////////
+// Hands out arrays backed by the scratch pool, and releases them when going
+// out of scope. Usage:
+//   ScratchScope scratch;
+//   real4d f = scratch.get<real4d>("f", nzm, ny, nx, ncrms);
+// The arrays must not be used after the scope is destroyed.
+//////////////////////////////////////////////////////////////////////////////////
+class ScratchScope {
+public:
+  ScratchScope(ScratchPool &pool = crm_scratch_pool) : pool(pool) {}
+  ScratchScope(ScratchScope const &) = delete;
+  ScratchScope &operator=(ScratchScope const &) = delete;
+
+  ~ScratchScope() {
+    for (auto ptr : ptrs) { pool.release(ptr); }
+  }
+
+  template <class ARR, class... DIMS>
+  ARR get(char const *label, DIMS... dims) {
+    typedef typename std::remove_pointer<decltype(std::declval<ARR>().data())>::type T;
+    size_t nelems = 1;
+    for (size_t d : {static_cast<size_t>(dims)...}) { nelems *= d; }
+    void *ptr = pool.acquire(nelems*sizeof(T));
+    ptrs.push_back(ptr);
+    return ARR(label, static_cast<T *>(ptr), dims...);
+  }
+
+protected:
+  ScratchPool         &pool;
+  std::vector<void *> ptrs;
+};
+
+
+extern "C" void crm_scratch_finalize(bool print_stats);
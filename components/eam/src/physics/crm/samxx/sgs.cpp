@@ -13,7 +13,8 @@ void kurant_sgs(real &cfl) {
   YAKL_SCOPE( grdf_z         , :: grdf_z );
   YAKL_SCOPE( ncrms          , :: ncrms );
 
-  real2d tkhmax("tkhmax",nzm,ncrms);
+  ScratchScope scratch;
+  real2d tkhmax = scratch.get<real2d>("tkhmax",nzm,ncrms);
 
   // for (int k=0; k<nzm; k++) {
   //   for (int icrm=0; icrm<ncrms; icrm++) {
@@ -81,7 +82,8 @@ void sgs_mom() {
 
 void sgs_scalars() {
   YAKL_SCOPE( use_ESMT, :: use_ESMT );
-  real2d dummy("dummy", nz, ncrms);
+  ScratchScope scratch;
+  real2d dummy = scratch.get<real2d>("dummy", nz, ncrms);
 
   diffuse_scalar(sgs_field_diag,1,t,fluxbt,fluxtt,tdiff,twsb);
 
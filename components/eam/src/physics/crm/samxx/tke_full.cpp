@@ -39,9 +39,10 @@ void tke_full(real5d &tke, int ind_tke, real5d &tk, int ind_tk, real5d &tkh, int
   real constexpr Ces = Ce/0.7*3.0;
   real constexpr Pr = 1.0;
 
-  real4d def2("def2", nzm, ny, nx, ncrms);
-  real4d buoy_sgs_vert("buoy_sgs_vert", nzm+1,ny,nx,ncrms);
-  real4d a_prod_bu_vert("buoy_sgs_vert", nzm+1,ny,nx,ncrms);
+  ScratchScope scratch;
+  real4d def2 = scratch.get<real4d>("def2", nzm, ny, nx, ncrms);
+  real4d buoy_sgs_vert = scratch.get<real4d>("buoy_sgs_vert", nzm+1,ny,nx,ncrms);
+  real4d a_prod_bu_vert = scratch.get<real4d>("buoy_sgs_vert", nzm+1,ny,nx,ncrms);
 
   if (RUN3D) {
     shear_prod3D(def2);
@@ -3,6 +3,7 @@
 
 #include "samxx_const.h"
 #include "YAKL_fft.h"
+#include "scratch_pool.h"
 
 
 void allocate();
@@ -163,6 +163,22 @@ def perform_consistency_checks(case, xml):
     CIME.utils.CIMEError: ERROR: rrtmgp::rad_frequency incompatible with restart frequency.
      Please, ensure restart happens on a step when rad is ON
      For daily (or less frequent) restart, rad_frequency must divide ATM_NCPL
+    >>> xml_str = '''
+    ... <params>
+    ...   <model_restart>
+    ...     <incremental type="logical">true</incremental>
+    ...   </model_restart>
+    ... </params>
+    ... '''
+    >>> xml = ET.fromstring(xml_str)
+    >>> case = MockCase({'TESTCASE':'ERS'})
+    >>> perform_consistency_checks(case,xml)
+    >>> case = MockCase({'TESTCASE':'ERP'})
+    >>> perform_consistency_checks(case,xml)
+    Traceback (most recent call last):
+    CIME.utils.CIMEError: ERROR: Scorpio::model_restart::incremental=true is not allowed in ERP tests.
+     Incremental restart files store per-rank data, and can only be read with the
+     same PE layout (and pack size) used to write them, while ERP changes the PE layout.
     """
 
     # RRTMGP can be supercycled. Restarts cannot fall in the middle
@@ -206,6 +222,17 @@ def perform_consistency_checks(case, xml):
                     " Please, ensure restart happens on a step when rad is ON\n"
                     " For daily (or less frequent) restart, rad_frequency must divide ATM_NCPL")
 
+    # Incremental restart files store the raw per-rank data of the restart fields,
+    # so they cannot be read back if the PE layout changes across the restart
+    model_restart = find_node(xml,"model_restart")
+    incremental = None if model_restart is None else get_child(model_restart,"incremental",must_exist=False)
+    if incremental is not None and refine_type(incremental.text,force_type="logical"):
+        testcase = case.get_value("TESTCASE")
+        expect (testcase != "ERP",
+                f"Scorpio::model_restart::incremental=true is not allowed in {testcase} tests.\n"
+                " Incremental restart files store per-rank data, and can only be read with the\n"
+                " same PE layout (and pack size) used to write them, while ERP changes the PE layout.")
+
 ###############################################################################
 def ordered_dump(data, item, Dumper=yaml.SafeDumper, **kwds):
 ###############################################################################
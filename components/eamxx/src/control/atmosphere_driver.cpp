@@ -6,7 +6,10 @@
 
 #include "share/atm_process/atmosphere_process_group.hpp"
 #include "share/atm_process/atmosphere_process_dag.hpp"
+#include "share/atm_process/atmosphere_diagnostic.hpp"
 #include "share/field/field_utils.hpp"
+#include "share/grid/remap/horiz_interp_remapper_data.hpp"
+#include "share/io/scream_incremental_restart.hpp"
 #include "share/util/scream_time_stamp.hpp"
 #include "share/util/scream_timing.hpp"
 #include "share/util/scream_utils.hpp"
@@ -31,6 +34,7 @@
 #endif
 
 #include <fstream>
+#include <functional>
 #include <random>
 
 namespace scream {
@@ -129,6 +133,11 @@ set_params(const ekat::ParameterList& atm_params)
 
   create_logger ();
 
+  // Horizontal remappers (output, nudging,...) can cache their CRS data on disk
+  const auto& remap_cache_dir =
+    m_atm_params.sublist("driver_options").get<std::string>("horiz_remap_cache_dir","");
+  HorizRemapperData::set_cache_dir(remap_cache_dir);
+
   m_ad_status |= s_params_set;
 }
 
@@ -220,6 +229,11 @@ void AtmosphereDriver::create_atm_processes()
   atm_proc_params.set("Logger",m_atm_logger);
   m_atm_process_group = std::make_shared<AtmosphereProcessGroup>(m_atm_comm,atm_proc_params);
 
+  // Optionally record per-process wall times and kernel/memory counters
+  if (m_atm_params.sublist("driver_options").get<bool>("enable_perf_counters",false)) {
+    enable_perf_counters();
+  }
+
   m_ad_status |= s_procs_created;
   stop_timer("EAMxx::create_atm_processes");
   stop_timer("EAMxx::init");
@@ -496,6 +510,73 @@ void AtmosphereDriver::add_additional_column_data_to_property_checks () {
   }
 }
 
+std::set<std::string> AtmosphereDriver::get_pinned_field_names ()
+{
+  using vos_t = std::vector<std::string>;
+  auto& driver_options_pl = m_atm_params.sublist("driver_options");
+
+  // Fields explicitly pinned by the user
+  auto pinned_list = driver_options_pl.get<vos_t>("field_memory_pinned_fields",vos_t{});
+  std::set<std::string> pinned (pinned_list.begin(),pinned_list.end());
+
+  // Fields used by property checks set up by the driver
+  for (const auto& fn : driver_options_pl.get<vos_t>("property_check_data_fields",vos_t{})) {
+    pinned.insert(fn);
+  }
+
+  // Fields read by output streams, which are written at the end of the time step.
+  // Output fields that are not in the field managers are diagnostics, which are computed
+  // at output time from other fields (possibly other diagnostics). We create them here
+  // (the same way AtmosphereOutput does) just to find out which fields they require.
+  auto& diag_factory = AtmosphereDiagnosticFactory::instance();
+  const auto phys_grid_name = m_grids_manager->get_grid("Physics")->name();
+  std::set<std::string> visited;
+  std::function<void(const std::string&,const std::string&)> pin_output_field;
+  pin_output_field = [&](const std::string& fname, const std::string& grid_name) {
+    if (not visited.insert(fname).second) {
+      return;
+    }
+    for (const auto& it : m_field_mgrs) {
+      if (it.second->has_field(fname)) {
+        pinned.insert(fname);
+        return;
+      }
+    }
+    const auto diag_info = get_diagnostic_params(fname,grid_name);
+    auto diag = diag_factory.create(diag_info.first,m_atm_comm,diag_info.second);
+    diag->set_grids(m_grids_manager);
+    for (const auto& req : diag->get_required_field_requests()) {
+      pin_output_field(req.fid.name(),req.fid.get_grid_name());
+    }
+  };
+  auto pin_output_fields = [&](const ekat::ParameterList& pl, const std::string& grid_name) {
+    vos_t names;
+    if (pl.isType<vos_t>("Field Names")) {
+      names = pl.get<vos_t>("Field Names");
+    } else if (pl.isType<std::string>("Field Names")) {
+      names.push_back(pl.get<std::string>("Field Names"));
+    }
+    for (const auto& fn : names) {
+      pin_output_field(fn,grid_name);
+    }
+  };
+  auto& io_params = m_atm_params.sublist("Scorpio");
+  for (const auto& fname : io_params.get<vos_t>("output_yaml_files",vos_t{})) {
+    ekat::ParameterList params;
+    ekat::parse_yaml_file(fname,params);
+    pin_output_fields(params,phys_grid_name);
+    if (params.isSublist("Fields")) {
+      const auto& fields_pl = params.sublist("Fields");
+      for (auto it=fields_pl.sublists_names_cbegin(); it!=fields_pl.sublists_names_cend(); ++it) {
+        const auto& gn = m_grids_manager->has_grid(*it) ? m_grids_manager->get_grid(*it)->name()
+                                                        : phys_grid_name;
+        pin_output_fields(fields_pl.sublist(*it),gn);
+      }
+    }
+  }
+  return pinned;
+}
+
 void AtmosphereDriver::create_fields()
 {
   m_atm_logger->info("[EAMxx] create_fields ...");
@@ -586,11 +667,33 @@ void AtmosphereDriver::create_fields()
   process_imported_groups (m_atm_process_group->get_required_group_requests());
   process_imported_groups (m_atm_process_group->get_computed_group_requests());
 
+  // If requested, let fields that are only needed during part of the atm time step
+  // share memory. Fields that are accessed outside of the atm procs run are pinned.
+  auto& driver_options_pl = m_atm_params.sublist("driver_options");
+  const bool plan_field_memory = driver_options_pl.get<bool>("plan_field_memory",false);
+  if (plan_field_memory) {
+    AtmProcDAG dag;
+    const auto lifetimes = dag.compute_field_lifetimes(*m_atm_process_group);
+    const auto pinned = get_pinned_field_names();
+    for (const auto& it : lifetimes) {
+      m_field_mgrs.at(it.first)->set_field_lifetimes(it.second,pinned);
+    }
+  }
+
   // Close the FM's, allocate all fields
   for (auto it : m_grids_manager->get_repo()) {
     auto grid = it.second;
     auto fm = m_field_mgrs.at(grid->name());
     fm->registration_ends();
+
+    const auto& mp = fm->get_memory_planner();
+    if (mp.is_planned()) {
+      m_atm_logger->info("[EAMxx] field memory plan on grid " + grid->name() + ":");
+      m_atm_logger->info("   - transient fields : " + std::to_string(mp.num_transient_fields()) + "/"
+                         + std::to_string(mp.num_transient_fields()+mp.num_persistent_fields()));
+      m_atm_logger->info("   - peak bytes before: " + std::to_string(mp.peak_bytes_before()));
+      m_atm_logger->info("   - peak bytes after : " + std::to_string(mp.peak_bytes_after()));
+    }
   }
 
   // Set all the fields/groups in the processes. Input fields/groups will be handed
@@ -891,6 +994,11 @@ void AtmosphereDriver::restart_model ()
 
   m_atm_logger->info("    [EAMxx] Restart filename: " + filename);
 
+  // Incremental restart files store the fields data in per-rank checkpoint files,
+  // which may reference the checkpoint files of previous restart files
+  const bool incremental = scorpio::has_attribute(filename,"GLOBAL","incremental_restart");
+  std::vector<Field> incremental_fields;
+
   for (auto& it : m_field_mgrs) {
     if (fvphyshack and it.second->get_grid()->name() == "Physics GLL") continue;
     if (not it.second->has_group("RESTART")) {
@@ -902,7 +1010,20 @@ void AtmosphereDriver::restart_model ()
     for (const auto& fn : restart_group->m_fields_names) {
       fnames.push_back(fn);
     }
-    read_fields_from_file (fnames,it.second->get_grid(),filename,m_current_ts);
+    if (incremental) {
+      for (const auto& fn : fnames) {
+        incremental_fields.push_back(it.second->get_field(fn));
+      }
+    } else {
+      read_fields_from_file (fnames,it.second->get_grid(),filename,m_current_ts);
+    }
+  }
+  if (incremental) {
+    m_atm_logger->info("    [EAMxx] Reading incremental restart data");
+    IncrementalRestart::read(filename,incremental_fields,m_atm_comm);
+    for (auto& f : incremental_fields) {
+      f.get_header().get_tracking().update_time_stamp(m_current_ts);
+    }
   }
 
   // Restart the num steps counter in the atm time stamp
@@ -1617,6 +1738,10 @@ void AtmosphereDriver::run (const int dt) {
   // the individual processes, which will be called in the correct order.
   m_atm_process_group->run(dt);
 
+  // Some atm procs may still be running part of their work (e.g., on host).
+  // Wait for them, since their outputs may be needed below.
+  m_atm_process_group->finish_async_work();
+
   // Some accumulated fields need to be divided by dt at the end of the atm step
   for (auto fm_it : m_field_mgrs) {
     const auto& fm = fm_it.second;
@@ -1672,6 +1797,10 @@ void AtmosphereDriver::finalize ( /* inputs? */ ) {
 
   // Finalize, and then destroy all atmosphere processes
   if (m_atm_process_group.get()) {
+    if (perf_counters_enabled()) {
+      const auto prefix = m_atm_params.sublist("driver_options").get<std::string>("perf_counters_file","eamxx_perf");
+      write_perf_summary(*m_atm_process_group,m_atm_comm,prefix);
+    }
     m_atm_process_group->finalize( /* inputs ? */ );
     m_atm_process_group = nullptr;
   }
@@ -1763,13 +1892,20 @@ void AtmosphereDriver::report_res_dep_memory_footprint () const {
   // 2) grids data (dofs, maps, geo views), 3) atm buff manager, and 4) IO.
 
   // Fields
+  // Note: transient fields share a single device allocation (see FieldMemoryPlanner)
   for (const auto& fm_it : m_field_mgrs) {
+    const auto& mp = fm_it.second->get_memory_planner();
+    if (mp.is_planned()) {
+      my_dev_mem_usage += mp.arena_bytes();
+    }
     for (const auto& it : *fm_it.second) {
       const auto& fap = it.second->get_header().get_alloc_properties();
       if (fap.is_subfield()) {
         continue;
       }
-      my_dev_mem_usage += fap.get_alloc_size();
+      if (not (mp.is_planned() and mp.is_transient(it.first))) {
+        my_dev_mem_usage += fap.get_alloc_size();
+      }
       my_host_mem_usage += fap.get_alloc_size();
     }
   }
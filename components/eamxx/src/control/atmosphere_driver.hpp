@@ -172,6 +172,10 @@ protected:
 
   void report_res_dep_memory_footprint () const;
 
+  // Names of fields that are accessed outside of the atm procs run (e.g., by IO),
+  // and therefore cannot share memory with other fields (see FieldMemoryPlanner)
+  std::set<std::string> get_pinned_field_names ();
+
   void create_logger ();
   void set_initial_conditions ();
   void restart_model ();
@@ -3,33 +3,6 @@
 #include "ekat/std_meta/ekat_std_utils.hpp"
 #include "ekat/util/ekat_units.hpp"
 
-namespace
-{
-// Find first position in array pointed by [beg,end) that is below z
-// If all z's in array are >=z, return end
-template<typename T>
-KOKKOS_INLINE_FUNCTION
-const T* find_first_smaller_z (const T* beg, const T* end, const T& z)
-{
-  // It's easier to find the last entry that is not smaller than z,
-  // and then we'll return the ptr after that
-  int count = end - beg;
-  while (count>1) {
-    auto mid = beg + count/2 - 1;
-    // if (z>=*mid) {
-    if (*mid>=z) {
-      beg = mid+1;
-    } else {
-      end = mid+1;
-    }
-    count = end - beg;
-  }
-
-  return *beg < z ? beg : end;
-}
-
-} // anonymous namespace
-
 namespace scream
 {
 
@@ -99,6 +72,9 @@ initialize_impl (const RunType /*run_type*/)
   // Figure out the z value
   m_z_suffix = tag==LEV ? "_mid" : "_int";
 
+  m_brackets = VerticalBracketCache::get_instance(get_field_in(m_z_name+m_z_suffix),m_z,
+                                                  VerticalBracketCache::Kind::Height);
+
   // All good, create the diag output
   FieldIdentifier d_fid (m_diag_name,layout.clone().strip_dim(tag),fid.get_units(),fid.get_grid_name());
   m_diagnostic_output = Field(d_fid);
@@ -124,6 +100,11 @@ void FieldAtHeight::compute_diagnostic_impl()
 
   using RangePolicy = typename KokkosTypes<DefaultDevice>::RangePolicy;
 
+  // Locate z_tgt in each column (only done once per update of the height field,
+  // across all the diagnostics at this height)
+  m_brackets->update();
+  const auto pos = m_brackets->get_positions();
+
   auto z_tgt = m_z;
   auto nlevs = fl.dims().back();
   if (fl.rank()==2) {
@@ -136,21 +117,18 @@ void FieldAtHeight::compute_diagnostic_impl()
         auto f_i = ekat::subview(f_view,i);
         auto z_i = ekat::subview(z_view,i);
 
-        auto beg = z_i.data();
-        auto end = beg+nlevs;
-        auto it = find_first_smaller_z(beg,end,z_tgt);
-        if (it==beg) {
+        const int it = pos(i);
+        if (it==0) {
           // We just extapolate with first entry
           d_view(i) = f_i(0);
-        } else if (it==end) {
+        } else if (it==nlevs) {
           // We just extapolate with last entry
           d_view(i) = f_i(nlevs-1);
         } else {
-          auto pos = it-beg;
-          auto z0 = z_i(pos-1);
-          auto z1 = z_i(pos);
-          auto f0 = f_i(pos-1);
-          auto f1 = f_i(pos);
+          auto z0 = z_i(it-1);
+          auto z1 = z_i(it);
+          auto f0 = f_i(it-1);
+          auto f1 = f_i(it);
 
           d_view(i) = ( (z_tgt-z0)*f1 + (z1-z_tgt)*f0 ) / (z1-z0);
         }
@@ -169,21 +147,18 @@ void FieldAtHeight::compute_diagnostic_impl()
         auto f_ij = ekat::subview(f_view,i,j);
         auto z_i  = ekat::subview(z_view,i);
 
-        auto beg = z_i.data();
-        auto end = beg+nlevs;
-        auto it = find_first_smaller_z(beg,end,z_tgt);
-        if (it==beg) {
+        const int it = pos(i);
+        if (it==0) {
           // We just extapolate with first entry
           d_view(i,j) = f_ij(0);
-        } else if (it==end) {
+        } else if (it==nlevs) {
           // We just extapolate with last entry
           d_view(i,j) = f_ij(nlevs-1);
         } else {
-          auto pos = it-beg;
-          auto z0 = z_i(pos-1);
-          auto z1 = z_i(pos);
-          auto f0 = f_ij(pos-1);
-          auto f1 = f_ij(pos);
+          auto z0 = z_i(it-1);
+          auto z1 = z_i(it);
+          auto f0 = f_ij(it-1);
+          auto f1 = f_ij(it);
 
           d_view(i,j) = ( (z_tgt-z0)*f1 + (z1-z_tgt)*f0 ) / (z1-z0);
         }
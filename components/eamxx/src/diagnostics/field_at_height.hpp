@@ -2,6 +2,7 @@
 #define EAMXX_FIELD_AT_HEIGHT_HPP
 
 #include "share/atm_process/atmosphere_diagnostic.hpp"
+#include "diagnostics/vertical_bracket_cache.hpp"
 
 namespace scream
 {
@@ -37,6 +38,9 @@ protected:
   std::string         m_field_name;
 
   Real                m_z;
+
+  // Position of the height in each column, shared with other diags at the same height
+  std::shared_ptr<VerticalBracketCache> m_brackets;
 };
 
 } //namespace scream
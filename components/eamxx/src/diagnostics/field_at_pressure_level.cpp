@@ -2,7 +2,6 @@
 #include "share/util/scream_universal_constants.hpp"
 
 #include "ekat/std_meta/ekat_std_utils.hpp"
-#include "ekat/util/ekat_upper_bound.hpp"
 #include "ekat/util/ekat_units.hpp"
 
 namespace scream
@@ -80,6 +79,9 @@ initialize_impl (const RunType /*run_type*/)
   m_num_levs = layout.dims().back();
   auto num_cols = layout.dims().front();
 
+  m_brackets = VerticalBracketCache::get_instance(get_field_in(m_pressure_name),m_pressure_level,
+                                                  VerticalBracketCache::Kind::Pressure);
+
   // Take care of mask tracking for this field, in case it is needed.  This has two steps:
   //   1.  We need to actually track the masked columns, so we create a 2d (COL only) field.
   //       NOTE: Here we assume that even a source field of rank 3+ will be masked the same
@@ -129,6 +131,12 @@ void FieldAtPressureLevel::compute_diagnostic_impl()
   const int ncols = pl.dim(0);
   const int nlevs = pl.dim(1);
 
+  // Locate p_tgt in each column (only done once per update of the pressure field,
+  // across all the diagnostics at this pressure level)
+  m_brackets->update();
+  const auto pos   = m_brackets->get_positions();
+  const auto pmask = m_brackets->get_mask();
+
   auto p_tgt = m_pressure_level;
   auto mval = m_mask_val;
   if (rank==2) {
@@ -139,20 +147,16 @@ void FieldAtPressureLevel::compute_diagnostic_impl()
     Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int icol) {
       auto x1 = ekat::subview(p_src_v,icol);
       auto y1 = ekat::subview(f_v,icol);
-      auto beg = x1.data();
-      auto end = beg + nlevs;
-      auto last = beg + (nlevs-1);
-      if (p_tgt<*beg or p_tgt>*last) {
+      if (pmask(icol)==0) {
         diag(icol) = mval;
         mask(icol) = 0;
       } else {
-        auto ub = ekat::upper_bound(beg,end,p_tgt);     
-        auto k1 = ub - beg;
+        const int k1 = pos(icol);
         if (k1==0) {
-          // Corner case: p_tgt==y1(0)
-          diag(icol) = y1(icol);
+          // Corner case: p_tgt==x1(0)
+          diag(icol) = y1(0);
         } else if (k1==nlevs) {
-          // Corner case: p_tgt==y1(nlevs-1)
+          // Corner case: p_tgt==x1(nlevs-1)
           diag(icol) = y1(nlevs-1);
         } else {
           // General case: interpolate between k1 and k1-1
@@ -170,34 +174,28 @@ void FieldAtPressureLevel::compute_diagnostic_impl()
     Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const MemberType& team) {
       int icol = team.league_rank();
       auto x1 = ekat::subview(p_src_v,icol);
-      auto beg = x1.data();
-      auto end = beg + nlevs;
-      auto last = beg + (nlevs-1);
+      const int k1 = pos(icol);
+      const bool in_range = pmask(icol)!=0;
       Kokkos::parallel_for(Kokkos::TeamVectorRange(team,ndims),[&](const int idim) {
-        if (p_tgt<*beg or p_tgt>*last) {
+        if (not in_range) {
           diag(icol,idim) = mval;
-          Kokkos::single(Kokkos::PerTeam(team),[&]{
-            mask(icol) = 0;
-          });
         } else {
           auto y1 = ekat::subview(f_v,icol,idim);
-          auto ub = ekat::upper_bound(beg,end,p_tgt);     
-          auto k1 = ub - beg;
           if (k1==0) {
-            // Corner case: p_tgt==y1(0)
-            diag(icol,idim) = y1(icol);
+            // Corner case: p_tgt==x1(0)
+            diag(icol,idim) = y1(0);
           } else if (k1==nlevs) {
-            // Corner case: p_tgt==y1(nlevs-1)
+            // Corner case: p_tgt==x1(nlevs-1)
             diag(icol,idim) = y1(nlevs-1);
           } else {
             // General case: interpolate between k1 and k1-1
             diag(icol,idim) = y1(k1-1) + (y1(k1)-y1(k1-1))/(x1(k1) - x1(k1-1)) * (p_tgt-x1(k1-1));
           }
-          Kokkos::single(Kokkos::PerTeam(team),[&]{
-            mask(icol) = 1;
-          });
         }
       });
+      Kokkos::single(Kokkos::PerTeam(team),[&]{
+        mask(icol) = in_range ? 1 : 0;
+      });
     });
   } else {
     EKAT_ERROR_MSG("Error! field at pressure level only supports fields ranks 2 and 3 \n");
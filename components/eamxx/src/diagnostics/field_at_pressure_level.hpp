@@ -2,6 +2,7 @@
 #define EAMXX_FIELD_AT_PRESSURE_LEVEL_HPP
 
 #include "share/atm_process/atmosphere_diagnostic.hpp"
+#include "diagnostics/vertical_bracket_cache.hpp"
 
 #include <ekat/ekat_pack.hpp>
 
@@ -41,6 +42,9 @@ protected:
   int                 m_num_levs;
   Real                m_mask_val;
 
+  // Position of the pressure level in each column, shared with other diags at the same level
+  std::shared_ptr<VerticalBracketCache> m_brackets;
+
 }; // class FieldAtPressureLevel
 
 } //namespace scream
@@ -138,6 +138,59 @@ TEST_CASE("field_at_pressure_level_p2")
   } 
   
 } // TEST_CASE("field_at_pressure_level")
+
+TEST_CASE("field_at_pressure_level_shared_brackets")
+{
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  int ncols = 3;
+  int nlevs = 10;
+  auto gm   = create_gm(comm,ncols,nlevs);
+  auto grid = gm->get_grid("Point Grid");
+  auto fm   = get_test_fm(grid);
+  util::TimeStamp t0 ({2022,1,1},{0,0,0});
+
+  PressureBnds pressure_bounds;
+  auto engine = scream::setup_random_test(&comm);
+  using RPDF = std::uniform_real_distribution<Real>;
+  Real p_mid_bnds_dz = pressure_bounds.p_surf/nlevs;
+  RPDF pdf_pmid(pressure_bounds.p_top+p_mid_bnds_dz,pressure_bounds.p_surf-p_mid_bnds_dz);
+
+  Real plevel = std::round(pdf_pmid(engine));
+  auto diag1 = get_test_diag(comm, fm, gm, "mid", plevel);
+  auto diag2 = get_test_diag(comm, fm, gm, "mid", plevel);
+  diag1->initialize(t0,RunType::Initial);
+  diag2->initialize(t0,RunType::Initial);
+
+  // Both diags use the same brackets
+  auto p_mid = fm->get_field("p_mid");
+  auto brackets = VerticalBracketCache::get_instance(p_mid,plevel,VerticalBracketCache::Kind::Pressure);
+  REQUIRE (brackets->num_updates()==0);
+
+  auto check = [&](const std::shared_ptr<FieldAtPressureLevel>& diag) {
+    auto diag_f = diag->get_diagnostic();
+    diag_f.sync_to_host();
+    auto diag_v = diag_f.get_view<const Real*, Host>();
+    for (int icol=0;icol<ncols;icol++) {
+      REQUIRE(approx(diag_v(icol),get_test_data(plevel)));
+    }
+  };
+
+  // The second diag reuses the brackets computed by the first one
+  diag1->compute_diagnostic();
+  diag2->compute_diagnostic();
+  REQUIRE (brackets->num_updates()==1);
+  check(diag1);
+  check(diag2);
+
+  // Once the pressure is updated, the brackets are recomputed (once)
+  p_mid.get_header().get_tracking().increment_version();
+  diag1->compute_diagnostic();
+  diag2->compute_diagnostic();
+  REQUIRE (brackets->num_updates()==2);
+  check(diag1);
+  check(diag2);
+}
 /*==========================================================================================================*/
 std::shared_ptr<FieldManager> get_test_fm(std::shared_ptr<const AbstractGrid> grid)
 {
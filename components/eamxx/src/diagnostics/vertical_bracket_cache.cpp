@@ -0,0 +1,124 @@
+#include "diagnostics/vertical_bracket_cache.hpp"
+
+#include "ekat/util/ekat_upper_bound.hpp"
+
+namespace
+{
+// Find first position in array pointed by [beg,end) that is below z
+// If all z's in array are >=z, return end
+template<typename T>
+KOKKOS_INLINE_FUNCTION
+const T* find_first_smaller_z (const T* beg, const T* end, const T& z)
+{
+  // It's easier to find the last entry that is not smaller than z,
+  // and then we'll return the ptr after that
+  int count = end - beg;
+  while (count>1) {
+    auto mid = beg + count/2 - 1;
+    // if (z>=*mid) {
+    if (*mid>=z) {
+      beg = mid+1;
+    } else {
+      end = mid+1;
+    }
+    count = end - beg;
+  }
+
+  return *beg < z ? beg : end;
+}
+
+} // anonymous namespace
+
+namespace scream
+{
+
+std::map<VerticalBracketCache::key_t,std::weak_ptr<VerticalBracketCache>>
+VerticalBracketCache::s_instances;
+
+VerticalBracketCache::
+VerticalBracketCache (const Field& coord, const Real target, const Kind kind)
+ : m_coord  (coord)
+ , m_target (target)
+ , m_kind   (kind)
+{
+  const auto& layout = m_coord.get_header().get_identifier().get_layout();
+  EKAT_REQUIRE_MSG (layout.rank()==2,
+      "Error! VerticalBracketCache requires a (COL,LEV) or (COL,ILEV) coordinate field.\n"
+      " - field name  : " + m_coord.name() + "\n"
+      " - field layout: " + layout.to_string() + "\n");
+
+  const int ncols = layout.dim(0);
+  m_pos  = view_1d<int>(m_coord.name() + " bracket positions",ncols);
+  m_mask = view_1d<int>(m_coord.name() + " bracket mask",ncols);
+}
+
+std::shared_ptr<VerticalBracketCache> VerticalBracketCache::
+get_instance (const Field& coord, const Real target, const Kind kind)
+{
+  // NOTE: each instance stores a copy of the coordinate field, so the header
+  //       cannot be destroyed (and its address reused) while the entry is alive.
+  const key_t key (coord.get_header_ptr().get(),target,kind);
+  auto ptr = s_instances[key].lock();
+  if (not ptr) {
+    ptr = std::make_shared<VerticalBracketCache>(coord,target,kind);
+    s_instances[key] = ptr;
+  }
+  return ptr;
+}
+
+void VerticalBracketCache::update ()
+{
+  const auto& tracking = m_coord.get_header().get_tracking();
+  const auto& ts = tracking.get_time_stamp();
+  const auto version = tracking.get_version();
+  if (m_ts.is_valid() and ts==m_ts and version==m_version) {
+    return;
+  }
+
+  compute_brackets();
+
+  m_ts = ts;
+  m_version = version;
+  ++m_num_updates;
+}
+
+void VerticalBracketCache::compute_brackets ()
+{
+  using RangePolicy = typename KT::RangePolicy;
+
+  const auto& layout = m_coord.get_header().get_identifier().get_layout();
+  const int ncols = layout.dim(0);
+  const int nlevs = layout.dim(1);
+
+  const auto x_v = m_coord.get_view<const Real**>();
+  const auto pos  = m_pos;
+  const auto mask = m_mask;
+  const auto tgt  = m_target;
+
+  RangePolicy policy (0,ncols);
+  if (m_kind==Kind::Pressure) {
+    Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int icol) {
+      auto x = ekat::subview(x_v,icol);
+      auto beg = x.data();
+      auto end = beg + nlevs;
+      auto last = beg + (nlevs-1);
+      if (tgt<*beg or tgt>*last) {
+        pos(icol) = 0;
+        mask(icol) = 0;
+      } else {
+        pos(icol) = ekat::upper_bound(beg,end,tgt) - beg;
+        mask(icol) = 1;
+      }
+    });
+  } else {
+    Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int icol) {
+      auto x = ekat::subview(x_v,icol);
+      auto beg = x.data();
+      auto end = beg + nlevs;
+      pos(icol) = find_first_smaller_z(beg,end,tgt) - beg;
+      mask(icol) = 1;
+    });
+  }
+}
+
+} //namespace scream
@@ -0,0 +1,95 @@
+#ifndef EAMXX_VERTICAL_BRACKET_CACHE_HPP
+#define EAMXX_VERTICAL_BRACKET_CACHE_HPP
+
+#include "share/field/field.hpp"
+#include "share/util/scream_time_stamp.hpp"
+#include "share/scream_types.hpp"
+
+#include <map>
+#include <memory>
+#include <tuple>
+
+namespace scream
+{
+
+/*
+ * Shared storage for the vertical search of the "field at level X" diagnostics.
+ *
+ * For a vertical coordinate field (e.g., p_mid or z_int) and a target value, this class
+ * stores, for each column, the position of the target within the column, together with
+ * a 0/1 mask telling whether the target lies within the column range. Diagnostics slicing
+ * different fields at the same target value share the same instance, so the search is
+ * done only once per update of the coordinate field, and each diagnostic only needs to
+ * gather and interpolate its own field.
+ *
+ * The brackets are recomputed whenever the time stamp or the update counter (see
+ * FieldTracking::get_version) of the coordinate field changes. If the coordinate field
+ * has no valid time stamp, they are recomputed at every call to update.
+ */
+
+class VerticalBracketCache
+{
+public:
+  // How the target is located in the column
+  enum class Kind {
+    // Coordinate increasing with the level index (pressure). The stored position is the
+    // first level whose coordinate is strictly larger than the target. Columns whose
+    // range does not contain the target are masked.
+    Pressure,
+    // Coordinate decreasing with the level index (height). The stored position is the
+    // first level whose coordinate is strictly smaller than the target. Columns are
+    // never masked (the diagnostic extrapolates with the first/last level).
+    Height
+  };
+
+  using KT = KokkosTypes<DefaultDevice>;
+  template<typename T>
+  using view_1d = typename KT::template view_1d<T>;
+
+  VerticalBracketCache (const Field& coord, const Real target, const Kind kind);
+
+  // Get the cache for the given coordinate field and target, creating it if no
+  // diagnostic is using it yet
+  static std::shared_ptr<VerticalBracketCache>
+  get_instance (const Field& coord, const Real target, const Kind kind);
+
+  // Recompute the brackets if the coordinate field was updated since the last call
+  void update ();
+
+  // Per-column position of the target (in [0,nlevs]), and 0/1 mask
+  view_1d<const int> get_positions () const { return m_pos; }
+  view_1d<const int> get_mask      () const { return m_mask; }
+
+  const Field& get_coordinate () const { return m_coord; }
+  Real get_target () const { return m_target; }
+  Kind get_kind () const { return m_kind; }
+
+  // Number of times the brackets were actually computed (mostly for testing)
+  int num_updates () const { return m_num_updates; }
+
+#ifndef KOKKOS_ENABLE_CUDA
+protected:
+#endif
+  void compute_brackets ();
+
+protected:
+  using key_t = std::tuple<const FieldHeader*,Real,Kind>;
+
+  static std::map<key_t,std::weak_ptr<VerticalBracketCache>> s_instances;
+
+  Field           m_coord;
+  Real            m_target;
+  Kind            m_kind;
+
+  view_1d<int>    m_pos;
+  view_1d<int>    m_mask;
+
+  // Tracking info of the coordinate field when the brackets were last computed
+  util::TimeStamp m_ts;
+  long long       m_version = -1;
+  int             m_num_updates = 0;
+};
+
+} //namespace scream
+
+#endif // EAMXX_VERTICAL_BRACKET_CACHE_HPP
@@ -8,9 +8,48 @@
 #include "share/field/field_utils.hpp"
 
 #include <array>
+#include <vector>
 
 namespace scream
 {
+
+namespace {
+
+// Inputs of the COSP simulator (besides z_mid, which is computed here)
+const std::vector<std::string> cosp_inputs_1d = {"sunlit", "surf_radiative_T"};
+const std::vector<std::string> cosp_inputs_2d = {"T_mid", "p_mid", "p_int", "qv", "qc", "qi",
+                                                 "cldfrac_rad", "eff_radius_qc", "eff_radius_qi",
+                                                 "dtau067", "dtau105"};
+// Outputs of the COSP simulator (cosp_sunlit is simply a copy of sunlit)
+const std::vector<std::string> cosp_outputs = {"isccp_cldtot", "isccp_ctptau", "modis_ctptau", "misr_cthtau"};
+
+// The device views of the fields may be strided (e.g., tracers) or padded,
+// so copy them with a kernel rather than with deep_copy
+template<typename SrcView>
+void copy_to_pinned (const SrcView& src, const Cosp::pinned_view<Real*>& dst)
+{
+  const int n = dst.extent(0);
+  Kokkos::parallel_for(Kokkos::RangePolicy<Cosp::KT::ExeSpace>(0,n),
+                       KOKKOS_LAMBDA (const int i) {
+    dst(i) = src(i);
+  });
+}
+
+template<typename SrcView>
+void copy_to_pinned (const SrcView& src, const Cosp::pinned_view<Real**>& dst)
+{
+  const int n0 = dst.extent(0);
+  const int n1 = dst.extent(1);
+  Kokkos::parallel_for(Kokkos::RangePolicy<Cosp::KT::ExeSpace>(0,n0*n1),
+                       KOKKOS_LAMBDA (const int idx) {
+    const int i = idx / n1;
+    const int j = idx % n1;
+    dst(i,j) = src(i,j);
+  });
+}
+
+} // anonymous namespace
+
 // =========================================================================================
 Cosp::Cosp (const ekat::Comm& comm, const ekat::ParameterList& params)
   : AtmosphereProcess(comm, params)
@@ -25,6 +64,9 @@ Cosp::Cosp (const ekat::Comm& comm, const ekat::ParameterList& params)
 
   // How many subcolumns to use for COSP
   m_num_subcols = m_params.get<Int>("cosp_subcolumns", 10);
+
+  // Whether to run the COSP simulator on host concurrently with the following atm procs
+  m_async = m_params.get<bool>("cosp_async", false);
 }
 
 // =========================================================================================
@@ -111,6 +153,21 @@ void Cosp::initialize_impl (const RunType /* run_type */)
       auto& atts = f.get_header().get_extra_data<stratts_t>("io: string attributes");
       atts["note"] = "Night values are zero; divide by cosp_sunlit to get daytime mean";
   }
+
+  m_z_mid = KT::view_2d<Real>("z_mid", m_num_cols, m_num_levs);
+  m_z_int = KT::view_2d<Real>("z_int", m_num_cols, m_num_levs+1);
+  m_z_mid_h = Kokkos::create_mirror_view(m_z_mid);
+
+  if (m_async) {
+    for (const std::string name : cosp_inputs_1d) {
+      m_snapshot_1d[name] = pinned_view<Real*>(name + "_snapshot", m_num_cols);
+    }
+    for (const std::string name : cosp_inputs_2d) {
+      const auto& fl = get_field_in(name).get_header().get_identifier().get_layout();
+      m_snapshot_2d[name] = pinned_view<Real**>(name + "_snapshot", fl.dim(0), fl.dim(1));
+    }
+    m_snapshot_2d["z_mid"] = pinned_view<Real**>("z_mid_snapshot", m_num_cols, m_num_levs);
+  }
 }
 
 // =========================================================================================
@@ -134,59 +191,44 @@ void Cosp::run_impl (const double dt)
   auto ts = timestamp();
   auto update_cosp = cosp_do(cosp_freq_in_steps, ts.get_num_steps());
 
-  // Get fields from field manager; note that we get host views because this
-  // interface serves primarily as a wrapper to a c++ to f90 bridge for the COSP
-  // all then need to be copied to layoutLeft views to permute the indices for
-  // F90.
-  //
-  // Need to make sure device data is synced to host?
-  get_field_in("qv").sync_to_host();
-  get_field_in("qc").sync_to_host();
-  get_field_in("qi").sync_to_host();
-  get_field_in("sunlit").sync_to_host();
-  get_field_in("surf_radiative_T").sync_to_host();
-  get_field_in("T_mid").sync_to_host();
-  get_field_in("p_mid").sync_to_host();
-  get_field_in("p_int").sync_to_host();
-  get_field_in("cldfrac_rad").sync_to_host();
-  get_field_in("eff_radius_qc").sync_to_host();
-  get_field_in("eff_radius_qi").sync_to_host();
-  get_field_in("dtau067").sync_to_host();
-  get_field_in("dtau105").sync_to_host();
-  get_field_in("phis").sync_to_host();
-  get_field_in("pseudo_density").sync_to_host();
-
-  auto qv      = get_field_in("qv").get_view<const Real**, Host>();
-  auto qc      = get_field_in("qc").get_view<const Real**, Host>();
-  auto qi      = get_field_in("qi").get_view<const Real**, Host>();
-  auto sunlit  = get_field_in("sunlit").get_view<const Real*, Host>();
-  auto skt     = get_field_in("surf_radiative_T").get_view<const Real*, Host>();
-  auto T_mid   = get_field_in("T_mid").get_view<const Real**, Host>();
-  auto p_mid   = get_field_in("p_mid").get_view<const Real**, Host>();
-  auto p_int   = get_field_in("p_int").get_view<const Real**, Host>();
-  auto phis    = get_field_in("phis").get_view<const Real*, Host>();
-  auto pseudo_density = get_field_in("pseudo_density").get_view<const Real**, Host>();
-  auto cldfrac = get_field_in("cldfrac_rad").get_view<const Real**, Host>();
-  auto reff_qc = get_field_in("eff_radius_qc").get_view<const Real**, Host>();
-  auto reff_qi = get_field_in("eff_radius_qi").get_view<const Real**, Host>();
-  auto dtau067 = get_field_in("dtau067").get_view<const Real**, Host>();
-  auto dtau105 = get_field_in("dtau105").get_view<const Real**, Host>();
-  auto isccp_cldtot = get_field_out("isccp_cldtot").get_view<Real*, Host>();
-  auto isccp_ctptau = get_field_out("isccp_ctptau").get_view<Real***, Host>();
-  auto modis_ctptau = get_field_out("modis_ctptau").get_view<Real***, Host>();
-  auto misr_cthtau  = get_field_out("misr_cthtau").get_view<Real***, Host>();
-  auto cosp_sunlit  = get_field_out("cosp_sunlit").get_view<Real*, Host>();  // Copy of sunlit flag with COSP frequency for proper averaging
+  // The AD should have already waited for the previous COSP call, but just in case
+  // (e.g., if we are being run outside of the AD), since we are about to reuse the buffers.
+  finish_async_work();
+
+  if (not update_cosp) {
+    // If not updating COSP statistics, set these to ZERO; this essentially weights
+    // the ISCCP cloud properties by the sunlit mask. What will be output for time-averages
+    // then is the time-average mask-weighted statistics; to get true averages, we need to
+    // divide by the time-average of the mask. I.e., if M is the sunlit mask, and X is the ISCCP
+    // statistic, then
+    //
+    //     avg(X) = sum(M * X) / sum(M) = (sum(M * X)/N) / (sum(M)/N) = avg(M * X) / avg(M)
+    //
+    // TODO: mask this when/if the AD ever supports masked averages
+    for (const std::string name : cosp_outputs) {
+      get_field_out(name).deep_copy(0);
+    }
+    get_field_out("cosp_sunlit").deep_copy(0);
+    return;
+  }
+
+  // Copy of sunlit flag with COSP frequency for proper averaging
+  get_field_out("cosp_sunlit").deep_copy(get_field_in("sunlit"));
 
   // Compute heights
-  const auto z_mid = CospFunc::view_2d<Real>("z_mid", m_num_cols, m_num_levs);
-  const auto z_int = CospFunc::view_2d<Real>("z_int", m_num_cols, m_num_levs+1);
+  const auto z_mid = m_z_mid;
+  const auto z_int = m_z_int;
   const auto dz = z_mid;  // reuse tmp memory for dz
   const auto ncol = m_num_cols;
   const auto nlev = m_num_levs;
+  const auto phis  = get_field_in("phis").get_view<const Real*>();
+  const auto p_mid = get_field_in("p_mid").get_view<const Real**>();
+  const auto T_mid = get_field_in("T_mid").get_view<const Real**>();
+  const auto qv    = get_field_in("qv").get_view<const Real**>();
+  const auto pseudo_density = get_field_in("pseudo_density").get_view<const Real**>();
   // calculate_z_int contains a team-level parallel_scan, which requires a special policy
-  // TODO: do this on device?
-  const auto scan_policy = ekat::ExeSpaceUtils<KTH::ExeSpace>::get_thread_range_parallel_scan_team_policy(ncol, nlev);
-  Kokkos::parallel_for(scan_policy, KOKKOS_LAMBDA (const KTH::MemberType& team) {
+  const auto scan_policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_thread_range_parallel_scan_team_policy(ncol, nlev);
+  Kokkos::parallel_for(scan_policy, KOKKOS_LAMBDA (const KT::MemberType& team) {
       const int i = team.league_rank();
       const auto dz_s    = ekat::subview(dz,    i);
       const auto p_mid_s = ekat::subview(p_mid, i);
@@ -204,59 +246,125 @@ void Cosp::run_impl (const double dt)
       team.team_barrier();
   });
 
-  // Call COSP wrapper routines
-  if (update_cosp) {
-    Real emsfc_lw = 0.99;
-    Kokkos::deep_copy(cosp_sunlit, sunlit);
-    CospFunc::view_2d<const Real> z_mid_c = z_mid;  // Need a const version of z_mid for call to CospFunc::main
-    CospFunc::main(
-            m_num_cols, m_num_subcols, m_num_levs, m_num_tau, m_num_ctp, m_num_cth,
-            emsfc_lw, sunlit, skt, T_mid, p_mid, p_int, z_mid_c, qv, qc, qi,
-            cldfrac, reff_qc, reff_qi, dtau067, dtau105,
-            isccp_cldtot, isccp_ctptau, modis_ctptau, misr_cthtau
-    );
-    // Remask night values to ZERO since our I/O does not know how to handle masked/missing values
-    // in temporal averages; this is all host data, so we can just use host loops like its the 1980s
-    for (int i = 0; i < m_num_cols; i++) {
-        if (sunlit(i) == 0) {
-            isccp_cldtot(i) = 0;
-            for (int j = 0; j < m_num_tau; j++) {
-                for (int k = 0; k < m_num_ctp; k++) {
-                    isccp_ctptau(i,j,k) = 0;
-                    modis_ctptau(i,j,k) = 0;
-                }
-                for (int k = 0; k < m_num_cth; k++) {
-                    misr_cthtau (i,j,k) = 0;
-                }
-            }
-        }
+  // Gather host views of inputs/outputs. COSP outputs are computed in the host views
+  // of the output fields, which are synced to device once COSP is done.
+  host_in_1d  in_1d;
+  host_in_2d  in_2d;
+  host_out_1d out_1d;
+  host_out_3d out_3d;
+  out_1d["isccp_cldtot"] = get_field_out("isccp_cldtot").get_view<Real*,Host>();
+  for (const std::string name : {"isccp_ctptau","modis_ctptau","misr_cthtau"}) {
+    out_3d[name] = get_field_out(name).get_view<Real***,Host>();
+  }
+
+  if (m_async) {
+    // Snapshot the inputs, so that later atm procs can keep updating them on device
+    for (const std::string name : cosp_inputs_1d) {
+      copy_to_pinned(get_field_in(name).get_view<const Real*>(),m_snapshot_1d.at(name));
     }
+    for (const std::string name : cosp_inputs_2d) {
+      copy_to_pinned(get_field_in(name).get_view<const Real**>(),m_snapshot_2d.at(name));
+    }
+    copy_to_pinned(z_mid,m_snapshot_2d.at("z_mid"));
+    Kokkos::fence();
+
+    for (const auto& it : m_snapshot_1d) {
+      in_1d[it.first] = KTH::view_1d<const Real>(it.second.data(),it.second.extent(0));
+    }
+    for (const auto& it : m_snapshot_2d) {
+      in_2d[it.first] = KTH::view_2d<const Real>(it.second.data(),it.second.extent(0),it.second.extent(1));
+    }
+
+    m_cosp_job = std::async(std::launch::async,[this,in_1d,in_2d,out_1d,out_3d]() {
+      run_cosp_host(in_1d,in_2d,out_1d,out_3d);
+    });
   } else {
-    // If not updating COSP statistics, set these to ZERO; this essentially weights
-    // the ISCCP cloud properties by the sunlit mask. What will be output for time-averages
-    // then is the time-average mask-weighted statistics; to get true averages, we need to
-    // divide by the time-average of the mask. I.e., if M is the sunlit mask, and X is the ISCCP
-    // statistic, then
-    //
-    //     avg(X) = sum(M * X) / sum(M) = (sum(M * X)/N) / (sum(M)/N) = avg(M * X) / avg(M)
-    //
-    // TODO: mask this when/if the AD ever supports masked averages
-    Kokkos::deep_copy(isccp_cldtot, 0.0);
-    Kokkos::deep_copy(isccp_ctptau, 0.0);
-    Kokkos::deep_copy(modis_ctptau, 0.0);
-    Kokkos::deep_copy(misr_cthtau, 0.0);
-    Kokkos::deep_copy(cosp_sunlit, 0.0);
+    for (const std::string name : cosp_inputs_1d) {
+      get_field_in(name).sync_to_host();
+      in_1d[name] = get_field_in(name).get_view<const Real*,Host>();
+    }
+    for (const std::string name : cosp_inputs_2d) {
+      get_field_in(name).sync_to_host();
+      in_2d[name] = get_field_in(name).get_view<const Real**,Host>();
+    }
+    Kokkos::deep_copy(m_z_mid_h,z_mid);
+    in_2d["z_mid"] = m_z_mid_h;
+
+    run_cosp_host(in_1d,in_2d,out_1d,out_3d);
+    for (const std::string name : cosp_outputs) {
+      get_field_out(name).sync_to_dev();
+    }
+  }
+}
+
+// =========================================================================================
+void Cosp::finish_async_work ()
+{
+  if (not m_cosp_job.valid()) {
+    return;
+  }
+
+  // Note: if COSP threw, get() rethrows the exception here
+  m_cosp_job.get();
+  for (const std::string name : cosp_outputs) {
+    get_field_out(name).sync_to_dev();
+  }
+}
+
+// =========================================================================================
+void Cosp::run_cosp_host (const host_in_1d& in_1d, const host_in_2d& in_2d,
+                          const host_out_1d& out_1d, const host_out_3d& out_3d) const
+{
+  // Call COSP wrapper routines
+  auto sunlit  = in_1d.at("sunlit");
+  auto skt     = in_1d.at("surf_radiative_T");
+  auto T_mid   = in_2d.at("T_mid");
+  auto p_mid   = in_2d.at("p_mid");
+  auto p_int   = in_2d.at("p_int");
+  auto z_mid   = in_2d.at("z_mid");
+  auto qv      = in_2d.at("qv");
+  auto qc      = in_2d.at("qc");
+  auto qi      = in_2d.at("qi");
+  auto cldfrac = in_2d.at("cldfrac_rad");
+  auto reff_qc = in_2d.at("eff_radius_qc");
+  auto reff_qi = in_2d.at("eff_radius_qi");
+  auto dtau067 = in_2d.at("dtau067");
+  auto dtau105 = in_2d.at("dtau105");
+  auto isccp_cldtot = out_1d.at("isccp_cldtot");
+  auto isccp_ctptau = out_3d.at("isccp_ctptau");
+  auto modis_ctptau = out_3d.at("modis_ctptau");
+  auto misr_cthtau  = out_3d.at("misr_cthtau");
+
+  Real emsfc_lw = 0.99;
+  CospFunc::main(
+          m_num_cols, m_num_subcols, m_num_levs, m_num_tau, m_num_ctp, m_num_cth,
+          emsfc_lw, sunlit, skt, T_mid, p_mid, p_int, z_mid, qv, qc, qi,
+          cldfrac, reff_qc, reff_qi, dtau067, dtau105,
+          isccp_cldtot, isccp_ctptau, modis_ctptau, misr_cthtau
+  );
+  // Remask night values to ZERO since our I/O does not know how to handle masked/missing values
+  // in temporal averages; this is all host data, so we can just use host loops like its the 1980s
+  for (int i = 0; i < m_num_cols; i++) {
+      if (sunlit(i) == 0) {
+          isccp_cldtot(i) = 0;
+          for (int j = 0; j < m_num_tau; j++) {
+              for (int k = 0; k < m_num_ctp; k++) {
+                  isccp_ctptau(i,j,k) = 0;
+                  modis_ctptau(i,j,k) = 0;
+              }
+              for (int k = 0; k < m_num_cth; k++) {
+                  misr_cthtau (i,j,k) = 0;
+              }
+          }
+      }
   }
-  get_field_out("isccp_cldtot").sync_to_dev();
-  get_field_out("isccp_ctptau").sync_to_dev();
-  get_field_out("modis_ctptau").sync_to_dev();
-  get_field_out("misr_cthtau").sync_to_dev();
-  get_field_out("cosp_sunlit").sync_to_dev();
 }
 
 // =========================================================================================
 void Cosp::finalize_impl()
 {
+  finish_async_work();
+
   // Finalize COSP wrappers
   CospFunc::finalize();
 }
@@ -5,6 +5,8 @@
 #include "share/util/scream_common_physics_functions.hpp"
 #include "ekat/ekat_parameter_list.hpp"
 
+#include <future>
+#include <map>
 #include <string>
 
 namespace scream
@@ -20,10 +22,19 @@ class Cosp : public AtmosphereProcess
 {
 
 public:
-  using PF  = scream::PhysicsFunctions<HostDevice>;
+  using PF  = scream::PhysicsFunctions<DefaultDevice>;
   using KT  = KokkosTypes<DefaultDevice>;
   using KTH = KokkosTypes<HostDevice>;
 
+  // Host memory that can be written directly from device kernels
+  template<typename DT>
+  using pinned_view = Kokkos::View<DT,Kokkos::LayoutRight,Kokkos::SharedHostPinnedSpace>;
+
+  using host_in_1d  = std::map<std::string,KTH::view_1d<const Real>>;
+  using host_in_2d  = std::map<std::string,KTH::view_2d<const Real>>;
+  using host_out_1d = std::map<std::string,KTH::view_1d<Real>>;
+  using host_out_3d = std::map<std::string,KTH::view_3d<Real>>;
+
   // Constructors
   Cosp (const ekat::Comm& comm, const ekat::ParameterList& params);
 
@@ -36,6 +47,9 @@ public:
   // Set the grid
   void set_grids (const std::shared_ptr<const GridsManager> grids_manager);
 
+  // In async mode, wait for the COSP simulator to finish, and sync outputs to device
+  void finish_async_work ();
+
   inline bool cosp_do(const int icosp, const int nstep) {
       // If icosp == 0, then never do cosp;
       // Otherwise, we always call cosp at the first step,
@@ -61,6 +75,10 @@ public:
 protected:
   void finalize_impl   ();
 
+  // Run the COSP simulator on host data, and remask night values
+  void run_cosp_host (const host_in_1d& in_1d, const host_in_2d& in_2d,
+                      const host_out_1d& out_1d, const host_out_3d& out_3d) const;
+
   // cosp frequency; positive is interpreted as number of steps, negative as number of hours
   int m_cosp_frequency;
   ekat::CaseInsensitiveString m_cosp_frequency_units;
@@ -75,6 +93,18 @@ protected:
 
   std::shared_ptr<const AbstractGrid> m_grid;
 
+  // Heights, computed on device at COSP steps
+  KT::view_2d<Real>                   m_z_mid;
+  KT::view_2d<Real>                   m_z_int;
+  KT::view_2d<Real>::HostMirror       m_z_mid_h;
+
+  // If true, at COSP steps the inputs are copied to pinned host buffers, and the
+  // simulator runs on a host thread, while the following atm procs run on device.
+  bool m_async;
+  std::map<std::string,pinned_view<Real*>>  m_snapshot_1d;
+  std::map<std::string,pinned_view<Real**>> m_snapshot_2d;
+  std::future<void>                         m_cosp_job;
+
 }; // class Cosp
 
 } // namespace scream
@@ -502,6 +502,179 @@ void update_interstitial_aerosols(
   }
 }
 
+// Fused version of copy_view_lev_slice (nc), compute_tke_at_interfaces,
+// compute_subgrid_scale_velocities, the copy of the aitken dry diameter,
+// store_liquid_cloud_fraction and compute_recipical_pseudo_density.
+// The interface values of w_sec and tke are recomputed in registers at
+// each level, rather than stored in global memory (w0 and rho are not
+// used by any of the later stages, so they are not computed).
+void compute_aci_inputs_fused(
+    haero::ThreadTeamPolicy team_policy,
+    const mam_coupling::DryAtmosphere &dry_atmosphere,
+    const MAMAci::const_view_2d wet_nc, const MAMAci::const_view_2d w_sec_mid,
+    const MAMAci::const_view_3d dgnum, const MAMAci::const_view_2d liqcldf,
+    const MAMAci::const_view_2d liqcldf_prev, const Real wsubmin,
+    const int top_lev, const int nlev,
+    // output
+    MAMAci::view_2d nc_inp_to_aci, MAMAci::view_2d wsub,
+    MAMAci::view_2d wsubice, MAMAci::view_2d wsig,
+    MAMAci::view_2d aitken_dry_dia, MAMAci::view_2d cloud_frac,
+    MAMAci::view_2d cloud_frac_prev, MAMAci::view_2d rpdel) {
+  MAMAci::const_view_2d qc   = dry_atmosphere.qc;
+  MAMAci::const_view_2d qi   = dry_atmosphere.qi;
+  MAMAci::const_view_2d pdel = dry_atmosphere.p_del;
+  MAMAci::const_view_2d dz   = dry_atmosphere.dz;
+  const int aitken_idx = static_cast<int>(mam4::ModeIndex::Aitken);
+  Kokkos::parallel_for(
+      team_policy, KOKKOS_LAMBDA(const haero::ThreadTeam &team) {
+        const int icol = team.league_rank();
+        // cut-off for cloud amount (ice or liquid)
+        static constexpr auto qsmall = 1e-18; // BAD_CONSTANT
+
+        // Same as ColumnOps::compute_interface_values_linear, with
+        // bc_top/bc_bot equal to the top/bottom midpoint values
+        auto w_sec_int = [&](const int kk) -> Real {
+          if(kk == 0) return w_sec_mid(icol, 0);
+          if(kk == nlev) return w_sec_mid(icol, nlev - 1);
+          return (w_sec_mid(icol, kk) * dz(icol, kk - 1) +
+                  w_sec_mid(icol, kk - 1) * dz(icol, kk)) /
+                 (dz(icol, kk - 1) + dz(icol, kk));
+        };
+
+        Kokkos::parallel_for(
+            Kokkos::TeamVectorRange(team, nlev), [&](int kk) {
+              // FIXME: Temporary assignment of nc
+              nc_inp_to_aci(icol, kk) = wet_nc(icol, kk);
+
+              // We need dry diameter for only aitken mode
+              aitken_dry_dia(icol, kk) = dgnum(icol, aitken_idx, kk);
+
+              EKAT_KERNEL_ASSERT_MSG(0 < pdel(icol, kk),
+                                     "Error: pdel should be > 0.\n");
+              rpdel(icol, kk) = 1 / pdel(icol, kk);
+
+              if(kk < top_lev) {
+                wsub(icol, kk)    = wsubmin;
+                wsubice(icol, kk) = 0.001;
+                wsig(icol, kk)    = 0.001;
+              } else {
+                const Real tke_k   = (3.0 / 2.0) * w_sec_int(kk);
+                const Real tke_kp1 = (3.0 / 2.0) * w_sec_int(kk + 1);
+                const Real wsub_k =
+                    haero::sqrt(0.5 * (tke_k + tke_kp1) * (2.0 / 3.0));
+                wsig(icol, kk) = mam4::utils::min_max_bound(0.001, 10.0, wsub_k);
+                wsubice(icol, kk) =
+                    mam4::utils::min_max_bound(0.2, 10.0, wsub_k);
+                wsub(icol, kk) = haero::max(wsubmin, wsub_k);
+
+                if((qc(icol, kk) + qi(icol, kk)) > qsmall) {
+                  cloud_frac(icol, kk)      = liqcldf(icol, kk);
+                  cloud_frac_prev(icol, kk) = liqcldf_prev(icol, kk);
+                } else {
+                  cloud_frac(icol, kk)      = 0;
+                  cloud_frac_prev(icol, kk) = 0;
+                }
+              }
+            });
+      });
+}
+
+// Fused version of the ccn copies, update_cloud_borne_aerosols,
+// update_interstitial_aerosols and the postprocess step. The updated dry
+// aerosols are kept in registers and only the wet mixing ratios are stored.
+// NOTE: the dry aerosol state is left untouched, which is fine since it is
+//       recomputed from the (updated) wet state at the next run.
+void update_aerosols_fused(
+    haero::ThreadTeamPolicy team_policy,
+    const mam_coupling::DryAtmosphere &dry_atmosphere,
+    const mam_coupling::AerosolState &dry_aero,
+    const MAMAci::view_2d qqcw_fld_work[mam4::ndrop::ncnst_tot],
+    const MAMAci::view_2d ptend_q[mam4::aero_model::pcnst],
+    const MAMAci::view_3d ccn, const int nlev, const Real dt,
+    // output
+    const mam_coupling::AerosolState &wet_aero,
+    MAMAci::view_2d ccn_out[6]) {
+  using PF = mam_coupling::PF;
+  constexpr int nmodes = mam_coupling::num_aero_modes();
+  constexpr int nspec  = mam_coupling::num_aero_species();
+
+  // Same ordering of qqcw_fld_work and ptend_q as in update_cloud_borne_aerosols
+  // and update_interstitial_aerosols (-1 if the species is not in the mode)
+  struct Indices {
+    int qqcw_nmr[nmodes];
+    int qqcw_mmr[nmodes][nspec];
+    int ptend_nmr[nmodes];
+    int ptend_mmr[nmodes][nspec];
+  } idx;
+  int ind_qqcw = 0;
+  int s_idx    = mam4::aero_model::pcnst - mam4::ndrop::ncnst_tot;
+  for(int m = 0; m < nmodes; ++m) {
+    idx.qqcw_nmr[m] = ind_qqcw++;
+    for(int a = 0; a < nspec; ++a) {
+      idx.qqcw_mmr[m][a]  = dry_aero.cld_aero_mmr[m][a].data() ? ind_qqcw++ : -1;
+      idx.ptend_mmr[m][a] = -1;
+    }
+    for(int a = 0; a < mam4::num_species_mode(m); ++a) {
+      if(dry_aero.int_aero_mmr[m][a].data()) {
+        idx.ptend_mmr[m][a] = s_idx++;
+      }
+    }
+    idx.ptend_nmr[m] = s_idx++;
+  }
+
+  MAMAci::view_2d qqcw[mam4::ndrop::ncnst_tot];
+  for(int i = 0; i < mam4::ndrop::ncnst_tot; ++i) qqcw[i] = qqcw_fld_work[i];
+  MAMAci::view_2d ptend[mam4::aero_model::pcnst];
+  for(int i = 0; i < mam4::aero_model::pcnst; ++i) ptend[i] = ptend_q[i];
+  MAMAci::view_2d ccn_2d[6];
+  for(int i = 0; i < 6; ++i) ccn_2d[i] = ccn_out[i];
+  MAMAci::view_2d qv_dry = dry_atmosphere.qv;
+
+  Kokkos::parallel_for(
+      team_policy, KOKKOS_LAMBDA(const haero::ThreadTeam &team) {
+        const int icol = team.league_rank();
+        Kokkos::parallel_for(
+            Kokkos::TeamVectorRange(team, nlev), [&](int kk) {
+              for(int i = 0; i < 6; ++i) {
+                ccn_2d[i](icol, kk) = ccn(icol, kk, i);
+              }
+              const Real qv_ik = qv_dry(icol, kk);
+              for(int m = 0; m < nmodes; ++m) {
+                // cloud borne aerosols
+                wet_aero.cld_aero_nmr[m](icol, kk) =
+                    PF::calculate_wetmmr_from_drymmr(
+                        qqcw[idx.qqcw_nmr[m]](icol, kk), qv_ik);
+                for(int a = 0; a < nspec; ++a) {
+                  if(idx.qqcw_mmr[m][a] >= 0) {
+                    wet_aero.cld_aero_mmr[m][a](icol, kk) =
+                        PF::calculate_wetmmr_from_drymmr(
+                            qqcw[idx.qqcw_mmr[m][a]](icol, kk), qv_ik);
+                  }
+                }
+                // interstitial aerosols
+                Real nmr = dry_aero.int_aero_nmr[m](icol, kk);
+                nmr += ptend[idx.ptend_nmr[m]](icol, kk) * dt;
+                wet_aero.int_aero_nmr[m](icol, kk) =
+                    PF::calculate_wetmmr_from_drymmr(nmr, qv_ik);
+                for(int a = 0; a < nspec; ++a) {
+                  if(wet_aero.int_aero_mmr[m][a].data()) {
+                    Real mmr = dry_aero.int_aero_mmr[m][a](icol, kk);
+                    if(idx.ptend_mmr[m][a] >= 0) {
+                      mmr += ptend[idx.ptend_mmr[m][a]](icol, kk) * dt;
+                    }
+                    wet_aero.int_aero_mmr[m][a](icol, kk) =
+                        PF::calculate_wetmmr_from_drymmr(mmr, qv_ik);
+                  }
+                }
+              }
+              for(int g = 0; g < mam_coupling::num_aero_gases(); ++g) {
+                wet_aero.gas_mmr[g](icol, kk) = PF::calculate_wetmmr_from_drymmr(
+                    dry_aero.gas_mmr[g](icol, kk), qv_ik);
+              }
+            });
+      });
+}
+
 void call_hetfrz_compute_tendencies(
     haero::ThreadTeamPolicy team_policy, mam4::Hetfrz &hetfrz_,
     mam_coupling::DryAtmosphere &dry_atm_,
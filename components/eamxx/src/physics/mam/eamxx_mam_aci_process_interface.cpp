@@ -283,6 +283,7 @@ void MAMAci::initialize_impl(const RunType run_type) {
 
   wsubmin_ = m_params.get<double>("wsubmin");
   top_lev_ = m_params.get<int>("top_level_mam4xx");
+  fused_pipeline_ = m_params.get<bool>("fused_pipeline", false);
 
   // ------------------------------------------------------------------------
   // Input fields read in from IC file, namelist or other processes
@@ -308,31 +309,26 @@ void MAMAci::initialize_impl(const RunType run_type) {
   dry_atm_.p_del = get_field_in("pseudo_density").get_view<const Real **>();
   dry_atm_.omega = get_field_in("omega").get_view<const Real **>();
 
-  // store fields converted to dry mmr from wet mmr in dry_atm_
-  dry_atm_.qv = buffer_.qv_dry;
-  dry_atm_.qc = buffer_.qc_dry;
-  dry_atm_.nc = buffer_.nc_dry;
-  dry_atm_.qi = buffer_.qi_dry;
-  dry_atm_.ni = buffer_.ni_dry;
+  // fields converted to dry mmr from wet mmr, geometric thickness of layers,
+  // geopotential heights (at interface and mid levels) and updraft velocity
+  // are stored in the dry state cache, shared with other MAM processes
+  dry_state_cache_ =
+      mam_coupling::DryStateCache::get_instance(grid_->name(), ncol_, nlev_);
+  dry_state_cache_->set_views(dry_atm_);
+  dry_state_cache_->set_views(dry_aero_);
+  dry_atm_inputs_ = {get_field_in("qv"),    get_field_in("qc"),
+                     get_field_in("nc"),    get_field_in("qi"),
+                     get_field_in("ni"),    get_field_in("T_mid"),
+                     get_field_in("p_mid"), get_field_in("pseudo_density")};
+  dry_updraft_inputs_ = {get_field_in("omega")};
+  dry_aero_inputs_ = {get_field_in("qv")};
 
   // pbl_height
   dry_atm_.pblh = get_field_in("pbl_height").get_view<const Real *>();
 
-  // geometric thickness of layers (m)
-  dry_atm_.dz = buffer_.dz;
-
-  // geopotential height above surface at interface levels (m)
-  dry_atm_.z_iface = buffer_.z_iface;
-
-  // geopotential height above surface at mid levels (m)
-  dry_atm_.z_mid = buffer_.z_mid;
-
   // total cloud fraction
   dry_atm_.cldfrac = get_field_in("cldfrac_tot").get_view<const Real **>();
 
-  // computed updraft velocity
-  dry_atm_.w_updraft = buffer_.w_updraft;
-
   // ------------------------------------------------------------------------
   // Output fields to be used by other processes
   // ------------------------------------------------------------------------
@@ -349,13 +345,13 @@ void MAMAci::initialize_impl(const RunType run_type) {
     const char *int_nmr_field_name = mam_coupling::int_aero_nmr_field_name(m);
     wet_aero_.int_aero_nmr[m] =
         get_field_out(int_nmr_field_name).get_view<Real **>();
-    dry_aero_.int_aero_nmr[m] = buffer_.dry_int_aero_nmr[m];
+    dry_aero_inputs_.push_back(get_field_out(int_nmr_field_name));
 
     // cloudborne aerosol tracers of interest: number (n) mixing ratios
     const char *cld_nmr_field_name = mam_coupling::cld_aero_nmr_field_name(m);
     wet_aero_.cld_aero_nmr[m] =
         get_field_out(cld_nmr_field_name).get_view<Real **>();
-    dry_aero_.cld_aero_nmr[m] = buffer_.dry_cld_aero_nmr[m];
+    dry_aero_inputs_.push_back(get_field_out(cld_nmr_field_name));
 
     for(int a = 0; a < mam_coupling::num_aero_species(); ++a) {
       // (interstitial) aerosol tracers of interest: mass (q) mixing ratios
@@ -365,7 +361,7 @@ void MAMAci::initialize_impl(const RunType run_type) {
       if(strlen(int_mmr_field_name) > 0) {
         wet_aero_.int_aero_mmr[m][a] =
             get_field_out(int_mmr_field_name).get_view<Real **>();
-        dry_aero_.int_aero_mmr[m][a] = buffer_.dry_int_aero_mmr[m][a];
+        dry_aero_inputs_.push_back(get_field_out(int_mmr_field_name));
       }
 
       // (cloudborne) aerosol tracers of interest: mass (q) mixing ratios
@@ -374,7 +370,7 @@ void MAMAci::initialize_impl(const RunType run_type) {
       if(strlen(cld_mmr_field_name) > 0) {
         wet_aero_.cld_aero_mmr[m][a] =
             get_field_out(cld_mmr_field_name).get_view<Real **>();
-        dry_aero_.cld_aero_mmr[m][a] = buffer_.dry_cld_aero_mmr[m][a];
+        dry_aero_inputs_.push_back(get_field_out(cld_mmr_field_name));
       }
     }
   }
@@ -382,7 +378,7 @@ void MAMAci::initialize_impl(const RunType run_type) {
     const char *gas_mmr_field_name = mam_coupling::gas_mmr_field_name(g);
     wet_aero_.gas_mmr[g] =
         get_field_out(gas_mmr_field_name).get_view<Real **>();
-    dry_aero_.gas_mmr[g] = buffer_.dry_gas_mmr[g];
+    dry_aero_inputs_.push_back(get_field_out(gas_mmr_field_name));
   }
 
   // hetrozenous freezing outputs
@@ -398,9 +394,13 @@ void MAMAci::initialize_impl(const RunType run_type) {
   // (Kokkos::resize only works on host to allocates memory)
   //---------------------------------------------------------------------------------
 
-  Kokkos::resize(rho_, ncol_, nlev_);
-  Kokkos::resize(w0_, ncol_, nlev_);
-  Kokkos::resize(tke_, ncol_, nlev_ + 1);
+  // The fused pipeline does not store w0, rho, tke and w_sec at interfaces
+  if(not fused_pipeline_) {
+    Kokkos::resize(rho_, ncol_, nlev_);
+    Kokkos::resize(w0_, ncol_, nlev_);
+    Kokkos::resize(tke_, ncol_, nlev_ + 1);
+    Kokkos::resize(w_sec_int_, ncol_, nlev_ + 1);
+  }
   Kokkos::resize(wsub_, ncol_, nlev_);
   Kokkos::resize(wsubice_, ncol_, nlev_);
   Kokkos::resize(wsig_, ncol_, nlev_);
@@ -501,8 +501,6 @@ void MAMAci::initialize_impl(const RunType run_type) {
   // Eddy diffusivity of heat at the interfaces
   Kokkos::resize(kvh_int_, ncol_, nlev_ + 1);
 
-  // Vertical velocity variance at the interfaces
-  Kokkos::resize(w_sec_int_, ncol_, nlev_ + 1);
   // Allocate work arrays
   for(int icnst = 0; icnst < mam4::ndrop::ncnst_tot; ++icnst) {
     qqcw_fld_work_[icnst] = view_2d("qqcw_fld_work_", ncol_, nlev_);
@@ -550,35 +548,59 @@ void MAMAci::run_impl(const double dt) {
       KT::ExeSpace>::get_thread_range_parallel_scan_team_policy(ncol_, nlev_);
 
   // preprocess input -- needs a scan for the calculation of local derivied
-  // quantities
-  Kokkos::parallel_for("preprocess", scan_policy, preprocess_);
-  Kokkos::fence();
+  // quantities. Dry states that are current in the shared cache are reused.
+  using DSC = mam_coupling::DryStateCache;
+  preprocess_.update_atm_ =
+      not dry_state_cache_->is_current(DSC::Atm, dry_atm_inputs_);
+  preprocess_.update_updraft_ =
+      not dry_state_cache_->is_current(DSC::Updraft, dry_updraft_inputs_);
+  preprocess_.update_aero_ =
+      not dry_state_cache_->is_current(DSC::Aero, dry_aero_inputs_);
+  if(preprocess_.update_atm_ or preprocess_.update_updraft_ or
+     preprocess_.update_aero_) {
+    Kokkos::parallel_for("preprocess", scan_policy, preprocess_);
+    Kokkos::fence();
+    dry_state_cache_->set_current(DSC::Atm, dry_atm_inputs_);
+    dry_state_cache_->set_current(DSC::Updraft, dry_updraft_inputs_);
+    dry_state_cache_->set_current(DSC::Aero, dry_aero_inputs_);
+  }
 
   haero::ThreadTeamPolicy team_policy(ncol_, Kokkos::AUTO);
 
-  // FIXME: Temporary assignment of nc
-  mam_coupling::copy_view_lev_slice(team_policy, wet_atm_.nc, nlev_,  // inputs
-                                    nc_inp_to_aci_);                  // output
-
-  compute_w0_and_rho(team_policy, dry_atm_, top_lev_, nlev_,
-                     // output
-                     w0_, rho_);
-
-  compute_tke_at_interfaces(team_policy, w_sec_mid_, dry_atm_.dz, nlev_, w_sec_int_,
-                            // output
-                            tke_);
+  if(fused_pipeline_) {
+    compute_aci_inputs_fused(team_policy, dry_atm_, wet_atm_.nc, w_sec_mid_,
+                             dgnum_, liqcldf_, liqcldf_prev_, wsubmin_,
+                             top_lev_, nlev_,
+                             // output
+                             nc_inp_to_aci_, wsub_, wsubice_, wsig_,
+                             aitken_dry_dia_, cloud_frac_, cloud_frac_prev_,
+                             rpdel_);
+    Kokkos::fence();  // wait for the inputs of the ACI stages to be computed.
+  } else {
+    // FIXME: Temporary assignment of nc
+    mam_coupling::copy_view_lev_slice(team_policy, wet_atm_.nc, nlev_,  // inputs
+                                      nc_inp_to_aci_);                  // output
+
+    compute_w0_and_rho(team_policy, dry_atm_, top_lev_, nlev_,
+                       // output
+                       w0_, rho_);
+
+    compute_tke_at_interfaces(team_policy, w_sec_mid_, dry_atm_.dz, nlev_, w_sec_int_,
+                              // output
+                              tke_);
 
-  Kokkos::fence();  // wait for tke_ to be computed.
-  compute_subgrid_scale_velocities(team_policy, tke_, wsubmin_, top_lev_, nlev_,
-                                   // output
-                                   wsub_, wsubice_, wsig_);
+    Kokkos::fence();  // wait for tke_ to be computed.
+    compute_subgrid_scale_velocities(team_policy, tke_, wsubmin_, top_lev_, nlev_,
+                                     // output
+                                     wsub_, wsubice_, wsig_);
 
-  // We need dry diameter for only aitken mode
-  Kokkos::deep_copy(
-      aitken_dry_dia_,
-      ekat::subview_1(dgnum_, static_cast<int>(mam4::ModeIndex::Aitken)));
+    // We need dry diameter for only aitken mode
+    Kokkos::deep_copy(
+        aitken_dry_dia_,
+        ekat::subview_1(dgnum_, static_cast<int>(mam4::ModeIndex::Aitken)));
 
-  Kokkos::fence();  // wait for aitken_dry_dia_ to be copied.
+    Kokkos::fence();  // wait for aitken_dry_dia_ to be copied.
+  }
 
   //  Compute Ice nucleation
   //  NOTE: The Fortran version uses "ast" for cloud fraction which is
@@ -591,17 +613,19 @@ void MAMAci::run_impl(const double dt) {
       // ## output to be used by the other processes ##
       naai_);
 
-  // Compute cloud fractions based on cloud threshold
-  store_liquid_cloud_fraction(team_policy, dry_atm_, liqcldf_, liqcldf_prev_,
-                              top_lev_, nlev_,
-                              // output
-                              cloud_frac_, cloud_frac_prev_);
+  if(not fused_pipeline_) {
+    // Compute cloud fractions based on cloud threshold
+    store_liquid_cloud_fraction(team_policy, dry_atm_, liqcldf_, liqcldf_prev_,
+                                top_lev_, nlev_,
+                                // output
+                                cloud_frac_, cloud_frac_prev_);
 
-  mam_coupling::compute_recipical_pseudo_density(team_policy, dry_atm_.p_del, nlev_,
-                                   // output
-                                   rpdel_);
+    mam_coupling::compute_recipical_pseudo_density(team_policy, dry_atm_.p_del, nlev_,
+                                     // output
+                                     rpdel_);
 
-  Kokkos::fence();  // wait for rpdel_ to be computed.
+    Kokkos::fence();  // wait for rpdel_ to be computed.
+  }
 
   //  Compute activated CCN number tendency (tendnd_) and updated
   //  cloud borne aerosols (stored in a work array) and interstitial
@@ -618,19 +642,6 @@ void MAMAci::run_impl(const double dt) {
                            dropmixnuc_scratch_mem_);
   Kokkos::fence();  // wait for ptend_q_ to be computed.
 
-  Kokkos::deep_copy(ccn_0p02_,
-                    Kokkos::subview(ccn_, Kokkos::ALL(), Kokkos::ALL(), 0));
-  Kokkos::deep_copy(ccn_0p05_,
-                    Kokkos::subview(ccn_, Kokkos::ALL(), Kokkos::ALL(), 1));
-  Kokkos::deep_copy(ccn_0p1_,
-                    Kokkos::subview(ccn_, Kokkos::ALL(), Kokkos::ALL(), 2));
-  Kokkos::deep_copy(ccn_0p2_,
-                    Kokkos::subview(ccn_, Kokkos::ALL(), Kokkos::ALL(), 3));
-  Kokkos::deep_copy(ccn_0p5_,
-                    Kokkos::subview(ccn_, Kokkos::ALL(), Kokkos::ALL(), 4));
-  Kokkos::deep_copy(ccn_1p0_,
-                    Kokkos::subview(ccn_, Kokkos::ALL(), Kokkos::ALL(), 5));
-
   //---------------------------------------------------------------------------
   //  NOTE: DO NOT UPDATE cloud borne aerosols using the qqcw_fld_work_ array
   //  at this point as heterozenous freezing needs to use cloud borne aerosols
@@ -646,6 +657,32 @@ void MAMAci::run_impl(const double dt) {
       // work arrays
       diagnostic_scratch_);
 
+  if(fused_pipeline_) {
+    // Update ccn outputs, cloud borne and interstitial aerosols, and convert
+    // dry mixing ratios to wet mixing ratios
+    view_2d ccn_out[6] = {ccn_0p02_, ccn_0p05_, ccn_0p1_,
+                          ccn_0p2_,  ccn_0p5_,  ccn_1p0_};
+    update_aerosols_fused(team_policy, dry_atm_, dry_aero_, qqcw_fld_work_,
+                          ptend_q_, ccn_, nlev_, dt,
+                          // output
+                          wet_aero_, ccn_out);
+    Kokkos::fence();  // wait before returning to calling function
+    return;
+  }
+
+  Kokkos::deep_copy(ccn_0p02_,
+                    Kokkos::subview(ccn_, Kokkos::ALL(), Kokkos::ALL(), 0));
+  Kokkos::deep_copy(ccn_0p05_,
+                    Kokkos::subview(ccn_, Kokkos::ALL(), Kokkos::ALL(), 1));
+  Kokkos::deep_copy(ccn_0p1_,
+                    Kokkos::subview(ccn_, Kokkos::ALL(), Kokkos::ALL(), 2));
+  Kokkos::deep_copy(ccn_0p2_,
+                    Kokkos::subview(ccn_, Kokkos::ALL(), Kokkos::ALL(), 3));
+  Kokkos::deep_copy(ccn_0p5_,
+                    Kokkos::subview(ccn_, Kokkos::ALL(), Kokkos::ALL(), 4));
+  Kokkos::deep_copy(ccn_1p0_,
+                    Kokkos::subview(ccn_, Kokkos::ALL(), Kokkos::ALL(), 5));
+
   //---------------------------------------------------------------
   // Now update interstitial and cloud borne aerosols
   //---------------------------------------------------------------
@@ -3,6 +3,7 @@
 
 // For MAM4 aerosol configuration
 #include <physics/mam/mam_coupling.hpp>
+#include <physics/mam/mam_dry_state_cache.hpp>
 
 // For declaring ACI class derived from atm process class
 #include <share/atm_process/atmosphere_process.hpp>
@@ -44,6 +45,10 @@ class MAMAci final : public scream::AtmosphereProcess {
   Real wsubmin_;  // Minimum subgrid vertical velocity
   int top_lev_;   // Top level for MAM4xx
 
+  // If true, the column-local stages before ice nucleation and after
+  // hetrozenous freezing are run as single fused kernels
+  bool fused_pipeline_;
+
   //------------------------------------------------------------------------
   // END: ACI runtime ( or namelist) options
   //------------------------------------------------------------------------
@@ -145,6 +150,12 @@ class MAMAci final : public scream::AtmosphereProcess {
   // workspace manager for internal local variables
   mam_coupling::Buffer buffer_;
 
+  // dry atmosphere and aerosol states, shared with other MAM processes
+  std::shared_ptr<mam_coupling::DryStateCache> dry_state_cache_;
+
+  // fields the dry atmosphere and aerosol states are computed from
+  std::vector<Field> dry_atm_inputs_, dry_updraft_inputs_, dry_aero_inputs_;
+
   // physics grid for column information
   std::shared_ptr<const AbstractGrid> grid_;
 
@@ -204,20 +215,33 @@ class MAMAci final : public scream::AtmosphereProcess {
         const Kokkos::TeamPolicy<KT::ExeSpace>::member_type &team) const {
       const int i = team.league_rank();  // column index
 
-      compute_dry_mixing_ratios(team, wet_atm_pre_, dry_atm_pre_, i);
-      compute_dry_mixing_ratios(team, wet_atm_pre_, wet_aero_pre_,
-                                dry_aero_pre_, i);
+      if (update_atm_) {
+        compute_dry_mixing_ratios(team, wet_atm_pre_, dry_atm_pre_, i);
+      }
+      if (update_aero_) {
+        compute_dry_mixing_ratios(team, wet_atm_pre_, wet_aero_pre_,
+                                  dry_aero_pre_, i);
+      }
       team.team_barrier();
       // vertical heights has to be computed after computing dry mixing ratios
       // for atmosphere
-      compute_vertical_layer_heights(team, dry_atm_pre_, i);
-      compute_updraft_velocities(team, wet_atm_pre_, dry_atm_pre_, i);
+      if (update_atm_) {
+        compute_vertical_layer_heights(team, dry_atm_pre_, i);
+      }
+      if (update_atm_ or update_updraft_) {
+        compute_updraft_velocities(team, wet_atm_pre_, dry_atm_pre_, i);
+      }
     }  // operator()
 
     // local variables for preprocess struct
     // number of horizontal columns and vertical levels
     int ncol_pre_, nlev_pre_;
 
+    // dry states to be (re)computed (see mam_dry_state_cache.hpp)
+    bool update_atm_     = true;
+    bool update_updraft_ = true;
+    bool update_aero_    = true;
+
     // local atmospheric and aerosol state data
     mam_coupling::WetAtmosphere wet_atm_pre_;
     mam_coupling::DryAtmosphere dry_atm_pre_;
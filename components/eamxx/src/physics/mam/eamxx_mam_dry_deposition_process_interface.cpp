@@ -261,17 +261,19 @@ void MAMDryDep::initialize_impl(const RunType run_type) {
   dry_atm_.pblh    = get_field_in("pbl_height").get_view<const Real *>();
   dry_atm_.omega   = get_field_in("omega").get_view<const Real **>();
 
-  // store fields converted to dry mmr from wet mmr in dry_atm_
-  dry_atm_.z_mid     = buffer_.z_mid;
-  dry_atm_.z_iface   = buffer_.z_iface;
-  dry_atm_.dz        = buffer_.dz;
-  dry_atm_.qv        = buffer_.qv_dry;
-  dry_atm_.qc        = buffer_.qc_dry;
-  dry_atm_.nc        = buffer_.nc_dry;
-  dry_atm_.qi        = buffer_.qi_dry;
-  dry_atm_.ni        = buffer_.ni_dry;
-  dry_atm_.w_updraft = buffer_.w_updraft;
-  dry_atm_.z_surf    = 0.0;  // FIXME: for now
+  // store fields converted to dry mmr from wet mmr (and the other derived
+  // quantities) in the dry state cache, shared with other MAM processes
+  dry_state_cache_ =
+      mam_coupling::DryStateCache::get_instance(grid_->name(), ncol_, nlev_);
+  dry_state_cache_->set_views(dry_atm_);
+  dry_state_cache_->set_views(dry_aero_);
+  dry_atm_inputs_ = {get_field_in("qv"),    get_field_in("qc"),
+                     get_field_in("nc"),    get_field_in("qi"),
+                     get_field_in("ni"),    get_field_in("T_mid"),
+                     get_field_in("p_mid"), get_field_in("pseudo_density")};
+  dry_updraft_inputs_ = {get_field_in("omega")};
+  dry_aero_inputs_ = {get_field_in("qv")};
+  dry_atm_.z_surf  = 0.0;  // FIXME: for now
 
   // ---- set wet/dry aerosol-related gas state data
   for(int m = 0; m < mam_coupling::num_aero_modes(); ++m) {
@@ -279,13 +281,13 @@ void MAMDryDep::initialize_impl(const RunType run_type) {
     const char *int_nmr_field_name = mam_coupling::int_aero_nmr_field_name(m);
     wet_aero_.int_aero_nmr[m] =
         get_field_out(int_nmr_field_name).get_view<Real **>();
-    dry_aero_.int_aero_nmr[m] = buffer_.dry_int_aero_nmr[m];
+    dry_aero_inputs_.push_back(get_field_out(int_nmr_field_name));
 
     // cloudborne aerosol tracers of interest: number (n) mixing ratios
     const char *cld_nmr_field_name = mam_coupling::cld_aero_nmr_field_name(m);
     wet_aero_.cld_aero_nmr[m] =
         get_field_out(cld_nmr_field_name).get_view<Real **>();
-    dry_aero_.cld_aero_nmr[m] = buffer_.dry_cld_aero_nmr[m];
+    dry_aero_inputs_.push_back(get_field_out(cld_nmr_field_name));
 
     for(int a = 0; a < mam_coupling::num_aero_species(); ++a) {
       // (interstitial) aerosol tracers of interest: mass (q) mixing ratios
@@ -294,7 +296,7 @@ void MAMDryDep::initialize_impl(const RunType run_type) {
       if(strlen(int_mmr_field_name) > 0) {
         wet_aero_.int_aero_mmr[m][a] =
             get_field_out(int_mmr_field_name).get_view<Real **>();
-        dry_aero_.int_aero_mmr[m][a] = buffer_.dry_int_aero_mmr[m][a];
+        dry_aero_inputs_.push_back(get_field_out(int_mmr_field_name));
       }
 
       // (cloudborne) aerosol tracers of interest: mass (q) mixing ratios
@@ -303,7 +305,7 @@ void MAMDryDep::initialize_impl(const RunType run_type) {
       if(strlen(cld_mmr_field_name) > 0) {
         wet_aero_.cld_aero_mmr[m][a] =
             get_field_out(cld_mmr_field_name).get_view<Real **>();
-        dry_aero_.cld_aero_mmr[m][a] = buffer_.dry_cld_aero_mmr[m][a];
+        dry_aero_inputs_.push_back(get_field_out(cld_mmr_field_name));
       }
     }
   }
@@ -311,7 +313,7 @@ void MAMDryDep::initialize_impl(const RunType run_type) {
     const char *gas_mmr_field_name = mam_coupling::gas_mmr_field_name(g);
     wet_aero_.gas_mmr[g] =
         get_field_out(gas_mmr_field_name).get_view<Real **>();
-    dry_aero_.gas_mmr[g] = buffer_.dry_gas_mmr[g];
+    dry_aero_inputs_.push_back(get_field_out(gas_mmr_field_name));
   }
 
   //-----------------------------------------------------------------
@@ -368,8 +370,22 @@ void MAMDryDep::run_impl(const double dt) {
       KT::ExeSpace>::get_thread_range_parallel_scan_team_policy(ncol_, nlev_);
 
   // preprocess input -- needs a scan for the calculation of atm height
-  Kokkos::parallel_for("preprocess", scan_policy, preprocess_);
-  Kokkos::fence();
+  // Dry states that are current in the shared cache are not recomputed.
+  using DSC = mam_coupling::DryStateCache;
+  preprocess_.update_atm_ =
+      not dry_state_cache_->is_current(DSC::Atm, dry_atm_inputs_);
+  preprocess_.update_updraft_ =
+      not dry_state_cache_->is_current(DSC::Updraft, dry_updraft_inputs_);
+  preprocess_.update_aero_ =
+      not dry_state_cache_->is_current(DSC::Aero, dry_aero_inputs_);
+  if(preprocess_.update_atm_ or preprocess_.update_updraft_ or
+     preprocess_.update_aero_) {
+    Kokkos::parallel_for("preprocess", scan_policy, preprocess_);
+    Kokkos::fence();
+    dry_state_cache_->set_current(DSC::Atm, dry_atm_inputs_);
+    dry_state_cache_->set_current(DSC::Updraft, dry_updraft_inputs_);
+    dry_state_cache_->set_current(DSC::Aero, dry_aero_inputs_);
+  }
 
   // -------------------------------------------------------------
   // Inputs fields for the process
@@ -6,6 +6,7 @@
 
 // For MAM4 aerosol configuration
 #include <physics/mam/mam_coupling.hpp>
+#include <physics/mam/mam_dry_state_cache.hpp>
 
 // For component name
 #include <string>
@@ -42,6 +43,12 @@ class MAMDryDep final : public scream::AtmosphereProcess {
   // buffer for sotring temporary variables
   mam_coupling::Buffer buffer_;
 
+  // dry atmosphere and aerosol states, shared with other MAM processes
+  std::shared_ptr<mam_coupling::DryStateCache> dry_state_cache_;
+
+  // fields the dry atmosphere and aerosol states are computed from
+  std::vector<Field> dry_atm_inputs_, dry_updraft_inputs_, dry_aero_inputs_;
+
   // physics grid for column information
   std::shared_ptr<const AbstractGrid> grid_;
 
@@ -170,20 +177,33 @@ class MAMDryDep final : public scream::AtmosphereProcess {
         const Kokkos::TeamPolicy<KT::ExeSpace>::member_type &team) const {
       const int i = team.league_rank();  // column index
 
-      compute_dry_mixing_ratios(team, wet_atm_pre_, dry_atm_pre_, i);
-      compute_dry_mixing_ratios(team, wet_atm_pre_, wet_aero_pre_,
-                                dry_aero_pre_, i);
+      if (update_atm_) {
+        compute_dry_mixing_ratios(team, wet_atm_pre_, dry_atm_pre_, i);
+      }
+      if (update_aero_) {
+        compute_dry_mixing_ratios(team, wet_atm_pre_, wet_aero_pre_,
+                                  dry_aero_pre_, i);
+      }
       team.team_barrier();
       // vertical heights has to be computed after computing dry mixing ratios
       // for atmosphere
-      compute_vertical_layer_heights(team, dry_atm_pre_, i);
-      compute_updraft_velocities(team, wet_atm_pre_, dry_atm_pre_, i);
+      if (update_atm_) {
+        compute_vertical_layer_heights(team, dry_atm_pre_, i);
+      }
+      if (update_atm_ or update_updraft_) {
+        compute_updraft_velocities(team, wet_atm_pre_, dry_atm_pre_, i);
+      }
     }  // Preprocess operator()
 
     // local variables for preprocess struct
     // number of horizontal columns and vertical levels
     int ncol_pre_, nlev_pre_;
 
+    // dry states to be (re)computed (see mam_dry_state_cache.hpp)
+    bool update_atm_     = true;
+    bool update_updraft_ = true;
+    bool update_aero_    = true;
+
     // local atmospheric and aerosol state data
     mam_coupling::WetAtmosphere wet_atm_pre_;
     mam_coupling::DryAtmosphere dry_atm_pre_;
@@ -6,6 +6,7 @@
 #include <mam4xx/mam4.hpp>
 #include <physics/mam/mam_aerosol_optics_read_tables.hpp>
 #include <physics/mam/mam_coupling.hpp>
+#include <physics/mam/mam_dry_state_cache.hpp>
 #include <share/atm_process/ATMBufferManager.hpp>
 #include <share/atm_process/atmosphere_process.hpp>
 #include <share/util/scream_common_physics_functions.hpp>
@@ -90,17 +91,31 @@ class MAMOptics final : public scream::AtmosphereProcess {
         const Kokkos::TeamPolicy<KT::ExeSpace>::member_type &team) const {
       const int i = team.league_rank();  // column index
       // first, compute dry fields
-      compute_dry_mixing_ratios(team, wet_atm_, dry_atm_, i);
-      compute_dry_mixing_ratios(team, wet_atm_, wet_aero_, dry_aero_, i);
+      if (update_atm_) {
+        compute_dry_mixing_ratios(team, wet_atm_, dry_atm_, i);
+      }
+      if (update_aero_) {
+        compute_dry_mixing_ratios(team, wet_atm_, wet_aero_,
+                                  dry_aero_, i);
+      }
       team.team_barrier();
       // second, we can use dry fields to compute dz, zmin, zint
-      compute_vertical_layer_heights(team, dry_atm_, i);
-      compute_updraft_velocities(team, wet_atm_, dry_atm_, i);
+      if (update_atm_) {
+        compute_vertical_layer_heights(team, dry_atm_, i);
+      }
+      if (update_atm_ or update_updraft_) {
+        compute_updraft_velocities(team, wet_atm_, dry_atm_, i);
+      }
     }  // operator()
 
     // number of horizontal columns and vertical levels
     int ncol_, nlev_;
 
+    // dry states to be (re)computed (see mam_dry_state_cache.hpp)
+    bool update_atm_     = true;
+    bool update_updraft_ = true;
+    bool update_aero_    = true;
+
     // local atmospheric and aerosol state data
     mam_coupling::WetAtmosphere wet_atm_;
     mam_coupling::DryAtmosphere dry_atm_;
@@ -180,6 +195,12 @@ class MAMOptics final : public scream::AtmosphereProcess {
   mam_coupling::view_int_1d get_idx_rrtmgp_from_rrtmg_swbands_;
 
   mam_coupling::Buffer buffer_;
+
+  // dry atmosphere and aerosol states, shared with other MAM processes
+  std::shared_ptr<mam_coupling::DryStateCache> dry_state_cache_;
+
+  // fields the dry atmosphere and aerosol states are computed from
+  std::vector<Field> dry_atm_inputs_, dry_updraft_inputs_, dry_aero_inputs_;
 };  // MAMOptics
 
 }  // namespace scream
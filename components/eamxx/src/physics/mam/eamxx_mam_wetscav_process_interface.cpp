@@ -281,22 +281,24 @@ void MAMWetscav::initialize_impl(const RunType run_type) {
   dry_atm_.pblh  = get_field_in("pbl_height").get_view<const Real *>();
   dry_atm_.phis  = get_field_in("phis").get_view<const Real *>();
 
-  // store fields converted to dry mmr from wet mmr in dry_atm_
-  dry_atm_.qv        = buffer_.qv_dry;
-  dry_atm_.qc        = buffer_.qc_dry;
-  dry_atm_.nc        = buffer_.nc_dry;
-  dry_atm_.qi        = buffer_.qi_dry;
-  dry_atm_.ni        = buffer_.ni_dry;
-  dry_atm_.z_mid     = buffer_.z_mid;
-  dry_atm_.dz        = buffer_.dz;
-  dry_atm_.z_iface   = buffer_.z_iface;
-  dry_atm_.w_updraft = buffer_.w_updraft;
+  // store fields converted to dry mmr from wet mmr (and the other derived
+  // quantities) in the dry state cache, shared with other MAM processes
+  dry_state_cache_ =
+      mam_coupling::DryStateCache::get_instance(m_grid->name(), ncol_, nlev_);
+  dry_state_cache_->set_views(dry_atm_);
+  dry_state_cache_->set_views(dry_aero_);
+  dry_atm_inputs_ = {get_field_in("qv"),    get_field_in("qc"),
+                     get_field_in("nc"),    get_field_in("qi"),
+                     get_field_in("ni"),    get_field_in("T_mid"),
+                     get_field_in("p_mid"), get_field_in("pseudo_density")};
+  dry_updraft_inputs_ = {get_field_in("omega")};
+  dry_aero_inputs_ = {get_field_in("qv")};
 
   // ---- set wet/dry aerosol-related gas state data
   for(int g = 0; g < mam_coupling::num_aero_gases(); ++g) {
     const char *mmr_field_name = mam_coupling::gas_mmr_field_name(g);
     wet_aero_.gas_mmr[g] = get_field_out(mmr_field_name).get_view<Real **>();
-    dry_aero_.gas_mmr[g] = buffer_.dry_gas_mmr[g];
+    dry_aero_inputs_.push_back(get_field_out(mmr_field_name));
   }
 
   // set wet/dry aerosol state data (interstitial aerosols only)
@@ -305,13 +307,13 @@ void MAMWetscav::initialize_impl(const RunType run_type) {
         mam_coupling::int_aero_nmr_field_name(imode);
     wet_aero_.int_aero_nmr[imode] =
         get_field_out(int_nmr_field_name).get_view<Real **>();
-    dry_aero_.int_aero_nmr[imode] = buffer_.dry_int_aero_nmr[imode];
+    dry_aero_inputs_.push_back(get_field_out(int_nmr_field_name));
 
     const char *cld_nmr_field_name =
         mam_coupling::cld_aero_nmr_field_name(imode);
     wet_aero_.cld_aero_nmr[imode] =
         get_field_out(cld_nmr_field_name).get_view<Real **>();
-    dry_aero_.cld_aero_nmr[imode] = wet_aero_.cld_aero_nmr[imode];
+    dry_aero_inputs_.push_back(get_field_out(cld_nmr_field_name));
 
     for(int ispec = 0; ispec < mam_coupling::num_aero_species(); ++ispec) {
       const char *int_mmr_field_name =
@@ -319,8 +321,7 @@ void MAMWetscav::initialize_impl(const RunType run_type) {
       if(strlen(int_mmr_field_name) > 0) {
         wet_aero_.int_aero_mmr[imode][ispec] =
             get_field_out(int_mmr_field_name).get_view<Real **>();
-        dry_aero_.int_aero_mmr[imode][ispec] =
-            buffer_.dry_int_aero_mmr[imode][ispec];
+        dry_aero_inputs_.push_back(get_field_out(int_mmr_field_name));
       }
 
       const char *cld_mmr_field_name =
@@ -328,8 +329,7 @@ void MAMWetscav::initialize_impl(const RunType run_type) {
       if(strlen(cld_mmr_field_name) > 0) {
         wet_aero_.cld_aero_mmr[imode][ispec] =
             get_field_out(cld_mmr_field_name).get_view<Real **>();
-        dry_aero_.cld_aero_mmr[imode][ispec] =
-            buffer_.dry_cld_aero_mmr[imode][ispec];
+        dry_aero_inputs_.push_back(get_field_out(cld_mmr_field_name));
       }
     }
   }
@@ -414,8 +414,22 @@ void MAMWetscav::run_impl(const double dt) {
 
   // preprocess input -- needs a scan for the calculation of all variables
   // needed by this process or setting up MAM4xx classes and their objects
-  Kokkos::parallel_for("preprocess", scan_policy, preprocess_);
-  Kokkos::fence();
+  // Dry states that are current in the shared cache are not recomputed.
+  using DSC = mam_coupling::DryStateCache;
+  preprocess_.update_atm_ =
+      not dry_state_cache_->is_current(DSC::Atm, dry_atm_inputs_);
+  preprocess_.update_updraft_ =
+      not dry_state_cache_->is_current(DSC::Updraft, dry_updraft_inputs_);
+  preprocess_.update_aero_ =
+      not dry_state_cache_->is_current(DSC::Aero, dry_aero_inputs_);
+  if(preprocess_.update_atm_ or preprocess_.update_updraft_ or
+     preprocess_.update_aero_) {
+    Kokkos::parallel_for("preprocess", scan_policy, preprocess_);
+    Kokkos::fence();
+    dry_state_cache_->set_current(DSC::Atm, dry_atm_inputs_);
+    dry_state_cache_->set_current(DSC::Updraft, dry_updraft_inputs_);
+    dry_state_cache_->set_current(DSC::Aero, dry_aero_inputs_);
+  }
 
   const mam_coupling::DryAtmosphere &dry_atm = dry_atm_;
   const auto &dry_aero                       = dry_aero_;
@@ -3,6 +3,7 @@
 
 // For MAM4 aerosol configuration
 #include <physics/mam/mam_coupling.hpp>
+#include <physics/mam/mam_dry_state_cache.hpp>
 
 // For declaring wetscav class derived from atm process class
 #include "share/atm_process/atmosphere_process.hpp"
@@ -83,13 +84,21 @@ class MAMWetscav : public scream::AtmosphereProcess {
         const Kokkos::TeamPolicy<KT::ExeSpace>::member_type &team) const {
       const int i = team.league_rank();  // column index
       // first, compute dry fields
-      compute_dry_mixing_ratios(team, wet_atm_pre_, dry_atm_pre_, i);
-      compute_dry_mixing_ratios(team, wet_atm_pre_, wet_aero_pre_,
-                                dry_aero_pre_, i);
+      if (update_atm_) {
+        compute_dry_mixing_ratios(team, wet_atm_pre_, dry_atm_pre_, i);
+      }
+      if (update_aero_) {
+        compute_dry_mixing_ratios(team, wet_atm_pre_, wet_aero_pre_,
+                                  dry_aero_pre_, i);
+      }
       team.team_barrier();
       // second, we can use dry fields to compute dz, zmin, zint
-      compute_vertical_layer_heights(team, dry_atm_pre_, i);
-      compute_updraft_velocities(team, wet_atm_pre_, dry_atm_pre_, i);
+      if (update_atm_) {
+        compute_vertical_layer_heights(team, dry_atm_pre_, i);
+      }
+      if (update_atm_ or update_updraft_) {
+        compute_updraft_velocities(team, wet_atm_pre_, dry_atm_pre_, i);
+      }
       // allows kernels below to use layer heights operator()
       team.team_barrier();
     }
@@ -97,6 +106,11 @@ class MAMWetscav : public scream::AtmosphereProcess {
     // Number of horizontal columns and vertical levels
     int ncol_pre_, nlev_pre_;
 
+    // dry states to be (re)computed (see mam_dry_state_cache.hpp)
+    bool update_atm_     = true;
+    bool update_updraft_ = true;
+    bool update_aero_    = true;
+
     // Local atmospheric and aerosol state data
     mam_coupling::WetAtmosphere wet_atm_pre_;
     mam_coupling::DryAtmosphere dry_atm_pre_;
@@ -193,6 +207,12 @@ class MAMWetscav : public scream::AtmosphereProcess {
 
   mam_coupling::Buffer buffer_;
 
+  // dry atmosphere and aerosol states, shared with other MAM processes
+  std::shared_ptr<mam_coupling::DryStateCache> dry_state_cache_;
+
+  // fields the dry atmosphere and aerosol states are computed from
+  std::vector<Field> dry_atm_inputs_, dry_updraft_inputs_, dry_aero_inputs_;
+
   std::shared_ptr<const AbstractGrid> m_grid;
 };  // class MAMWetscav
 
@@ -0,0 +1,120 @@
+#include <physics/mam/mam_dry_state_cache.hpp>
+
+#include <ekat/ekat_assert.hpp>
+
+#include <cstring>
+
+namespace scream::mam_coupling {
+
+std::map<std::string,std::weak_ptr<DryStateCache>> DryStateCache::s_instances;
+
+DryStateCache::DryStateCache (const int ncol, const int nlev)
+ : m_ncol (ncol)
+ , m_nlev (nlev)
+{
+  m_qv        = view_2d("mam_dry_qv",ncol,nlev);
+  m_qc        = view_2d("mam_dry_qc",ncol,nlev);
+  m_nc        = view_2d("mam_dry_nc",ncol,nlev);
+  m_qi        = view_2d("mam_dry_qi",ncol,nlev);
+  m_ni        = view_2d("mam_dry_ni",ncol,nlev);
+  m_z_mid     = view_2d("mam_dry_z_mid",ncol,nlev);
+  m_z_iface   = view_2d("mam_dry_z_iface",ncol,nlev+1);
+  m_dz        = view_2d("mam_dry_dz",ncol,nlev);
+  m_w_updraft = view_2d("mam_dry_w_updraft",ncol,nlev);
+
+  for (int m = 0; m < num_aero_modes(); ++m) {
+    m_int_aero_nmr[m] = view_2d(std::string("mam_dry_")+int_aero_nmr_field_name(m),ncol,nlev);
+    m_cld_aero_nmr[m] = view_2d(std::string("mam_dry_")+cld_aero_nmr_field_name(m),ncol,nlev);
+    for (int a = 0; a < num_aero_species(); ++a) {
+      const char* int_mmr_name = int_aero_mmr_field_name(m,a);
+      if (strlen(int_mmr_name) > 0) {
+        m_int_aero_mmr[m][a] = view_2d(std::string("mam_dry_")+int_mmr_name,ncol,nlev);
+      }
+      const char* cld_mmr_name = cld_aero_mmr_field_name(m,a);
+      if (strlen(cld_mmr_name) > 0) {
+        m_cld_aero_mmr[m][a] = view_2d(std::string("mam_dry_")+cld_mmr_name,ncol,nlev);
+      }
+    }
+  }
+  for (int g = 0; g < num_aero_gases(); ++g) {
+    m_gas_mmr[g] = view_2d(std::string("mam_dry_")+gas_mmr_field_name(g),ncol,nlev);
+  }
+}
+
+std::shared_ptr<DryStateCache> DryStateCache::
+get_instance (const std::string& grid_name, const int ncol, const int nlev)
+{
+  auto ptr = s_instances[grid_name].lock();
+  if (not ptr) {
+    ptr = std::make_shared<DryStateCache>(ncol,nlev);
+    s_instances[grid_name] = ptr;
+  }
+  EKAT_REQUIRE_MSG (ptr->m_ncol==ncol and ptr->m_nlev==nlev,
+      "Error! MAM dry state cache was created with different dimensions.\n"
+      "  - grid name: " + grid_name + "\n"
+      "  - cache ncol/nlev: " + std::to_string(ptr->m_ncol) + "/" + std::to_string(ptr->m_nlev) + "\n"
+      "  - input ncol/nlev: " + std::to_string(ncol) + "/" + std::to_string(nlev) + "\n");
+  return ptr;
+}
+
+void DryStateCache::set_views (DryAtmosphere& dry_atm) const
+{
+  dry_atm.qv        = m_qv;
+  dry_atm.qc        = m_qc;
+  dry_atm.nc        = m_nc;
+  dry_atm.qi        = m_qi;
+  dry_atm.ni        = m_ni;
+  dry_atm.z_mid     = m_z_mid;
+  dry_atm.z_iface   = m_z_iface;
+  dry_atm.dz        = m_dz;
+  dry_atm.w_updraft = m_w_updraft;
+}
+
+void DryStateCache::set_views (AerosolState& dry_aero) const
+{
+  for (int m = 0; m < num_aero_modes(); ++m) {
+    dry_aero.int_aero_nmr[m] = m_int_aero_nmr[m];
+    dry_aero.cld_aero_nmr[m] = m_cld_aero_nmr[m];
+    for (int a = 0; a < num_aero_species(); ++a) {
+      dry_aero.int_aero_mmr[m][a] = m_int_aero_mmr[m][a];
+      dry_aero.cld_aero_mmr[m][a] = m_cld_aero_mmr[m][a];
+    }
+  }
+  for (int g = 0; g < num_aero_gases(); ++g) {
+    dry_aero.gas_mmr[g] = m_gas_mmr[g];
+  }
+}
+
+bool DryStateCache::
+is_current (const State s, const std::vector<Field>& inputs) const
+{
+  const auto& sig = m_signatures[s];
+  return sig.size()>0 and sig==compute_signature(inputs);
+}
+
+void DryStateCache::
+set_current (const State s, const std::vector<Field>& inputs)
+{
+  m_signatures[s] = compute_signature(inputs);
+}
+
+void DryStateCache::invalidate ()
+{
+  for (auto& sig : m_signatures) {
+    sig.clear();
+  }
+}
+
+auto DryStateCache::
+compute_signature (const std::vector<Field>& inputs) -> signature_t
+{
+  signature_t sig;
+  sig.reserve(inputs.size());
+  for (const auto& f : inputs) {
+    const auto& fh = f.get_header();
+    sig.emplace_back(&fh,fh.get_tracking().get_version());
+  }
+  return sig;
+}
+
+} // namespace scream::mam_coupling
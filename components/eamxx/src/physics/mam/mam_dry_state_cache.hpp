@@ -0,0 +1,87 @@
+#ifndef MAM_DRY_STATE_CACHE_HPP
+#define MAM_DRY_STATE_CACHE_HPP
+
+#include <physics/mam/mam_coupling.hpp>
+#include <share/field/field.hpp>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace scream::mam_coupling {
+
+// This class stores the dry atmosphere and dry aerosol states computed by
+// the preprocess step of MAM atm processes, so that they can be shared across
+// the MAM processes running on the same grid.
+//
+// The states are stored in dedicated views (rather than in the ATM buffer,
+// which is overwritten by other atm processes). For each state we record
+// the wet fields it was computed from, together with their update counter
+// (see FieldTracking::get_version). A process only needs to recompute a state
+// if it uses different fields, or if any of these fields was updated since the
+// state was last computed. Each state must be keyed only on the fields it is
+// computed from: e.g., omega only feeds the updraft velocity, so keying the Atm
+// state on it would recompute the water species and heights when only omega
+// changed.
+//
+// NOTE: processes can modify the cached aerosol state during their run, as
+//       long as they write the result back into the wet aerosol fields they
+//       compute (which increments their update counter). The cached dry
+//       atmosphere state must be treated as read-only.
+// NOTE: the cache is shared by all processes, so MAM processes in a parallel
+//       group must not run concurrently.
+class DryStateCache {
+public:
+  enum State {
+    Atm     = 0,  // dry water species and layer heights
+    Updraft = 1,  // updraft velocity (also recomputed whenever Atm is)
+    Aero    = 2   // dry aerosol and gas mixing ratios
+  };
+
+  DryStateCache (const int ncol, const int nlev);
+
+  // Get the cache for the given grid, creating it if no process is using it yet
+  static std::shared_ptr<DryStateCache>
+  get_instance (const std::string& grid_name, const int ncol, const int nlev);
+
+  // Point the dry views of the input structs to the cached ones.
+  // Only aerosol species used by mam4 get a view.
+  void set_views (DryAtmosphere& dry_atm) const;
+  void set_views (AerosolState& dry_aero) const;
+
+  // Whether the given state was last computed from the current values of the input fields
+  bool is_current (const State s, const std::vector<Field>& inputs) const;
+
+  // Record that the given state was just computed from the input fields
+  void set_current (const State s, const std::vector<Field>& inputs);
+
+  // Force a recomputation of all states at the next run
+  void invalidate ();
+
+protected:
+
+  using signature_t = std::vector<std::pair<const FieldHeader*,long long>>;
+
+  static signature_t compute_signature (const std::vector<Field>& inputs);
+
+  int m_ncol;
+  int m_nlev;
+
+  view_2d   m_qv, m_qc, m_nc, m_qi, m_ni;
+  view_2d   m_z_mid, m_z_iface, m_dz, m_w_updraft;
+
+  view_2d   m_int_aero_nmr[num_aero_modes()];
+  view_2d   m_cld_aero_nmr[num_aero_modes()];
+  view_2d   m_int_aero_mmr[num_aero_modes()][num_aero_species()];
+  view_2d   m_cld_aero_mmr[num_aero_modes()][num_aero_species()];
+  view_2d   m_gas_mmr[num_aero_gases()];
+
+  signature_t   m_signatures[3];
+
+  static std::map<std::string,std::weak_ptr<DryStateCache>> s_instances;
+};
+
+} // namespace scream::mam_coupling
+
+#endif // MAM_DRY_STATE_CACHE_HPP
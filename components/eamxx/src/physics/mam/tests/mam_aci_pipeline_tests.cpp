@@ -0,0 +1,286 @@
+#include <catch2/catch.hpp>
+
+#include <physics/mam/eamxx_mam_aci_process_interface.hpp>
+#include <physics/mam/eamxx_mam_aci_functions.hpp>
+
+#include "share/util/scream_setup_random_test.hpp"
+
+#include <ekat/util/ekat_test_utils.hpp>
+
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+namespace {
+
+using namespace scream;
+
+using view_2d = MAMAci::view_2d;
+using view_3d = MAMAci::view_3d;
+
+template<typename ViewT>
+void check_equal (const ViewT& v1, const ViewT& v2) {
+  auto h1 = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),v1);
+  auto h2 = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),v2);
+  REQUIRE (h1.size()==h2.size());
+  for (size_t i=0; i<h1.size(); ++i) {
+    REQUIRE (h1.data()[i]==Approx(h2.data()[i]).epsilon(1e-12).margin(1e-300));
+  }
+}
+
+// Allocate views for all the aerosols in the mam4 mode-species layout
+void allocate (mam_coupling::AerosolState& aero, const int ncol, const int nlev) {
+  for (int m=0; m<mam_coupling::num_aero_modes(); ++m) {
+    aero.int_aero_nmr[m] = view_2d("int_nmr",ncol,nlev);
+    aero.cld_aero_nmr[m] = view_2d("cld_nmr",ncol,nlev);
+    for (int a=0; a<mam_coupling::num_aero_species(); ++a) {
+      if (strlen(mam_coupling::int_aero_mmr_field_name(m,a))>0) {
+        aero.int_aero_mmr[m][a] = view_2d("int_mmr",ncol,nlev);
+      }
+      if (strlen(mam_coupling::cld_aero_mmr_field_name(m,a))>0) {
+        aero.cld_aero_mmr[m][a] = view_2d("cld_mmr",ncol,nlev);
+      }
+    }
+  }
+  for (int g=0; g<mam_coupling::num_aero_gases(); ++g) {
+    aero.gas_mmr[g] = view_2d("gas_mmr",ncol,nlev);
+  }
+}
+
+template<typename Engine, typename PDF>
+void randomize (const mam_coupling::AerosolState& aero, Engine& engine, PDF& pdf) {
+  for (int m=0; m<mam_coupling::num_aero_modes(); ++m) {
+    ekat::genRandArray(aero.int_aero_nmr[m],engine,pdf);
+    ekat::genRandArray(aero.cld_aero_nmr[m],engine,pdf);
+    for (int a=0; a<mam_coupling::num_aero_species(); ++a) {
+      if (aero.int_aero_mmr[m][a].data()) {
+        ekat::genRandArray(aero.int_aero_mmr[m][a],engine,pdf);
+      }
+      if (aero.cld_aero_mmr[m][a].data()) {
+        ekat::genRandArray(aero.cld_aero_mmr[m][a],engine,pdf);
+      }
+    }
+  }
+  for (int g=0; g<mam_coupling::num_aero_gases(); ++g) {
+    ekat::genRandArray(aero.gas_mmr[g],engine,pdf);
+  }
+}
+
+void check_equal (const mam_coupling::AerosolState& a1, const mam_coupling::AerosolState& a2) {
+  for (int m=0; m<mam_coupling::num_aero_modes(); ++m) {
+    check_equal(a1.int_aero_nmr[m],a2.int_aero_nmr[m]);
+    check_equal(a1.cld_aero_nmr[m],a2.cld_aero_nmr[m]);
+    for (int a=0; a<mam_coupling::num_aero_species(); ++a) {
+      if (a1.int_aero_mmr[m][a].data()) {
+        check_equal(a1.int_aero_mmr[m][a],a2.int_aero_mmr[m][a]);
+      }
+      if (a1.cld_aero_mmr[m][a].data()) {
+        check_equal(a1.cld_aero_mmr[m][a],a2.cld_aero_mmr[m][a]);
+      }
+    }
+  }
+  for (int g=0; g<mam_coupling::num_aero_gases(); ++g) {
+    check_equal(a1.gas_mmr[g],a2.gas_mmr[g]);
+  }
+}
+
+} // anonymous namespace
+
+TEST_CASE("aci_pipeline_fused_vs_staged") {
+  using namespace scream;
+  using RPDF = std::uniform_real_distribution<Real>;
+
+  auto engine = setup_random_test();
+
+  // Number of columns of a typical GPU rank, and number of repetitions for timings
+  const int ncol = 1024;
+  const int nlev = mam4::nlev;
+  const int nrep = 10;
+  const int top_lev = 6;
+  const Real wsubmin = 0.001;
+  const Real dt = 1800;
+
+  haero::ThreadTeamPolicy team_policy(ncol, Kokkos::AUTO);
+
+  // Inputs
+  mam_coupling::DryAtmosphere dry_atm;
+  view_2d T_mid ("T_mid",ncol,nlev),  p_mid ("p_mid",ncol,nlev);
+  view_2d p_del ("p_del",ncol,nlev),  omega ("omega",ncol,nlev);
+  view_2d dz    ("dz",ncol,nlev),     qv    ("qv",ncol,nlev);
+  view_2d qc    ("qc",ncol,nlev),     qi    ("qi",ncol,nlev);
+  view_2d nc    ("nc",ncol,nlev),     w_sec ("w_sec",ncol,nlev);
+  view_2d liqcldf ("liqcldf",ncol,nlev), liqcldf_prev ("liqcldf_prev",ncol,nlev);
+  view_3d dgnum ("dgnum",ncol,mam_coupling::num_aero_modes(),nlev);
+  view_3d ccn ("ccn",ncol,nlev,6);
+
+  RPDF pdf_T(200,300), pdf_p(1e4,1e5), pdf_dp(100,1000), pdf_omega(-1,1);
+  RPDF pdf_dz(10,1000), pdf_q(0,1e-3), pdf_n(0,1e6), pdf_w(0,1), pdf_cf(0,1);
+  RPDF pdf_dgnum(1e-8,1e-7), pdf_aero(0,1e-6), pdf_tend(-1e-10,1e-10);
+  ekat::genRandArray(T_mid,engine,pdf_T);
+  ekat::genRandArray(p_mid,engine,pdf_p);
+  ekat::genRandArray(p_del,engine,pdf_dp);
+  ekat::genRandArray(omega,engine,pdf_omega);
+  ekat::genRandArray(dz,engine,pdf_dz);
+  ekat::genRandArray(qv,engine,pdf_q);
+  ekat::genRandArray(qc,engine,pdf_q);
+  ekat::genRandArray(qi,engine,pdf_q);
+  ekat::genRandArray(nc,engine,pdf_n);
+  ekat::genRandArray(w_sec,engine,pdf_w);
+  ekat::genRandArray(liqcldf,engine,pdf_cf);
+  ekat::genRandArray(liqcldf_prev,engine,pdf_cf);
+  ekat::genRandArray(dgnum,engine,pdf_dgnum);
+  ekat::genRandArray(ccn,engine,pdf_n);
+
+  dry_atm.T_mid = T_mid;
+  dry_atm.p_mid = p_mid;
+  dry_atm.p_del = p_del;
+  dry_atm.omega = omega;
+  dry_atm.dz    = dz;
+  dry_atm.qv    = qv;
+  dry_atm.qc    = qc;
+  dry_atm.qi    = qi;
+
+  mam_coupling::AerosolState dry_aero;
+  allocate(dry_aero,ncol,nlev);
+  randomize(dry_aero,engine,pdf_aero);
+
+  view_2d qqcw[mam4::ndrop::ncnst_tot];
+  for (int i=0; i<mam4::ndrop::ncnst_tot; ++i) {
+    qqcw[i] = view_2d("qqcw",ncol,nlev);
+    ekat::genRandArray(qqcw[i],engine,pdf_aero);
+  }
+  view_2d ptend_q[mam4::aero_model::pcnst];
+  for (int i=0; i<mam4::aero_model::pcnst; ++i) {
+    ptend_q[i] = view_2d("ptend_q",ncol,nlev);
+    ekat::genRandArray(ptend_q[i],engine,pdf_tend);
+  }
+
+  // Outputs of the two variants
+  struct Outputs {
+    Outputs (const int ncol, const int nlev) {
+      for (auto v : {&nc_inp, &wsub, &wsubice, &wsig, &aitken_dia, &cf, &cf_prev, &rpdel}) {
+        *v = view_2d("out",ncol,nlev);
+      }
+      for (int i=0; i<6; ++i) {
+        ccn_out[i] = view_2d("ccn_out",ncol,nlev);
+      }
+      allocate(wet_aero,ncol,nlev);
+    }
+    view_2d nc_inp, wsub, wsubice, wsig, aitken_dia, cf, cf_prev, rpdel;
+    view_2d ccn_out[6];
+    mam_coupling::AerosolState wet_aero;
+  };
+  Outputs staged(ncol,nlev), fused(ncol,nlev);
+
+  view_2d w0 ("w0",ncol,nlev), rho ("rho",ncol,nlev);
+  view_2d tke ("tke",ncol,nlev+1), w_sec_int ("w_sec_int",ncol,nlev+1);
+
+  // The staged update modifies the dry aerosols in place, so work on a copy
+  mam_coupling::AerosolState dry_aero_copy;
+  allocate(dry_aero_copy,ncol,nlev);
+
+  MAMAci::const_view_2d nc_const = nc;
+  auto run_staged_pre = [&]() {
+    mam_coupling::copy_view_lev_slice(team_policy, nc_const, nlev, staged.nc_inp);
+    compute_w0_and_rho(team_policy, dry_atm, top_lev, nlev, w0, rho);
+    compute_tke_at_interfaces(team_policy, w_sec, dz, nlev, w_sec_int, tke);
+    Kokkos::fence();
+    compute_subgrid_scale_velocities(team_policy, tke, wsubmin, top_lev, nlev,
+                                     staged.wsub, staged.wsubice, staged.wsig);
+    Kokkos::deep_copy(staged.aitken_dia,
+        ekat::subview_1(dgnum, static_cast<int>(mam4::ModeIndex::Aitken)));
+    store_liquid_cloud_fraction(team_policy, dry_atm, liqcldf, liqcldf_prev,
+                                top_lev, nlev, staged.cf, staged.cf_prev);
+    mam_coupling::compute_recipical_pseudo_density(team_policy, p_del, nlev, staged.rpdel);
+    Kokkos::fence();
+  };
+  auto run_fused_pre = [&]() {
+    compute_aci_inputs_fused(team_policy, dry_atm, nc, w_sec, dgnum, liqcldf,
+                             liqcldf_prev, wsubmin, top_lev, nlev,
+                             fused.nc_inp, fused.wsub, fused.wsubice, fused.wsig,
+                             fused.aitken_dia, fused.cf, fused.cf_prev, fused.rpdel);
+    Kokkos::fence();
+  };
+  auto run_staged_post = [&]() {
+    for (int i=0; i<6; ++i) {
+      Kokkos::deep_copy(staged.ccn_out[i],Kokkos::subview(ccn, Kokkos::ALL(), Kokkos::ALL(), i));
+    }
+    update_cloud_borne_aerosols(qqcw, nlev, dry_aero_copy);
+    update_interstitial_aerosols(team_policy, ptend_q, nlev, dt, dry_aero_copy);
+    const auto dry_copy = dry_aero_copy;
+    const auto wet      = staged.wet_aero;
+    Kokkos::parallel_for(team_policy, KOKKOS_LAMBDA(const haero::ThreadTeam &team) {
+      mam_coupling::compute_wet_mixing_ratios(team, dry_atm, dry_copy, wet, team.league_rank());
+    });
+    Kokkos::fence();
+  };
+  auto run_fused_post = [&]() {
+    update_aerosols_fused(team_policy, dry_atm, dry_aero, qqcw, ptend_q, ccn,
+                          nlev, dt, fused.wet_aero, fused.ccn_out);
+    Kokkos::fence();
+  };
+  auto reset_dry_copy = [&]() {
+    for (int m=0; m<mam_coupling::num_aero_modes(); ++m) {
+      Kokkos::deep_copy(dry_aero_copy.int_aero_nmr[m],dry_aero.int_aero_nmr[m]);
+      Kokkos::deep_copy(dry_aero_copy.cld_aero_nmr[m],dry_aero.cld_aero_nmr[m]);
+      for (int a=0; a<mam_coupling::num_aero_species(); ++a) {
+        if (dry_aero.int_aero_mmr[m][a].data()) {
+          Kokkos::deep_copy(dry_aero_copy.int_aero_mmr[m][a],dry_aero.int_aero_mmr[m][a]);
+        }
+        if (dry_aero.cld_aero_mmr[m][a].data()) {
+          Kokkos::deep_copy(dry_aero_copy.cld_aero_mmr[m][a],dry_aero.cld_aero_mmr[m][a]);
+        }
+      }
+    }
+    for (int g=0; g<mam_coupling::num_aero_gases(); ++g) {
+      Kokkos::deep_copy(dry_aero_copy.gas_mmr[g],dry_aero.gas_mmr[g]);
+    }
+    Kokkos::fence();
+  };
+
+  SECTION ("correctness") {
+    run_staged_pre();
+    run_fused_pre();
+    check_equal(staged.nc_inp,fused.nc_inp);
+    check_equal(staged.wsub,fused.wsub);
+    check_equal(staged.wsubice,fused.wsubice);
+    check_equal(staged.wsig,fused.wsig);
+    check_equal(staged.aitken_dia,fused.aitken_dia);
+    check_equal(staged.cf,fused.cf);
+    check_equal(staged.cf_prev,fused.cf_prev);
+    check_equal(staged.rpdel,fused.rpdel);
+
+    reset_dry_copy();
+    run_staged_post();
+    run_fused_post();
+    for (int i=0; i<6; ++i) {
+      check_equal(staged.ccn_out[i],fused.ccn_out[i]);
+    }
+    check_equal(staged.wet_aero,fused.wet_aero);
+  }
+
+  SECTION ("timings") {
+    // Warm up
+    run_staged_pre();
+    run_fused_pre();
+
+    Kokkos::Timer timer;
+    double t_staged = 0, t_fused = 0;
+    for (int irep=0; irep<nrep; ++irep) {
+      reset_dry_copy();
+      timer.reset();
+      run_staged_pre();
+      run_staged_post();
+      t_staged += timer.seconds();
+
+      timer.reset();
+      run_fused_pre();
+      run_fused_post();
+      t_fused += timer.seconds();
+    }
+    std::cout << " ACI pipeline (ncol=" << ncol << ", nlev=" << nlev << ", " << nrep << " reps):\n"
+              << std::setprecision(4)
+              << "   staged: " << t_staged/nrep*1e3 << " ms/rep\n"
+              << "   fused : " << t_fused/nrep*1e3 << " ms/rep\n";
+  }
+}
@@ -6,6 +6,36 @@
 #include "share/property_checks/field_lower_bound_check.hpp"
 #include "share/property_checks/field_within_interval_check.hpp"
 
+#include <cmath>
+
+namespace {
+
+// Days from the J2000 epoch (2000-01-01 12:00:00) to the given time, in the
+// proleptic gregorian calendar (regardless of the model calendar), consistently
+// with the python datetime objects used by the python ML correction.
+double days_from_j2000 (const scream::util::TimeStamp& ts)
+{
+  // Days from 1970-01-01 to the given date (see http://howardhinnant.github.io/date_algorithms.html)
+  auto days_from_civil = [](int y, const int m, const int d) -> long long {
+    y -= m<=2;
+    const long long era = (y>=0 ? y : y-399) / 400;
+    const long long yoe = y - era*400;
+    const long long doy = (153*(m + (m>2 ? -3 : 9)) + 2)/5 + d-1;
+    const long long doe = yoe*365 + yoe/4 - yoe/100 + doy;
+    return era*146097 + doe - 719468;
+  };
+  const double j2000 = days_from_civil(2000,1,1) + 0.5;
+  return days_from_civil(ts.get_year(),ts.get_month(),ts.get_day())
+       + ts.sec_of_day()/86400.0 - j2000;
+}
+
+bool is_model_set (const std::string& path)
+{
+  return path!="NONE" and path!="None";
+}
+
+} // anonymous namespace
+
 namespace scream {
 // =========================================================================================
 MLCorrection::MLCorrection(const ekat::Comm &comm,
@@ -16,6 +46,12 @@ MLCorrection::MLCorrection(const ekat::Comm &comm,
   m_ML_model_path_sfc_fluxes = m_params.get<std::string>("ML_model_path_sfc_fluxes");
   m_fields_ml_output_variables = m_params.get<std::vector<std::string>>("ML_output_fields");
   m_ML_correction_unit_test = m_params.get<bool>("ML_correction_unit_test");
+  m_ML_inference = m_params.get<std::string>("ML_inference","python");
+  m_ML_native_validation = m_params.get<bool>("ML_native_validation",false);
+  EKAT_REQUIRE_MSG (m_ML_inference=="python" or m_ML_inference=="native",
+      "Error! Invalid choice for ML_inference.\n"
+      " - ML_inference: " + m_ML_inference + "\n"
+      " - valid options: python, native\n");
 }
 
 // =========================================================================================
@@ -72,18 +108,37 @@ void MLCorrection::set_grids(
 
 // =========================================================================================
 void MLCorrection::initialize_impl(const RunType /* run_type */) {
-  fpe_mask = ekat::get_enabled_fpes();
-  ekat::disable_all_fpes();  // required for importing numpy  
-  if ( Py_IsInitialized() == 0 ) {
-    pybind11::initialize_interpreter();
+  const bool native = m_ML_inference=="native";
+  if (not native or m_ML_native_validation) {
+    fpe_mask = ekat::get_enabled_fpes();
+    ekat::disable_all_fpes();  // required for importing numpy  
+    if ( Py_IsInitialized() == 0 ) {
+      pybind11::initialize_interpreter();
+    }
+    pybind11::module sys = pybind11::module::import("sys");
+    sys.attr("path").attr("insert")(1, ML_CORRECTION_CUSTOM_PATH);
+    py_correction = pybind11::module::import("ml_correction");
+    ML_model_tq = py_correction.attr("get_ML_model")(m_ML_model_path_tq);
+    ML_model_uv = py_correction.attr("get_ML_model")(m_ML_model_path_uv);
+    ML_model_sfc_fluxes = py_correction.attr("get_ML_model")(m_ML_model_path_sfc_fluxes);
+    ekat::enable_fpes(fpe_mask);
+  }
+
+  if (native) {
+    // With native inference, the model paths point to weights files
+    // (see ml_correction_native_model.hpp for the format)
+    if (is_model_set(m_ML_model_path_tq)) {
+      m_native_tq = std::make_shared<MLCorrectionNativeModel>(m_ML_model_path_tq,m_num_cols,m_num_levs);
+    }
+    if (is_model_set(m_ML_model_path_uv)) {
+      m_native_uv = std::make_shared<MLCorrectionNativeModel>(m_ML_model_path_uv,m_num_cols,m_num_levs);
+    }
+    if (is_model_set(m_ML_model_path_sfc_fluxes)) {
+      m_native_sfc_fluxes = std::make_shared<MLCorrectionNativeModel>(m_ML_model_path_sfc_fluxes,m_num_cols,m_num_levs);
+    }
+    m_cos_zenith     = view_1d("ml_cos_zenith",m_num_cols);
+    m_sw_flux_dn_toa = view_1d("ml_sw_flux_dn_toa",m_num_cols);
   }
-  pybind11::module sys = pybind11::module::import("sys");
-  sys.attr("path").attr("insert")(1, ML_CORRECTION_CUSTOM_PATH);
-  py_correction = pybind11::module::import("ml_correction");
-  ML_model_tq = py_correction.attr("get_ML_model")(m_ML_model_path_tq);
-  ML_model_uv = py_correction.attr("get_ML_model")(m_ML_model_path_uv);
-  ML_model_sfc_fluxes = py_correction.attr("get_ML_model")(m_ML_model_path_sfc_fluxes);
-  ekat::enable_fpes(fpe_mask);
 
   // Enforce bounds on quantities adjusted by ML using Field Property Checks
   using LowerBound = FieldLowerBoundCheck;
@@ -98,66 +153,19 @@ void MLCorrection::initialize_impl(const RunType /* run_type */) {
 
 // =========================================================================================
 void MLCorrection::run_impl(const double dt) {
-  // use model time to infer solar zenith angle for the ML prediction
-  auto current_ts = timestamp();
-  std::string datetime_str = current_ts.get_date_string() + " " + current_ts.get_time_string();
-
-  const auto &phis            = get_field_in("phis").get_view<const Real *, Host>();
-  const auto &sfc_alb_dif_vis = get_field_in("sfc_alb_dif_vis").get_view<const Real *, Host>();  
-
-  const auto &qv              = get_field_out("qv").get_view<Real **, Host>();
-  const auto &T_mid           = get_field_out("T_mid").get_view<Real **, Host>();
-  const auto &SW_flux_dn      = get_field_out("SW_flux_dn").get_view<Real **, Host>();
-  const auto &sfc_flux_sw_net = get_field_out("sfc_flux_sw_net").get_view<Real *, Host>();
-  const auto &sfc_flux_lw_dn  = get_field_out("sfc_flux_lw_dn").get_view<Real *, Host>();
-  const auto &u               = get_field_out("horiz_winds").get_component(0).get_view<Real **, Host>();
-  const auto &v               = get_field_out("horiz_winds").get_component(1).get_view<Real **, Host>();
-
   // For precipitation adjustment we need to track the change in column integrated 'qv'
   // So we clone the original qv before ML changes the state so we can back out a qv_tend
   // to use with precip adjustment.
   auto qv_src = get_field_in("qv");
   auto qv_in = qv_src.clone();
 
-  auto h_lat  = m_lat.get_view<const Real*,Host>();
-  auto h_lon  = m_lon.get_view<const Real*,Host>();
-
-  const auto& tracers = get_group_out("tracers");
-  const auto& tracers_info = tracers.m_info;
-  Int num_tracers = tracers_info->size();
-
-  ekat::disable_all_fpes();  // required for importing numpy
-  if ( Py_IsInitialized() == 0 ) {
-    pybind11::initialize_interpreter();
+  if (m_ML_inference=="python") {
+    run_python(dt);
+  } else if (m_ML_native_validation) {
+    run_native_with_validation(dt);
+  } else {
+    run_native(dt);
   }
-  // for qv, we need to stride across number of tracers
-  pybind11::object ob1     = py_correction.attr("update_fields")(
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * m_num_levs, T_mid.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * m_num_levs * num_tracers, qv.data(), pybind11::str{}),          
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * m_num_levs, u.data(), pybind11::str{}),        
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * m_num_levs, v.data(), pybind11::str{}),       
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, h_lat.data(), pybind11::str{}),       
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, h_lon.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, phis.data(), pybind11::str{}),   
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * (m_num_levs+1), SW_flux_dn.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, sfc_alb_dif_vis.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, sfc_flux_sw_net.data(), pybind11::str{}),   
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, sfc_flux_lw_dn.data(), pybind11::str{}),                                                                                                   
-      m_num_cols, m_num_levs, num_tracers, dt, 
-      ML_model_tq, ML_model_uv, ML_model_sfc_fluxes, datetime_str);
-  pybind11::gil_scoped_release no_gil;  
-  ekat::enable_fpes(fpe_mask);   
 
   // Now back out the qv change abd apply it to precipitation, only if Tq ML is turned on
   if (m_ML_model_path_tq != "None") {
@@ -172,6 +180,7 @@ void MLCorrection::run_impl(const double dt) {
     const auto num_levs = m_num_levs;
     const auto policy = ESU::get_default_team_policy(m_num_cols, m_num_levs);
     
+    const auto &T_mid   = get_field_in("T_mid").get_view<const Real **>();
     const auto &qv_told = qv_in.get_view<const Real **>();
     const auto &qv_tnew = get_field_in("qv").get_view<const Real **>();
     Kokkos::parallel_for("Compute WVP diff", policy,
@@ -227,6 +236,245 @@ void MLCorrection::run_impl(const double dt) {
   }
 }
 
+// =========================================================================================
+void MLCorrection::run_python(const double dt) {
+  // use model time to infer solar zenith angle for the ML prediction
+  auto current_ts = timestamp();
+  std::string datetime_str = current_ts.get_date_string() + " " + current_ts.get_time_string();
+
+  // The python models work on host data
+  for (auto& f : get_fields_in()) {
+    f.sync_to_host();
+  }
+
+  const auto &phis            = get_field_in("phis").get_view<const Real *, Host>();
+  const auto &sfc_alb_dif_vis = get_field_in("sfc_alb_dif_vis").get_view<const Real *, Host>();  
+
+  const auto &qv              = get_field_out("qv").get_view<Real **, Host>();
+  const auto &T_mid           = get_field_out("T_mid").get_view<Real **, Host>();
+  const auto &SW_flux_dn      = get_field_out("SW_flux_dn").get_view<Real **, Host>();
+  const auto &sfc_flux_sw_net = get_field_out("sfc_flux_sw_net").get_view<Real *, Host>();
+  const auto &sfc_flux_lw_dn  = get_field_out("sfc_flux_lw_dn").get_view<Real *, Host>();
+  const auto &u               = get_field_out("horiz_winds").get_component(0).get_view<Real **, Host>();
+  const auto &v               = get_field_out("horiz_winds").get_component(1).get_view<Real **, Host>();
+
+  auto h_lat  = m_lat.get_view<const Real*,Host>();
+  auto h_lon  = m_lon.get_view<const Real*,Host>();
+
+  const auto& tracers = get_group_out("tracers");
+  const auto& tracers_info = tracers.m_info;
+  Int num_tracers = tracers_info->size();
+
+  ekat::disable_all_fpes();  // required for importing numpy
+  if ( Py_IsInitialized() == 0 ) {
+    pybind11::initialize_interpreter();
+  }
+  // for qv, we need to stride across number of tracers
+  pybind11::object ob1     = py_correction.attr("update_fields")(
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * m_num_levs, T_mid.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * m_num_levs * num_tracers, qv.data(), pybind11::str{}),          
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * m_num_levs, u.data(), pybind11::str{}),        
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * m_num_levs, v.data(), pybind11::str{}),       
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, h_lat.data(), pybind11::str{}),       
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, h_lon.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, phis.data(), pybind11::str{}),   
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * (m_num_levs+1), SW_flux_dn.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, sfc_alb_dif_vis.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, sfc_flux_sw_net.data(), pybind11::str{}),   
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, sfc_flux_lw_dn.data(), pybind11::str{}),                                                                                                   
+      m_num_cols, m_num_levs, num_tracers, dt, 
+      ML_model_tq, ML_model_uv, ML_model_sfc_fluxes, datetime_str);
+  pybind11::gil_scoped_release no_gil;  
+  ekat::enable_fpes(fpe_mask);   
+
+  for (auto& f : get_fields_out()) {
+    f.sync_to_dev();
+  }
+}
+
+// =========================================================================================
+void MLCorrection::set_native_inputs(MLCorrectionNativeModel& model) {
+  for (const auto& var : model.get_inputs()) {
+    const auto& name = var.name;
+    if (name=="T_mid" or name=="qv") {
+      model.set_input_3d(name,get_field_in(name).get_view<const Real**>());
+    } else if (name=="U" or name=="V") {
+      const int comp = name=="U" ? 0 : 1;
+      model.set_input_3d(name,get_field_out("horiz_winds").get_component(comp).get_view<const Real**>());
+    } else if (name=="lat") {
+      model.set_input_2d(name,m_lat.get_view<const Real*>());
+    } else if (name=="surface_geopotential") {
+      model.set_input_2d(name,get_field_in("phis").get_view<const Real*>());
+    } else if (name=="surface_diffused_shortwave_albedo") {
+      model.set_input_2d(name,get_field_in("sfc_alb_dif_vis").get_view<const Real*>());
+    } else if (name=="cos_zenith_angle") {
+      model.set_input_2d(name,m_cos_zenith);
+    } else if (name=="total_sky_downward_shortwave_flux_at_top_of_atmosphere") {
+      model.set_input_2d(name,m_sw_flux_dn_toa);
+    } else {
+      EKAT_ERROR_MSG ("Error! Unsupported input for native ML model.\n"
+          " - model file: " + model.get_file_name() + "\n"
+          " - input name: " + name + "\n");
+    }
+  }
+}
+
+// =========================================================================================
+void MLCorrection::run_native(const double dt) {
+  using KT = KokkosTypes<DefaultDevice>;
+  using RangePolicy = typename KT::RangePolicy;
+  using PC = scream::physics::Constants<Real>;
+
+  const int ncols = m_num_cols;
+  const int nlevs = m_num_levs;
+
+  // Inputs derived from the model state. The solar zenith angle follows the
+  // same algorithm as the python ML correction (vcm.cos_zenith_angle): only the
+  // time-dependent terms are computed on host.
+  const bool has_lat_lon = m_lat.is_allocated() and m_lon.is_allocated();
+  if (has_lat_lon) {
+    const double days = days_from_j2000(timestamp());
+    const double jc   = days / 36525.0;  // Julian centuries
+    const double deg2rad = PC::Pi/180.0;
+
+    // Greenwich mean sidereal time
+    const double theta = 67310.54841 + jc*(876600*3600 + 8640184.812866 + jc*(0.093104 - jc*6.2*10e-6));
+    double gmst = std::fmod(theta/240.0*deg2rad, 2*PC::Pi);
+    if (gmst<0) {
+      gmst += 2*PC::Pi;
+    }
+
+    // Sun ecliptic longitude, and obliquity of the ecliptic
+    const double mean_anomaly = deg2rad*(357.52910 + 35999.05030*jc - 0.0001559*jc*jc - 0.00000048*jc*jc*jc);
+    const double mean_lon = deg2rad*(280.46645 + 36000.76983*jc + 0.0003032*jc*jc);
+    const double d_l = deg2rad*((1.914600 - 0.004817*jc - 0.000014*jc*jc)*std::sin(mean_anomaly)
+                               + (0.019993 - 0.000101*jc)*std::sin(2*mean_anomaly)
+                               + 0.000290*std::sin(3*mean_anomaly));
+    const double eclon = mean_lon + d_l;
+    const double eps = deg2rad*(23.0 + 26.0/60 + 21.406/3600.0
+                                - (46.836769*jc - 0.0001831*jc*jc + 0.00200340*jc*jc*jc
+                                   - 0.576e-6*jc*jc*jc*jc - 4.34e-8*jc*jc*jc*jc*jc)/3600.0);
+
+    // Sun right ascension and declination
+    const double x = std::cos(eclon);
+    const double y = std::cos(eps)*std::sin(eclon);
+    const double z = std::sin(eps)*std::sin(eclon);
+    const double r = std::sqrt(1.0 - z*z);
+    const double declination = std::atan2(z,r);
+    const double right_ascension = 2*std::atan2(y,x+r);
+
+    const Real sin_dec = std::sin(declination);
+    const Real cos_dec = std::cos(declination);
+    const Real hour_angle_0 = gmst - right_ascension;
+    const Real d2r = deg2rad;
+    const auto lat = m_lat.get_view<const Real*>();
+    const auto lon = m_lon.get_view<const Real*>();
+    const auto cos_zenith = m_cos_zenith;
+    Kokkos::parallel_for(RangePolicy(0,ncols),
+                         KOKKOS_LAMBDA(const int icol) {
+      const Real lat_r = lat(icol)*d2r;
+      const Real h_angle = hour_angle_0 + lon(icol)*d2r;
+      cos_zenith(icol) = Kokkos::sin(lat_r)*sin_dec + Kokkos::cos(lat_r)*cos_dec*Kokkos::cos(h_angle);
+    });
+  }
+
+  const auto T_mid = get_field_out("T_mid").get_view<Real**>();
+  const auto qv    = get_field_out("qv").get_view<Real**>();
+  const auto u     = get_field_out("horiz_winds").get_component(0).get_view<Real**>();
+  const auto v     = get_field_out("horiz_winds").get_component(1).get_view<Real**>();
+
+  // Add dt*tendency to a 3d state
+  auto apply_tend = [&](const MLCorrectionNativeModel& model, const std::string& tend_name,
+                        const MLCorrectionNativeModel::view_2d<Real>& state) {
+    const auto tend = model.get_output(tend_name);
+    Kokkos::parallel_for(RangePolicy(0,ncols*nlevs),
+                         KOKKOS_LAMBDA(const int idx) {
+      const int icol = idx / nlevs;
+      const int ilev = idx % nlevs;
+      state(icol,ilev) += tend(icol,ilev)*dt;
+    });
+  };
+
+  // Note: the models run in sequence, so that each model sees the state
+  //       corrected by the previous ones (as in the python implementation)
+  if (m_native_tq) {
+    set_native_inputs(*m_native_tq);
+    m_native_tq->predict();
+    apply_tend(*m_native_tq,"dQ1",T_mid);
+    apply_tend(*m_native_tq,"dQ2",qv);
+  }
+  if (m_native_uv) {
+    set_native_inputs(*m_native_uv);
+    m_native_uv->predict();
+    apply_tend(*m_native_uv,m_native_uv->has_output("dQxwind") ? "dQxwind" : "dQu",u);
+    apply_tend(*m_native_uv,m_native_uv->has_output("dQywind") ? "dQywind" : "dQv",v);
+  }
+  if (m_native_sfc_fluxes) {
+    const auto SW_flux_dn = get_field_in("SW_flux_dn").get_view<const Real**>();
+    const auto sw_flux_dn_toa = m_sw_flux_dn_toa;
+    Kokkos::parallel_for(RangePolicy(0,ncols),
+                         KOKKOS_LAMBDA(const int icol) {
+      sw_flux_dn_toa(icol) = SW_flux_dn(icol,0);
+    });
+
+    set_native_inputs(*m_native_sfc_fluxes);
+    m_native_sfc_fluxes->predict();
+    const auto sw_net = m_native_sfc_fluxes->get_output("net_shortwave_sfc_flux_via_transmissivity");
+    const auto lw_dn  = m_native_sfc_fluxes->get_output("override_for_time_adjusted_total_sky_downward_longwave_flux_at_surface");
+    const auto sfc_flux_sw_net = get_field_out("sfc_flux_sw_net").get_view<Real*>();
+    const auto sfc_flux_lw_dn  = get_field_out("sfc_flux_lw_dn").get_view<Real*>();
+    Kokkos::parallel_for(RangePolicy(0,ncols),
+                         KOKKOS_LAMBDA(const int icol) {
+      sfc_flux_sw_net(icol) = sw_net(icol,0);
+      sfc_flux_lw_dn(icol)  = lw_dn(icol,0);
+    });
+  }
+}
+
+// =========================================================================================
+void MLCorrection::run_native_with_validation(const double dt) {
+  // Save the state, so that both implementations start from it
+  std::vector<Field> state, python_state;
+  for (const auto& f : get_fields_out()) {
+    state.push_back(f.clone());
+  }
+
+  run_python(dt);
+  for (const auto& f : get_fields_out()) {
+    python_state.push_back(f.clone());
+  }
+
+  int i = 0;
+  for (auto f : get_fields_out()) {
+    f.deep_copy(state[i++]);
+  }
+  run_native(dt);
+
+  // Report the max difference between the two, for each corrected field
+  i = 0;
+  for (const auto& f : get_fields_out()) {
+    auto diff = f.clone();
+    diff.update(python_state[i++],Real(-1),Real(1));
+    const auto dmax = field_max<Real>(diff,&m_comm);
+    const auto dmin = field_min<Real>(diff,&m_comm);
+    if (m_comm.am_i_root()) {
+      m_atm_logger->info("[MLCorrection] native vs python, max abs diff of " + f.name() + ": "
+                         + std::to_string(std::max(dmax,-dmin)));
+    }
+  }
+}
+
 // =========================================================================================
 void MLCorrection::finalize_impl() {
   // Do nothing
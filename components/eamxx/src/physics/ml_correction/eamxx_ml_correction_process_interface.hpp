@@ -16,6 +16,7 @@
 #include "share/grid/mesh_free_grids_manager.hpp"
 #include "share/grid/point_grid.hpp"
 #include "share/util/scream_time_stamp.hpp"
+#include "ml_correction_native_model.hpp"
 
 namespace scream {
 
@@ -49,6 +50,19 @@ class MLCorrection : public AtmosphereProcess {
   void finalize_impl();
   void apply_tendency(Field& base, const Field& next, const int dt);
 
+  // Apply the corrections using the python models, or the native ones
+  void run_python(const double dt);
+  void run_native(const double dt);
+
+  // Run both the python and the native models, and report the differences.
+  // The native results are kept.
+  void run_native_with_validation(const double dt);
+
+  // Point the model inputs to the corresponding fields
+  void set_native_inputs(MLCorrectionNativeModel& model);
+
+  using view_1d = MLCorrectionNativeModel::view_1d<Real>;
+
   std::shared_ptr<const AbstractGrid>   m_grid;
   // Keep track of field dimensions and the iteration count
   Int m_num_cols;
@@ -64,6 +78,15 @@ class MLCorrection : public AtmosphereProcess {
   pybind11::object ML_model_tq;
   pybind11::object ML_model_uv;
   pybind11::object ML_model_sfc_fluxes;
+
+  // Native inference (see MLCorrectionNativeModel)
+  std::string m_ML_inference;
+  bool m_ML_native_validation;
+  std::shared_ptr<MLCorrectionNativeModel> m_native_tq;
+  std::shared_ptr<MLCorrectionNativeModel> m_native_uv;
+  std::shared_ptr<MLCorrectionNativeModel> m_native_sfc_fluxes;
+  view_1d m_cos_zenith;
+  view_1d m_sw_flux_dn_toa;
   int fpe_mask;
 };  // class MLCorrection
 
@@ -0,0 +1,408 @@
+#include "ml_correction_native_model.hpp"
+
+#include "ekat/ekat_assert.hpp"
+
+#include <fstream>
+#include <sstream>
+
+namespace scream {
+
+// =========================================================================================
+MLCorrectionNativeModel::
+MLCorrectionNativeModel (const std::string& weights_file,
+                         const int ncols, const int nlevs)
+ : m_file_name (weights_file)
+ , m_ncols (ncols)
+ , m_nlevs (nlevs)
+{
+  read_file ();
+  check_and_allocate ();
+}
+
+// =========================================================================================
+bool MLCorrectionNativeModel::has_input (const std::string& name) const
+{
+  return find(m_inputs,name)>=0;
+}
+
+bool MLCorrectionNativeModel::has_output (const std::string& name) const
+{
+  return find(m_outputs,name)>=0;
+}
+
+// =========================================================================================
+void MLCorrectionNativeModel::
+set_input_3d (const std::string& name, const view_2d<const Real>& v)
+{
+  const int idx = find(m_inputs,name);
+  EKAT_REQUIRE_MSG (idx>=0,
+      "Error! Input not used by the ML model.\n"
+      " - model file: " + m_file_name + "\n"
+      " - input name: " + name + "\n");
+  EKAT_REQUIRE_MSG (m_inputs[idx].is_3d,
+      "Error! The ML model expects a 2d input, but a 3d view was given.\n"
+      " - model file: " + m_file_name + "\n"
+      " - input name: " + name + "\n");
+  EKAT_REQUIRE_MSG (int(v.extent(0))==m_ncols && int(v.extent(1))==m_nlevs,
+      "Error! Wrong extents for ML model input.\n"
+      " - model file: " + m_file_name + "\n"
+      " - input name: " + name + "\n");
+  m_input_3d[idx] = v;
+}
+
+void MLCorrectionNativeModel::
+set_input_2d (const std::string& name, const view_1d<const Real>& v)
+{
+  const int idx = find(m_inputs,name);
+  EKAT_REQUIRE_MSG (idx>=0,
+      "Error! Input not used by the ML model.\n"
+      " - model file: " + m_file_name + "\n"
+      " - input name: " + name + "\n");
+  EKAT_REQUIRE_MSG (not m_inputs[idx].is_3d,
+      "Error! The ML model expects a 3d input, but a 2d view was given.\n"
+      " - model file: " + m_file_name + "\n"
+      " - input name: " + name + "\n");
+  EKAT_REQUIRE_MSG (int(v.extent(0))==m_ncols,
+      "Error! Wrong extents for ML model input.\n"
+      " - model file: " + m_file_name + "\n"
+      " - input name: " + name + "\n");
+  m_input_2d[idx] = v;
+}
+
+// =========================================================================================
+auto MLCorrectionNativeModel::
+get_output (const std::string& name) const -> view_2d<const Real>
+{
+  const int idx = find(m_outputs,name);
+  EKAT_REQUIRE_MSG (idx>=0,
+      "Error! Output not computed by the ML model.\n"
+      " - model file : " + m_file_name + "\n"
+      " - output name: " + name + "\n");
+  return m_output_data[idx];
+}
+
+// =========================================================================================
+void MLCorrectionNativeModel::predict ()
+{
+  gather_inputs ();
+
+  const int nlayers = m_layers.size();
+  for (int l=0; l<nlayers; ++l) {
+    apply_layer (m_layers[l],m_buf[l%2],m_buf[(l+1)%2]);
+  }
+
+  scatter_outputs (m_buf[nlayers%2]);
+}
+
+// =========================================================================================
+void MLCorrectionNativeModel::gather_inputs ()
+{
+  using RangePolicy = typename KT::RangePolicy;
+
+  const auto x = m_buf[0];
+  const int ncols = m_ncols;
+  const int nlevs = m_nlevs;
+  const bool pointwise = m_type==Type::Pointwise;
+
+  int feature = 0;
+  for (size_t i=0; i<m_inputs.size(); ++i) {
+    const auto& var = m_inputs[i];
+    const Real offset = var.offset;
+    const Real scale  = var.scale;
+    const int  fbeg   = feature;
+
+    if (var.is_3d) {
+      const auto v = m_input_3d[i];
+      EKAT_REQUIRE_MSG (v.data()!=nullptr,
+          "Error! ML model input was not set.\n"
+          " - model file: " + m_file_name + "\n"
+          " - input name: " + var.name + "\n");
+      Kokkos::parallel_for(RangePolicy(0,ncols*nlevs),
+                           KOKKOS_LAMBDA(const int idx) {
+        const int icol = idx / nlevs;
+        const int ilev = idx % nlevs;
+        const Real val = (v(icol,ilev)-offset)/scale;
+        if (pointwise) {
+          x(fbeg,idx) = val;
+        } else {
+          x(fbeg+ilev,icol) = val;
+        }
+      });
+    } else {
+      const auto v = m_input_2d[i];
+      EKAT_REQUIRE_MSG (v.data()!=nullptr,
+          "Error! ML model input was not set.\n"
+          " - model file: " + m_file_name + "\n"
+          " - input name: " + var.name + "\n");
+      if (pointwise) {
+        // Broadcast the column value to all levels
+        Kokkos::parallel_for(RangePolicy(0,ncols*nlevs),
+                             KOKKOS_LAMBDA(const int idx) {
+          x(fbeg,idx) = (v(idx / nlevs)-offset)/scale;
+        });
+      } else {
+        Kokkos::parallel_for(RangePolicy(0,ncols),
+                             KOKKOS_LAMBDA(const int icol) {
+          x(fbeg,icol) = (v(icol)-offset)/scale;
+        });
+      }
+    }
+    feature += (var.is_3d and not pointwise) ? nlevs : 1;
+  }
+}
+
+// =========================================================================================
+void MLCorrectionNativeModel::
+apply_layer (const Layer& layer, const view_2d<const Real>& x, const view_2d<Real>& y)
+{
+  using RangePolicy = typename KT::RangePolicy;
+
+  const int nin  = layer.nin;
+  const int nout = layer.nout;
+  const int ns   = m_num_samples;
+  const auto w   = layer.w;
+  const auto b   = layer.b;
+  const auto act = layer.act;
+
+  // Batched y = act(W*x+b). Consecutive threads process consecutive samples,
+  // so that x and y accesses are coalesced, while W and b are broadcast.
+  Kokkos::parallel_for(RangePolicy(0,nout*ns),
+                       KOKKOS_LAMBDA(const int idx) {
+    const int o = idx / ns;
+    const int s = idx % ns;
+    Real val = b(o);
+    for (int i=0; i<nin; ++i) {
+      val += w(o,i)*x(i,s);
+    }
+    switch (act) {
+      case Activation::ReLU:    val = val>0 ? val : Real(0);  break;
+      case Activation::Tanh:    val = Kokkos::tanh(val);      break;
+      case Activation::Sigmoid: val = 1/(1+Kokkos::exp(-val)); break;
+      default:                                                break;
+    }
+    y(o,s) = val;
+  });
+}
+
+// =========================================================================================
+void MLCorrectionNativeModel::scatter_outputs (const view_2d<const Real>& y)
+{
+  using RangePolicy = typename KT::RangePolicy;
+
+  const int ncols = m_ncols;
+  const int nlevs = m_nlevs;
+  const bool pointwise = m_type==Type::Pointwise;
+
+  int feature = 0;
+  for (size_t i=0; i<m_outputs.size(); ++i) {
+    const auto& var = m_outputs[i];
+    const Real offset = var.offset;
+    const Real scale  = var.scale;
+    const int  fbeg   = feature;
+    const auto v = m_output_data[i];
+
+    if (var.is_3d) {
+      Kokkos::parallel_for(RangePolicy(0,ncols*nlevs),
+                           KOKKOS_LAMBDA(const int idx) {
+        const int icol = idx / nlevs;
+        const int ilev = idx % nlevs;
+        const Real val = pointwise ? y(fbeg,idx) : y(fbeg+ilev,icol);
+        v(icol,ilev) = val*scale + offset;
+      });
+    } else {
+      Kokkos::parallel_for(RangePolicy(0,ncols),
+                           KOKKOS_LAMBDA(const int icol) {
+        v(icol,0) = y(fbeg,icol)*scale + offset;
+      });
+    }
+    feature += (var.is_3d and not pointwise) ? nlevs : 1;
+  }
+}
+
+// =========================================================================================
+void MLCorrectionNativeModel::read_file ()
+{
+  std::ifstream ifile (m_file_name);
+  EKAT_REQUIRE_MSG (ifile.good(),
+      "Error! Could not open ML model weights file.\n"
+      " - model file: " + m_file_name + "\n");
+
+  // Read all the tokens, skipping comments
+  std::vector<std::string> tokens;
+  std::string line;
+  while (std::getline(ifile,line)) {
+    line = line.substr(0,line.find('#'));
+    std::istringstream iss(line);
+    std::string tok;
+    while (iss >> tok) {
+      tokens.push_back(tok);
+    }
+  }
+
+  size_t pos = 0;
+  auto next = [&](const std::string& what) -> const std::string& {
+    EKAT_REQUIRE_MSG (pos<tokens.size(),
+        "Error! Unexpected end of ML model weights file.\n"
+        " - model file: " + m_file_name + "\n"
+        " - expected  : " + what + "\n");
+    return tokens[pos++];
+  };
+  auto expect = [&](const std::string& keyword) {
+    const auto& tok = next(keyword);
+    EKAT_REQUIRE_MSG (tok==keyword,
+        "Error! Unexpected token in ML model weights file.\n"
+        " - model file: " + m_file_name + "\n"
+        " - expected  : " + keyword + "\n"
+        " - found     : " + tok + "\n");
+  };
+  auto next_int  = [&](const std::string& what) { return std::stoi(next(what)); };
+  auto next_real = [&](const std::string& what) { return Real(std::stod(next(what))); };
+  auto read_vars = [&](const std::string& kind, std::vector<Variable>& vars) {
+    expect(kind);
+    const int n = next_int("number of " + kind);
+    for (int i=0; i<n; ++i) {
+      Variable var;
+      var.name = next(kind + " name");
+      const auto& dim = next(kind + " dimensionality");
+      EKAT_REQUIRE_MSG (dim=="2d" || dim=="3d",
+          "Error! Invalid dimensionality in ML model weights file.\n"
+          " - model file: " + m_file_name + "\n"
+          " - variable  : " + var.name + "\n"
+          " - found     : " + dim + "\n"
+          " - expected  : 2d, 3d\n");
+      var.is_3d  = dim=="3d";
+      var.offset = next_real(kind + " offset");
+      var.scale  = next_real(kind + " scale");
+      EKAT_REQUIRE_MSG (var.scale!=0,
+          "Error! Zero scale in ML model weights file.\n"
+          " - model file: " + m_file_name + "\n"
+          " - variable  : " + var.name + "\n");
+      vars.push_back(var);
+    }
+  };
+
+  expect("type");
+  const auto& type = next("model type");
+  EKAT_REQUIRE_MSG (type=="column" || type=="pointwise",
+      "Error! Invalid model type in ML model weights file.\n"
+      " - model file: " + m_file_name + "\n"
+      " - found     : " + type + "\n"
+      " - expected  : column, pointwise\n");
+  m_type = type=="column" ? Type::Column : Type::Pointwise;
+
+  read_vars("inputs",m_inputs);
+  read_vars("outputs",m_outputs);
+
+  expect("layers");
+  const int nlayers = next_int("number of layers");
+  for (int l=0; l<nlayers; ++l) {
+    Layer layer;
+    expect("dense");
+    layer.nin  = next_int("layer input size");
+    layer.nout = next_int("layer output size");
+    const auto& act = next("layer activation");
+    if (act=="linear") {
+      layer.act = Activation::Linear;
+    } else if (act=="relu") {
+      layer.act = Activation::ReLU;
+    } else if (act=="tanh") {
+      layer.act = Activation::Tanh;
+    } else if (act=="sigmoid") {
+      layer.act = Activation::Sigmoid;
+    } else {
+      EKAT_ERROR_MSG ("Error! Invalid activation in ML model weights file.\n"
+          " - model file: " + m_file_name + "\n"
+          " - found     : " + act + "\n"
+          " - expected  : linear, relu, tanh, sigmoid\n");
+    }
+
+    layer.w = view_2d<Real>("ml_layer_w",layer.nout,layer.nin);
+    layer.b = view_1d<Real>("ml_layer_b",layer.nout);
+    auto w_h = Kokkos::create_mirror_view(layer.w);
+    auto b_h = Kokkos::create_mirror_view(layer.b);
+    for (int o=0; o<layer.nout; ++o) {
+      for (int i=0; i<layer.nin; ++i) {
+        w_h(o,i) = next_real("layer weight");
+      }
+    }
+    for (int o=0; o<layer.nout; ++o) {
+      b_h(o) = next_real("layer bias");
+    }
+    Kokkos::deep_copy(layer.w,w_h);
+    Kokkos::deep_copy(layer.b,b_h);
+
+    m_layers.push_back(layer);
+  }
+
+  EKAT_REQUIRE_MSG (pos==tokens.size(),
+      "Error! Unexpected trailing data in ML model weights file.\n"
+      " - model file: " + m_file_name + "\n");
+}
+
+// =========================================================================================
+void MLCorrectionNativeModel::check_and_allocate ()
+{
+  const bool pointwise = m_type==Type::Pointwise;
+  auto num_features = [&](const std::vector<Variable>& vars) {
+    int n = 0;
+    for (const auto& var : vars) {
+      n += (var.is_3d and not pointwise) ? m_nlevs : 1;
+    }
+    return n;
+  };
+
+  EKAT_REQUIRE_MSG (m_inputs.size()>0 && m_outputs.size()>0 && m_layers.size()>0,
+      "Error! ML model needs at least one input, one output, and one layer.\n"
+      " - model file: " + m_file_name + "\n");
+  if (pointwise) {
+    for (const auto& var : m_outputs) {
+      EKAT_REQUIRE_MSG (var.is_3d,
+          "Error! Pointwise ML models can only have 3d outputs.\n"
+          " - model file : " + m_file_name + "\n"
+          " - output name: " + var.name + "\n");
+    }
+  }
+
+  // Check that the layers are chained correctly
+  int width = num_features(m_inputs);
+  int max_width = width;
+  for (size_t l=0; l<m_layers.size(); ++l) {
+    EKAT_REQUIRE_MSG (m_layers[l].nin==width,
+        "Error! Mismatching sizes in ML model layers.\n"
+        " - model file  : " + m_file_name + "\n"
+        " - layer       : " + std::to_string(l) + "\n"
+        " - layer input : " + std::to_string(m_layers[l].nin) + "\n"
+        " - expected    : " + std::to_string(width) + "\n");
+    width = m_layers[l].nout;
+    max_width = std::max(max_width,width);
+  }
+  EKAT_REQUIRE_MSG (width==num_features(m_outputs),
+      "Error! The output size of the last ML model layer does not match the model outputs.\n"
+      " - model file  : " + m_file_name + "\n"
+      " - layer output: " + std::to_string(width) + "\n"
+      " - expected    : " + std::to_string(num_features(m_outputs)) + "\n");
+
+  m_num_samples = pointwise ? m_ncols*m_nlevs : m_ncols;
+  m_buf[0] = view_2d<Real>("ml_activations_0",max_width,m_num_samples);
+  m_buf[1] = view_2d<Real>("ml_activations_1",max_width,m_num_samples);
+
+  m_input_3d.resize(m_inputs.size());
+  m_input_2d.resize(m_inputs.size());
+  for (const auto& var : m_outputs) {
+    m_output_data.emplace_back(var.name,m_ncols,var.is_3d ? m_nlevs : 1);
+  }
+}
+
+// =========================================================================================
+int MLCorrectionNativeModel::
+find (const std::vector<Variable>& vars, const std::string& name)
+{
+  for (size_t i=0; i<vars.size(); ++i) {
+    if (vars[i].name==name) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+} // namespace scream
@@ -0,0 +1,133 @@
+#ifndef SCREAM_ML_CORRECTION_NATIVE_MODEL_HPP
+#define SCREAM_ML_CORRECTION_NATIVE_MODEL_HPP
+
+#include "share/scream_types.hpp"
+
+#include <string>
+#include <vector>
+
+namespace scream {
+
+/*
+ * A feed-forward neural network, evaluated on device with Kokkos.
+ *
+ * This is the native alternative to the python ML correction models: the
+ * inputs are read directly from device views, and the outputs are written
+ * in device views, so no host copy (nor python interpreter) is involved.
+ *
+ * Two kinds of models are supported:
+ *  - column: one sample per column. The features of a sample are the values
+ *    of all the inputs in the column (nlevs values for 3d inputs, one for 2d
+ *    inputs), concatenated in the order the inputs are listed in the file.
+ *    Outputs are concatenated in the same way.
+ *  - pointwise: one sample per (column,level). The features of a sample are
+ *    the values of the inputs at that level (2d inputs are broadcast across
+ *    levels). All outputs must be 3d.
+ *
+ * The weights file is a plain text file with the following format (blank
+ * lines and anything after a '#' are ignored):
+ *
+ *   type column|pointwise
+ *   inputs N
+ *   <name> 2d|3d <offset> <scale>      (N lines)
+ *   outputs M
+ *   <name> 2d|3d <offset> <scale>      (M lines)
+ *   layers L
+ *   dense <nin> <nout> linear|relu|tanh|sigmoid   (L blocks, each followed by)
+ *   <nout*nin weights, row major, i.e., one row per output>
+ *   <nout biases>
+ *
+ * Inputs are normalized as (x-offset)/scale before entering the first layer,
+ * and outputs are de-normalized as y*scale+offset after the last one.
+ */
+
+class MLCorrectionNativeModel {
+public:
+  using KT = KokkosTypes<DefaultDevice>;
+
+  template<typename T>
+  using view_1d = typename KT::template view_1d<T>;
+  template<typename T>
+  using view_2d = typename KT::template view_2d<T>;
+
+  enum class Type { Column, Pointwise };
+  enum class Activation { Linear, ReLU, Tanh, Sigmoid };
+
+  struct Variable {
+    std::string name;
+    bool        is_3d;
+    Real        offset;
+    Real        scale;
+  };
+
+  struct Layer {
+    int             nin;
+    int             nout;
+    Activation      act;
+    view_2d<Real>   w;    // (nout,nin)
+    view_1d<Real>   b;    // (nout)
+  };
+
+  MLCorrectionNativeModel (const std::string& weights_file,
+                           const int ncols, const int nlevs);
+
+  Type get_type () const { return m_type; }
+  const std::string& get_file_name () const { return m_file_name; }
+  const std::vector<Variable>& get_inputs  () const { return m_inputs; }
+  const std::vector<Variable>& get_outputs () const { return m_outputs; }
+  const std::vector<Layer>&    get_layers  () const { return m_layers; }
+
+  bool has_input  (const std::string& name) const;
+  bool has_output (const std::string& name) const;
+
+  // Set the data of an input. 3d inputs must be (ncols,nlevs), 2d inputs (ncols).
+  // The views are only read during predict, so they must be set before each call
+  // only if they are reallocated.
+  void set_input_3d (const std::string& name, const view_2d<const Real>& v);
+  void set_input_2d (const std::string& name, const view_1d<const Real>& v);
+
+  // Evaluate the network on all samples
+  void predict ();
+
+  // Outputs are (ncols,nlevs) for 3d outputs, and (ncols,1) for 2d outputs
+  view_2d<const Real> get_output (const std::string& name) const;
+
+#ifndef KOKKOS_ENABLE_CUDA
+protected:
+#endif
+  void gather_inputs ();
+  void apply_layer (const Layer& layer, const view_2d<const Real>& x, const view_2d<Real>& y);
+  void scatter_outputs (const view_2d<const Real>& y);
+
+protected:
+  void read_file ();
+  void check_and_allocate ();
+
+  // Index of a variable in a list, or -1 if not found
+  static int find (const std::vector<Variable>& vars, const std::string& name);
+
+  std::string   m_file_name;
+  int           m_ncols;
+  int           m_nlevs;
+  int           m_num_samples;
+
+  Type          m_type;
+  std::vector<Variable>   m_inputs;
+  std::vector<Variable>   m_outputs;
+  std::vector<Layer>      m_layers;
+
+  // Input data, one entry per input (only one of the two views is set)
+  std::vector<view_2d<const Real>> m_input_3d;
+  std::vector<view_1d<const Real>> m_input_2d;
+
+  // Activations of the network, stored as (feature,sample), so that threads
+  // working on consecutive samples access contiguous memory
+  view_2d<Real> m_buf[2];
+
+  // Output data, one entry per output
+  std::vector<view_2d<Real>> m_output_data;
+};
+
+} // namespace scream
+
+#endif // SCREAM_ML_CORRECTION_NATIVE_MODEL_HPP
@@ -0,0 +1,178 @@
+#include <catch2/catch.hpp>
+
+#include "physics/ml_correction/ml_correction_native_model.hpp"
+
+#include "share/util/scream_setup_random_test.hpp"
+
+#include <cmath>
+#include <fstream>
+#include <vector>
+
+namespace {
+
+using namespace scream;
+
+using Model = MLCorrectionNativeModel;
+
+// A small dense network, stored on host, used to write the weights file
+// and to compute the reference output
+struct HostLayer {
+  int nin, nout;
+  std::string act;
+  std::vector<Real> w, b;
+};
+
+Real activate (const std::string& act, const Real x) {
+  if (act=="relu")    return x>0 ? x : 0;
+  if (act=="tanh")    return std::tanh(x);
+  if (act=="sigmoid") return 1/(1+std::exp(-x));
+  return x;
+}
+
+std::vector<Real> eval (const std::vector<HostLayer>& layers, std::vector<Real> x) {
+  for (const auto& l : layers) {
+    std::vector<Real> y(l.nout);
+    for (int o=0; o<l.nout; ++o) {
+      Real val = l.b[o];
+      for (int i=0; i<l.nin; ++i) {
+        val += l.w[o*l.nin+i]*x[i];
+      }
+      y[o] = activate(l.act,val);
+    }
+    x = y;
+  }
+  return x;
+}
+
+template<typename Engine>
+std::vector<HostLayer> make_layers (Engine& engine, const std::vector<int>& sizes) {
+  std::uniform_real_distribution<Real> pdf(-0.5,0.5);
+  const std::vector<std::string> acts = {"relu","tanh","sigmoid"};
+  std::vector<HostLayer> layers;
+  for (size_t l=0; l+1<sizes.size(); ++l) {
+    HostLayer hl;
+    hl.nin  = sizes[l];
+    hl.nout = sizes[l+1];
+    hl.act  = l+2==sizes.size() ? "linear" : acts[l%acts.size()];
+    for (int k=0; k<hl.nin*hl.nout; ++k) hl.w.push_back(pdf(engine));
+    for (int k=0; k<hl.nout; ++k)        hl.b.push_back(pdf(engine));
+    layers.push_back(hl);
+  }
+  return layers;
+}
+
+void write_file (const std::string& fname, const std::string& header,
+                 const std::vector<HostLayer>& layers) {
+  std::ofstream of(fname);
+  of.precision(17);
+  of << "# Test model\n" << header;
+  of << "layers " << layers.size() << "\n";
+  for (const auto& l : layers) {
+    of << "dense " << l.nin << " " << l.nout << " " << l.act << "\n";
+    for (auto w : l.w) of << w << " ";
+    of << "\n";
+    for (auto b : l.b) of << b << " ";
+    of << "\n";
+  }
+}
+
+} // anonymous namespace
+
+TEST_CASE("ml_correction_native_model") {
+  using view_1d = Model::view_1d<Real>;
+  using view_2d = Model::view_2d<Real>;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+  auto engine = scream::setup_random_test(&comm);
+  std::uniform_real_distribution<Real> pdf_T(200,300), pdf_phis(0,1000);
+
+  const int ncols = 7;
+  const int nlevs = 5;
+
+  // Inputs: T (3d, normalized with offset 250 and scale 50), phis (2d, scale 1000)
+  view_2d T("T",ncols,nlevs);
+  view_1d phis("phis",ncols);
+  auto T_h    = Kokkos::create_mirror_view(T);
+  auto phis_h = Kokkos::create_mirror_view(phis);
+  for (int i=0; i<ncols; ++i) {
+    phis_h(i) = pdf_phis(engine);
+    for (int k=0; k<nlevs; ++k) {
+      T_h(i,k) = pdf_T(engine);
+    }
+  }
+  Kokkos::deep_copy(T,T_h);
+  Kokkos::deep_copy(phis,phis_h);
+
+  const std::string vars =
+    "inputs 2\n"
+    "T_mid 3d 250 50\n"
+    "surface_geopotential 2d 0 1000\n";
+
+  SECTION ("column") {
+    // Outputs: dQ1 (3d, scale 1e-3) and a 2d flux (offset 100, scale 10)
+    auto layers = make_layers(engine,{nlevs+1,8,8,nlevs+1});
+    write_file("ml_native_column.txt",
+               "type column\n" + vars +
+               "outputs 2\n"
+               "dQ1 3d 0 1e-3\n"
+               "flux 2d 100 10\n",
+               layers);
+
+    Model model ("ml_native_column.txt",ncols,nlevs);
+    model.set_input_3d("T_mid",T);
+    model.set_input_2d("surface_geopotential",phis);
+    model.predict();
+
+    auto dQ1  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),model.get_output("dQ1"));
+    auto flux = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),model.get_output("flux"));
+    for (int i=0; i<ncols; ++i) {
+      std::vector<Real> x;
+      for (int k=0; k<nlevs; ++k) x.push_back((T_h(i,k)-250)/50);
+      x.push_back(phis_h(i)/1000);
+      auto y = eval(layers,x);
+      for (int k=0; k<nlevs; ++k) {
+        REQUIRE (dQ1(i,k)==Approx(y[k]*1e-3).epsilon(1e-10));
+      }
+      REQUIRE (flux(i,0)==Approx(y[nlevs]*10+100).epsilon(1e-10));
+    }
+  }
+
+  SECTION ("pointwise") {
+    auto layers = make_layers(engine,{2,16,2});
+    write_file("ml_native_pointwise.txt",
+               "type pointwise\n" + vars +
+               "outputs 2\n"
+               "dQ1 3d 0 1e-3\n"
+               "dQ2 3d 0 1e-6\n",
+               layers);
+
+    Model model ("ml_native_pointwise.txt",ncols,nlevs);
+    model.set_input_3d("T_mid",T);
+    model.set_input_2d("surface_geopotential",phis);
+    model.predict();
+
+    auto dQ1 = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),model.get_output("dQ1"));
+    auto dQ2 = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),model.get_output("dQ2"));
+    for (int i=0; i<ncols; ++i) {
+      for (int k=0; k<nlevs; ++k) {
+        auto y = eval(layers,{(T_h(i,k)-250)/50,phis_h(i)/1000});
+        REQUIRE (dQ1(i,k)==Approx(y[0]*1e-3).epsilon(1e-10));
+        REQUIRE (dQ2(i,k)==Approx(y[1]*1e-6).epsilon(1e-10));
+      }
+    }
+  }
+
+  SECTION ("errors") {
+    // Last layer does not match the outputs
+    auto layers = make_layers(engine,{2,4,3});
+    write_file("ml_native_bad.txt",
+               "type pointwise\n" + vars +
+               "outputs 1\n"
+               "dQ1 3d 0 1\n",
+               layers);
+    REQUIRE_THROWS (Model("ml_native_bad.txt",ncols,nlevs));
+
+    // Missing file
+    REQUIRE_THROWS (Model("ml_native_missing.txt",ncols,nlevs));
+  }
+}
@@ -23,6 +23,7 @@ Nudging::Nudging (const ekat::Comm& comm, const ekat::ParameterList& params)
   m_fields_nudge = m_params.get<std::vector<std::string>>("nudging_fields");
   m_use_weights   = m_params.get<bool>("use_nudging_weights",false);
   m_skip_vert_interpolation   = m_params.get<bool>("skip_vert_interpolation",false);
+  m_prefetch_data = m_params.get<bool>("prefetch_nudging_data",false);
   // If we are doing horizontal refine-remapping, we need to get the mapfile from user
   m_refine_remap_file = m_params.get<std::string>(
       "nudging_refine_remap_mapfile", "no-file-given");
@@ -230,7 +231,7 @@ void Nudging::initialize_impl (const RunType /* run_type */)
   auto grid_ext = m_horiz_remapper->get_src_grid();
 
   // Initialize the time interpolator and horiz remapper
-  m_time_interp = util::TimeInterpolation(grid_ext, m_datafiles);
+  m_time_interp = util::TimeInterpolation(grid_ext, m_datafiles, m_prefetch_data);
   m_time_interp.set_logger(m_atm_logger,"[EAMxx::Nudging] Reading nudging data");
 
   // NOTE: we are ASSUMING all fields are 3d and scalar!
@@ -74,6 +74,7 @@ protected:
   int m_timescale;
   bool m_use_weights;
   bool m_skip_vert_interpolation;
+  bool m_prefetch_data;
   std::vector<std::string> m_datafiles;
   std::string              m_static_vertical_pressure_file;
   // add nudging weights for regional nudging update
@@ -102,6 +102,9 @@ void P3Microphysics::set_grids(const std::shared_ptr<const GridsManager> grids_m
   add_field<Computed>("eff_radius_qr",       scalar3d_layout_mid, micron,    grid_name, ps);
   add_field<Computed>("precip_total_tend",   scalar3d_layout_mid, kg/(kg*s), grid_name, ps);
   add_field<Computed>("nevapr",              scalar3d_layout_mid, kg/(kg*s), grid_name, ps);
+  // These are zeroed and recomputed at every P3 run, and only used within the time step
+  declare_transient_field("precip_total_tend", grid_name);
+  declare_transient_field("nevapr",            grid_name);
 
   // History Only: (all fields are just outputs and are really only meant for I/O purposes)
   // TODO: These should be averaged over subcycle as well.  But there is no simple mechanism
@@ -420,7 +423,10 @@ void P3Microphysics::initialize_impl (const RunType /* run_type */)
   }
 
   // Load tables
-  P3F::init_kokkos_ice_lookup_tables(lookup_tables.ice_table_vals, lookup_tables.collect_table_vals);
+  // Note: the binary copy of the ice table is only used/generated if a cache dir is given
+  const auto ice_table_cache_dir = m_params.get<std::string>("ice_table_cache_dir","");
+  P3F::init_kokkos_ice_lookup_tables(lookup_tables.ice_table_vals, lookup_tables.collect_table_vals,
+                                     m_comm, ice_table_cache_dir);
   P3F::init_kokkos_tables(lookup_tables.vn_table_vals, lookup_tables.vm_table_vals,
                           lookup_tables.revap_table_vals, lookup_tables.mu_r_table_vals,
                           lookup_tables.dnu_table_vals);
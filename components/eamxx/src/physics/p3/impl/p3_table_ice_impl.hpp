@@ -3,7 +3,18 @@
 
 #include "p3_functions.hpp" // for ETI only but harmless for GPU
 
+#include "share/util/scream_utils.hpp"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
 #include <fstream>
+#include <sstream>
 
 namespace scream {
 namespace p3 {
@@ -13,26 +24,87 @@ namespace p3 {
  * this file, #include p3_functions.hpp instead.
  */
 
-template <typename S, typename D>
-void Functions<S,D>
-::init_kokkos_ice_lookup_tables(view_ice_table& ice_table_vals, view_collect_table& collect_table_vals) {
+namespace p3_ice_table_impl {
+constexpr char binary_table_magic[8] = {'P','3','I','C','E','T','B','L'};
+} // namespace p3_ice_table_impl
 
-  using DeviceIcetable = typename view_ice_table::non_const_type;
-  using DeviceColtable = typename view_collect_table::non_const_type;
+template <typename S, typename D>
+std::string Functions<S,D>
+::get_ice_table_binary_name(const std::string& cache_dir) {
+  const std::string ascii_filename = std::string(P3C::p3_lookup_base) + std::string(P3C::p3_version);
+  const auto pos = ascii_filename.find_last_of('/');
+  const auto basename = pos==std::string::npos ? ascii_filename : ascii_filename.substr(pos+1);
+  return cache_dir + "/" + basename + ".bin";
+}
 
-  const auto ice_table_vals_d     = DeviceIcetable("ice_table_vals");
-  const auto collect_table_vals_d = DeviceColtable("collect_table_vals");
+template <typename S, typename D>
+void Functions<S,D>
+::read_ice_lookup_tables(std::vector<double>& vals, const std::string& cache_dir) {
+  using namespace p3_ice_table_impl;
+
+  constexpr int ice_size  = P3C::densize*P3C::rimsize*P3C::isize*P3C::ice_table_size;
+  constexpr int coll_size = P3C::densize*P3C::rimsize*P3C::isize*P3C::rcollsize*P3C::collect_table_size;
+  vals.resize(ice_size+coll_size);
+
+  const std::string filename = std::string(P3C::p3_lookup_base) + std::string(P3C::p3_version);
+
+  // Load the raw ascii table. Reading its bytes is cheap compared to parsing
+  // them, and we need them to validate the binary table anyways.
+  std::string ascii;
+  {
+    std::ifstream in(filename,std::ios::binary);
+    EKAT_REQUIRE_MSG(in.good(), "Error! Could not open P3 ice table file " << filename << "\n");
+    std::ostringstream ss;
+    ss << in.rdbuf();
+    ascii = ss.str();
+  }
 
-  const auto ice_table_vals_h    = Kokkos::create_mirror_view(ice_table_vals_d);
-  const auto collect_table_vals_h = Kokkos::create_mirror_view(collect_table_vals_d);
+  // Header we expect in the binary table
+  IceTableBinaryHeader expected;
+  std::copy(binary_table_magic,binary_table_magic+8,expected.magic);
+  std::fill(expected.version,expected.version+16,'\0');
+  std::string(P3C::p3_version).copy(expected.version,15);
+  const int sizes[6] = {P3C::densize, P3C::rimsize, P3C::isize, P3C::ice_table_size,
+                        P3C::rcollsize, P3C::collect_table_size};
+  std::copy(sizes,sizes+6,expected.sizes);
+  expected.src_size = ascii.size();
+  expected.src_hash = fnv1a_hash(ascii.data(),ascii.size());
+  const size_t bin_size = sizeof(IceTableBinaryHeader) + vals.size()*sizeof(double);
+
+  // If a cache dir was given, try to memory-map the binary table first
+  const bool use_cache = not cache_dir.empty();
+  const std::string bin_filename = use_cache ? get_ice_table_binary_name(cache_dir) : "";
+  int fd = use_cache ? open(bin_filename.c_str(),O_RDONLY) : -1;
+  if (fd>=0) {
+    struct stat st;
+    void* addr = MAP_FAILED;
+    if (fstat(fd,&st)==0 and size_t(st.st_size)==bin_size) {
+      addr = mmap(nullptr,bin_size,PROT_READ,MAP_PRIVATE,fd,0);
+    }
+    close(fd);
+    if (addr!=MAP_FAILED) {
+      const auto& h = *reinterpret_cast<const IceTableBinaryHeader*>(addr);
+      const bool valid = std::equal(h.magic,h.magic+8,expected.magic) and
+                         std::equal(h.version,h.version+16,expected.version) and
+                         std::equal(h.sizes,h.sizes+6,expected.sizes) and
+                         h.src_size==expected.src_size and
+                         h.src_hash==expected.src_hash;
+      if (valid) {
+        auto data = reinterpret_cast<const double*>(reinterpret_cast<const char*>(addr)+sizeof(IceTableBinaryHeader));
+        std::copy(data,data+vals.size(),vals.begin());
+      }
+      munmap(addr,bin_size);
+      if (valid) {
+        return;
+      }
+    }
+  }
 
   //
-  // read in ice microphysics table into host views
+  // read in ice microphysics table from the ascii file
   //
 
-  std::string filename = std::string(P3C::p3_lookup_base) + std::string(P3C::p3_version);
-
-  std::ifstream in(filename);
+  std::istringstream in(ascii);
 
   // read header
   std::string version, version_val;
@@ -40,6 +112,16 @@ void Functions<S,D>
   EKAT_REQUIRE_MSG(version == "VERSION", "Bad " << filename << ", expected VERSION X.Y.Z header");
   EKAT_REQUIRE_MSG(version_val == P3C::p3_version, "Bad " << filename << ", expected version " << P3C::p3_version << ", but got " << version_val);
 
+  // Same layout as ice_table_vals and collect_table_vals
+  auto ice_idx = [](int jj, int ii, int i, int j) {
+    return ((jj*P3C::rimsize + ii)*P3C::isize + i)*P3C::ice_table_size + j;
+  };
+  auto coll_idx = [](int jj, int ii, int i, int j, int k) {
+    return (((jj*P3C::rimsize + ii)*P3C::isize + i)*P3C::rcollsize + j)*P3C::collect_table_size + k;
+  };
+  double* ice_vals  = vals.data();
+  double* coll_vals = vals.data() + ice_size;
+
   // read tables
   double dum_s; int dum_i; // dum_s needs to be double to stream correctly
   for (int jj = 0; jj < P3C::densize; ++jj) {
@@ -50,7 +132,7 @@ void Functions<S,D>
         for (int j = 0; j < 15; ++j) {
           in >> dum_s;
           if (j > 1 && j != 10) {
-            ice_table_vals_h(jj, ii, i, j_idx++) = dum_s;
+            ice_vals[ice_idx(jj, ii, i, j_idx++)] = dum_s;
           }
         }
       }
@@ -62,7 +144,7 @@ void Functions<S,D>
           for (int k = 0; k < 6; ++k) {
             in >> dum_s;
             if (k == 3 || k == 4) {
-              collect_table_vals_h(jj, ii, i, j, k_idx++) = std::log10(dum_s);
+              coll_vals[coll_idx(jj, ii, i, j, k_idx++)] = std::log10(dum_s);
             }
           }
         }
@@ -70,6 +152,64 @@ void Functions<S,D>
     }
   }
 
+  if (not use_cache) {
+    return;
+  }
+
+  // Generate the binary table in the cache dir for future runs. Write to a tmp file
+  // and rename, so that concurrent runs never see a partial file. Failing to write
+  // the binary table is not an error (e.g., the cache dir may be read-only).
+  const std::string tmp_filename = bin_filename + ".tmp." + std::to_string(getpid());
+  bool success;
+  {
+    std::ofstream out(tmp_filename,std::ios::binary);
+    out.write(reinterpret_cast<const char*>(&expected),sizeof(IceTableBinaryHeader));
+    out.write(reinterpret_cast<const char*>(vals.data()),vals.size()*sizeof(double));
+    success = out.good();
+  }
+  if (not success or std::rename(tmp_filename.c_str(),bin_filename.c_str())!=0) {
+    std::remove(tmp_filename.c_str());
+  }
+}
+
+template <typename S, typename D>
+void Functions<S,D>
+::init_kokkos_ice_lookup_tables(view_ice_table& ice_table_vals, view_collect_table& collect_table_vals) {
+  init_kokkos_ice_lookup_tables(ice_table_vals,collect_table_vals,ekat::Comm(MPI_COMM_SELF),"");
+}
+
+template <typename S, typename D>
+void Functions<S,D>
+::init_kokkos_ice_lookup_tables(view_ice_table& ice_table_vals, view_collect_table& collect_table_vals,
+                                const ekat::Comm& comm, const std::string& cache_dir) {
+
+  using DeviceIcetable = typename view_ice_table::non_const_type;
+  using DeviceColtable = typename view_collect_table::non_const_type;
+
+  const auto ice_table_vals_d     = DeviceIcetable("ice_table_vals");
+  const auto collect_table_vals_d = DeviceColtable("collect_table_vals");
+
+  const auto ice_table_vals_h    = Kokkos::create_mirror_view(ice_table_vals_d);
+  const auto collect_table_vals_h = Kokkos::create_mirror_view(collect_table_vals_d);
+
+  //
+  // read tables on root rank, and broadcast them to all other ranks
+  //
+
+  std::vector<double> vals;
+  if (comm.am_i_root()) {
+    read_ice_lookup_tables(vals,cache_dir);
+  }
+  int size = vals.size();
+  comm.broadcast(&size,1,comm.root_rank());
+  vals.resize(size);
+  comm.broadcast(vals.data(),size,comm.root_rank());
+
+  // Copy into host views (same layout as the raw values)
+  const int ice_size = ice_table_vals_h.size();
+  std::copy(vals.begin(),vals.begin()+ice_size,ice_table_vals_h.data());
+  std::copy(vals.begin()+ice_size,vals.end(),collect_table_vals_h.data());
+
   // deep copy to device
   Kokkos::deep_copy(ice_table_vals_d, ice_table_vals_h);
   Kokkos::deep_copy(collect_table_vals_d, collect_table_vals_h);
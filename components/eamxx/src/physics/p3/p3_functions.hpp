@@ -7,6 +7,11 @@
 
 #include "ekat/ekat_pack_kokkos.hpp"
 #include "ekat/ekat_workspace.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
 
 namespace scream {
 namespace p3 {
@@ -314,6 +319,33 @@ struct Functions
   static void init_kokkos_ice_lookup_tables(
     view_ice_table& ice_table_vals, view_collect_table& collect_table_vals);
 
+  // Same as above, but only the root rank reads the tables, and broadcasts them.
+  // If cache_dir is not empty, the binary version of the table in it is used (or generated).
+  static void init_kokkos_ice_lookup_tables(
+    view_ice_table& ice_table_vals, view_collect_table& collect_table_vals,
+    const ekat::Comm& comm, const std::string& cache_dir);
+
+  // Header of the binary version of the ice lookup table. It is followed by the table
+  // values (see read_ice_lookup_tables), stored as doubles. The size and hash of the
+  // ascii table it was generated from allow to detect stale binary tables.
+  struct IceTableBinaryHeader {
+    char magic[8];
+    char version[16];
+    int  sizes[6];
+    long long     src_size;
+    std::uint64_t src_hash;
+  };
+
+  // Name of the binary version of the ice lookup table in cache_dir
+  static std::string get_ice_table_binary_name(const std::string& cache_dir);
+
+  // Read the ice lookup tables values, as stored in ice_table_vals and collect_table_vals
+  // (one after the other), but in double precision. If cache_dir is not empty, the values
+  // are read from a binary version of the ascii table in cache_dir, provided that it was
+  // generated from the same ascii table (same size and hash). Otherwise, the ascii table
+  // is parsed, and we attempt to (re)generate the binary table in cache_dir.
+  static void read_ice_lookup_tables(std::vector<double>& vals, const std::string& cache_dir);
+
   // Map (mu_r, lamr) to Table3 data.
   KOKKOS_FUNCTION
   static void lookup(const Spack& mu_r, const Spack& lamr,
@@ -10,6 +10,10 @@
 
 #include <thread>
 #include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
 #include <algorithm>
 #include <random>
 
@@ -59,6 +63,46 @@ struct UnitWrap::UnitTest<D>::TestTableIce {
         }
       }
     }
+
+    // Read tables again, broadcasting them from the root rank, and caching the binary
+    // version of the table in the test run dir. The 1st time, the binary table is
+    // generated, the 2nd time it is used, and the 3rd time it is found stale (we
+    // tamper with the ascii table hash in its header) and regenerated.
+    ekat::Comm comm(MPI_COMM_WORLD);
+    const std::string cache_dir = ".";
+    const std::string bin_filename = Functions::get_ice_table_binary_name(cache_dir);
+    for (int iread=0; iread<3; ++iread) {
+      if (iread==1) {
+        REQUIRE (std::ifstream(bin_filename).good());
+      } else if (iread==2 and comm.am_i_root()) {
+        std::fstream bin(bin_filename,std::ios::binary | std::ios::in | std::ios::out);
+        bin.seekp(offsetof(typename Functions::IceTableBinaryHeader,src_hash));
+        const std::uint64_t bad_hash = 0;
+        bin.write(reinterpret_cast<const char*>(&bad_hash),sizeof(bad_hash));
+      }
+      comm.barrier();
+
+      view_ice_table ice_table_vals2;
+      view_collect_table collect_table_vals2;
+      Functions::init_kokkos_ice_lookup_tables(ice_table_vals2, collect_table_vals2, comm, cache_dir);
+
+      const auto ice_table_vals2_host = Kokkos::create_mirror_view(ice_table_vals2);
+      const auto collect_table_vals2_host = Kokkos::create_mirror_view(collect_table_vals2);
+      Kokkos::deep_copy(ice_table_vals2_host, ice_table_vals2);
+      Kokkos::deep_copy(collect_table_vals2_host, collect_table_vals2);
+      for (size_t i = 0; i < ice_table_vals_host.size(); ++i) {
+        REQUIRE(ice_table_vals2_host.data()[i] == ice_table_vals_host.data()[i]);
+      }
+      for (size_t i = 0; i < collect_table_vals_host.size(); ++i) {
+        REQUIRE(collect_table_vals2_host.data()[i] == collect_table_vals_host.data()[i]);
+      }
+      comm.barrier();
+    }
+
+    // Do not leave the binary table around
+    if (comm.am_i_root()) {
+      std::remove(bin_filename.c_str());
+    }
   }
 
   template <typename View>
@@ -5,6 +5,7 @@
 #include "physics/share/scream_trcmix.hpp"
 
 #include "share/io/scream_scorpio_interface.hpp"
+#include "share/field/field_utils.hpp"
 #include "share/util/eamxx_fv_phys_rrtmgp_active_gases_workaround.hpp"
 #include "share/property_checks/field_within_interval_check.hpp"
 #include "share/util/scream_common_physics_functions.hpp"
@@ -12,6 +13,8 @@
 
 #include "ekat/ekat_assert.hpp"
 
+#include <tuple>
+
 #include "cpp/rrtmgp/mo_gas_concentrations.h"
 #ifdef RRTMGP_ENABLE_YAKL
 #include "YAKL.h"
@@ -73,8 +76,33 @@ void RRTMGPRadiation::set_grids(const std::shared_ptr<const GridsManager> grids_
     m_lon = m_grid->get_geometry_data("lon");
   }
 
+  // Determine rad timestep, specified as number of atm steps
+  m_rad_freq_in_steps = m_params.get<Int>("rad_frequency", 1);
+
+  // If staggered, the column chunks are spread across the steps of the rad interval,
+  // so we need at least one chunk per step (if possible)
+  m_stagger_rad = m_params.get<bool>("stagger_rad_columns",false) and m_rad_freq_in_steps>1;
+
+  // If true, the SW calculation on daytime columns is spread evenly across ranks.
+  // Since that is a collective operation, all ranks must call rrtmgp_main the same
+  // number of times, so each rank does all its columns in one chunk.
+  m_sw_load_balance = m_params.get<bool>("sw_load_balance",false);
+  EKAT_REQUIRE_MSG (not (m_sw_load_balance and m_stagger_rad),
+      "Error! Options 'sw_load_balance' and 'stagger_rad_columns' are not compatible.\n");
+#ifndef RRTMGP_ENABLE_KOKKOS
+  EKAT_REQUIRE_MSG (not m_sw_load_balance,
+      "Error! Option 'sw_load_balance' requires the kokkos version of RRTMGP.\n");
+#endif
+
   // Figure out radiation column chunks stats
   m_col_chunk_size = std::min(m_params.get("column_chunk_size", m_ncol),m_ncol);
+  if (m_sw_load_balance) {
+    m_col_chunk_size = m_ncol;
+  }
+  if (m_stagger_rad) {
+    const int stagger_chunk_size = (m_ncol+m_rad_freq_in_steps-1) / m_rad_freq_in_steps;
+    m_col_chunk_size = std::max(1,std::min(m_col_chunk_size,stagger_chunk_size));
+  }
   m_num_col_chunks = (m_ncol+m_col_chunk_size-1) / m_col_chunk_size;
   m_col_chunk_beg.resize(m_num_col_chunks+1,0);
   for (int i=0; i<m_num_col_chunks; ++i) {
@@ -567,8 +595,20 @@ void RRTMGPRadiation::init_buffers(const ATMBufferManager &buffer_manager)
 void RRTMGPRadiation::initialize_impl(const RunType /* run_type */) {
   using PC = scream::physics::Constants<Real>;
 
-  // Determine rad timestep, specified as number of atm steps
-  m_rad_freq_in_steps = m_params.get<Int>("rad_frequency", 1);
+  // With staggered radiation, on the first step of a run we need to update all columns,
+  // since there are no heating rates/fluxes from previous steps to reuse. This holds
+  // for restarts too, since the fields computed by rrtmgp are not in the restart files.
+  m_force_full_rad_update = true;
+
+  // Aerosol optics are only used on radiation steps (every step, if staggered), so let
+  // the process computing them (e.g., SPA) know it can skip them on the other steps.
+  // This overrides the "every step" declaration made when the fields were set.
+  const int aero_freq = m_stagger_rad ? 1 : m_rad_freq_in_steps;
+  if (m_do_aerosol_rad and aero_freq>0) {
+    for (const std::string fname : {"aero_tau_sw","aero_ssa_sw","aero_g_sw","aero_tau_lw"}) {
+      declare_field_needed_every(get_field_in(fname),name(),aero_freq);
+    }
+  }
 
   // Determine orbital year. If orbital_year is negative, use current year
   // from timestamp for orbital year; if positive, use provided orbital year
@@ -761,6 +801,21 @@ void RRTMGPRadiation::run_impl (const double dt) {
   auto ts = timestamp();
   auto update_rad = scream::rrtmgp::radiation_do(m_rad_freq_in_steps, ts.get_num_steps());
 
+  // Figure out which chunks of columns we update this step. If staggered, each step
+  // of the rad interval updates a different subset of the chunks, while the
+  // other columns keep the heating rates and fluxes from previous steps.
+  int chunk_beg = 0;
+  int chunk_end = m_num_col_chunks;
+  if (m_stagger_rad) {
+    std::tie(chunk_beg,chunk_end) = scream::rrtmgp::radiation_chunks_to_update(
+        m_rad_freq_in_steps, m_num_col_chunks, ts.get_num_steps(), m_force_full_rad_update);
+    update_rad = chunk_end>chunk_beg;
+  }
+  m_force_full_rad_update = false;
+  const int upd_col_beg = update_rad ? m_col_chunk_beg[chunk_beg] : 0;
+  const int upd_col_end = update_rad ? m_col_chunk_beg[chunk_end] : 0;
+  const int upd_ncol    = upd_col_end - upd_col_beg;
+
   if (update_rad) {
     // On each chunk, we internally "reset" the GasConcs object to subview the concs 3d array
     // with the correct ncol dimension. So let's keep a copy of the original (ref-counted)
@@ -799,13 +854,15 @@ void RRTMGPRadiation::run_impl (const double dt) {
     shr_orb_decl_c2f(calday, eccen, mvelpp, lambm0,
                      obliqr, &delta, &eccf);
 
-    // Precompute VMR for all gases, on all cols, before starting the chunks loop
+    // Precompute VMR for all gases, on all the cols updated this step, before starting
+    // the chunks loop. With staggered radiation, that is only a subset of the columns.
     //
     // h2o is taken from qv
     // o3 is computed elsewhere (either read from file or computed by chemistry);
     // n2 and co are set to constants and are not handled by trcmix;
     // the rest are handled by trcmix
     const auto gas_mol_weights = m_gas_mol_weights;
+    const auto upd_cols = std::make_pair(upd_col_beg,upd_col_end);
     for (int igas = 0; igas < m_ngas; igas++) {
       auto name = m_gas_names[igas];
 
@@ -817,9 +874,9 @@ void RRTMGPRadiation::run_impl (const double dt) {
       if (name == "h2o") {
         // h2o is (wet) mass mixing ratio in FM, otherwise known as "qv", which we've already read in above
         // Convert to vmr
-        const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(m_ncol, m_nlay);
+        const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(upd_ncol, m_nlay);
         Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
-          const int icol = team.league_rank();
+          const int icol = upd_col_beg + team.league_rank();
           Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
             d_vmr(icol,k) = PF::calculate_vmr_from_mmr(gas_mol_weights[igas],d_qv(icol,k),d_qv(icol,k));
           });
@@ -827,15 +884,18 @@ void RRTMGPRadiation::run_impl (const double dt) {
         Kokkos::fence();
       } else {
         // This gives (dry) mass mixing ratios
+        physics::trcmix_view1d<const Real> upd_lat = Kokkos::subview(m_lat.get_view<const Real*>(), upd_cols);
+        physics::trcmix_view2d<const Real> upd_pmid = Kokkos::subview(d_pmid, upd_cols, Kokkos::ALL());
+        physics::trcmix_view2d<Real> upd_vmr = Kokkos::subview(d_vmr, upd_cols, Kokkos::ALL());
         scream::physics::trcmix(
-          name, m_nlay, m_lat.get_view<const Real*>(), d_pmid, d_vmr,
+          name, m_nlay, upd_lat, upd_pmid, upd_vmr,
           m_co2vmr, m_n2ovmr, m_ch4vmr, m_f11vmr, m_f12vmr
         );
         // Back out volume mixing ratios
         const auto air_mol_weight = PC::MWdry;
-        const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(m_ncol, m_nlay);
+        const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(upd_ncol, m_nlay);
         Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
-          const int i = team.league_rank();
+          const int i = upd_col_beg + team.league_rank();
           Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
             d_vmr(i,k) = air_mol_weight / gas_mol_weights[igas] * d_vmr(i,k);
           });
@@ -844,7 +904,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
     }
 
     // Loop over each chunk of columns
-    for (int ic=0; ic<m_num_col_chunks; ++ic) {
+    for (int ic=chunk_beg; ic<chunk_end; ++ic) {
       const int beg  = m_col_chunk_beg[ic];
       const int ncol = m_col_chunk_beg[ic+1] - beg;
       this->log(LogLevel::debug,
@@ -1404,7 +1464,8 @@ void RRTMGPRadiation::run_impl (const double dt) {
         lw_clnsky_flux_up_k, lw_clnsky_flux_dn_k,
         sw_bnd_flux_up_k, sw_bnd_flux_dn_k, sw_bnd_flux_dir_k, lw_bnd_flux_up_k, lw_bnd_flux_dn_k,
         eccf, m_atm_logger,
-        m_extra_clnclrsky_diag, m_extra_clnsky_diag
+        m_extra_clnclrsky_diag, m_extra_clnsky_diag,
+        m_sw_load_balance ? &m_comm : nullptr
       );
       COMPARE_ALL_WRAP(std::vector<real2d>({
         sw_flux_up, sw_flux_dn, sw_flux_dn_dir, lw_flux_up, lw_flux_dn,
@@ -1695,13 +1756,15 @@ void RRTMGPRadiation::run_impl (const double dt) {
   // contain actual heating rate, not pdel scaled heating rate. Otherwise, if we have NOT updated the
   // radiative heating, then we need to back out the heating from the rad_heating*pdel term that we carry
   // across timesteps to conserve energy.
+  // NOTE: only columns in [upd_col_beg,upd_col_end) were updated this timestep
   const int ncols = m_ncol;
   const int nlays = m_nlay;
   const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncols, nlays);
   Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
     const int i = team.league_rank();
+    const bool col_updated = i>=upd_col_beg and i<upd_col_end;
     Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlays), [&] (const int& k) {
-      if (update_rad) {
+      if (col_updated) {
         d_tmid(i,k) = d_tmid(i,k) + d_rad_heating_pdel(i,k) * dt;
         d_rad_heating_pdel(i,k) = d_pdel(i,k) * d_rad_heating_pdel(i,k);
       } else {
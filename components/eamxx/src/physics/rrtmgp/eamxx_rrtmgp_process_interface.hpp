@@ -117,6 +117,14 @@ public:
   // Rad frequency in number of steps
   int m_rad_freq_in_steps;
 
+  // If true (and rad frequency>1), spread the column chunks across the steps of
+  // the rad interval, so that each step updates only a subset of the columns
+  bool m_stagger_rad;
+  bool m_force_full_rad_update;
+
+  // If true, the SW calculation on daytime columns is spread evenly across ranks
+  bool m_sw_load_balance;
+
   // Whether or not to do subcolumn sampling of cloud state for MCICA
   bool m_do_subcol_sampling;
 
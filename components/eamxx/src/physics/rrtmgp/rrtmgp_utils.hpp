@@ -10,6 +10,8 @@
 #include "YAKL_Bounds_fortran.h"
 #endif
 
+#include <utility>
+
 namespace scream {
 namespace rrtmgp {
 
@@ -81,6 +83,22 @@ inline bool radiation_do(const int irad, const int nstep) {
   }
 }
 
+// With staggered radiation, the column chunks are spread across the steps of the
+// rad interval, so that each chunk is updated once every irad steps. Return the
+// range [beg,end) of the chunks to update at step nstep (possibly empty).
+// If full_update is true, all chunks are updated.
+inline std::pair<int,int> radiation_chunks_to_update(const int irad, const int nchunks,
+                                                     const int nstep, const bool full_update) {
+  if (irad == 0) {
+    return {0,0};
+  } else if (full_update) {
+    return {0,nchunks};
+  } else {
+    const int phase = nstep % irad;
+    return {(phase*nchunks)/irad, ((phase+1)*nchunks)/irad};
+  }
+}
+
 // Verify that array only contains values within valid range, and if not
 // report min and max of array
 #ifdef RRTMGP_ENABLE_YAKL
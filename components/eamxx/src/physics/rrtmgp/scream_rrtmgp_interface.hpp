@@ -363,6 +363,9 @@ static void compute_broadband_surface_fluxes(
  * Main driver code to run RRTMGP.
  * The input logger is in charge of outputing info to
  * screen and/or to file (or neither), depending on how it was set up.
+ * If sw_balance_comm is not null, the shortwave calculation on daytime columns
+ * is spread evenly across the ranks of sw_balance_comm (this makes the call
+ * collective over sw_balance_comm).
  */
 static void rrtmgp_main(
   const int ncol, const int nlay,
@@ -385,7 +388,8 @@ static void rrtmgp_main(
   const real3dk &lw_bnd_flux_up, const real3dk &lw_bnd_flux_dn,
   const Real tsi_scaling,
   const std::shared_ptr<spdlog::logger>& logger,
-  const bool extra_clnclrsky_diag = false, const bool extra_clnsky_diag = false)
+  const bool extra_clnclrsky_diag = false, const bool extra_clnsky_diag = false,
+  const ekat::Comm* sw_balance_comm = nullptr)
 {
 #ifdef SCREAM_RRTMGP_DEBUG
   // Sanity check inputs, and possibly repair
@@ -518,7 +522,8 @@ static void rrtmgp_main(
     sfc_alb_dir, sfc_alb_dif, mu0, aerosol_sw, clouds_sw_gpt,
     fluxes_sw, clnclrsky_fluxes_sw, clrsky_fluxes_sw, clnsky_fluxes_sw,
     tsi_scaling, logger,
-    extra_clnclrsky_diag, extra_clnsky_diag
+    extra_clnclrsky_diag, extra_clnsky_diag,
+    sw_balance_comm
             );
 
   // Do longwave
@@ -545,6 +550,423 @@ static void rrtmgp_finalize()
   pool_t::finalize();
 }
 
+/*
+ * Compact the indices of the daytime columns (mu0>0) at the beginning of
+ * dayIndices, preserving their order. Returns the number of daytime columns.
+ */
+static int compute_day_indices(const int ncol, const real1dk &mu0, const int1dk &dayIndices)
+{
+  int nday = 0;
+  Kokkos::parallel_scan(ncol, KOKKOS_LAMBDA(int icol, int& offset, const bool final) {
+    if (mu0(icol) > 0) {
+      if (final) {
+        dayIndices(offset) = icol;
+      }
+      ++offset;
+    }
+  }, nday);
+  return nday;
+}
+
+// Inputs of the shortwave calculation on a subset of the columns
+struct sw_columns_t {
+  int ncol = 0;
+  real1dk mu0;
+  real2dk p_lay, t_lay, p_lev;
+  real2dk sfc_alb_dir, sfc_alb_dif;   // (ncol,nbnd)
+  gas_concs_t gas_concs;
+  optical_props2_t aerosol, clouds;
+};
+
+// Outputs of the shortwave calculation on a subset of the columns
+struct sw_fluxes_t {
+  fluxes_t allsky;
+  fluxes_broadband_t clnclrsky, clrsky, clnsky;
+};
+
+static sw_columns_t alloc_sw_columns(const int ncol, const int nlay, gas_optics_t &k_dist, const string1dv &gas_names)
+{
+  const int nbnd = k_dist.get_nband();
+  sw_columns_t cols;
+  cols.ncol = ncol;
+  cols.mu0   = real1dk("mu0_day", ncol);
+  cols.p_lay = real2dk("p_lay_day", ncol, nlay);
+  cols.t_lay = real2dk("t_lay_day", ncol, nlay);
+  cols.p_lev = real2dk("p_lev_day", ncol, nlay+1);
+  cols.sfc_alb_dir = real2dk("sfc_alb_dir_day", ncol, nbnd);
+  cols.sfc_alb_dif = real2dk("sfc_alb_dif_day", ncol, nbnd);
+  cols.gas_concs.init(gas_names, ncol, nlay);
+  cols.aerosol.init(k_dist.get_band_lims_wavenumber());
+  cols.aerosol.alloc_2str(ncol, nlay);
+  cols.clouds.init(k_dist.get_band_lims_wavenumber(), k_dist.get_band_lims_gpoint());
+  cols.clouds.alloc_2str(ncol, nlay);
+  return cols;
+}
+
+static sw_fluxes_t alloc_sw_fluxes(const int ncol, const int nlay, const int nbnd)
+{
+  sw_fluxes_t f;
+  f.allsky.flux_up         = real2dk("flux_up_day", ncol, nlay+1);
+  f.allsky.flux_dn         = real2dk("flux_dn_day", ncol, nlay+1);
+  f.allsky.flux_dn_dir     = real2dk("flux_dn_dir_day", ncol, nlay+1);
+  f.allsky.bnd_flux_up     = real3dk("bnd_flux_up_day", ncol, nlay+1, nbnd);
+  f.allsky.bnd_flux_dn     = real3dk("bnd_flux_dn_day", ncol, nlay+1, nbnd);
+  f.allsky.bnd_flux_dn_dir = real3dk("bnd_flux_dn_dir_day", ncol, nlay+1, nbnd);
+  for (auto bb : {&f.clnclrsky, &f.clrsky, &f.clnsky}) {
+    bb->flux_up     = real2dk("flux_up_day", ncol, nlay+1);
+    bb->flux_dn     = real2dk("flux_dn_day", ncol, nlay+1);
+    bb->flux_dn_dir = real2dk("flux_dn_dir_day", ncol, nlay+1);
+  }
+  return f;
+}
+
+// Call func on each flux array of f
+template <typename F>
+static void for_each_sw_flux(sw_fluxes_t &f, F&& func)
+{
+  for (auto bb : {&f.clnclrsky, &f.clrsky, &f.clnsky}) {
+    func(bb->flux_up);
+    func(bb->flux_dn);
+    func(bb->flux_dn_dir);
+  }
+  func(f.allsky.flux_up);
+  func(f.allsky.flux_dn);
+  func(f.allsky.flux_dn_dir);
+  func(f.allsky.bnd_flux_up);
+  func(f.allsky.bnd_flux_dn);
+  func(f.allsky.bnd_flux_dn_dir);
+}
+
+/*
+ * Shortwave calculation on a subset of the columns (e.g., the daytime ones).
+ * Note: aerosol and cloud optics in cols are delta-scaled in place.
+ */
+static void rrtmgp_sw_columns(
+  gas_optics_t &k_dist, const int nlay, const bool top_at_1,
+  sw_columns_t &cols, sw_fluxes_t &fluxes,
+  const Real tsi_scaling,
+  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag)
+{
+  const int ncol = cols.ncol;
+  if (ncol == 0) {
+    return;
+  }
+  const int nbnd = k_dist.get_nband();
+  const int ngpt = k_dist.get_ngpt();
+
+  // RRTMGP assumes surface albedos have a screwy dimension ordering
+  // for some strange reason, so we need to transpose these
+  auto sfc_alb_dir = cols.sfc_alb_dir;
+  auto sfc_alb_dif = cols.sfc_alb_dif;
+  view_t<RealT**> sfc_alb_dir_T("sfc_alb_dir", nbnd, ncol);
+  view_t<RealT**> sfc_alb_dif_T("sfc_alb_dif", nbnd, ncol);
+  Kokkos::parallel_for(MDRP::template get<2>({nbnd,ncol}), KOKKOS_LAMBDA(int ibnd, int icol) {
+    sfc_alb_dir_T(ibnd,icol) = sfc_alb_dir(icol,ibnd);
+    sfc_alb_dif_T(ibnd,icol) = sfc_alb_dif(icol,ibnd);
+  });
+
+  // Allocate space for optical properties
+  optical_props2_t optics;
+  optics.alloc_2str(ncol, nlay, k_dist);
+
+  optical_props2_t optics_no_aerosols;
+  if (extra_clnsky_diag) {
+    // Allocate space for optical properties (no aerosols)
+    optics_no_aerosols.alloc_2str(ncol, nlay, k_dist);
+  }
+
+  // Limit temperatures for gas optics look-up tables
+  auto t_lay_limited = view_t<RealT**>("t_lay_limited", ncol, nlay);
+  limit_to_bounds_k(cols.t_lay, k_dist_sw_k.get_temp_min(), k_dist_sw_k.get_temp_max(), t_lay_limited);
+
+  // Do gas optics
+  view_t<RealT**> toa_flux("toa_flux", ncol, ngpt);
+  oview_t<RealT***> col_gas("col_gas", std::make_pair(0, ncol-1), std::make_pair(0, nlay-1), std::make_pair(-1, k_dist.get_ngas()-1));
+
+  k_dist.gas_optics(ncol, nlay, top_at_1, cols.p_lay, cols.p_lev, t_lay_limited, cols.gas_concs, col_gas, optics, toa_flux);
+  if (extra_clnsky_diag) {
+    k_dist.gas_optics(ncol, nlay, top_at_1, cols.p_lay, cols.p_lev, t_lay_limited, cols.gas_concs, col_gas, optics_no_aerosols, toa_flux);
+  }
+
+#ifdef SCREAM_RRTMGP_DEBUG
+  // Check gas optics
+  check_range_k(optics.tau,  0, std::numeric_limits<RealT>::max(), "rrtmgp_sw:optics.tau");
+  check_range_k(optics.ssa,  0,                                1, "rrtmgp_sw:optics.ssa"); //, "optics.ssa");
+  check_range_k(optics.g  , -1,                                1, "rrtmgp_sw:optics.g  "); //, "optics.g"  );
+#endif
+
+  // Apply tsi_scaling
+  Kokkos::parallel_for(MDRP::template get<2>({ngpt,ncol}), KOKKOS_LAMBDA(int igpt, int icol) {
+    toa_flux(icol,igpt) = tsi_scaling * toa_flux(icol,igpt);
+  });
+
+  // All calculations use the allsky fluxes as work space, so the broadband
+  // fluxes of the other configurations are copied out after each one
+  auto& allsky = fluxes.allsky;
+  auto copy_broadband = [&](fluxes_broadband_t& dst) {
+    Kokkos::deep_copy(dst.flux_up,     allsky.flux_up);
+    Kokkos::deep_copy(dst.flux_dn,     allsky.flux_dn);
+    Kokkos::deep_copy(dst.flux_dn_dir, allsky.flux_dn_dir);
+  };
+
+  if (extra_clnclrsky_diag) {
+    // Compute clear-clean-sky (just gas) fluxes
+    rte_sw(optics, top_at_1, cols.mu0, toa_flux, sfc_alb_dir_T, sfc_alb_dif_T, allsky);
+    copy_broadband(fluxes.clnclrsky);
+  }
+
+  // Combine gas and aerosol optics
+  cols.aerosol.delta_scale();
+  cols.aerosol.increment(optics);
+
+  // Compute clearsky (gas + aerosol) fluxes
+  rte_sw(optics, top_at_1, cols.mu0, toa_flux, sfc_alb_dir_T, sfc_alb_dif_T, allsky);
+  copy_broadband(fluxes.clrsky);
+
+  // Now merge in cloud optics
+  cols.clouds.delta_scale();
+
+  if (extra_clnsky_diag) {
+    // Compute cleansky (gas + clouds) fluxes
+    cols.clouds.increment(optics_no_aerosols);
+    rte_sw(optics_no_aerosols, top_at_1, cols.mu0, toa_flux, sfc_alb_dir_T, sfc_alb_dif_T, allsky);
+    copy_broadband(fluxes.clnsky);
+  }
+
+  // Combine gas and cloud optics, and compute allsky fluxes
+  cols.clouds.increment(optics);
+  rte_sw(optics, top_at_1, cols.mu0, toa_flux, sfc_alb_dir_T, sfc_alb_dif_T, allsky);
+}
+
+/*
+ * Plan to spread the daytime columns evenly across ranks. Daytime columns are
+ * ordered globally by (rank, local index), and each rank computes a contiguous
+ * range of them, so that the number of columns per rank differs by at most one.
+ * All counts/offsets are in number of columns, and are indexed by rank.
+ */
+struct sw_balance_plan_t {
+  int nwork = 0;                // Number of columns computed on this rank
+  std::vector<int> send_cols;   // Our daytime columns computed on each rank
+  std::vector<int> send_offs;
+  std::vector<int> recv_cols;   // Columns of each rank computed here
+  std::vector<int> recv_offs;
+};
+
+static sw_balance_plan_t compute_sw_balance_plan(const std::vector<int> &nday_per_rank, const int rank)
+{
+  using gid_t = long long;
+  const int nranks = nday_per_rank.size();
+
+  std::vector<gid_t> day_beg(nranks+1,0);
+  for (int r = 0; r < nranks; ++r) {
+    day_beg[r+1] = day_beg[r] + nday_per_rank[r];
+  }
+  const gid_t nday_tot = day_beg[nranks];
+  auto work_beg = [&](const int r) -> gid_t {
+    return r*(nday_tot/nranks) + std::min<gid_t>(r,nday_tot%nranks);
+  };
+  auto overlap = [](const gid_t a0, const gid_t a1, const gid_t b0, const gid_t b1) -> int {
+    return std::max<gid_t>(0, std::min(a1,b1) - std::max(a0,b0));
+  };
+
+  sw_balance_plan_t plan;
+  plan.nwork = work_beg(rank+1) - work_beg(rank);
+  plan.send_cols.resize(nranks,0);
+  plan.send_offs.resize(nranks,0);
+  plan.recv_cols.resize(nranks,0);
+  plan.recv_offs.resize(nranks,0);
+  for (int r = 0; r < nranks; ++r) {
+    plan.send_cols[r] = overlap(day_beg[rank], day_beg[rank+1], work_beg(r), work_beg(r+1));
+    plan.recv_cols[r] = overlap(day_beg[r], day_beg[r+1], work_beg(rank), work_beg(rank+1));
+    if (r > 0) {
+      plan.send_offs[r] = plan.send_offs[r-1] + plan.send_cols[r-1];
+      plan.recv_offs[r] = plan.recv_offs[r-1] + plan.recv_cols[r-1];
+    }
+  }
+  return plan;
+}
+
+// Buffer with the (packed) data of one column per row
+using colbuf_t = Kokkos::View<RealT**, Kokkos::LayoutRight, DeviceT>;
+
+// Copy the data of each column of v into the corresponding row of buf, starting at
+// the given offset, and advance the offset. The unpack versions do the opposite.
+static void pack_columns(const real1dk &v, const colbuf_t &buf, int &offset)
+{
+  const int off = offset;
+  Kokkos::parallel_for(buf.extent(0), KOKKOS_LAMBDA(int icol) {
+    buf(icol,off) = v(icol);
+  });
+  offset += 1;
+}
+static void pack_columns(const real2dk &v, const colbuf_t &buf, int &offset)
+{
+  const int ncol = buf.extent(0);
+  const int n = v.extent(1);
+  const int off = offset;
+  Kokkos::parallel_for(MDRP::template get<2>({n,ncol}), KOKKOS_LAMBDA(int i, int icol) {
+    buf(icol,off+i) = v(icol,i);
+  });
+  offset += n;
+}
+static void pack_columns(const real3dk &v, const colbuf_t &buf, int &offset)
+{
+  const int ncol = buf.extent(0);
+  const int n1 = v.extent(1);
+  const int n2 = v.extent(2);
+  const int off = offset;
+  Kokkos::parallel_for(MDRP::template get<3>({n2,n1,ncol}), KOKKOS_LAMBDA(int j, int i, int icol) {
+    buf(icol,off+i*n2+j) = v(icol,i,j);
+  });
+  offset += n1*n2;
+}
+static void unpack_columns(const colbuf_t &buf, const real1dk &v, int &offset)
+{
+  const int off = offset;
+  Kokkos::parallel_for(buf.extent(0), KOKKOS_LAMBDA(int icol) {
+    v(icol) = buf(icol,off);
+  });
+  offset += 1;
+}
+static void unpack_columns(const colbuf_t &buf, const real2dk &v, int &offset)
+{
+  const int ncol = buf.extent(0);
+  const int n = v.extent(1);
+  const int off = offset;
+  Kokkos::parallel_for(MDRP::template get<2>({n,ncol}), KOKKOS_LAMBDA(int i, int icol) {
+    v(icol,i) = buf(icol,off+i);
+  });
+  offset += n;
+}
+static void unpack_columns(const colbuf_t &buf, const real3dk &v, int &offset)
+{
+  const int ncol = buf.extent(0);
+  const int n1 = v.extent(1);
+  const int n2 = v.extent(2);
+  const int off = offset;
+  Kokkos::parallel_for(MDRP::template get<3>({n2,n1,ncol}), KOKKOS_LAMBDA(int j, int i, int icol) {
+    v(icol,i,j) = buf(icol,off+i*n2+j);
+  });
+  offset += n1*n2;
+}
+
+// Send the rows of src to other ranks, and receive rows from other ranks in dst
+static void exchange_columns(
+  const ekat::Comm &comm,
+  const colbuf_t &src, const std::vector<int> &send_cols, const std::vector<int> &send_offs,
+  const colbuf_t &dst, const std::vector<int> &recv_cols, const std::vector<int> &recv_offs)
+{
+  const int nranks = comm.size();
+  const int nvals = src.extent(1);
+  std::vector<int> send_counts(nranks), send_displs(nranks), recv_counts(nranks), recv_displs(nranks);
+  for (int r = 0; r < nranks; ++r) {
+    send_counts[r] = send_cols[r]*nvals;
+    send_displs[r] = send_offs[r]*nvals;
+    recv_counts[r] = recv_cols[r]*nvals;
+    recv_displs[r] = recv_offs[r]*nvals;
+  }
+
+  const auto mpi_real = ekat::get_mpi_type<RealT>();
+  if (SCREAM_MPI_ON_DEVICE) {
+    Kokkos::fence();
+    MPI_Alltoallv(src.data(), send_counts.data(), send_displs.data(), mpi_real,
+                  dst.data(), recv_counts.data(), recv_displs.data(), mpi_real, comm.mpi_comm());
+  } else {
+    auto src_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), src);
+    auto dst_h = Kokkos::create_mirror_view(dst);
+    MPI_Alltoallv(src_h.data(), send_counts.data(), send_displs.data(), mpi_real,
+                  dst_h.data(), recv_counts.data(), recv_displs.data(), mpi_real, comm.mpi_comm());
+    Kokkos::deep_copy(dst, dst_h);
+  }
+}
+
+/*
+ * Shortwave calculation on the daytime columns of all ranks, spread evenly
+ * across ranks (see compute_sw_balance_plan). The inputs of the daytime columns
+ * are sent to the rank computing them, and the fluxes are sent back.
+ * This is a collective call over comm.
+ */
+static void rrtmgp_sw_balanced(
+  const ekat::Comm &comm,
+  gas_optics_t &k_dist, const int nlay, const bool top_at_1,
+  const string1dv &gas_names,
+  sw_columns_t &day, sw_fluxes_t &fluxes_day,
+  const Real tsi_scaling,
+  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag)
+{
+  const int nbnd = k_dist.get_nband();
+  const int ngpt = k_dist.get_ngpt();
+  const int ngas = gas_names.size();
+
+  std::vector<int> nday_per_rank(comm.size());
+  MPI_Allgather(&day.ncol, 1, MPI_INT, nday_per_rank.data(), 1, MPI_INT, comm.mpi_comm());
+  const auto plan = compute_sw_balance_plan(nday_per_rank, comm.rank());
+  const int nwork = plan.nwork;
+
+  // Send the inputs of our daytime columns to the ranks computing them
+  const int nin = 1 + 3*nlay+1 + 2*nbnd + ngas*nlay + 3*nlay*nbnd + 3*nlay*ngpt;
+  colbuf_t send_in("sw_send_in", day.ncol, nin);
+  colbuf_t recv_in("sw_recv_in", nwork, nin);
+  if (day.ncol > 0) {
+    int offset = 0;
+    pack_columns(day.mu0, send_in, offset);
+    pack_columns(day.p_lay, send_in, offset);
+    pack_columns(day.t_lay, send_in, offset);
+    pack_columns(day.p_lev, send_in, offset);
+    pack_columns(day.sfc_alb_dir, send_in, offset);
+    pack_columns(day.sfc_alb_dif, send_in, offset);
+    auto vmr = real2dk("vmr", day.ncol, nlay);
+    for (int igas = 0; igas < ngas; igas++) {
+      day.gas_concs.get_vmr(gas_names[igas], vmr);
+      pack_columns(vmr, send_in, offset);
+    }
+    pack_columns(day.aerosol.tau, send_in, offset);
+    pack_columns(day.aerosol.ssa, send_in, offset);
+    pack_columns(day.aerosol.g, send_in, offset);
+    pack_columns(day.clouds.tau, send_in, offset);
+    pack_columns(day.clouds.ssa, send_in, offset);
+    pack_columns(day.clouds.g, send_in, offset);
+  }
+  exchange_columns(comm, send_in, plan.send_cols, plan.send_offs, recv_in, plan.recv_cols, plan.recv_offs);
+
+  // Compute the fluxes on the columns we received
+  auto fluxes_work = alloc_sw_fluxes(nwork, nlay, nbnd);
+  if (nwork > 0) {
+    auto work = alloc_sw_columns(nwork, nlay, k_dist, gas_names);
+    int offset = 0;
+    unpack_columns(recv_in, work.mu0, offset);
+    unpack_columns(recv_in, work.p_lay, offset);
+    unpack_columns(recv_in, work.t_lay, offset);
+    unpack_columns(recv_in, work.p_lev, offset);
+    unpack_columns(recv_in, work.sfc_alb_dir, offset);
+    unpack_columns(recv_in, work.sfc_alb_dif, offset);
+    for (int igas = 0; igas < ngas; igas++) {
+      auto vmr = real2dk("vmr", nwork, nlay);
+      unpack_columns(recv_in, vmr, offset);
+      work.gas_concs.set_vmr(gas_names[igas], vmr);
+    }
+    unpack_columns(recv_in, work.aerosol.tau, offset);
+    unpack_columns(recv_in, work.aerosol.ssa, offset);
+    unpack_columns(recv_in, work.aerosol.g, offset);
+    unpack_columns(recv_in, work.clouds.tau, offset);
+    unpack_columns(recv_in, work.clouds.ssa, offset);
+    unpack_columns(recv_in, work.clouds.g, offset);
+
+    rrtmgp_sw_columns(k_dist, nlay, top_at_1, work, fluxes_work,
+                      tsi_scaling, extra_clnclrsky_diag, extra_clnsky_diag);
+  }
+
+  // Send the fluxes back to the ranks owning the columns
+  const int nout = 12*(nlay+1) + 3*(nlay+1)*nbnd;
+  colbuf_t send_out("sw_send_out", nwork, nout);
+  colbuf_t recv_out("sw_recv_out", day.ncol, nout);
+  int offset = 0;
+  for_each_sw_flux(fluxes_work, [&](const auto& v) { pack_columns(v, send_out, offset); });
+  exchange_columns(comm, send_out, plan.recv_cols, plan.recv_offs, recv_out, plan.send_cols, plan.send_offs);
+  offset = 0;
+  for_each_sw_flux(fluxes_day, [&](const auto& v) { unpack_columns(recv_out, v, offset); });
+}
+
 /*
  * Shortwave driver (called by rrtmgp_main)
  */
@@ -558,7 +980,8 @@ static void rrtmgp_sw(
   fluxes_t &fluxes, fluxes_broadband_t &clnclrsky_fluxes, fluxes_broadband_t &clrsky_fluxes, fluxes_broadband_t &clnsky_fluxes,
   const Real tsi_scaling,
   const std::shared_ptr<spdlog::logger>& logger,
-  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag)
+  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag,
+  const ekat::Comm* balance_comm = nullptr)
 {
   // Get problem sizes
   int nbnd = k_dist.get_nband();
@@ -606,203 +1029,130 @@ static void rrtmgp_sw(
   // Get daytime indices
   auto dayIndices = view_t<int*>("dayIndices", ncol);
   Kokkos::deep_copy(dayIndices, -1);
+  const int nday = compute_day_indices(ncol, mu0, dayIndices);
 
-  int nday = 0;
-  // Serialized for now.
-  Kokkos::parallel_reduce(1, KOKKOS_LAMBDA(int, int& nday_inner) {
-    for (int icol = 0; icol < ncol; ++icol) {
-      if (mu0(icol) > 0) {
-        dayIndices(nday_inner++) = icol;
-      }
-    }
-  }, Kokkos::Sum<int>(nday));
-
-  if (nday == 0) {
+  if (nday == 0 and balance_comm == nullptr) {
     // No daytime columns in this chunk, skip the rest of this routine
     return;
   }
 
-  // Subset mu0
-  auto mu0_day = view_t<RealT*>("mu0_day", nday);
-  Kokkos::parallel_for(nday, KOKKOS_LAMBDA(int iday) {
-    mu0_day(iday) = mu0(dayIndices(iday));
-  });
-
-  // subset state variables
-  auto p_lay_day = view_t<RealT**>("p_lay_day", nday, nlay);
-  auto t_lay_day = view_t<RealT**>("t_lay_day", nday, nlay);
-  Kokkos::parallel_for(MDRP::template get<2>({nlay,nday}), KOKKOS_LAMBDA(int ilay, int iday) {
-    p_lay_day(iday,ilay) = p_lay(dayIndices(iday),ilay);
-    t_lay_day(iday,ilay) = t_lay(dayIndices(iday),ilay);
-  });
-  auto p_lev_day = view_t<RealT**>("p_lev_day", nday, nlay+1);
-  auto t_lev_day = view_t<RealT**>("t_lev_day", nday, nlay+1);
-  Kokkos::parallel_for(MDRP::template get<2>({nlay+1,nday}), KOKKOS_LAMBDA(int ilev, int iday) {
-    p_lev_day(iday,ilev) = p_lev(dayIndices(iday),ilev);
-    t_lev_day(iday,ilev) = t_lev(dayIndices(iday),ilev);
-  });
-
-  // Subset gases
-  auto gas_names = gas_concs.get_gas_names();
-  gas_concs_t gas_concs_day;
-  gas_concs_day.init(gas_names, nday, nlay);
-  for (int igas = 0; igas < ngas; igas++) {
-    auto vmr_day = view_t<RealT**>("vmr_day", nday, nlay);
-    auto vmr     = view_t<RealT**>("vmr"    , ncol, nlay);
-    gas_concs.get_vmr(gas_names[igas], vmr);
-    Kokkos::parallel_for(MDRP::template get<2>({nlay,nday}), KOKKOS_LAMBDA(int ilay, int iday) {
-      vmr_day(iday,ilay) = vmr(dayIndices(iday),ilay);
-    });
-    gas_concs_day.set_vmr(gas_names[igas], vmr_day);
-  }
-
-  // Subset aerosol optics
-  optical_props2_t aerosol_day;
-  aerosol_day.init(k_dist.get_band_lims_wavenumber());
-  aerosol_day.alloc_2str(nday, nlay);
-  Kokkos::parallel_for(MDRP::template get<3>({nbnd,nlay,nday}), KOKKOS_LAMBDA(int ibnd, int ilay, int iday) {
-    aerosol_day.tau(iday,ilay,ibnd) = aerosol.tau(dayIndices(iday),ilay,ibnd);
-    aerosol_day.ssa(iday,ilay,ibnd) = aerosol.ssa(dayIndices(iday),ilay,ibnd);
-    aerosol_day.g  (iday,ilay,ibnd) = aerosol.g  (dayIndices(iday),ilay,ibnd);
-  });
-
-  // Subset cloud optics
-  // TODO: nbnd -> ngpt once we pass sub-sampled cloud state
-  optical_props2_t clouds_day;
-  clouds_day.init(k_dist.get_band_lims_wavenumber(), k_dist.get_band_lims_gpoint());
-  clouds_day.alloc_2str(nday, nlay);
-  Kokkos::parallel_for(MDRP::template get<3>({ngpt,nlay,nday}), KOKKOS_LAMBDA(int igpt, int ilay, int iday) {
-    clouds_day.tau(iday,ilay,igpt) = clouds.tau(dayIndices(iday),ilay,igpt);
-    clouds_day.ssa(iday,ilay,igpt) = clouds.ssa(dayIndices(iday),ilay,igpt);
-    clouds_day.g  (iday,ilay,igpt) = clouds.g  (dayIndices(iday),ilay,igpt);
-  });
-
-  // RRTMGP assumes surface albedos have a screwy dimension ordering
-  // for some strange reason, so we need to transpose these; also do
-  // daytime subsetting in the same kernel
-  view_t<RealT**> sfc_alb_dir_T("sfc_alb_dir", nbnd, nday);
-  view_t<RealT**> sfc_alb_dif_T("sfc_alb_dif", nbnd, nday);
-  Kokkos::parallel_for(MDRP::template get<2>({nbnd,nday}), KOKKOS_LAMBDA(int ibnd, int icol) {
-    sfc_alb_dir_T(ibnd,icol) = sfc_alb_dir(dayIndices(icol),ibnd);
-    sfc_alb_dif_T(ibnd,icol) = sfc_alb_dif(dayIndices(icol),ibnd);
-  });
-
-  // Temporaries we need for daytime-only fluxes
-  auto flux_up_day = view_t<RealT**>("flux_up_day", nday, nlay+1);
-  auto flux_dn_day = view_t<RealT**>("flux_dn_day", nday, nlay+1);
-  auto flux_dn_dir_day = view_t<RealT**>("flux_dn_dir_day", nday, nlay+1);
-  auto bnd_flux_up_day = view_t<RealT***>("bnd_flux_up_day", nday, nlay+1, nbnd);
-  auto bnd_flux_dn_day = view_t<RealT***>("bnd_flux_dn_day", nday, nlay+1, nbnd);
-  auto bnd_flux_dn_dir_day = view_t<RealT***>("bnd_flux_dn_dir_day", nday, nlay+1, nbnd);
-  fluxes_t fluxes_day;
-  fluxes_day.flux_up         = flux_up_day;
-  fluxes_day.flux_dn         = flux_dn_day;
-  fluxes_day.flux_dn_dir     = flux_dn_dir_day;
-  fluxes_day.bnd_flux_up     = bnd_flux_up_day;
-  fluxes_day.bnd_flux_dn     = bnd_flux_dn_day;
-  fluxes_day.bnd_flux_dn_dir = bnd_flux_dn_dir_day;
-
-  // Allocate space for optical properties
-  optical_props2_t optics;
-  optics.alloc_2str(nday, nlay, k_dist);
-
-  optical_props2_t optics_no_aerosols;
-  if (extra_clnsky_diag) {
-    // Allocate space for optical properties (no aerosols)
-    optics_no_aerosols.alloc_2str(nday, nlay, k_dist);
-  }
-
-  // Limit temperatures for gas optics look-up tables
-  auto t_lay_limited = view_t<RealT**>("t_lay_limited", nday, nlay);
-  limit_to_bounds_k(t_lay_day, k_dist_sw_k.get_temp_min(), k_dist_sw_k.get_temp_max(), t_lay_limited);
-
-  // Do gas optics
-  view_t<RealT**> toa_flux("toa_flux", nday, ngpt);
   bool top_at_1 = false;
   Kokkos::parallel_reduce(1, KOKKOS_LAMBDA(int, bool& val) {
     val |= p_lay(0, 0) < p_lay(0, nlay-1);
   }, Kokkos::LOr<bool>(top_at_1));
 
-  oview_t<RealT***> col_gas("col_gas", std::make_pair(0, ncol-1), std::make_pair(0, nlay-1), std::make_pair(-1, k_dist.get_ngas()-1));
-
-  k_dist.gas_optics(nday, nlay, top_at_1, p_lay_day, p_lev_day, t_lay_limited, gas_concs_day, col_gas, optics, toa_flux);
-  if (extra_clnsky_diag) {
-    k_dist.gas_optics(nday, nlay, top_at_1, p_lay_day, p_lev_day, t_lay_limited, gas_concs_day, col_gas, optics_no_aerosols, toa_flux);
-  }
-
-#ifdef SCREAM_RRTMGP_DEBUG
-  // Check gas optics
-  check_range_k(optics.tau,  0, std::numeric_limits<RealT>::max(), "rrtmgp_sw:optics.tau");
-  check_range_k(optics.ssa,  0,                                1, "rrtmgp_sw:optics.ssa"); //, "optics.ssa");
-  check_range_k(optics.g  , -1,                                1, "rrtmgp_sw:optics.g  "); //, "optics.g"  );
-#endif
-
-  // Apply tsi_scaling
-  Kokkos::parallel_for(MDRP::template get<2>({ngpt,nday}), KOKKOS_LAMBDA(int igpt, int iday) {
-    toa_flux(iday,igpt) = tsi_scaling * toa_flux(iday,igpt);
-  });
+  // Subset inputs to the daytime columns
+  auto gas_names = gas_concs.get_gas_names();
+  sw_columns_t day;
+  if (nday > 0) {
+    day = alloc_sw_columns(nday, nlay, k_dist, gas_names);
+
+    // Subset mu0
+    auto mu0_day = day.mu0;
+    Kokkos::parallel_for(nday, KOKKOS_LAMBDA(int iday) {
+      mu0_day(iday) = mu0(dayIndices(iday));
+    });
 
-  if (extra_clnclrsky_diag) {
-    // Compute clear-clean-sky (just gas) fluxes on daytime columns
-    rte_sw(optics, top_at_1, mu0_day, toa_flux, sfc_alb_dir_T, sfc_alb_dif_T, fluxes_day);
-    // Expand daytime fluxes to all columns
+    // subset state variables
+    auto p_lay_day = day.p_lay;
+    auto t_lay_day = day.t_lay;
+    Kokkos::parallel_for(MDRP::template get<2>({nlay,nday}), KOKKOS_LAMBDA(int ilay, int iday) {
+      p_lay_day(iday,ilay) = p_lay(dayIndices(iday),ilay);
+      t_lay_day(iday,ilay) = t_lay(dayIndices(iday),ilay);
+    });
+    auto p_lev_day = day.p_lev;
     Kokkos::parallel_for(MDRP::template get<2>({nlay+1,nday}), KOKKOS_LAMBDA(int ilev, int iday) {
-      const int icol = dayIndices(iday);
-      clnclrsky_flux_up    (icol,ilev) = flux_up_day    (iday,ilev);
-      clnclrsky_flux_dn    (icol,ilev) = flux_dn_day    (iday,ilev);
-      clnclrsky_flux_dn_dir(icol,ilev) = flux_dn_dir_day(iday,ilev);
+      p_lev_day(iday,ilev) = p_lev(dayIndices(iday),ilev);
     });
-  }
 
-  // Combine gas and aerosol optics
-  aerosol_day.delta_scale();
-  aerosol_day.increment(optics);
+    // Subset gases
+    for (int igas = 0; igas < ngas; igas++) {
+      auto vmr_day = view_t<RealT**>("vmr_day", nday, nlay);
+      auto vmr     = view_t<RealT**>("vmr"    , ncol, nlay);
+      gas_concs.get_vmr(gas_names[igas], vmr);
+      Kokkos::parallel_for(MDRP::template get<2>({nlay,nday}), KOKKOS_LAMBDA(int ilay, int iday) {
+        vmr_day(iday,ilay) = vmr(dayIndices(iday),ilay);
+      });
+      day.gas_concs.set_vmr(gas_names[igas], vmr_day);
+    }
 
-  // Compute clearsky (gas + aerosol) fluxes on daytime columns
-  rte_sw(optics, top_at_1, mu0_day, toa_flux, sfc_alb_dir_T, sfc_alb_dif_T, fluxes_day);
+    // Subset aerosol optics
+    auto& aerosol_day = day.aerosol;
+    Kokkos::parallel_for(MDRP::template get<3>({nbnd,nlay,nday}), KOKKOS_LAMBDA(int ibnd, int ilay, int iday) {
+      aerosol_day.tau(iday,ilay,ibnd) = aerosol.tau(dayIndices(iday),ilay,ibnd);
+      aerosol_day.ssa(iday,ilay,ibnd) = aerosol.ssa(dayIndices(iday),ilay,ibnd);
+      aerosol_day.g  (iday,ilay,ibnd) = aerosol.g  (dayIndices(iday),ilay,ibnd);
+    });
 
-  // Expand daytime fluxes to all columns
-  Kokkos::parallel_for(MDRP::template get<2>({nlay+1,nday}), KOKKOS_LAMBDA(int ilev, int iday) {
-    const int icol = dayIndices(iday);
-    clrsky_flux_up    (icol,ilev) = flux_up_day    (iday,ilev);
-    clrsky_flux_dn    (icol,ilev) = flux_dn_day    (iday,ilev);
-    clrsky_flux_dn_dir(icol,ilev) = flux_dn_dir_day(iday,ilev);
-  });
+    // Subset cloud optics
+    auto& clouds_day = day.clouds;
+    Kokkos::parallel_for(MDRP::template get<3>({ngpt,nlay,nday}), KOKKOS_LAMBDA(int igpt, int ilay, int iday) {
+      clouds_day.tau(iday,ilay,igpt) = clouds.tau(dayIndices(iday),ilay,igpt);
+      clouds_day.ssa(iday,ilay,igpt) = clouds.ssa(dayIndices(iday),ilay,igpt);
+      clouds_day.g  (iday,ilay,igpt) = clouds.g  (dayIndices(iday),ilay,igpt);
+    });
 
-  // Now merge in cloud optics and do allsky calculations
+    // Subset surface albedos
+    auto sfc_alb_dir_day = day.sfc_alb_dir;
+    auto sfc_alb_dif_day = day.sfc_alb_dif;
+    Kokkos::parallel_for(MDRP::template get<2>({nbnd,nday}), KOKKOS_LAMBDA(int ibnd, int iday) {
+      sfc_alb_dir_day(iday,ibnd) = sfc_alb_dir(dayIndices(iday),ibnd);
+      sfc_alb_dif_day(iday,ibnd) = sfc_alb_dif(dayIndices(iday),ibnd);
+    });
+  }
 
-  // Combine gas and cloud optics
-  clouds_day.delta_scale();
-  clouds_day.increment(optics);
   // Compute fluxes on daytime columns
-  rte_sw(optics, top_at_1, mu0_day, toa_flux, sfc_alb_dir_T, sfc_alb_dif_T, fluxes_day);
+  auto fluxes_day = alloc_sw_fluxes(nday, nlay, nbnd);
+  if (balance_comm != nullptr) {
+    // Spread the daytime columns evenly across ranks, and get back their fluxes
+    rrtmgp_sw_balanced(*balance_comm, k_dist, nlay, top_at_1, gas_names, day, fluxes_day,
+                       tsi_scaling, extra_clnclrsky_diag, extra_clnsky_diag);
+  } else {
+    rrtmgp_sw_columns(k_dist, nlay, top_at_1, day, fluxes_day,
+                      tsi_scaling, extra_clnclrsky_diag, extra_clnsky_diag);
+  }
+
   // Expand daytime fluxes to all columns
+  auto flux_up_day     = fluxes_day.allsky.flux_up;
+  auto flux_dn_day     = fluxes_day.allsky.flux_dn;
+  auto flux_dn_dir_day = fluxes_day.allsky.flux_dn_dir;
+  auto clrsky_flux_up_day     = fluxes_day.clrsky.flux_up;
+  auto clrsky_flux_dn_day     = fluxes_day.clrsky.flux_dn;
+  auto clrsky_flux_dn_dir_day = fluxes_day.clrsky.flux_dn_dir;
+  auto clnclrsky_flux_up_day     = fluxes_day.clnclrsky.flux_up;
+  auto clnclrsky_flux_dn_day     = fluxes_day.clnclrsky.flux_dn;
+  auto clnclrsky_flux_dn_dir_day = fluxes_day.clnclrsky.flux_dn_dir;
+  auto clnsky_flux_up_day     = fluxes_day.clnsky.flux_up;
+  auto clnsky_flux_dn_day     = fluxes_day.clnsky.flux_dn;
+  auto clnsky_flux_dn_dir_day = fluxes_day.clnsky.flux_dn_dir;
   Kokkos::parallel_for(MDRP::template get<2>({nlay+1,nday}), KOKKOS_LAMBDA(int ilev, int iday) {
     const int icol = dayIndices(iday);
     flux_up    (icol,ilev) = flux_up_day    (iday,ilev);
     flux_dn    (icol,ilev) = flux_dn_day    (iday,ilev);
     flux_dn_dir(icol,ilev) = flux_dn_dir_day(iday,ilev);
+    clrsky_flux_up    (icol,ilev) = clrsky_flux_up_day    (iday,ilev);
+    clrsky_flux_dn    (icol,ilev) = clrsky_flux_dn_day    (iday,ilev);
+    clrsky_flux_dn_dir(icol,ilev) = clrsky_flux_dn_dir_day(iday,ilev);
+    if (extra_clnclrsky_diag) {
+      clnclrsky_flux_up    (icol,ilev) = clnclrsky_flux_up_day    (iday,ilev);
+      clnclrsky_flux_dn    (icol,ilev) = clnclrsky_flux_dn_day    (iday,ilev);
+      clnclrsky_flux_dn_dir(icol,ilev) = clnclrsky_flux_dn_dir_day(iday,ilev);
+    }
+    if (extra_clnsky_diag) {
+      clnsky_flux_up    (icol,ilev) = clnsky_flux_up_day    (iday,ilev);
+      clnsky_flux_dn    (icol,ilev) = clnsky_flux_dn_day    (iday,ilev);
+      clnsky_flux_dn_dir(icol,ilev) = clnsky_flux_dn_dir_day(iday,ilev);
+    }
   });
+  auto bnd_flux_up_day     = fluxes_day.allsky.bnd_flux_up;
+  auto bnd_flux_dn_day     = fluxes_day.allsky.bnd_flux_dn;
+  auto bnd_flux_dn_dir_day = fluxes_day.allsky.bnd_flux_dn_dir;
   Kokkos::parallel_for(MDRP::template get<3>({nbnd,nlay+1,nday}), KOKKOS_LAMBDA(int ibnd, int ilev, int iday) {
     const int icol = dayIndices(iday);
     bnd_flux_up    (icol,ilev,ibnd) = bnd_flux_up_day    (iday,ilev,ibnd);
     bnd_flux_dn    (icol,ilev,ibnd) = bnd_flux_dn_day    (iday,ilev,ibnd);
     bnd_flux_dn_dir(icol,ilev,ibnd) = bnd_flux_dn_dir_day(iday,ilev,ibnd);
   });
-
-  if (extra_clnsky_diag) {
-    // First increment clouds in optics_no_aerosols
-    clouds_day.increment(optics_no_aerosols);
-    // Compute cleansky (gas + clouds) fluxes on daytime columns
-    rte_sw(optics_no_aerosols, top_at_1, mu0_day, toa_flux, sfc_alb_dir_T, sfc_alb_dif_T, fluxes_day);
-    // Expand daytime fluxes to all columns
-    Kokkos::parallel_for(MDRP::template get<2>({nlay+1,nday}), KOKKOS_LAMBDA(int ilev, int iday) {
-      const int icol = dayIndices(iday);
-      clnsky_flux_up    (icol,ilev) = flux_up_day    (iday,ilev);
-      clnsky_flux_dn    (icol,ilev) = flux_dn_day    (iday,ilev);
-      clnsky_flux_dn_dir(icol,ilev) = flux_dn_dir_day(iday,ilev);
-    });
-  }
 }
 
 /*
@@ -1625,6 +1625,255 @@ TEST_CASE("rrtmgp_aerocom_cloudtop_k") {
   // cleanup
   scream::finalize_kls();
 }
+
+TEST_CASE("rrtmgp_day_indices_k") {
+  scream::init_kls();
+  const int ncol = 10;
+  auto mu0 = real1dk("mu0", ncol);
+  auto day_indices = int1dk("day_indices", ncol);
+  Kokkos::parallel_for(ncol, KOKKOS_LAMBDA(int icol) {
+    // Sunlit columns: 1,2,5,8
+    mu0(icol) = (icol==1 || icol==2 || icol==5 || icol==8) ? 0.5 : (icol%2==0 ? 0 : -0.5);
+  });
+  const int nday = interface_t::compute_day_indices(ncol, mu0, day_indices);
+  REQUIRE(nday == 4);
+  auto day_indices_h = chc(day_indices);
+  REQUIRE(day_indices_h(0) == 1);
+  REQUIRE(day_indices_h(1) == 2);
+  REQUIRE(day_indices_h(2) == 5);
+  REQUIRE(day_indices_h(3) == 8);
+
+  // No sunlit columns
+  Kokkos::deep_copy(mu0, 0);
+  REQUIRE(interface_t::compute_day_indices(ncol, mu0, day_indices) == 0);
+  scream::finalize_kls();
+}
+
+TEST_CASE("rrtmgp_sw_balance_plan") {
+  // Daytime columns on each rank: all on the "day side" ranks
+  const std::vector<int> nday = {0, 7, 10, 0, 0};
+  const int nranks = nday.size();
+  const int ntot = 17;
+
+  int nwork_tot = 0;
+  std::vector<std::vector<int>> sent(nranks), recvd(nranks);
+  for (int rank = 0; rank < nranks; ++rank) {
+    auto plan = interface_t::compute_sw_balance_plan(nday, rank);
+
+    // Work is balanced
+    REQUIRE((plan.nwork == ntot/nranks || plan.nwork == ntot/nranks+1));
+    nwork_tot += plan.nwork;
+
+    // Each rank sends all its columns, and receives what it computes
+    int nsend = 0, nrecv = 0;
+    for (int r = 0; r < nranks; ++r) {
+      REQUIRE(plan.send_offs[r] == nsend);
+      REQUIRE(plan.recv_offs[r] == nrecv);
+      nsend += plan.send_cols[r];
+      nrecv += plan.recv_cols[r];
+    }
+    REQUIRE(nsend == nday[rank]);
+    REQUIRE(nrecv == plan.nwork);
+    sent[rank]  = plan.send_cols;
+    recvd[rank] = plan.recv_cols;
+  }
+  REQUIRE(nwork_tot == ntot);
+
+  // What r1 sends to r2 is what r2 receives from r1
+  for (int r1 = 0; r1 < nranks; ++r1) {
+    for (int r2 = 0; r2 < nranks; ++r2) {
+      REQUIRE(sent[r1][r2] == recvd[r2][r1]);
+    }
+  }
+}
+
+TEST_CASE("rrtmgp_sw_balance_bfb_k") {
+  using namespace ekat::logger;
+  using logger_t = Logger<LogNoFile,LogRootRank>;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+  auto logger = std::make_shared<logger_t>("",LogLevel::info,comm);
+
+  scream::init_kls();
+
+  const int ncol = 8;
+  const int nlay = 16;
+  GasConcsK<scream::Real, Kokkos::LayoutRight, DefaultDevice> gas_concs;
+  string1dv gas_names = {"h2o", "co2", "o3", "n2o", "co", "ch4", "o2", "n2"};
+  gas_concs.init(gas_names,ncol,nlay);
+  interface_t::rrtmgp_initialize(gas_concs, coefficients_file_sw, coefficients_file_lw, cloud_optics_file_sw, cloud_optics_file_lw, logger);
+  const int nswbands = interface_t::k_dist_sw_k.get_nband();
+  const int nlwbands = interface_t::k_dist_lw_k.get_nband();
+  const int nswgpts  = interface_t::k_dist_sw_k.get_ngpt();
+  const int nlwgpts  = interface_t::k_dist_lw_k.get_ngpt();
+
+  // A simple cloudy atmosphere, which changes with the global column index.
+  // Only the first half of the ranks has daytime columns (and only some of them),
+  // so that balancing the work has to move columns across ranks.
+  const int col_offset = comm.rank()*ncol;
+  const bool day_rank = comm.rank() < (comm.size()+1)/2;
+  real2dk p_lay("p_lay", ncol, nlay), t_lay("t_lay", ncol, nlay);
+  real2dk p_lev("p_lev", ncol, nlay+1), t_lev("t_lev", ncol, nlay+1);
+  real2dk lwp("lwp", ncol, nlay), iwp("iwp", ncol, nlay);
+  real2dk rel("rel", ncol, nlay), rei("rei", ncol, nlay), cld("cld", ncol, nlay);
+  real2dk sfc_alb_dir("sfc_alb_dir", ncol, nswbands), sfc_alb_dif("sfc_alb_dif", ncol, nswbands);
+  real1dk mu0("mu0", ncol);
+  Kokkos::parallel_for(MDRP::template get<2>({nlay+1,ncol}), KOKKOS_LAMBDA(int ilev, int icol) {
+    p_lev(icol,ilev) = 100 + (100000-100)*scream::Real(ilev)/nlay;
+    t_lev(icol,ilev) = 200 + 90*scream::Real(ilev)/nlay + 0.25*(col_offset+icol);
+  });
+  Kokkos::parallel_for(MDRP::template get<2>({nlay,ncol}), KOKKOS_LAMBDA(int ilay, int icol) {
+    p_lay(icol,ilay) = (p_lev(icol,ilay) + p_lev(icol,ilay+1)) / 2;
+    t_lay(icol,ilay) = (t_lev(icol,ilay) + t_lev(icol,ilay+1)) / 2;
+    const bool cloudy = ilay>=nlay/2 && ilay<nlay/2+3;
+    cld(icol,ilay) = cloudy ? 0.5 : 0;
+    lwp(icol,ilay) = cloudy ? 20 : 0;
+    iwp(icol,ilay) = cloudy ? 5 : 0;
+    rel(icol,ilay) = 10;
+    rei(icol,ilay) = 40;
+  });
+  Kokkos::parallel_for(MDRP::template get<2>({nswbands,ncol}), KOKKOS_LAMBDA(int ibnd, int icol) {
+    sfc_alb_dir(icol,ibnd) = 0.06;
+    sfc_alb_dif(icol,ibnd) = 0.08;
+  });
+  Kokkos::parallel_for(ncol, KOKKOS_LAMBDA(int icol) {
+    mu0(icol) = (day_rank && icol%4!=3) ? 0.1 + 0.1*icol : 0;
+  });
+  const std::vector<scream::Real> vmrs = {0, 4e-4, 1e-7, 3e-7, 1e-7, 1.8e-6, 0.21, 0.78};
+  for (size_t igas = 0; igas < gas_names.size(); ++igas) {
+    real2dk vmr("vmr", ncol, nlay);
+    const scream::Real v = vmrs[igas];
+    Kokkos::parallel_for(MDRP::template get<2>({nlay,ncol}), KOKKOS_LAMBDA(int ilay, int icol) {
+      // Only h2o changes with height
+      vmr(icol,ilay) = v>0 ? v : 1e-5 + 1e-2*scream::Real(ilay)/nlay;
+    });
+    gas_concs.set_vmr(gas_names[igas], vmr);
+  }
+
+  // Aerosol optics are zero
+  real3dk aer_tau_sw("aer_tau_sw", ncol, nlay, nswbands);
+  real3dk aer_ssa_sw("aer_ssa_sw", ncol, nlay, nswbands);
+  real3dk aer_asm_sw("aer_asm_sw", ncol, nlay, nswbands);
+  real3dk aer_tau_lw("aer_tau_lw", ncol, nlay, nlwbands);
+
+  // Run rrtmgp, and return all the SW fluxes
+  auto run = [&](const ekat::Comm* balance_comm) {
+    std::vector<real2dk> f2d;
+    for (int i = 0; i < 12; ++i) {
+      f2d.push_back(real2dk("sw_flux", ncol, nlay+1));
+    }
+    std::vector<real2dk> lw2d;
+    for (int i = 0; i < 8; ++i) {
+      lw2d.push_back(real2dk("lw_flux", ncol, nlay+1));
+    }
+    std::vector<real3dk> f3d;
+    for (int i = 0; i < 3; ++i) {
+      f3d.push_back(real3dk("sw_bnd_flux", ncol, nlay+1, nswbands));
+    }
+    real3dk lw_bnd_flux_up ("lw_bnd_flux_up", ncol, nlay+1, nlwbands);
+    real3dk lw_bnd_flux_dn ("lw_bnd_flux_dn", ncol, nlay+1, nlwbands);
+    real3dk cld_tau_sw_bnd("cld_tau_sw_bnd", ncol, nlay, nswbands);
+    real3dk cld_tau_lw_bnd("cld_tau_lw_bnd", ncol, nlay, nlwbands);
+    real3dk cld_tau_sw("cld_tau_sw", ncol, nlay, nswgpts);
+    real3dk cld_tau_lw("cld_tau_lw", ncol, nlay, nlwgpts);
+
+    interface_t::rrtmgp_main(
+      ncol, nlay,
+      p_lay, t_lay, p_lev, t_lev, gas_concs,
+      sfc_alb_dir, sfc_alb_dif, mu0,
+      lwp, iwp, rel, rei, cld,
+      aer_tau_sw, aer_ssa_sw, aer_asm_sw, aer_tau_lw,
+      cld_tau_sw_bnd, cld_tau_lw_bnd,
+      cld_tau_sw, cld_tau_lw,
+      f2d[0], f2d[1], f2d[2],
+      lw2d[0], lw2d[1],
+      f2d[3], f2d[4], f2d[5],
+      f2d[6], f2d[7], f2d[8],
+      f2d[9], f2d[10], f2d[11],
+      lw2d[2], lw2d[3],
+      lw2d[4], lw2d[5],
+      lw2d[6], lw2d[7],
+      f3d[0], f3d[1], f3d[2],
+      lw_bnd_flux_up, lw_bnd_flux_dn, 1, logger,
+      true, true,
+      balance_comm);
+    return std::make_pair(f2d,f3d);
+  };
+
+  const auto ref = run(nullptr);
+  const auto bal = run(&comm);
+
+  // Balancing only changes where columns are computed: fluxes must be bfb
+  for (size_t i = 0; i < ref.first.size(); ++i) {
+    const auto ref_h = chc(ref.first[i]);
+    const auto bal_h = chc(bal.first[i]);
+    for (int icol = 0; icol < ncol; ++icol) {
+      for (int ilev = 0; ilev < nlay+1; ++ilev) {
+        REQUIRE(bal_h(icol,ilev) == ref_h(icol,ilev));
+      }
+    }
+  }
+  for (size_t i = 0; i < ref.second.size(); ++i) {
+    const auto ref_h = chc(ref.second[i]);
+    const auto bal_h = chc(bal.second[i]);
+    for (int icol = 0; icol < ncol; ++icol) {
+      for (int ilev = 0; ilev < nlay+1; ++ilev) {
+        for (int ibnd = 0; ibnd < nswbands; ++ibnd) {
+          REQUIRE(bal_h(icol,ilev,ibnd) == ref_h(icol,ilev,ibnd));
+        }
+      }
+    }
+  }
+
+  // Sanity check: daytime columns do see some sunlight
+  if (day_rank) {
+    REQUIRE(chc(ref.first[1])(0,nlay) > 0);
+  }
+
+  interface_t::rrtmgp_finalize();
+  gas_concs.reset();
+  scream::finalize_kls();
+}
 #endif
 
+TEST_CASE("rrtmgp_test_radiation_chunks_to_update") {
+  using scream::rrtmgp::radiation_chunks_to_update;
+
+  // No radiation at all
+  REQUIRE(radiation_chunks_to_update(0, 4, 0, true) == std::make_pair(0,0));
+
+  for (int irad : {2, 3, 5}) {
+    for (int nchunks = 1; nchunks <= 12; ++nchunks) {
+      // A full update (on the first step of a run, be it initial or restarted)
+      // updates all chunks, regardless of the step
+      for (int nstep : {0, 1, irad+1}) {
+        REQUIRE(radiation_chunks_to_update(irad, nchunks, nstep, true) == std::make_pair(0,nchunks));
+      }
+
+      // Any irad consecutive steps update each chunk exactly once, starting from
+      // any step (e.g., the one after a restart), and the pattern repeats every irad steps
+      for (int nstep0 = 0; nstep0 < 2*irad; ++nstep0) {
+        std::vector<int> count(nchunks,0);
+        for (int nstep = nstep0; nstep < nstep0+irad; ++nstep) {
+          const auto chunks = radiation_chunks_to_update(irad, nchunks, nstep, false);
+          REQUIRE(chunks.first <= chunks.second);
+          for (int ic = chunks.first; ic < chunks.second; ++ic) {
+            ++count[ic];
+          }
+          REQUIRE(chunks == radiation_chunks_to_update(irad, nchunks, nstep+irad, false));
+        }
+        for (int ic = 0; ic < nchunks; ++ic) {
+          REQUIRE(count[ic] == 1);
+        }
+      }
+
+      // Steps update at most ceil(nchunks/irad) chunks
+      for (int nstep = 0; nstep < irad; ++nstep) {
+        const auto chunks = radiation_chunks_to_update(irad, nchunks, nstep, false);
+        REQUIRE(chunks.second-chunks.first <= (nchunks+irad-1)/irad);
+      }
+    }
+  }
+}
+
 }
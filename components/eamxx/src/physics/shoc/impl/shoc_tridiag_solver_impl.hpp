@@ -81,18 +81,77 @@ void Functions<S,D>::vd_shoc_solve(
   const uview_1d<Scalar>& du,
   const uview_1d<Scalar>& dl,
   const uview_1d<Scalar>& d,
-  const uview_2d<Spack>&  var)
+  const uview_2d<Spack>&  var,
+  const TridiagSolver     solver)
 {
-#ifdef EKAT_DEFAULT_BFB
-  ekat::tridiag::bfb(team, dl, d, du, var);
-#else
-#ifdef EAMXX_ENABLE_GPU
-  ekat::tridiag::cr(team, dl, d, du, ekat::scalarize(var));
-#else
-  const auto f = [&] () { ekat::tridiag::thomas(dl, d, du, var); };
-  Kokkos::single(Kokkos::PerTeam(team), f);
-#endif
-#endif
+  switch (solver) {
+    case TridiagSolver::Thomas:
+    {
+      const auto f = [&] () { ekat::tridiag::thomas(dl, d, du, var); };
+      Kokkos::single(Kokkos::PerTeam(team), f);
+      break;
+    }
+    case TridiagSolver::CR:
+      ekat::tridiag::cr(team, dl, d, du, ekat::scalarize(var));
+      break;
+    case TridiagSolver::BFB:
+      ekat::tridiag::bfb(team, dl, d, du, var);
+      break;
+    case TridiagSolver::Batched:
+      vd_shoc_solve_batched(team, du, dl, d, var, false);
+      break;
+    case TridiagSolver::BatchedBFB:
+      vd_shoc_solve_batched(team, du, dl, d, var, true);
+      break;
+  }
+}
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>::vd_shoc_solve_batched(
+  const MemberType&      team,
+  const uview_1d<Scalar>& du,
+  const uview_1d<Scalar>& dl,
+  const uview_1d<Scalar>& d,
+  const uview_2d<Spack>&  var,
+  const bool              bfb)
+{
+  const Int nlev = d.extent(0);
+  const Int nrhs_pack = var.extent(1);
+
+  // Thomas factorization. It is sequential in the levels, but it is
+  // done only once for all the rhs.
+  Kokkos::single(Kokkos::PerTeam(team), [&] () {
+    for (Int k=1; k<nlev; ++k) {
+      dl(k) = dl(k)/d(k-1);
+      d(k)  = d(k) - dl(k)*du(k-1);
+    }
+    if (not bfb) {
+      for (Int k=0; k<nlev; ++k) {
+        d(k) = 1/d(k);
+      }
+    }
+  });
+  team.team_barrier();
+
+  // Forward and backward substitution. Each thread handles one pack of rhs,
+  // so that all loads of var are contiguous across the rhs dimension.
+  Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nrhs_pack), [&] (const Int& p) {
+    for (Int k=1; k<nlev; ++k) {
+      var(k,p) = var(k,p) - dl(k)*var(k-1,p);
+    }
+    if (bfb) {
+      var(nlev-1,p) = var(nlev-1,p)/d(nlev-1);
+      for (Int k=nlev-1; k>0; --k) {
+        var(k-1,p) = (var(k-1,p) - du(k-1)*var(k,p))/d(k-1);
+      }
+    } else {
+      var(nlev-1,p) = var(nlev-1,p)*d(nlev-1);
+      for (Int k=nlev-1; k>0; --k) {
+        var(k-1,p) = (var(k-1,p) - du(k-1)*var(k,p))*d(k-1);
+      }
+    }
+  });
 }
 
 } // namespace shoc
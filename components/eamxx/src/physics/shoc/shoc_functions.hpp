@@ -69,6 +69,27 @@ struct Functions
   using WorkspaceMgr = typename ekat::WorkspaceManager<Spack,  Device>;
   using Workspace    = typename WorkspaceMgr::Workspace;
 
+  // Algorithms available to vd_shoc_solve
+  enum class TridiagSolver {
+    Thomas,     // ekat::tridiag::thomas, run by a single thread of the team
+    CR,         // ekat::tridiag::cr, cyclic reduction (parallel over levels)
+    BFB,        // ekat::tridiag::bfb, BFB with the Fortran solver
+    Batched,    // vd_shoc_solve_batched, using the inverse of the pivots
+    BatchedBFB  // vd_shoc_solve_batched, with the arithmetic of the Fortran solver
+  };
+
+  // Solver used by vd_shoc_solve if none is specified
+  KOKKOS_INLINE_FUNCTION
+  static constexpr TridiagSolver default_tridiag_solver () {
+#ifdef EKAT_DEFAULT_BFB
+    return TridiagSolver::BFB;
+#elif defined(EAMXX_ENABLE_GPU)
+    return TridiagSolver::CR;
+#else
+    return TridiagSolver::Batched;
+#endif
+  }
+
   // This struct stores runtime options for shoc_main
  struct SHOCRuntime {
    SHOCRuntime() = default;
@@ -1205,7 +1226,22 @@ struct Functions
     const uview_1d<Scalar>& du,
     const uview_1d<Scalar>& dl,
     const uview_1d<Scalar>& d,
-    const uview_2d<Spack>&  var);
+    const uview_2d<Spack>&  var,
+    const TridiagSolver     solver = default_tridiag_solver());
+
+  // Factorizes the matrix once, then solves for all the rhs (the columns of var).
+  // Each thread of the team sweeps the levels of one pack of rhs. If bfb=true,
+  // the operations match those of the Fortran vd_shoc_decomp/vd_shoc_solve.
+  // Otherwise, the pivots are inverted once, to avoid divisions in the sweeps.
+  // Like the ekat solvers, it overwrites dl and d.
+  KOKKOS_FUNCTION
+  static void vd_shoc_solve_batched(
+    const MemberType&       team,
+    const uview_1d<Scalar>& du,
+    const uview_1d<Scalar>& dl,
+    const uview_1d<Scalar>& d,
+    const uview_2d<Spack>&  var,
+    const bool              bfb);
 
   KOKKOS_FUNCTION
   static void pblintd_surf_temp(const Int& nlev, const Int& nlevi, const Int& npbl,
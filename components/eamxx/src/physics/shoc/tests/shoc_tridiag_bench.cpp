@@ -0,0 +1,140 @@
+#include "shoc_functions.hpp"
+
+#include "share/scream_types.hpp"
+#include "share/scream_session.hpp"
+
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+#include "ekat/util/ekat_test_utils.hpp"
+#include "ekat/ekat_assert.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+using namespace scream;
+using namespace scream::shoc;
+
+/* shoc_tridiag_bench times the implicit diffusion solve of SHOC (vd_shoc_decomp
+ * followed by vd_shoc_solve) for each of the available tridiagonal solvers,
+ * on ncol columns with nlev levels and nrhs right hand sides (in SHOC, the
+ * number of tracers plus thl, qw, and tke).
+ */
+
+using SHF        = Functions<Real, DefaultDevice>;
+using Scalar     = SHF::Scalar;
+using Spack      = SHF::Spack;
+using KT         = SHF::KT;
+using ExeSpace   = KT::ExeSpace;
+using MemberType = SHF::MemberType;
+using TS         = SHF::TridiagSolver;
+
+void expect_another_arg (int i, int argc) {
+  EKAT_REQUIRE_MSG(i != argc-1, "Expected another cmd-line arg.");
+}
+
+// Returns the average time (in seconds) of one decomp+solve on all columns
+double run (const TS solver, const Int ncol, const Int nlev, const Int nrhs,
+            const Int repeat)
+{
+  const Int nlevi = nlev+1;
+  const Int nlevi_pack = ekat::npack<Spack>(nlevi);
+  const Int nlev_pack  = ekat::npack<Spack>(nlev);
+  const Int rhs_pack   = ekat::npack<Spack>(nrhs);
+
+  SHF::view_2d<Spack>  kv_term("kv_term", ncol, nlevi_pack), tmpi("tmpi", ncol, nlevi_pack),
+                       rdp_zt("rdp_zt", ncol, nlev_pack);
+  SHF::view_2d<Scalar> du("du", ncol, nlev), dl("dl", ncol, nlev), d("d", ncol, nlev);
+  SHF::view_3d<Spack>  var("var", ncol, nlev, rhs_pack);
+
+  // Values of the right order of magnitude for a 72 levels column, with dt=300s.
+  // The system is diagonally dominant, so the solution stays bounded across repetitions.
+  Kokkos::deep_copy(kv_term, Spack(10));
+  Kokkos::deep_copy(tmpi, Spack(0.02));
+  Kokkos::deep_copy(rdp_zt, Spack(0.005));
+  Kokkos::deep_copy(var, Spack(1));
+
+  const Scalar dtime = 300;
+  const Scalar flux  = 0;
+  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, nlev_pack);
+  auto kernel = KOKKOS_LAMBDA(const MemberType& team) {
+    const Int i = team.league_rank();
+    const auto du_s  = ekat::subview(du, i);
+    const auto dl_s  = ekat::subview(dl, i);
+    const auto d_s   = ekat::subview(d, i);
+    const auto var_s = Kokkos::subview(var, i, Kokkos::ALL(), Kokkos::ALL());
+
+    SHF::vd_shoc_decomp(team, nlev, ekat::subview(kv_term, i), ekat::subview(tmpi, i),
+                        ekat::subview(rdp_zt, i), dtime, flux, du_s, dl_s, d_s);
+    team.team_barrier();
+    SHF::vd_shoc_solve(team, du_s, dl_s, d_s, var_s, solver);
+  };
+
+  // Warmup
+  Kokkos::parallel_for(policy, kernel);
+  Kokkos::fence();
+
+  const auto start = std::chrono::steady_clock::now();
+  for (Int r = 0; r < repeat; ++r) {
+    Kokkos::parallel_for(policy, kernel);
+  }
+  Kokkos::fence();
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  return elapsed.count()/repeat;
+}
+
+} // namespace anon
+
+int main (int argc, char** argv) {
+  Int ncol = 128;
+  Int nlev = 72;
+  Int nrhs = 43;
+  Int repeat = 100;
+  for (int i = 1; i < argc; ++i) {
+    if (ekat::argv_matches(argv[i], "-i", "--ncol")) {
+      expect_another_arg(i, argc);
+      ++i;
+      ncol = std::atoi(argv[i]);
+    }
+    if (ekat::argv_matches(argv[i], "-k", "--nlev")) {
+      expect_another_arg(i, argc);
+      ++i;
+      nlev = std::atoi(argv[i]);
+    }
+    if (ekat::argv_matches(argv[i], "-q", "--nrhs")) {
+      expect_another_arg(i, argc);
+      ++i;
+      nrhs = std::atoi(argv[i]);
+    }
+    if (ekat::argv_matches(argv[i], "-r", "--repeat")) {
+      expect_another_arg(i, argc);
+      ++i;
+      repeat = std::atoi(argv[i]);
+    }
+  }
+  EKAT_REQUIRE_MSG (ncol>0 && nlev>1 && nrhs>0 && repeat>0,
+      "Error! Invalid benchmark sizes.\n");
+
+  const std::vector<std::pair<TS,std::string>> solvers = {
+    {TS::Thomas,     "thomas"},
+    {TS::CR,         "cr"},
+    {TS::BFB,        "bfb"},
+    {TS::Batched,    "batched"},
+    {TS::BatchedBFB, "batched_bfb"}
+  };
+
+  scream::initialize_scream_session(argc, argv); {
+    printf("shoc_tridiag_bench> ncol %d nlev %d nrhs %d repeat %d pack size %d\n",
+           ncol, nlev, nrhs, repeat, Spack::n);
+    for (const auto& s : solvers) {
+      const double t = run(s.first, ncol, nlev, nrhs, repeat);
+      printf("shoc_tridiag_bench> %12s %12.3e s/call\n", s.second.c_str(), t);
+    }
+  } scream::finalize_scream_session();
+
+  return 0;
+}
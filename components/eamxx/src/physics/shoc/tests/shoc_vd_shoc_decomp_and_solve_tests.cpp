@@ -9,6 +9,10 @@
 
 #include "shoc_unit_tests_common.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 namespace scream {
 namespace shoc {
 namespace unit_test {
@@ -79,6 +83,113 @@ struct UnitWrap::UnitTest<D>::TestVdShocDecompandSolve {
     }
   } // run_bfb
 
+  // Run decomp and solve on the data (C layout), using the given solver
+  static std::vector<Real> solve(const VdShocDecompandSolveData& data,
+                                 const typename Functions::TridiagSolver solver)
+  {
+    const Int shcol = data.shcol, nlev = data.nlev, nlevi = data.nlevi, n_rhs = data.n_rhs;
+    const Int nlevi_pack = ekat::npack<Spack>(nlevi);
+    const Int nlev_pack  = ekat::npack<Spack>(nlev);
+    const Int rhs_pack   = ekat::npack<Spack>(n_rhs);
+
+    view_2d<Spack>  kv_term("kv_term", shcol, nlevi_pack), tmpi("tmpi", shcol, nlevi_pack),
+                    rdp_zt("rdp_zt", shcol, nlev_pack);
+    view_1d<Scalar> flux("flux", shcol);
+    view_2d<Scalar> du("du", shcol, nlev), dl("dl", shcol, nlev), d("d", shcol, nlev);
+    view_3d<Spack>  var("var", shcol, nlev, rhs_pack);
+
+    auto kv_term_h = Kokkos::create_mirror_view(kv_term);
+    auto tmpi_h    = Kokkos::create_mirror_view(tmpi);
+    auto rdp_zt_h  = Kokkos::create_mirror_view(rdp_zt);
+    auto flux_h    = Kokkos::create_mirror_view(flux);
+    auto var_h     = Kokkos::create_mirror_view(var);
+    for (Int i = 0; i < shcol; ++i) {
+      flux_h(i) = data.flux[i];
+      for (Int k = 0; k < nlevi; ++k) {
+        kv_term_h(i, k/Spack::n)[k%Spack::n] = data.kv_term[i*nlevi + k];
+        tmpi_h(i, k/Spack::n)[k%Spack::n]    = data.tmpi[i*nlevi + k];
+      }
+      for (Int k = 0; k < nlev; ++k) {
+        rdp_zt_h(i, k/Spack::n)[k%Spack::n] = data.rdp_zt[i*nlev + k];
+        for (Int q = 0; q < n_rhs; ++q) {
+          var_h(i, k, q/Spack::n)[q%Spack::n] = data.var[(i*nlev + k)*n_rhs + q];
+        }
+      }
+    }
+    Kokkos::deep_copy(kv_term, kv_term_h);
+    Kokkos::deep_copy(tmpi, tmpi_h);
+    Kokkos::deep_copy(rdp_zt, rdp_zt_h);
+    Kokkos::deep_copy(flux, flux_h);
+    Kokkos::deep_copy(var, var_h);
+
+    const Scalar dtime = data.dtime;
+    const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(shcol, nlev_pack);
+    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+      const Int i = team.league_rank();
+      const auto du_s  = ekat::subview(du, i);
+      const auto dl_s  = ekat::subview(dl, i);
+      const auto d_s   = ekat::subview(d, i);
+      const auto var_s = Kokkos::subview(var, i, Kokkos::ALL(), Kokkos::ALL());
+
+      Functions::vd_shoc_decomp(team, nlev, ekat::subview(kv_term, i), ekat::subview(tmpi, i),
+                                ekat::subview(rdp_zt, i), dtime, flux(i), du_s, dl_s, d_s);
+      team.team_barrier();
+      Functions::vd_shoc_solve(team, du_s, dl_s, d_s, var_s, solver);
+    });
+
+    Kokkos::deep_copy(var_h, var);
+    std::vector<Real> result(shcol*nlev*n_rhs);
+    for (Int i = 0; i < shcol; ++i) {
+      for (Int k = 0; k < nlev; ++k) {
+        for (Int q = 0; q < n_rhs; ++q) {
+          result[(i*nlev + k)*n_rhs + q] = var_h(i, k, q/Spack::n)[q%Spack::n];
+        }
+      }
+    }
+    return result;
+  }
+
+  static void run_solvers()
+  {
+    using TS = typename Functions::TridiagSolver;
+
+    auto engine = setup_random_test();
+
+    VdShocDecompandSolveData f90_data[] = {
+      // shcol, nlev, nlevi, dtime, n_rhs
+      VdShocDecompandSolveData(10, 72, 73, 5, 43),
+      VdShocDecompandSolveData(7, 16, 17, 1, 2),
+      VdShocDecompandSolveData(2, 7, 8, 1, 1)
+    };
+
+    for (auto& d_f90 : f90_data) {
+      d_f90.randomize(engine);
+      VdShocDecompandSolveData d_cxx(d_f90);
+
+      const auto thomas      = solve(d_cxx, TS::Thomas);
+      const auto cr          = solve(d_cxx, TS::CR);
+      const auto batched     = solve(d_cxx, TS::Batched);
+      const auto batched_bfb = solve(d_cxx, TS::BatchedBFB);
+
+      // All solvers agree up to round-off
+      const Real tol = std::is_same<Real,float>::value ? 1e-4 : 1e-10;
+      for (size_t k = 0; k < thomas.size(); ++k) {
+        const Real scale = std::max(Real(1), std::abs(thomas[k]));
+        REQUIRE(std::abs(cr[k]-thomas[k]) <= tol*scale);
+        REQUIRE(std::abs(batched[k]-thomas[k]) <= tol*scale);
+        REQUIRE(std::abs(batched_bfb[k]-thomas[k]) <= tol*scale);
+      }
+
+      // In bfb mode, the batched solver matches the Fortran solver
+      if (SCREAM_BFB_TESTING) {
+        vd_shoc_decomp_and_solve(d_f90);
+        for (Int k = 0; k < d_f90.total(d_f90.var); ++k) {
+          REQUIRE(d_f90.var[k] == batched_bfb[k]);
+        }
+      }
+    }
+  } // run_solvers
+
 };
 
 } // namespace unit_test
@@ -94,4 +205,11 @@ TEST_CASE("vd_shoc_solve_bfb", "[shoc]")
   TestStruct::run_bfb();
 }
 
+TEST_CASE("vd_shoc_solve_solvers", "[shoc]")
+{
+  using TestStruct = scream::shoc::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestVdShocDecompandSolve;
+
+  TestStruct::run_solvers();
+}
+
 } // empty namespace
@@ -1,6 +1,7 @@
 #include "eamxx_spa_process_interface.hpp"
 
 #include "share/util/scream_time_stamp.hpp"
+#include "share/field/field_utils.hpp"
 #include "share/io/scream_scorpio_interface.hpp"
 #include "share/property_checks/field_within_interval_check.hpp"
 
@@ -248,10 +249,24 @@ void SPA::run_impl (const double dt)
   /* Update time state and if the month has changed, update the data.*/
     SPAFunc::update_spa_timestate(SPADataReader,SPAIOPDataReader,ts,*SPAHorizInterp,SPATimeState,SPAData_start,SPAData_end);
 
+  // Consumers of the SPA outputs may declare they only need them on some steps
+  // (e.g., radiation only needs the aerosol optics on radiation steps). Only
+  // interpolate what is needed this step. Fields not updated keep their old values.
+  const int nsteps = timestamp().get_num_steps();
+  bool need_optics = false;
+  for (const std::string fname : {"aero_g_sw","aero_ssa_sw","aero_tau_sw","aero_tau_lw"}) {
+    need_optics |= is_field_needed(get_field_out(fname),nsteps);
+  }
+  const bool need_ccn = is_field_needed(get_field_out("nccn"),nsteps);
+  if (not need_optics and not need_ccn) {
+    return;
+  }
+
   // Call the main SPA routine to get interpolated aerosol forcings.
   const auto& pmid_tgt = get_field_in("p_mid").get_view<const Spack**>();
   SPAFunc::spa_main(SPATimeState, pmid_tgt, m_buffer.p_mid_src,
-                    SPAData_start,SPAData_end,m_buffer.spa_temp,SPAData_out);
+                    SPAData_start,SPAData_end,m_buffer.spa_temp,SPAData_out,
+                    need_optics);
 }
 
 // =========================================================================================
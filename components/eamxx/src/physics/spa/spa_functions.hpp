@@ -186,7 +186,8 @@ struct SPAFunctions
     const SPAInput&   data_beg,
     const SPAInput&   data_end,
     const SPAInput&   data_tmp,         // Temporary
-    const SPAOutput&  data_out);
+    const SPAOutput&  data_out,
+    const bool        aero_optics = true);  // If false, only CCN is computed
 
   static void update_spa_data_from_file(
     std::shared_ptr<AtmosphereInput>& scorpio_reader,
@@ -210,7 +211,8 @@ struct SPAFunctions
       const SPATimeState& time_state,
       const SPAInput&  data_beg,
       const SPAInput&  data_end,
-      const SPAInput&  data_out);
+      const SPAInput&  data_out,
+      const bool       aero_optics = true);
 
   static void compute_source_pressure_levels (
       const view_1d<const Real>& ps_src,
@@ -222,7 +224,8 @@ struct SPAFunctions
       const view_2d<const Spack>& p_src,
       const view_2d<const Spack>& p_tgt,
       const SPAData&  data_in,
-      const SPAData&  data_out);
+      const SPAData&  data_out,
+      const bool      aero_optics = true);
 
   // Return the subcolumn of the proper variable, where ivar
   // is a condensed idx for var and possibly band. In particular:
@@ -193,6 +193,8 @@ create_spa_data_reader (
 //      which can be different.)
 //   nswbands, nlwbands: The number of shortwave (sw) and longwave (lw) aerosol bands
 //     for the data that will be passed to radiation.
+//   aero_optics: If false, only CCN is interpolated, and the aerosol optics
+//     fields in data_out are left untouched.
 template <typename S, typename D>
 void SPAFunctions<S,D>
 ::spa_main(
@@ -202,7 +204,8 @@ void SPAFunctions<S,D>
   const SPAInput&   data_beg,
   const SPAInput&   data_end,
   const SPAInput&   data_tmp,
-  const SPAOutput&  data_out)
+  const SPAOutput&  data_out,
+  const bool        aero_optics)
 {
   // Beg/End/Tmp month must have all sizes matching
   EKAT_REQUIRE_MSG (
@@ -233,13 +236,13 @@ void SPAFunctions<S,D>
       "       SPAInput and SPAOutput data structs must have the same number columns.\n");
 
   // Step 1. Perform time interpolation
-  perform_time_interpolation(time_state,data_beg,data_end,data_tmp);
+  perform_time_interpolation(time_state,data_beg,data_end,data_tmp,aero_optics);
 
   // Step 2. Compute source pressure levels
   compute_source_pressure_levels(data_tmp.PS, p_src, data_beg.hyam, data_beg.hybm);
 
   // Step 3. Perform vertical interpolation
-  perform_vertical_interpolation(p_src, p_tgt, data_tmp.data, data_out);
+  perform_vertical_interpolation(p_src, p_tgt, data_tmp.data, data_out, aero_optics);
 }
 
 /*-----------------------------------------------------------------*/
@@ -249,7 +252,8 @@ void SPAFunctions<S,D>
   const SPATimeState& time_state,
   const SPAInput&  data_beg,
   const SPAInput&  data_end,
-  const SPAInput&  data_out)
+  const SPAInput&  data_out,
+  const bool       aero_optics)
 {
   // NOTE: we *assume* data_beg and data_end have the *same* hybrid v coords.
   //       IF this ever ceases to be the case, you can interp those too.
@@ -270,8 +274,9 @@ void SPAFunctions<S,D>
   EKAT_REQUIRE(data_end.data.ncols==data_beg.data.ncols);
   EKAT_REQUIRE(data_end.data.nlevs==data_beg.data.nlevs);
 
-  // We can ||ize over columns as well as over variables and bands
-  const int num_vars = 1+data_beg.data.nswbands*3+data_beg.data.nlwbands;
+  // We can ||ize over columns as well as over variables and bands.
+  // Since CCN is the first variable, we can skip the optics by truncating the range.
+  const int num_vars = aero_optics ? 1+data_beg.data.nswbands*3+data_beg.data.nlwbands : 1;
   const int outer_iters = data_beg.data.ncols*num_vars;
   const int num_vert_packs = ekat::PackInfo<Spack::n>::num_packs(data_beg.data.nlevs);
   const auto policy = ESU::get_default_team_policy(outer_iters, num_vert_packs);
@@ -346,7 +351,8 @@ perform_vertical_interpolation(
   const view_2d<const Spack>& p_src,
   const view_2d<const Spack>& p_tgt,
   const SPAData& input,
-  const SPAData& output)
+  const SPAData& output,
+  const bool     aero_optics)
 {
   using ExeSpace = typename KT::ExeSpace;
   using ESU = ekat::ExeSpaceUtils<ExeSpace>;
@@ -366,7 +372,7 @@ perform_vertical_interpolation(
   LIV vert_interp(ncols,nlevs_src,nlevs_tgt);
 
   // We can ||ize over columns as well as over variables and bands
-  const int num_vars = 1+input.nswbands*3+input.nlwbands;
+  const int num_vars = aero_optics ? 1+input.nswbands*3+input.nlwbands : 1;
   const int num_vert_packs = ekat::PackInfo<Spack::n>::num_packs(nlevs_tgt);
   const auto policy_setup = ESU::get_default_team_policy(ncols, num_vert_packs);
 
@@ -39,6 +39,7 @@ void AtmosphereDiagnostic::compute_diagnostic (const double dt) {
       "  - Diag name: " + name() + "\n");
 
   m_diagnostic_output.get_header().get_tracking().update_time_stamp(ts);
+  m_diagnostic_output.get_header().get_tracking().increment_version();
 
   // Note: call the impl method *after* setting the diag time stamp.
   // Some derived classes may "refuse" to compute the diag, due to some
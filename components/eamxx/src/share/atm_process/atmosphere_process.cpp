@@ -89,55 +89,93 @@ void AtmosphereProcess::initialize (const TimeStamp& t0, const RunType run_type)
 void AtmosphereProcess::run (const double dt) {
   m_atm_logger->debug("[EAMxx::" + this->name() + "] run...");
   start_timer (m_timer_prefix + this->name() + "::run");
-  if (m_params.get("enable_precondition_checks", true)) {
-    // Run 'pre-condition' property checks stored in this AP
-    run_precondition_checks();
+
+  const bool perf = perf_counters_enabled();
+  PerfCounterValues counters_start;
+  if (perf) {
+    counters_start = get_perf_counters();
   }
+  {
+    // Time everything except the perf counters bookkeeping
+    PerfTimer total_timer (m_perf_record.time_total);
+
+    if (m_params.get("enable_precondition_checks", true)) {
+      // Run 'pre-condition' property checks stored in this AP
+      PerfTimer timer (m_perf_record.time_property_checks);
+      run_precondition_checks();
+    }
 
-  // Let the derived class do the actual run
-  auto dt_sub = dt / m_num_subcycles;
+    // Let the derived class do the actual run
+    auto dt_sub = dt / m_num_subcycles;
 
-  // Init single step tendencies (if any) with current value of output field
-  init_step_tendencies ();
+    // Init single step tendencies (if any) with current value of output field
+    {
+      PerfTimer timer (m_perf_record.time_tendencies);
+      init_step_tendencies ();
+    }
 
-  for (m_subcycle_iter=0; m_subcycle_iter<m_num_subcycles; ++m_subcycle_iter) {
+    for (m_subcycle_iter=0; m_subcycle_iter<m_num_subcycles; ++m_subcycle_iter) {
 
-    if (has_column_conservation_check()) {
-      // Column local mass and energy checks requires the total mass and energy
-      // to be computed directly before the atm process is run, as well and store
-      // the correct timestep for the process.
-      compute_column_conservation_checks_data(dt_sub);
-    }
+      if (has_column_conservation_check()) {
+        // Column local mass and energy checks requires the total mass and energy
+        // to be computed directly before the atm process is run, as well and store
+        // the correct timestep for the process.
+        PerfTimer timer (m_perf_record.time_conservation_checks);
+        compute_column_conservation_checks_data(dt_sub);
+      }
 
-    if (m_internal_diagnostics_level > 0)
-      print_global_state_hash(name() + "-pre-sc-" + std::to_string(m_subcycle_iter),
-                              true, false, false);
+      if (m_internal_diagnostics_level > 0)
+        print_global_state_hash(name() + "-pre-sc-" + std::to_string(m_subcycle_iter),
+                                true, false, false);
 
-    // Run derived class implementation
-    run_impl(dt_sub);
+      // Run derived class implementation
+      {
+        PerfTimer timer (m_perf_record.time_run_impl);
+        run_impl(dt_sub);
+      }
 
-    if (m_internal_diagnostics_level > 0)
-      print_global_state_hash(name() + "-pst-sc-" + std::to_string(m_subcycle_iter),
-                              true, true, true);
+      // Unlike time stamps, update counters are incremented at every subcycle
+      increment_fields_versions ();
 
-    if (has_column_conservation_check()) {
-      // Run the column local mass and energy conservation checks
-      run_column_conservation_check();
+      if (m_internal_diagnostics_level > 0)
+        print_global_state_hash(name() + "-pst-sc-" + std::to_string(m_subcycle_iter),
+                                true, true, true);
+
+      if (has_column_conservation_check()) {
+        // Run the column local mass and energy conservation checks
+        PerfTimer timer (m_perf_record.time_conservation_checks);
+        run_column_conservation_check();
+      }
     }
-  }
 
-  // Complete tendency calculations (if any)
-  compute_step_tendencies(dt);
+    // Complete tendency calculations (if any)
+    {
+      PerfTimer timer (m_perf_record.time_tendencies);
+      compute_step_tendencies(dt);
+    }
 
-  if (m_params.get("enable_postcondition_checks", true)) {
-    // Run 'post-condition' property checks stored in this AP
-    run_postcondition_checks();
+    if (m_params.get("enable_postcondition_checks", true)) {
+      // Run 'post-condition' property checks stored in this AP
+      PerfTimer timer (m_perf_record.time_property_checks);
+      run_postcondition_checks();
+    }
+
+    m_time_stamp += dt;
+    if (m_update_time_stamps) {
+      // Update all output fields time stamps
+      update_time_stamps ();
+    }
   }
 
-  m_time_stamp += dt;
-  if (m_update_time_stamps) {
-    // Update all output fields time stamps
-    update_time_stamps ();
+  if (perf) {
+    const auto counters_end = get_perf_counters();
+    auto& c = m_perf_record.counters;
+    c.kernel_launches += counters_end.kernel_launches - counters_start.kernel_launches;
+    c.num_allocations += counters_end.num_allocations - counters_start.num_allocations;
+    c.bytes_allocated += counters_end.bytes_allocated - counters_start.bytes_allocated;
+    c.bytes_h2d       += counters_end.bytes_h2d       - counters_start.bytes_h2d;
+    c.bytes_d2h       += counters_end.bytes_d2h       - counters_start.bytes_d2h;
+    ++m_perf_record.num_runs;
   }
   stop_timer (m_timer_prefix + this->name() + "::run");
 }
@@ -378,6 +416,11 @@ void AtmosphereProcess::run_property_check (const prop_check_ptr&       property
   } else if (res_and_msg.result==CheckResult::Repairable) {
     // Ok, we can fix this
     property_check->repair();
+    // The repair changed the fields values, so consumers caching data
+    // computed from them must see a new version
+    for (auto f : property_check->repairable_fields()) {
+      f->get_header().get_tracking().increment_version();
+    }
     log (m_repair_log_level,
       "WARNING: Failed and repaired " + pre_post_str + " property check.\n"
       "  - Atmosphere process name: " + name() + "\n"
@@ -461,10 +504,10 @@ void AtmosphereProcess::run_precondition_checks () const {
   m_atm_logger->debug("[" + this->name() + "] run_precondition_checks...");
   start_timer(m_timer_prefix + this->name() + "::run-precondition-checks");
   // Run all pre-condition property checks
-  for (const auto& it : m_precondition_checks) {
-    run_property_check(it.second, it.first,
-                       PropertyCheckCategory::Precondition);
-  }
+  run_property_checks(m_precondition_checks,
+                      m_precondition_checks_batch,
+                      m_precondition_checks_batch_idx,
+                      PropertyCheckCategory::Precondition);
   stop_timer(m_timer_prefix + this->name() + "::run-precondition-checks");
   m_atm_logger->debug("[" + this->name() + "] run_precondition_checks...done!");
 }
@@ -473,14 +516,50 @@ void AtmosphereProcess::run_postcondition_checks () const {
   m_atm_logger->debug("[" + this->name() + "] run_postcondition_checks...");
   start_timer(m_timer_prefix + this->name() + "::run-postcondition-checks");
   // Run all post-condition property checks
-  for (const auto& it : m_postcondition_checks) {
-    run_property_check(it.second, it.first,
-                       PropertyCheckCategory::Postcondition);
-  }
+  run_property_checks(m_postcondition_checks,
+                      m_postcondition_checks_batch,
+                      m_postcondition_checks_batch_idx,
+                      PropertyCheckCategory::Postcondition);
   stop_timer(m_timer_prefix + this->name() + "::run-postcondition-checks");
   m_atm_logger->debug("[" + this->name() + "] run_postcondition_checks...done!");
 }
 
+void AtmosphereProcess::
+run_property_checks (const std::list<std::pair<CheckFailHandling,prop_check_ptr>>& checks,
+                     std::shared_ptr<FieldChecksBatch>& batch,
+                     std::vector<int>&                  batch_idx,
+                     const PropertyCheckCategory        property_check_category) const
+{
+  if (batch==nullptr) {
+    batch = std::make_shared<FieldChecksBatch>();
+    batch_idx.clear();
+    for (const auto& it : checks) {
+      batch_idx.push_back(batch->add_check(it.second) ? batch->num_checks()-1 : -1);
+    }
+    batch->setup();
+  }
+
+  // Evaluate all batched checks in one go
+  batch->run();
+
+  // Run the full check for checks that did not pass or are not batched, so that
+  // the proper result (and diagnostic message) is computed. If a check repairs
+  // a field, the batch results for the remaining checks may be stale, so run them
+  // all in full from then on.
+  bool batch_valid = true;
+  int i = 0;
+  for (const auto& it : checks) {
+    const int ib = batch_idx[i++];
+    if (batch_valid and ib>=0 and batch->passed(ib)) {
+      continue;
+    }
+    run_property_check(it.second, it.first, property_check_category);
+    if (it.second->can_repair()) {
+      batch_valid = false;
+    }
+  }
+}
+
 void AtmosphereProcess::run_column_conservation_check () const {
   m_atm_logger->debug("[" + this->name() + "] run_column_conservation_check...");
   start_timer(m_timer_prefix + this->name() + "::run-column-conservation-checks");
@@ -552,6 +631,15 @@ bool AtmosphereProcess::has_computed_field (const std::string& name, const std::
   return false;
 }
 
+void AtmosphereProcess::declare_transient_field (const std::string& name, const std::string& grid_name) {
+  EKAT_REQUIRE_MSG (has_computed_field(name,grid_name),
+      "Error! Only computed fields can be declared transient.\n"
+      "   - atm process: " + this->name() + "\n"
+      "   - field name : " + name + "\n"
+      "   - grid name  : " + grid_name + "\n");
+  m_transient_fields[grid_name].insert(name);
+}
+
 bool AtmosphereProcess::has_required_group (const std::string& name, const std::string& grid) const {
   for (const auto& it : m_required_group_requests) {
     if (it.name==name && it.grid==grid) {
@@ -598,12 +686,31 @@ void AtmosphereProcess::update_time_stamps () {
   }
 }
 
+void AtmosphereProcess::increment_fields_versions () {
+  for (auto& f : m_fields_out) {
+    f.get_header().get_tracking().increment_version();
+  }
+  for (auto& g : m_groups_out) {
+    if (g.m_bundle) {
+      g.m_bundle->get_header().get_tracking().increment_version();
+    } else {
+      for (auto& f : g.m_fields) {
+        f.second->get_header().get_tracking().increment_version();
+      }
+    }
+  }
+}
+
 void AtmosphereProcess::add_me_as_provider (const Field& f) {
   f.get_header_ptr()->get_tracking().add_provider(weak_from_this());
 }
 
 void AtmosphereProcess::add_me_as_customer (const Field& f) {
   f.get_header_ptr()->get_tracking().add_customer(weak_from_this());
+
+  // Unless told otherwise (see declare_field_needed_every), assume we need f every step
+  auto f_copy = f;
+  declare_field_needed_every(f_copy,name(),1);
 }
 
 void AtmosphereProcess::add_internal_field (const Field& f) {
@@ -733,6 +840,7 @@ add_precondition_check (const prop_check_ptr& pc, const CheckFailHandling cfh)
         "  - Property check name: " + pc->name() + "\n");
   }
   m_precondition_checks.push_back(std::make_pair(cfh,pc));
+  m_precondition_checks_batch = nullptr;
 }
 
 void AtmosphereProcess::
@@ -780,6 +888,7 @@ add_postcondition_check (const prop_check_ptr& pc, const CheckFailHandling cfh)
         "  - Property check name: " + pc->name() + "\n");
   }
   m_postcondition_checks.push_back(std::make_pair(cfh,pc));
+  m_postcondition_checks_batch = nullptr;
 }
 
 void AtmosphereProcess::
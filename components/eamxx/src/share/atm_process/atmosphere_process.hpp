@@ -3,11 +3,13 @@
 
 #include "share/iop/intensive_observation_period.hpp"
 #include "share/atm_process/atmosphere_process_utils.hpp"
+#include "share/atm_process/atmosphere_process_perf.hpp"
 #include "share/atm_process/ATMBufferManager.hpp"
 #include "share/atm_process/SCDataManager.hpp"
 #include "share/field/field_identifier.hpp"
 #include "share/field/field_manager.hpp"
 #include "share/property_checks/property_check.hpp"
+#include "share/property_checks/field_checks_batch.hpp"
 #include "share/field/field_request.hpp"
 #include "share/field/field.hpp"
 #include "share/field/field_group.hpp"
@@ -128,6 +130,12 @@ public:
   //       or that of the output fields.
   void set_update_time_stamps (const bool do_update);
 
+  // Processes that leave part of their work running asynchronously at the end of
+  // run (e.g., on a host thread) must complete it here, making sure their output
+  // fields are up to date on device. The AD calls this at the end of each atm step,
+  // before the outputs are written.
+  virtual void finish_async_work () {}
+
   // These methods set fields/groups in the atm process. The fields/groups are stored
   // in a list (with some helpers maps that can be used to quickly retrieve them).
   // If derived class need additional bookkeping/checks, they can override the
@@ -181,6 +189,10 @@ public:
   const std::set<GroupRequest>& get_required_group_requests () const { return m_required_group_requests; }
   const std::set<GroupRequest>& get_computed_group_requests () const { return m_computed_group_requests; }
 
+  // Computed fields (as grid_name->field names) that this process declared transient
+  // (see declare_transient_field). Only these can share memory under the field memory planner.
+  const strmap_t<std::set<std::string>>& get_transient_fields () const { return m_transient_fields; }
+
   // These sets allow to get all the actual in/out fields stored by the atm proc
   // Note: if an atm proc requires a group, then all the fields in the group, as well as
   //       the bundled field (if present) will be added as required fields for this atm proc.
@@ -287,6 +299,10 @@ public:
     return m_atm_logger;
   }
 
+  // Performance record of this process (only filled if perf counters are enabled,
+  // see atmosphere_process_perf.hpp)
+  const AtmProcPerfRecord& get_perf_record () const { return m_perf_record; }
+
 protected:
 
   // Sends a message to the atm log
@@ -298,6 +314,12 @@ protected:
 
   int get_internal_diagnostics_level () const { return m_internal_diagnostics_level; }
 
+  // Declare that a computed field is entirely overwritten at every run of this process,
+  // before being read, and that its value is not needed at the next atm time step.
+  // Fields that are not rewritten at every step (e.g., only on radiation steps) must
+  // NOT be declared transient, since the field memory planner may reuse their memory.
+  void declare_transient_field (const std::string& name, const std::string& grid_name);
+
   // Derived classes can used these method, so that if we change how fields/groups
   // requirement are stored (e.g., change the std container), they don't need to change
   // their implementation.
@@ -419,8 +441,9 @@ protected:
   // This provides access to this process's timestamp.
   const TimeStamp& timestamp() const { return m_time_stamp; }
 
-  // These three methods modify the FieldTracking of the input field (see field_tracking.hpp)
+  // These methods modify the FieldTracking of the input field (see field_tracking.hpp)
   void update_time_stamps ();
+  void increment_fields_versions ();
   void add_me_as_provider (const Field& f);
   void add_me_as_customer (const Field& f);
 
@@ -515,6 +538,14 @@ private:
                            const CheckFailHandling     check_fail_handling,
                            const PropertyCheckCategory property_check_category) const;
 
+  // Run a list of property checks, evaluating the pointwise ones in a single
+  // fused kernel (see FieldChecksBatch), and running the full check only for
+  // the ones that did not pass (or that cannot be batched).
+  void run_property_checks (const std::list<std::pair<CheckFailHandling,prop_check_ptr>>& checks,
+                            std::shared_ptr<FieldChecksBatch>& batch,
+                            std::vector<int>&                  batch_idx,
+                            const PropertyCheckCategory        property_check_category) const;
+
   // NOTE: all these members are private, so that derived classes cannot
   //       bypass checks from the base class by accessing the members directly.
   //       Instead, they are forced to use access function, which include
@@ -547,10 +578,21 @@ private:
   std::set<GroupRequest>   m_required_group_requests;
   std::set<GroupRequest>   m_computed_group_requests;
 
+  // Computed fields that can be safely stored in transient memory
+  strmap_t<std::set<std::string>> m_transient_fields;
+
   // List of property checks for fields
   std::list<std::pair<CheckFailHandling,prop_check_ptr>> m_precondition_checks;
   std::list<std::pair<CheckFailHandling,prop_check_ptr>> m_postcondition_checks;
 
+  // Fused pointwise checks for the lists above. They are (re)built lazily at the
+  // first run after a check is added. For the i-th check in the list, the idx
+  // vector stores its position in the batch (or -1 if it cannot be batched).
+  mutable std::shared_ptr<FieldChecksBatch> m_precondition_checks_batch;
+  mutable std::shared_ptr<FieldChecksBatch> m_postcondition_checks_batch;
+  mutable std::vector<int> m_precondition_checks_batch_idx;
+  mutable std::vector<int> m_postcondition_checks_batch_idx;
+
   // Column local mass and energy conservation check
   std::pair<CheckFailHandling,prop_check_ptr> m_column_conservation_check;
 
@@ -587,6 +629,9 @@ private:
   // Controls global hashing output for debugging non-BFBness.
   int m_internal_diagnostics_level;
 
+  // Wall times and counters of the run method
+  AtmProcPerfRecord m_perf_record;
+
 protected:
 
   // IOP object
@@ -349,7 +349,8 @@ add_nodes (const group_type& atm_procs)
   const int num_procs = atm_procs.get_num_processes();
   const bool sequential = (atm_procs.get_schedule_type()==ScheduleType::Sequential);
 
-  EKAT_REQUIRE_MSG (sequential, "Error! Parallel splitting dag not yet supported.\n");
+  // In parallel splitting, the procs in the group only depend on nodes before the group
+  const int first_sibling = sequential ? -1 : m_nodes.size();
 
   for (int i=0; i<num_procs; ++i) {
     const auto proc = atm_procs.get_process(i);
@@ -370,6 +371,7 @@ add_nodes (const group_type& atm_procs)
       Node& node = m_nodes.back();;
       node.id = id;
       node.name = proc->name();
+      node.first_sibling = first_sibling;
       m_unmet_deps[id].clear(); // Ensures an entry for this id is in the map
 
       // Input fields
@@ -439,13 +441,16 @@ add_nodes (const group_type& atm_procs)
 
 void AtmProcDAG::add_edges () {
   for (auto& node : m_nodes) {
+    // Only nodes before this one (or before its parallel group) can be parents
+    const int max_parent_id = node.first_sibling>=0 ? node.first_sibling : node.id;
+
     // First individual input fields. Add this node as a children
     // of any *previous* node that computes them. If none provides
     // them, add to the unmet deps list
     for (auto id : node.required) {
       auto it = m_fid_to_last_provider.find(id);
       // Note: check that last provider id is SMALLER than this node id
-      if (it!=m_fid_to_last_provider.end() and it->second<node.id) {
+      if (it!=m_fid_to_last_provider.end() and it->second<max_parent_id) {
         auto parent_id = it->second;
         m_nodes[parent_id].children.push_back(node.id);
       } else {
@@ -468,7 +473,7 @@ void AtmProcDAG::add_edges () {
       // First check when the group as a whole was last updated
       auto it = m_fid_to_last_provider.find(id);
       // Note: check that last provider id is SMALLER than this node id
-      if (it!=m_fid_to_last_provider.end() and it->second<node.id) {
+      if (it!=m_fid_to_last_provider.end() and it->second<max_parent_id) {
         last_group_update_id = it->second;
       }
       // Then check when each group member was last updated
@@ -478,7 +483,7 @@ void AtmProcDAG::add_edges () {
         auto fid_id = std::find(m_fids.begin(),m_fids.end(),fid) - m_fids.begin();
         it = m_fid_to_last_provider.find(fid_id);
         // Note: check that last provider id is SMALLER than this node id
-        if (it!=m_fid_to_last_provider.end() and it->second<node.id) {
+        if (it!=m_fid_to_last_provider.end() and it->second<max_parent_id) {
           last_members_update_id[i] = it->second;
         }
         ++i;
@@ -507,6 +512,74 @@ void AtmProcDAG::add_edges () {
   }
 }
 
+AtmProcDAG::lifetimes_map AtmProcDAG::
+compute_field_lifetimes (const group_type& atm_procs) const
+{
+  lifetimes_map lifetimes;
+  int proc_idx = 0;
+  add_lifetimes(atm_procs,proc_idx,false,lifetimes);
+  return lifetimes;
+}
+
+void AtmProcDAG::
+add_lifetimes (const group_type& atm_procs, int& proc_idx,
+               const bool merged, lifetimes_map& lifetimes) const
+{
+  // Procs in a parallel group all read the state at the start of the group, and
+  // procs in a subcycled group run more than once per time step. Either way, the
+  // fields of all the procs in the group must be alive for the whole group, which
+  // we achieve by giving all the procs in the group the same index.
+  const bool merge = merged or
+                     atm_procs.get_schedule_type()!=ScheduleType::Sequential or
+                     atm_procs.get_num_subcycles()>1;
+
+  const int num_procs = atm_procs.get_num_processes();
+  for (int i=0; i<num_procs; ++i) {
+    const auto proc = atm_procs.get_process(i);
+    if (proc->type()==AtmosphereProcessType::Group) {
+      auto group = std::dynamic_pointer_cast<const group_type>(proc);
+      EKAT_REQUIRE_MSG(group, "Error! Unexpected failure in dynamic_pointer_cast.\n"
+                                "       Please, contact developers.\n");
+      add_lifetimes(*group,proc_idx,merge,lifetimes);
+      continue;
+    }
+
+    // Note: process inputs first, so that fields that are updated by the
+    //       first proc that touches them are marked as needed from prev step
+    for (const auto& req : proc->get_required_field_requests()) {
+      auto& lt = lifetimes[req.fid.get_grid_name()][req.fid.name()];
+      if (lt.first<0) {
+        lt.needed_from_prev_step = true;
+      }
+      lt.last = std::max(lt.last,proc_idx);
+    }
+    // Note: a proc may skip writing some of its outputs on some steps (e.g., rad
+    //       fluxes on non-rad steps), so a computed field is transient only if
+    //       ALL the procs computing it explicitly declared it as such.
+    const auto& transient = proc->get_transient_fields();
+    for (const auto& req : proc->get_computed_field_requests()) {
+      const auto& gn = req.fid.get_grid_name();
+      auto& lt = lifetimes[gn][req.fid.name()];
+      auto it = transient.find(gn);
+      if (it==transient.end() or it->second.count(req.fid.name())==0) {
+        lt.needed_from_prev_step = true;
+      }
+      if (lt.first<0 and not lt.needed_from_prev_step) {
+        lt.first = proc_idx;
+      }
+      lt.last = std::max(lt.last,proc_idx);
+    }
+
+    if (not merge) {
+      ++proc_idx;
+    }
+  }
+
+  if (merge and not merged) {
+    ++proc_idx;
+  }
+}
+
 int AtmProcDAG::add_fid (const FieldIdentifier& fid) {
   auto it = ekat::find(m_fids,fid);
   if (it==m_fids.end()) {
@@ -5,6 +5,7 @@
 #include <string>
 #include "share/atm_process/atmosphere_process_group.hpp"
 #include "share/field/field_group.hpp"
+#include "share/field/field_memory_planner.hpp"
 
 namespace scream {
 
@@ -26,6 +27,15 @@ public:
     return m_unmet_deps;
   }
 
+  // Map grid_name -> (field name -> lifetime within the atm time step)
+  using lifetimes_map = std::map<std::string,std::map<std::string,FieldLifetime>>;
+
+  // Compute the lifetime of each field within the atm time step (see FieldLifetime).
+  // Unlike create_dag, this only uses the field requests of the atm procs, so it
+  // can be called before fields are allocated (e.g., to plan their allocation).
+  // Only computed fields that all their providers declared transient can be transient.
+  lifetimes_map compute_field_lifetimes (const group_type& atm_procs) const;
+
 protected:
 
   void cleanup ();
@@ -44,10 +54,16 @@ protected:
 
   void update_unmet_deps ();
 
+  void add_lifetimes (const group_type& atm_procs, int& proc_idx,
+                      const bool merged, lifetimes_map& lifetimes) const;
+
   struct Node {
     std::vector<int>  children;
     std::string       name;
     int               id;
+    // In parallel groups, nodes do not depend on their siblings. This is the id
+    // of the first node in the parallel group (if any) containing this node.
+    int               first_sibling = -1;
     std::set<int>     computed;     // output fields
     std::set<int>     required;     // input  fields
     std::set<int>     gr_computed;  // output groups
@@ -24,7 +24,6 @@ AtmosphereProcessGroup (const ekat::Comm& comm, const ekat::ParameterList& param
       m_group_schedule_type = ScheduleType::Sequential;
     } else if (m_params.get<std::string>("schedule_type") == "Parallel") {
       m_group_schedule_type = ScheduleType::Parallel;
-      ekat::error::runtime_abort("Error! Parallel schedule not yet implemented.\n");
     } else {
       ekat::error::runtime_abort("Error! Invalid 'schedule_type'. Available choices are 'Parallel' and 'Sequential'.\n");
     }
@@ -46,25 +45,11 @@ AtmosphereProcessGroup (const ekat::Comm& comm, const ekat::ParameterList& param
   // so we don't expect users to register the APG in the factory.
   apf.register_product("group",&create_atmosphere_process<AtmosphereProcessGroup>);
   for (const auto& ap_name : group_list) {
-    // The comm to be passed to the processes construction is
-    //  - the same as the comm of this APG, if num_entries=1 or sched_type=Sequential
-    //  - a sub-comm of this APG's comm otherwise
+    // The comm to be passed to the processes construction is the same as the comm
+    // of this APG. Even with Parallel schedule, all atm procs run on all ranks,
+    // so we don't need to split the comm, nor to remap fields to/from a sub-comm
+    // distribution.
     ekat::Comm proc_comm = m_comm;
-    if (m_group_schedule_type==ScheduleType::Parallel) {
-      // This is what's going to happen when we implment this:
-      //  - the processes in the group are going to be run in parallel
-      //  - each rank is assigned ONE atm process
-      //  - all the atm processes not assigned to this rank will be filled with
-      //    an instance of "RemoteProcessStub" (to be implemented),
-      //    which is a do-nothing class, only responsible to keep track of dependencies
-      //  - the input parameter list should specify for each atm process the number
-      //    of mpi ranks dedicated to it. Obviously, these numbers should add up
-      //    to the size of the input communicator.
-      //  - this class is then responsible of 'combining' the results togehter,
-      //    including remapping input/output fields to/from the sub-comm
-      //    distribution.
-      EKAT_ERROR_MSG("Error! Parallel schedule type not yet implemented.\n");
-    }
 
     // Get the params of this atm proc
     auto& params_i = m_params.sublist(ap_name);
@@ -110,6 +95,8 @@ AtmosphereProcessGroup (const ekat::Comm& comm, const ekat::ParameterList& param
       ed2proc[it.first] = ap->name();
     }
   }
+
+  m_private_copies.resize(m_group_size);
 }
 
 std::shared_ptr<AtmosphereProcessGroup::atm_proc_type>
@@ -365,6 +352,17 @@ void AtmosphereProcessGroup::add_additional_data_fields_to_property_checks (cons
 }
 
 void AtmosphereProcessGroup::initialize_impl (const RunType run_type) {
+  // Private copies were cloned when fields were set, before ICs were loaded.
+  for (int iproc=0; iproc<m_group_size; ++iproc) {
+    for (auto& it : m_private_copies[iproc]) {
+      it.second.deep_copy(m_privatized_fields.at(it.first));
+      const auto& ts = m_privatized_fields.at(it.first).get_header().get_tracking().get_time_stamp();
+      if (ts.is_valid()) {
+        it.second.get_header().get_tracking().update_time_stamp(ts);
+      }
+    }
+  }
+
   for (auto& atm_proc : m_atm_processes) {
     atm_proc->initialize(timestamp(),run_type);
 #ifdef SCREAM_HAS_MEMORY_USAGE
@@ -374,6 +372,9 @@ void AtmosphereProcessGroup::initialize_impl (const RunType run_type) {
     m_atm_logger->debug("[EAMxx::initialize::"+atm_proc->name()+"] memory usage: " + std::to_string(max_mem_usage) + "MB");
 #endif
   }
+
+  // Some atm procs may set computed fields during initialization
+  merge_private_copies ();
 }
 
 void AtmosphereProcessGroup::run_impl (const double dt) {
@@ -407,8 +408,95 @@ void AtmosphereProcessGroup::run_sequential (const double dt) {
   }
 }
 
-void AtmosphereProcessGroup::run_parallel (const double /* dt */) {
-  EKAT_REQUIRE_MSG (false,"Error! Parallel splitting not yet implemented.\n");
+void AtmosphereProcessGroup::run_parallel (const double dt) {
+  // All atm procs must see the input state, so reset private copies
+  for (int iproc=0; iproc<m_group_size; ++iproc) {
+    for (auto& it : m_private_copies[iproc]) {
+      it.second.deep_copy(m_privatized_fields.at(it.first));
+      it.second.get_header().get_tracking().increment_version();
+    }
+  }
+
+  // The stored atm procs should update the timestamp if both
+  //  - this is the last subcycle iteration
+  //  - nobody from outside told this APG to not update timestamps
+  const bool do_update = do_update_time_stamp() &&
+                      (get_subcycle_iter()==get_num_subcycles()-1);
+  for (auto atm_proc : m_atm_processes) {
+    atm_proc->set_update_time_stamps(do_update);
+  }
+
+  // Note: "parallel" refers to the splitting, not to the execution: the atm procs
+  //       run one after the other, on the default exec space. Since each proc
+  //       computes on its own private copy, the result does not depend on the order.
+  for (auto atm_proc : m_atm_processes) {
+    atm_proc->run(dt);
+  }
+
+  merge_private_copies ();
+}
+
+bool AtmosphereProcessGroup::
+needs_private_copy (const int iproc, const FieldIdentifier& fid) const
+{
+  if (not m_atm_processes[iproc]->has_computed_field(fid)) {
+    return false;
+  }
+  for (int jproc=0; jproc<m_group_size; ++jproc) {
+    if (jproc!=iproc and (m_atm_processes[jproc]->has_computed_field(fid) or
+                          m_atm_processes[jproc]->has_required_field(fid))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+Field AtmosphereProcessGroup::
+get_private_copy (const int iproc, const Field& f)
+{
+  const auto& key = f.get_header().get_identifier().get_id_string();
+  auto& copies = m_private_copies[iproc];
+  auto it = copies.find(key);
+  if (it==copies.end()) {
+    it = copies.emplace(key,f.clone()).first;
+  }
+  return it->second;
+}
+
+void AtmosphereProcessGroup::merge_private_copies ()
+{
+  // Since the group field was not modified during the run, if k atm procs
+  // computed the field f, the merged value is
+  //   f + sum_i (f_i - f) = (1-k)*f + sum_i f_i
+  for (auto& it : m_privatized_fields) {
+    auto& f = it.second;
+    std::vector<Field> copies;
+    for (const auto& pc : m_private_copies) {
+      if (pc.count(it.first)==1) {
+        copies.push_back(pc.at(it.first));
+      }
+    }
+    const int k = copies.size();
+    if (k==1) {
+      f.deep_copy(copies[0]);
+      continue;
+    }
+
+    EKAT_REQUIRE_MSG (f.data_type()==DataType::RealType,
+        "Error! Cannot merge non-real fields computed by multiple atm procs in a parallel group.\n"
+        "  - group name: " + name() + "\n"
+        "  - field name: " + f.name() + "\n");
+    f.update(copies[0],Real(1),Real(1-k));
+    for (int i=1; i<k; ++i) {
+      f.update(copies[i],Real(1),Real(1));
+    }
+  }
+}
+
+void AtmosphereProcessGroup::finish_async_work () {
+  for (auto atm_proc : m_atm_processes) {
+    atm_proc->finish_async_work();
+  }
 }
 
 void AtmosphereProcessGroup::finalize_impl (/* what inputs? */) {
@@ -429,6 +517,7 @@ set_required_field (const Field& f) {
     // In parallel splitting, all required fields are *actual* inputs,
     // and the base class impl is fine.
     AtmosphereProcess::set_required_field(f);
+    return;
   }
 
   // Find the first process that requires this group
@@ -497,6 +586,7 @@ set_required_group (const FieldGroup& group) {
     // In parallel splitting, all required group are *actual* inputs,
     // and the base class impl is fine.
     AtmosphereProcess::set_required_group(group);
+    return;
   }
 
   // Find the first process that requires this group
@@ -582,6 +672,24 @@ set_required_group_impl (const FieldGroup& group)
 void AtmosphereProcessGroup::
 set_computed_group_impl (const FieldGroup& group)
 {
+  if (m_group_schedule_type==ScheduleType::Parallel) {
+    // We don't privatize groups (yet), so a group computed by an atm proc
+    // cannot be computed or required by another atm proc in the group.
+    int num_users = 0;
+    for (auto atm_proc : m_atm_processes) {
+      if (atm_proc->has_computed_group(group.m_info->m_group_name,group.grid_name()) or
+          atm_proc->has_required_group(group.m_info->m_group_name,group.grid_name())) {
+        ++num_users;
+      }
+    }
+    EKAT_REQUIRE_MSG (num_users<=1,
+        "Error! Parallel schedule does not support groups computed by an atm proc\n"
+        "       and computed/required by another atm proc in the same group.\n"
+        "  - atm proc group: " + name() + "\n"
+        "  - field group   : " + group.m_info->m_group_name + "\n"
+        "  - grid name     : " + group.grid_name() + "\n");
+  }
+
   for (auto atm_proc : m_atm_processes) {
     if (atm_proc->has_computed_group(group.m_info->m_group_name,group.grid_name())) {
       atm_proc->set_computed_group(group);
@@ -598,16 +706,35 @@ set_computed_group_impl (const FieldGroup& group)
 
 void AtmosphereProcessGroup::set_required_field_impl (const Field& f) {
   const auto& fid = f.get_header().get_identifier();
-  for (auto atm_proc : m_atm_processes) {
+  const bool parallel = m_group_schedule_type==ScheduleType::Parallel;
+  for (int iproc=0; iproc<m_group_size; ++iproc) {
+    auto atm_proc = m_atm_processes[iproc];
     if (atm_proc->has_required_field(fid)) {
-      atm_proc->set_required_field(f);
+      if (parallel and needs_private_copy(iproc,fid)) {
+        // This atm proc must read the same copy it updates
+        atm_proc->set_required_field(get_private_copy(iproc,f).get_const());
+      } else {
+        atm_proc->set_required_field(f);
+      }
     }
   }
 }
 
 void AtmosphereProcessGroup::set_computed_field_impl (const Field& f) {
   const auto& fid = f.get_header().get_identifier();
-  for (auto atm_proc : m_atm_processes) {
+  const bool parallel = m_group_schedule_type==ScheduleType::Parallel;
+  for (int iproc=0; iproc<m_group_size; ++iproc) {
+    auto atm_proc = m_atm_processes[iproc];
+    if (parallel and needs_private_copy(iproc,fid)) {
+      // This atm proc updates its own copy, which is merged into f after the run
+      m_privatized_fields[fid.get_id_string()] = f;
+      auto copy = get_private_copy(iproc,f);
+      atm_proc->set_computed_field(copy);
+      if (atm_proc->has_required_field(fid)) {
+        atm_proc->set_required_field(copy.get_const());
+      }
+      continue;
+    }
     if (atm_proc->has_computed_field(fid)) {
       atm_proc->set_computed_field(f);
     }
@@ -24,6 +24,17 @@ namespace scream
  *  The only caveat is required fields in sequential scheduling: if an atm proc
  *  requires a field that is computed by a previous atm proc in the group,
  *  that field is not exposed as a required field of the group.
+ *
+ *  In parallel scheduling, all atm procs see the same input state (the one at the
+ *  beginning of the group run). If a field is computed by an atm proc, and also
+ *  computed or required by another atm proc in the group, each atm proc computing
+ *  it works on a private copy. After all atm procs have run, the increments of
+ *  the private copies are summed into the group field.
+ *  NOTE: this only implements the parallel-split *semantics*. The atm procs are
+ *        still run one at a time (they are not thread-safe, and all launch on the
+ *        default exec space), so a parallel group is not faster than a sequential
+ *        one. In fact, it is a bit slower, due to the initialization of the
+ *        private copies and the final merge.
  */
 
 class AtmosphereProcessGroup : public AtmosphereProcess
@@ -68,6 +79,9 @@ public:
 
   ScheduleType get_schedule_type () const { return m_group_schedule_type; }
 
+  // Complete the async work of all the processes in the group
+  void finish_async_work ();
+
   // Computes total number of bytes needed for local variables
   size_t requested_buffer_size_in_bytes () const;
 
@@ -127,6 +141,16 @@ protected:
   void run_sequential (const double dt);
   void run_parallel   (const double dt);
 
+  // Parallel schedule only: returns true if the iproc-th atm proc must compute
+  // fid on a private copy (see class description).
+  bool needs_private_copy (const int iproc, const FieldIdentifier& fid) const;
+
+  // Get the private copy of f for the iproc-th atm proc (creating it if needed)
+  Field get_private_copy (const int iproc, const Field& f);
+
+  // Parallel schedule only: sum the increments of the private copies into the group fields
+  void merge_private_copies ();
+
   // The methods to set the fields/groups in the right processes of the group
   void set_required_field_impl (const Field& f);
   void set_computed_field_impl (const Field& f);
@@ -143,6 +167,11 @@ protected:
   // The schedule type: Parallel vs Sequential
   ScheduleType   m_group_schedule_type;
 
+  // Parallel schedule only: the group fields that have private copies, and
+  // the private copies of each atm proc (both indexed by the fid id string)
+  strmap_t<Field>               m_privatized_fields;
+  std::vector<strmap_t<Field>>  m_private_copies;
+
   // This is only needed to be able to access grids objects later on
   std::shared_ptr<const GridsManager>   m_grids_mgr;
 };
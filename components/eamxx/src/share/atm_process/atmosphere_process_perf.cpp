@@ -0,0 +1,173 @@
+#include "share/atm_process/atmosphere_process_perf.hpp"
+#include "share/atm_process/atmosphere_process_group.hpp"
+
+#include <Kokkos_Core.hpp>
+
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+
+namespace scream
+{
+
+namespace {
+
+bool s_perf_enabled = false;
+
+std::atomic<long long> s_kernel_launches (0);
+std::atomic<long long> s_num_allocations (0);
+std::atomic<long long> s_bytes_allocated (0);
+std::atomic<long long> s_bytes_h2d (0);
+std::atomic<long long> s_bytes_d2h (0);
+
+bool is_host_space (const Kokkos::Tools::SpaceHandle& h) {
+  return std::strcmp(h.name,"Host")==0 || std::strstr(h.name,"HostPinned")!=nullptr;
+}
+
+void count_kernel (const char* /* name */, const uint32_t /* dev_id */, uint64_t* /* kernel_id */) {
+  ++s_kernel_launches;
+}
+
+void count_allocation (const Kokkos::Tools::SpaceHandle /* space */, const char* /* label */,
+                       const void* /* ptr */, const uint64_t size) {
+  ++s_num_allocations;
+  s_bytes_allocated += size;
+}
+
+void count_deep_copy (const Kokkos::Tools::SpaceHandle dst, const char* /* dst_label */, const void* /* dst_ptr */,
+                      const Kokkos::Tools::SpaceHandle src, const char* /* src_label */, const void* /* src_ptr */,
+                      const uint64_t size) {
+  const bool src_host = is_host_space(src);
+  const bool dst_host = is_host_space(dst);
+  if (src_host and not dst_host) {
+    s_bytes_h2d += size;
+  } else if (dst_host and not src_host) {
+    s_bytes_d2h += size;
+  }
+}
+
+// Name, depth in the process tree, and record of a process
+struct PerfEntry {
+  std::string             name;
+  int                     depth;
+  const AtmProcPerfRecord* record;
+};
+
+void gather_entries (const AtmosphereProcess& proc, const int depth,
+                     std::vector<PerfEntry>& entries) {
+  entries.push_back(PerfEntry{proc.name(),depth,&proc.get_perf_record()});
+  const auto group = dynamic_cast<const AtmosphereProcessGroup*>(&proc);
+  if (group!=nullptr) {
+    for (int i=0; i<group->get_num_processes(); ++i) {
+      gather_entries(*group->get_process(i),depth+1,entries);
+    }
+  }
+}
+
+} // anonymous namespace
+
+void enable_perf_counters ()
+{
+  if (s_perf_enabled) {
+    return;
+  }
+  s_perf_enabled = true;
+
+  // Don't override the callbacks of a Kokkos Tools library
+  if (not Kokkos::Tools::profileLibraryLoaded()) {
+    using namespace Kokkos::Tools::Experimental;
+    set_begin_parallel_for_callback(count_kernel);
+    set_begin_parallel_reduce_callback(count_kernel);
+    set_begin_parallel_scan_callback(count_kernel);
+    set_allocate_data_callback(count_allocation);
+    set_begin_deep_copy_callback(count_deep_copy);
+  }
+}
+
+bool perf_counters_enabled ()
+{
+  return s_perf_enabled;
+}
+
+PerfCounterValues get_perf_counters ()
+{
+  PerfCounterValues v;
+  v.kernel_launches = s_kernel_launches;
+  v.num_allocations = s_num_allocations;
+  v.bytes_allocated = s_bytes_allocated;
+  v.bytes_h2d       = s_bytes_h2d;
+  v.bytes_d2h       = s_bytes_d2h;
+  return v;
+}
+
+PerfTimer::PerfTimer (double& accum)
+ : m_accum (s_perf_enabled ? &accum : nullptr)
+{
+  if (m_accum!=nullptr) {
+    Kokkos::fence();
+    m_start = clock_t::now();
+  }
+}
+
+PerfTimer::~PerfTimer ()
+{
+  if (m_accum!=nullptr) {
+    Kokkos::fence();
+    *m_accum += std::chrono::duration<double>(clock_t::now()-m_start).count();
+  }
+}
+
+void write_perf_summary (const AtmosphereProcess& proc, const ekat::Comm& comm,
+                         const std::string& prefix)
+{
+  std::vector<PerfEntry> entries;
+  gather_entries(proc,0,entries);
+
+  const std::string fname = prefix + ".rank" + std::to_string(comm.rank());
+
+  // JSON
+  std::ofstream json (fname + ".json");
+  json << std::setprecision(9);
+  json << "{\n"
+       << "  \"rank\": " << comm.rank() << ",\n"
+       << "  \"processes\": [\n";
+  for (size_t i=0; i<entries.size(); ++i) {
+    const auto& e = entries[i];
+    const auto& r = *e.record;
+    json << "    {\"name\": \"" << e.name << "\", \"depth\": " << e.depth
+         << ", \"num_runs\": " << r.num_runs
+         << ", \"time_total\": " << r.time_total
+         << ", \"time_property_checks\": " << r.time_property_checks
+         << ", \"time_tendencies\": " << r.time_tendencies
+         << ", \"time_conservation_checks\": " << r.time_conservation_checks
+         << ", \"time_run_impl\": " << r.time_run_impl
+         << ", \"kernel_launches\": " << r.counters.kernel_launches
+         << ", \"num_allocations\": " << r.counters.num_allocations
+         << ", \"bytes_allocated\": " << r.counters.bytes_allocated
+         << ", \"bytes_h2d\": " << r.counters.bytes_h2d
+         << ", \"bytes_d2h\": " << r.counters.bytes_d2h
+         << "}" << (i+1<entries.size() ? "," : "") << "\n";
+  }
+  json << "  ]\n"
+       << "}\n";
+
+  // CSV
+  std::ofstream csv (fname + ".csv");
+  csv << std::setprecision(9);
+  csv << "name,depth,num_runs,time_total,time_property_checks,time_tendencies,"
+         "time_conservation_checks,time_run_impl,kernel_launches,num_allocations,"
+         "bytes_allocated,bytes_h2d,bytes_d2h\n";
+  for (const auto& e : entries) {
+    const auto& r = *e.record;
+    csv << e.name << "," << e.depth << "," << r.num_runs << ","
+        << r.time_total << "," << r.time_property_checks << ","
+        << r.time_tendencies << "," << r.time_conservation_checks << ","
+        << r.time_run_impl << "," << r.counters.kernel_launches << ","
+        << r.counters.num_allocations << "," << r.counters.bytes_allocated << ","
+        << r.counters.bytes_h2d << "," << r.counters.bytes_d2h << "\n";
+  }
+}
+
+} // namespace scream
@@ -0,0 +1,88 @@
+#ifndef SCREAM_ATMOSPHERE_PROCESS_PERF_HPP
+#define SCREAM_ATMOSPHERE_PROCESS_PERF_HPP
+
+#include <ekat/mpi/ekat_comm.hpp>
+
+#include <chrono>
+#include <string>
+
+namespace scream
+{
+
+class AtmosphereProcess;
+
+/*
+ * Per-process performance counters
+ *
+ * When enabled (see enable_perf_counters), each AtmosphereProcess keeps a record of
+ * the wall time spent in the different phases of its run method, as well as the
+ * number of kernels launched, the device memory allocated, and the bytes moved
+ * between host and device while it runs.
+ *
+ * Kernel launches, allocations, and deep copies are counted via Kokkos Tools callbacks.
+ * These are only installed if no Kokkos Tools library is loaded (since that library
+ * would be overridden); otherwise, those counters stay zero.
+ *
+ * NOTE: when perf counters are enabled, the execution space is fenced at the boundaries
+ *       of each timed phase, so that times of asynchronous kernels are attributed
+ *       to the right phase.
+ * NOTE: all counters are inclusive: the record of a process group includes the work of
+ *       the processes it contains.
+ * NOTE: the counters are global, not per thread. Work done on other host threads (e.g.,
+ *       the COSP simulator in async mode, see eamxx_cosp.hpp) is counted in the record
+ *       of whichever process is running on the main thread at the time.
+ */
+
+struct PerfCounterValues {
+  long long kernel_launches = 0;
+  long long num_allocations = 0;
+  long long bytes_allocated = 0;
+  long long bytes_h2d       = 0;
+  long long bytes_d2h       = 0;
+};
+
+struct AtmProcPerfRecord {
+  int num_runs = 0;
+
+  // Wall times (in seconds)
+  double time_total               = 0;  // The whole run method
+  double time_property_checks     = 0;  // Pre- and post-condition checks
+  double time_tendencies          = 0;  // Setup and computation of process tendencies
+  double time_conservation_checks = 0;  // Column mass/energy conservation checks
+  double time_run_impl            = 0;  // The process implementation
+
+  PerfCounterValues counters;
+};
+
+// Turn on perf counters. Must be called before the processes run.
+void enable_perf_counters ();
+bool perf_counters_enabled ();
+
+// Current value of the global counters
+PerfCounterValues get_perf_counters ();
+
+// Adds the wall time of its lifetime to the given variable. If perf
+// counters are not enabled, it does nothing.
+class PerfTimer {
+public:
+  explicit PerfTimer (double& accum);
+  ~PerfTimer ();
+
+  PerfTimer (const PerfTimer&) = delete;
+  PerfTimer& operator= (const PerfTimer&) = delete;
+
+private:
+  using clock_t = std::chrono::steady_clock;
+
+  double*             m_accum;
+  clock_t::time_point m_start;
+};
+
+// Write the records of the given process, and of all the processes it contains
+// (if it is a group), in the files <prefix>.rank<N>.json and <prefix>.rank<N>.csv
+void write_perf_summary (const AtmosphereProcess& proc, const ekat::Comm& comm,
+                         const std::string& prefix);
+
+} // namespace scream
+
+#endif // SCREAM_ATMOSPHERE_PROCESS_PERF_HPP
@@ -226,4 +226,28 @@ void Field::allocate_view ()
   m_data.h_view = Kokkos::create_mirror_view(m_data.d_view);
 }
 
+void Field::allocate_view (const view_dev_t<char*>& buffer, const long long offset)
+{
+  EKAT_REQUIRE_MSG(!is_allocated(), "Error! View was already allocated.\n");
+
+  // Short names
+  const auto& id     = m_header->get_identifier();
+  const auto& layout = id.get_layout();
+  auto& alloc_prop   = m_header->get_alloc_properties();
+
+  // Commit the allocation properties
+  alloc_prop.commit(layout);
+
+  const auto view_dim = alloc_prop.get_alloc_size();
+  EKAT_REQUIRE_MSG (offset>=0 and offset+view_dim<=static_cast<long long>(buffer.size()),
+      "Error! Input buffer is too small to host the field.\n"
+      "  - field name : " + id.name() + "\n"
+      "  - alloc size : " + std::to_string(view_dim) + "\n"
+      "  - offset     : " + std::to_string(offset) + "\n"
+      "  - buffer size: " + std::to_string(buffer.size()) + "\n");
+
+  m_data.d_view = Kokkos::subview(buffer,Kokkos::make_pair(offset,offset+view_dim));
+  m_data.h_view = Kokkos::create_mirror_view(m_data.d_view);
+}
+
 } // namespace scream
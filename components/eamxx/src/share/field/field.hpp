@@ -278,6 +278,11 @@ public:
   // Allocate the actual view
   void allocate_view ();
 
+  // Allocate the view as a subview of a larger buffer, starting at the given
+  // byte offset. Used to let fields with disjoint lifetimes share memory.
+  // NOTE: the buffer is ref-counted, so it is kept alive by the field.
+  void allocate_view (const view_dev_t<char*>& buffer, const long long offset);
+
 #ifndef KOKKOS_ENABLE_CUDA
   // Cuda requires methods enclosing __device__ lambda's to be public
 protected:
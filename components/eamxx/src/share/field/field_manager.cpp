@@ -689,9 +689,15 @@ void FieldManager::registration_ends ()
     info.m_bundled = true;
   }
 
+  // If we know the fields lifetimes, let transient fields share memory
+  if (m_field_lifetimes.size()>0) {
+    allocate_transient_fields ();
+  }
+
   for (auto& it : m_fields) {
     if (it.second->is_allocated()) {
-      // If the field has been already allocated, then it was in a bunlded group, so skip it.
+      // If the field has been already allocated, then it was in a bunlded group
+      // (or it is transient), so skip it.
       continue;
     }
     // A brand new field. Allocate it
@@ -717,10 +723,77 @@ void FieldManager::registration_ends ()
   m_repo_state = RepoState::Closed;
 }
 
+void FieldManager::
+set_field_lifetimes (const std::map<std::string,FieldLifetime>& lifetimes,
+                     const std::set<std::string>& pinned_fields)
+{
+  EKAT_REQUIRE_MSG(m_repo_state==RepoState::Open,
+      "Error! Field lifetimes can only be set while registration is open.\n");
+
+  m_field_lifetimes.clear();
+  for (const auto& it : lifetimes) {
+    m_field_lifetimes.emplace(it.first,it.second);
+  }
+  m_pinned_fields.clear();
+  for (const auto& fn : pinned_fields) {
+    m_pinned_fields.insert(fn);
+  }
+}
+
+void FieldManager::allocate_transient_fields ()
+{
+  // Fields in a group may be accessed via the group by some process,
+  // which the lifetime does not account for. Don't alias them.
+  std::set<ci_string> in_groups;
+  for (const auto& it : m_field_groups) {
+    for (const auto& fn : it.second->m_fields_names) {
+      in_groups.insert(fn);
+    }
+  }
+
+  for (auto& it : m_fields) {
+    const auto& fn = it.first;
+    auto& f = *it.second;
+    auto& fh = f.get_header();
+    if (not fh.get_parent().expired()) {
+      // Subfields do not own their memory
+      continue;
+    }
+
+    auto& ap = fh.get_alloc_properties();
+    ap.commit(fh.get_identifier().get_layout());
+    const auto bytes = ap.get_alloc_size();
+
+    auto lt = m_field_lifetimes.find(fn);
+    if (f.is_allocated() or lt==m_field_lifetimes.end() or not lt->second.is_transient() or
+        in_groups.count(fn)==1 or m_pinned_fields.count(fn)==1) {
+      m_memory_planner.add_persistent_field(fn,bytes);
+    } else {
+      m_memory_planner.add_transient_field(fn,bytes,lt->second.first,lt->second.last);
+    }
+  }
+
+  m_memory_planner.plan();
+  if (m_memory_planner.num_transient_fields()==0) {
+    return;
+  }
+
+  // Allocate the arena, and carve the transient fields out of it
+  Field::view_dev_t<char*> arena ("fm_arena_"+m_grid->name(),m_memory_planner.arena_bytes());
+  for (auto& it : m_fields) {
+    if (m_memory_planner.is_transient(it.first)) {
+      it.second->allocate_view(arena,m_memory_planner.get_offset(it.first));
+    }
+  }
+}
+
 void FieldManager::clean_up() {
   // Clear the maps
   m_fields.clear();
   m_field_groups.clear();
+  m_field_lifetimes.clear();
+  m_pinned_fields.clear();
+  m_memory_planner = FieldMemoryPlanner();
 
   // Reset repo state
   m_repo_state = RepoState::Clean;
@@ -5,6 +5,7 @@
 #include "share/field/field.hpp"
 #include "share/field/field_group.hpp"
 #include "share/field/field_request.hpp"
+#include "share/field/field_memory_planner.hpp"
 #include "share/util/scream_utils.hpp"
 #include "share/scream_types.hpp"
 
@@ -56,6 +57,17 @@ public:
   void registration_ends ();
   void clean_up ();
 
+  // Optionally, provide the lifetime of fields within the atm time step, so that
+  // registration_ends can let transient fields share memory (see FieldMemoryPlanner).
+  // Fields that are not in the map, that belong to a group, or that are pinned
+  // (e.g., because they are needed outside of the atm procs run), are allocated as usual.
+  // NOTE: must be called before registration ends
+  void set_field_lifetimes (const std::map<std::string,FieldLifetime>& lifetimes,
+                            const std::set<std::string>& pinned_fields = {});
+
+  // If field lifetimes were set, this stores the memory plan
+  const FieldMemoryPlanner& get_memory_planner () const { return m_memory_planner; }
+
   // Adds an externally-constructed field to the FieldManager. Allows the FM
   // to make the field available as if it had been built with the usual
   // registration procedures.
@@ -109,6 +121,8 @@ protected:
 
   void pre_process_group_requests ();
 
+  void allocate_transient_fields ();
+
   // The state of the repository
   RepoState           m_repo_state;
 
@@ -137,6 +151,11 @@ protected:
   // we 'skip' them, hoping that some other request will contain the right specs.
   // If no complete request is given for that field, we need to error out
   std::list<std::pair<std::string,std::string>> m_incomplete_requests;
+
+  // Lifetimes of fields within the atm time step, used to plan their allocation
+  std::map<ci_string,FieldLifetime>   m_field_lifetimes;
+  std::set<ci_string>                 m_pinned_fields;
+  FieldMemoryPlanner                  m_memory_planner;
 };
 
 } // namespace scream
@@ -0,0 +1,148 @@
+#include "share/field/field_memory_planner.hpp"
+
+#include <ekat/ekat_assert.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace scream
+{
+
+FieldMemoryPlanner::
+FieldMemoryPlanner (const long long alignment)
+ : m_alignment (alignment)
+{
+  EKAT_REQUIRE_MSG (alignment>0,
+      "Error! Invalid alignment for FieldMemoryPlanner.\n"
+      "  - alignment: " + std::to_string(alignment) + "\n");
+}
+
+void FieldMemoryPlanner::
+add_transient_field (const ci_string& name, const long long bytes,
+                     const int first, const int last)
+{
+  EKAT_REQUIRE_MSG (not m_planned,
+      "Error! Cannot add fields to FieldMemoryPlanner after plan() was called.\n");
+  EKAT_REQUIRE_MSG (m_transient.count(name)==0 and m_persistent.count(name)==0,
+      "Error! Field already added to FieldMemoryPlanner.\n"
+      "  - field name: " + name + "\n");
+  EKAT_REQUIRE_MSG (first>=0 and first<=last,
+      "Error! Invalid lifetime for transient field.\n"
+      "  - field name: " + name + "\n"
+      "  - lifetime  : [" + std::to_string(first) + "," + std::to_string(last) + "]\n");
+
+  m_transient[name] = Entry{bytes,first,last};
+}
+
+void FieldMemoryPlanner::
+add_persistent_field (const ci_string& name, const long long bytes)
+{
+  EKAT_REQUIRE_MSG (not m_planned,
+      "Error! Cannot add fields to FieldMemoryPlanner after plan() was called.\n");
+  EKAT_REQUIRE_MSG (m_transient.count(name)==0 and m_persistent.count(name)==0,
+      "Error! Field already added to FieldMemoryPlanner.\n"
+      "  - field name: " + name + "\n");
+
+  m_persistent[name] = bytes;
+}
+
+void FieldMemoryPlanner::plan ()
+{
+  EKAT_REQUIRE_MSG (not m_planned,
+      "Error! FieldMemoryPlanner::plan() was already called.\n");
+
+  auto align = [&](const long long n) {
+    return ((n + m_alignment - 1) / m_alignment) * m_alignment;
+  };
+
+  // Place larger fields first. Break ties with the name, to get the
+  // same layout on all ranks.
+  std::vector<std::pair<ci_string,Entry*>> order;
+  for (auto& it : m_transient) {
+    order.emplace_back(it.first,&it.second);
+  }
+  std::sort(order.begin(),order.end(),[](const auto& lhs, const auto& rhs) {
+    return lhs.second->bytes>rhs.second->bytes or
+           (lhs.second->bytes==rhs.second->bytes and lhs.first<rhs.first);
+  });
+
+  std::vector<const Entry*> placed;
+  std::vector<const Entry*> clashing;
+  m_arena_bytes = 0;
+  for (auto& it : order) {
+    auto& e = *it.second;
+
+    // Only fields that are alive at the same time as e can clash with it
+    clashing.clear();
+    for (auto p : placed) {
+      if (p->first<=e.last and e.first<=p->last) {
+        clashing.push_back(p);
+      }
+    }
+    std::sort(clashing.begin(),clashing.end(),[](const Entry* lhs, const Entry* rhs) {
+      return lhs->offset<rhs->offset;
+    });
+
+    // Find the first gap large enough to fit e
+    long long offset = 0;
+    for (auto p : clashing) {
+      if (offset+e.bytes<=p->offset) {
+        break;
+      }
+      offset = std::max(offset,align(p->offset+p->bytes));
+    }
+    e.offset = offset;
+    placed.push_back(&e);
+
+    m_arena_bytes = std::max(m_arena_bytes,align(offset+e.bytes));
+  }
+
+  m_planned = true;
+}
+
+bool FieldMemoryPlanner::is_transient (const ci_string& name) const
+{
+  return m_transient.count(name)==1;
+}
+
+long long FieldMemoryPlanner::get_offset (const ci_string& name) const
+{
+  EKAT_REQUIRE_MSG (m_planned,
+      "Error! Cannot query offsets before calling FieldMemoryPlanner::plan().\n");
+  auto it = m_transient.find(name);
+  EKAT_REQUIRE_MSG (it!=m_transient.end(),
+      "Error! Field is not transient in FieldMemoryPlanner.\n"
+      "  - field name: " + name + "\n");
+  return it->second.offset;
+}
+
+long long FieldMemoryPlanner::arena_bytes () const
+{
+  return m_arena_bytes;
+}
+
+long long FieldMemoryPlanner::peak_bytes_before () const
+{
+  long long bytes = 0;
+  for (const auto& it : m_transient) {
+    bytes += it.second.bytes;
+  }
+  for (const auto& it : m_persistent) {
+    bytes += it.second;
+  }
+  return bytes;
+}
+
+long long FieldMemoryPlanner::peak_bytes_after () const
+{
+  long long bytes = m_planned ? m_arena_bytes : 0;
+  for (const auto& it : m_transient) {
+    bytes += m_planned ? 0 : it.second.bytes;
+  }
+  for (const auto& it : m_persistent) {
+    bytes += it.second;
+  }
+  return bytes;
+}
+
+} // namespace scream
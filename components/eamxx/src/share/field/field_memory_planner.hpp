@@ -0,0 +1,98 @@
+#ifndef SCREAM_FIELD_MEMORY_PLANNER_HPP
+#define SCREAM_FIELD_MEMORY_PLANNER_HPP
+
+#include <ekat/util/ekat_string_utils.hpp>
+
+#include <map>
+#include <string>
+
+namespace scream
+{
+
+/*
+ * The lifetime of a field within an atm time step.
+ *
+ * Atm processes are numbered in the order they run within the time step
+ * (processes that may run concurrently, or that are subcycled together,
+ * share the same number). For each field we store the first process that
+ * computes it, and the last process that uses it (either as input or output).
+ * If a field is needed by some process before it is computed (or if it is
+ * never computed), its value must persist across time steps. The same holds
+ * if any of the processes computing it did not declare it transient (see
+ * AtmosphereProcess::declare_transient_field), since processes are allowed
+ * to leave their outputs untouched on some steps.
+ */
+
+struct FieldLifetime {
+  int first = -1;     // First process computing the field
+  int last  = -1;     // Last process using the field
+  bool needed_from_prev_step = false;
+
+  // Whether the field memory can be reused outside of [first,last]
+  bool is_transient () const {
+    return not needed_from_prev_step and first>=0;
+  }
+};
+
+/*
+ * A class to compute a memory layout for a set of fields, given their lifetime.
+ *
+ * Transient fields (see FieldLifetime) are placed in a single arena, in such a way
+ * that two fields overlap in memory only if their lifetimes are disjoint.
+ * All other fields are persistent, and are simply accounted for, to report
+ * the total memory footprint before and after the planning.
+ *
+ * Offsets are computed with a greedy strategy: fields are placed in decreasing
+ * order of size, each at the lowest (aligned) offset that does not clash with
+ * any of the already placed fields whose lifetime overlaps with its own.
+ */
+
+class FieldMemoryPlanner {
+public:
+  using ci_string = ekat::CaseInsensitiveString;
+
+  FieldMemoryPlanner (const long long alignment = 128);
+
+  void add_transient_field  (const ci_string& name, const long long bytes,
+                             const int first, const int last);
+  void add_persistent_field (const ci_string& name, const long long bytes);
+
+  // Compute the arena offsets. No fields can be added afterwards.
+  void plan ();
+
+  bool is_planned () const { return m_planned; }
+
+  bool is_transient (const ci_string& name) const;
+  long long get_offset (const ci_string& name) const;
+
+  // Size of the arena for all transient fields
+  long long arena_bytes () const;
+
+  // Memory footprint if all fields were allocated separately
+  long long peak_bytes_before () const;
+  // Memory footprint of persistent fields plus the arena
+  long long peak_bytes_after () const;
+
+  int num_transient_fields  () const { return m_transient.size(); }
+  int num_persistent_fields () const { return m_persistent.size(); }
+
+protected:
+
+  struct Entry {
+    long long bytes;
+    int       first;
+    int       last;
+    long long offset = -1;
+  };
+
+  std::map<ci_string,Entry>       m_transient;
+  std::map<ci_string,long long>   m_persistent;
+
+  long long   m_alignment;
+  long long   m_arena_bytes = 0;
+  bool        m_planned = false;
+};
+
+} // namespace scream
+
+#endif // SCREAM_FIELD_MEMORY_PLANNER_HPP
@@ -37,6 +37,17 @@ void FieldTracking::invalidate_time_stamp ()
   m_time_stamp = util::TimeStamp();
 }
 
+void FieldTracking::increment_version ()
+{
+  ++m_version;
+
+  for (auto it : this->get_children()) {
+    auto c = it.lock();
+    EKAT_REQUIRE_MSG(c, "Error! A weak pointer of a child field expired.\n");
+    c->increment_version();
+  }
+}
+
 void FieldTracking::set_accum_start_time (const TimeStamp& t_start) {
   EKAT_REQUIRE_MSG (not m_time_stamp.is_valid() || m_time_stamp<=t_start,
       "Error! Accumulation start time is older than current timestamp of the field.\n");
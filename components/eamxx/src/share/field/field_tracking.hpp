@@ -39,6 +39,11 @@ public:
   // Please, notice this is not the OS time stamp (see time_stamp.hpp for details).
   const TimeStamp& get_time_stamp () const { return m_time_stamp; }
 
+  // A counter of the updates of the field. Unlike the time stamp, this is incremented
+  // at every update (including subcycles, and non-final iterations of subcycled groups),
+  // so it can be used to check whether quantities derived from the field are still current.
+  long long get_version () const { return m_version; }
+
   //  - provider: can compute the field as an output
   //  - customer: requires the field as an input
   const atm_proc_set_type& get_providers () const { return m_providers; }
@@ -62,6 +67,10 @@ public:
   void update_time_stamp (const TimeStamp& ts);
   void invalidate_time_stamp ();
 
+  // Increment the update counter of the field.
+  // NOTE: like update_time_stamp, this also increments the counter of the children (if any).
+  void increment_version ();
+
   // Set/get accumulation interval start
   void set_accum_start_time (const TimeStamp& ts);
   const TimeStamp& get_accum_start_time () const { return m_accum_start; }
@@ -73,6 +82,7 @@ protected:
 
   // Tracking the updates of the field
   TimeStamp         m_time_stamp;
+  long long         m_version = 0;
 
   // For accumulated vars, the time where the accumulation started
   TimeStamp         m_accum_start;
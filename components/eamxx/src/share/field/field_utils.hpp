@@ -207,6 +207,49 @@ print_field_hyperslab (const Field& f,
   }
 }
 
+// A consumer of a field that only uses it on some time steps can declare so, allowing
+// the process that computes the field to skip it on the other steps. Declarations are
+// keyed by consumer, so that a consumer can override its own previous declaration.
+// A field is needed on step n if it has no declarations, or if n is a multiple of the
+// frequency declared by any of its consumers.
+// NOTE: the declarations are stored in the field header, which is shared by all the
+//       copies of the field (e.g., the ones stored in each atm process).
+// NOTE: on steps where it is not needed, the field may hold stale values. Hence, every
+//       consumer must declare its frequency: atm processes (including diagnostics)
+//       declare all their required fields as needed every step (see
+//       AtmosphereProcess::set_required_field), and so do output streams. Processes
+//       that need a field less often can then override their own declaration.
+inline void declare_field_needed_every (Field& f, const std::string& consumer, const int nsteps)
+{
+  EKAT_REQUIRE_MSG (nsteps>0,
+      "Error! Invalid frequency for field use declaration.\n"
+      " - field name: " + f.name() + "\n"
+      " - consumer  : " + consumer + "\n"
+      " - nsteps    : " + std::to_string(nsteps) + "\n");
+
+  using freqs_t = std::map<std::string,int>;
+  auto& hdr = f.get_header();
+  if (not hdr.has_extra_data("needed_every_nsteps")) {
+    hdr.set_extra_data("needed_every_nsteps",freqs_t());
+  }
+  hdr.get_extra_data<freqs_t>("needed_every_nsteps")[consumer] = nsteps;
+}
+
+inline bool is_field_needed (const Field& f, const int num_steps)
+{
+  using freqs_t = std::map<std::string,int>;
+  const auto& hdr = f.get_header();
+  if (not hdr.has_extra_data("needed_every_nsteps")) {
+    return true;
+  }
+  for (const auto& it : hdr.get_extra_data<freqs_t>("needed_every_nsteps")) {
+    if (num_steps%it.second==0) {
+      return true;
+    }
+  }
+  return false;
+}
+
 } // namespace scream
 
 #endif // SCREAM_FIELD_UTILS_HPP
@@ -130,6 +130,10 @@ do_bind_field (const int ifield, const field_type& src, const field_type& tgt)
       const auto& f_lt = src.get_header().get_identifier().get_layout();
       const auto& m_lt = src_mask.get_header().get_identifier().get_layout();
       using namespace ShortFieldTagsNames;
+      EKAT_REQUIRE_MSG(f_lt.rank()<=4,
+          "Error! Masked remap is only supported for fields of rank up to 4.\n"
+          "  - field name: " + src.name() + "\n"
+          "  - field layout: " + f_lt.to_string() + "\n");
       EKAT_REQUIRE_MSG(f_lt.has_tag(COL) == m_lt.has_tag(COL),
           "Error! Incompatible field and mask layouts.\n"
           "  - field name: " + src.name() + "\n"
@@ -164,31 +168,29 @@ void CoarseningRemapper::do_remap_fwd ()
     return (ap.get_last_extent() % SCREAM_PACK_SIZE) == 0;
   };
 
-  // Loop over each field
+  // First, perform the local mat-vec. Recall that in these y=Ax products,
+  // x is the src field, and y is the overlapped tgt field.
+  // Fields without a mask are all handled in a single kernel
+  batched_local_mat_vec ();
+
+  // Loop over masked fields
   for (int i=0; i<m_num_fields; ++i) {
-    // First, perform the local mat-vec. Recall that in these y=Ax products,
-    // x is the src field, and y is the overlapped tgt field.
+    const int mask_idx = m_field_idx_to_mask_idx[i];
+    if (mask_idx<=0) {
+      continue;
+    }
+
     const auto& f_src = m_src_fields[i];
     const auto& f_ov  = m_ov_fields[i];
 
-    const int mask_idx = m_field_idx_to_mask_idx[i];
-    if (mask_idx>0) {
-      // Pass the mask to the local_mat_vec routine
-      const auto& mask = m_src_fields[mask_idx];
+    // Pass the mask to the local_mat_vec routine
+    const auto& mask = m_src_fields[mask_idx];
 
-      // If possible, dispatch kernel with SCREAM_PACK_SIZE
-      if (can_pack_field(f_src) and can_pack_field(f_ov) and can_pack_field(mask)) {
-        local_mat_vec<SCREAM_PACK_SIZE>(f_src,f_ov,mask);
-      } else {
-        local_mat_vec<1>(f_src,f_ov,mask);
-      }
+    // If possible, dispatch kernel with SCREAM_PACK_SIZE
+    if (can_pack_field(f_src) and can_pack_field(f_ov) and can_pack_field(mask)) {
+      local_mat_vec<SCREAM_PACK_SIZE>(f_src,f_ov,mask);
     } else {
-      // If possible, dispatch kernel with SCREAM_PACK_SIZE
-      if (can_pack_field(f_src) and can_pack_field(f_ov)) {
-        local_mat_vec<SCREAM_PACK_SIZE>(f_src,f_ov);
-      } else {
-        local_mat_vec<1>(f_src,f_ov);
-      }
+      local_mat_vec<1>(f_src,f_ov,mask);
     }
   }
 
@@ -559,7 +561,7 @@ local_mat_vec (const Field& x, const Field& y, const Field& mask) const
     }
     default:
     {
-      EKAT_ERROR_MSG("Error::coarsening_remapper::local_mat_vec doesn't support fields of rank 4 or greater");
+      EKAT_ERROR_MSG("Error::coarsening_remapper::local_mat_vec doesn't support masked fields of rank 5 or greater");
     }
   }
 }
@@ -1101,6 +1103,15 @@ void CoarseningRemapper::setup_mpi_data_structures ()
     MPI_Recv_init (recv_ptr, n, mpi_real, pid,
                    0, mpi_comm, &req);
   }
+
+  // Fields without a mask can all be handled by the batched mat-vec
+  std::vector<int> batched_fields;
+  for (int i=0; i<m_num_fields; ++i) {
+    if (m_field_idx_to_mask_idx[i]<=0) {
+      batched_fields.push_back(i);
+    }
+  }
+  setup_batched_mat_vec(batched_fields);
 }
 
 void CoarseningRemapper::clean_up ()
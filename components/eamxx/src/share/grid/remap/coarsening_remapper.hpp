@@ -75,6 +75,8 @@ protected:
 #ifdef KOKKOS_ENABLE_CUDA
 public:
 #endif
+  // Masked version of the local mat-vec. Unlike the batched mat-vec used for
+  // unmasked fields, this only supports fields of rank up to 4.
   template<int N>
   void local_mat_vec (const Field& f_src, const Field& f_tgt, const Field& mask) const;
   template<int N>
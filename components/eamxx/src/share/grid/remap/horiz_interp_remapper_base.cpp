@@ -31,8 +31,13 @@ HorizInterpRemapperBase (const grid_ptr_type& fine_grid,
   // This is a special remapper. We only go in one direction
   m_bwd_allowed = false;
 
-  // Get the remap data (if not already present, it will be built)
-  auto& data = s_remapper_data[m_map_file];
+  // Get the remap data (if not already present, it will be built).
+  // The same map file may be used with different fine grids (e.g., physics
+  // vs dynamics output), so the data is shared only if fine grid and type also match.
+  // Note: grid names are the same on all ranks, so data is built collectively.
+  m_remapper_data_key = m_map_file + "|" + fine_grid->name() + "|"
+                      + (m_type==InterpType::Refine ? "refine" : "coarsen");
+  auto& data = s_remapper_data[m_remapper_data_key];
   if (data.num_customers==0) {
     data.build(m_map_file,m_fine_grid,m_comm,m_type);
   }
@@ -42,6 +47,14 @@ HorizInterpRemapperBase (const grid_ptr_type& fine_grid,
   m_col_lids = data.col_lids;
   m_weights = data.weights;
 
+  // The batched mat-vec stores each row's col ids/weights in team scratch
+  auto row_offsets_h = Kokkos::create_mirror_view(m_row_offsets);
+  Kokkos::deep_copy(row_offsets_h,m_row_offsets);
+  m_max_row_nnz = 0;
+  for (size_t row=0; row+1<row_offsets_h.size(); ++row) {
+    m_max_row_nnz = std::max(m_max_row_nnz,row_offsets_h(row+1)-row_offsets_h(row));
+  }
+
   // The grids really only matter for the horiz part. We may have 2+ remappers with
   // fine grids that only differ in terms of number of levs. Such remappers cannot
   // store the same coarse grid. So we soft-clone the grid, and reset the number of levels
@@ -73,7 +86,7 @@ HorizInterpRemapperBase (const grid_ptr_type& fine_grid,
 HorizInterpRemapperBase::
 ~HorizInterpRemapperBase ()
 {
-  auto it = s_remapper_data.find(m_map_file);
+  auto it = s_remapper_data.find(m_remapper_data_key);
   if (it==s_remapper_data.end()) {
     // This would be very suspicious. But since the error is "benign",
     // and since we want to avoid throwing inside a destructor, just issue a warning.
@@ -352,11 +365,154 @@ local_mat_vec (const Field& x, const Field& y) const
     }
     default:
     {
-      EKAT_ERROR_MSG("Error::refining_remapper::local_mat_vec doesn't support fields of rank 4 or greater");
+      EKAT_ERROR_MSG("Error! HorizInterpRemapperBase::local_mat_vec doesn't support fields of rank 5 or greater.\n"
+                     "  Use the batched mat-vec instead (see batched_local_mat_vec).\n");
     }
   }
 }
 
+void HorizInterpRemapperBase::
+setup_batched_mat_vec (const std::vector<int>& field_ids)
+{
+  using PackInfo = ekat::PackInfo<SCREAM_PACK_SIZE>;
+
+  // Recall that in these y=Ax products, the ov fields are on the side of the coarse grid
+  auto get_x = [&](const int ifield) -> const Field& {
+    return m_type==InterpType::Refine ? m_ov_fields[ifield] : m_src_fields[ifield];
+  };
+  auto get_y = [&](const int ifield) -> const Field& {
+    return m_type==InterpType::Refine ? m_tgt_fields[ifield] : m_ov_fields[ifield];
+  };
+
+  // Helper function, to establish if a field can be handled with packs
+  // Note: the last dim of rank-1 fields is COL, which cannot be packed
+  auto can_pack_field = [](const Field& f) {
+    const auto& ap = f.get_header().get_alloc_properties();
+    return f.rank()>1 and (ap.get_last_extent() % SCREAM_PACK_SIZE) == 0;
+  };
+
+  // Use packs only if all fields can be packed, so that all entries of the
+  // fused index space have the same type
+  m_batched_pack_size = SCREAM_PACK_SIZE;
+  for (int ifield : field_ids) {
+    if (not can_pack_field(get_x(ifield)) or not can_pack_field(get_y(ifield))) {
+      m_batched_pack_size = 1;
+    }
+  }
+
+  // Express the last dim in packs (if packing), so that StridedData::offset
+  // returns the offset of the first Real of the pack
+  auto to_packs = [&](auto& sd) {
+    if (m_batched_pack_size>1) {
+      sd.extents[sd.rank-1] = PackInfo::num_packs(sd.extents[sd.rank-1]);
+      sd.strides[sd.rank-1] *= SCREAM_PACK_SIZE;
+    }
+  };
+
+  const int nfields = field_ids.size();
+  std::vector<BatchedMatVecEntry> entries(nfields);
+  std::vector<int> sizes(nfields);
+  for (int i=0; i<nfields; ++i) {
+    const int ifield = field_ids[i];
+
+    auto& e = entries[i];
+    e.x = get_strided_data<const Real>(get_x(ifield));
+    e.y = get_strided_data<Real>(get_y(ifield));
+    to_packs(e.x);
+    to_packs(e.y);
+
+    // Each row of the mat-vec processes one column of each field
+    sizes[i] = e.x.size(1);
+  }
+  m_batched.setup(entries,sizes);
+}
+
+void HorizInterpRemapperBase::
+batched_local_mat_vec () const
+{
+  if (m_batched_pack_size>1) {
+    batched_local_mat_vec_impl<SCREAM_PACK_SIZE>();
+  } else {
+    batched_local_mat_vec_impl<1>();
+  }
+}
+
+template<int PackSize>
+void HorizInterpRemapperBase::
+batched_local_mat_vec_impl () const
+{
+  using Pack         = ekat::Pack<Real,PackSize>;
+  using MemberType   = typename KT::MemberType;
+  using ESU          = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
+  using ScratchSpace = typename KT::ExeSpace::scratch_memory_space;
+  using Unmanaged   = Kokkos::MemoryTraits<Kokkos::Unmanaged>;
+  using scratch_int_1d  = Kokkos::View<int*, ScratchSpace,Unmanaged>;
+  using scratch_real_1d = Kokkos::View<Real*,ScratchSpace,Unmanaged>;
+
+  if (m_batched.size==0) {
+    return;
+  }
+
+  const auto row_grid = m_type==InterpType::Refine ? m_fine_grid : m_ov_coarse_grid;
+  const int  nrows    = row_grid->get_num_local_dofs();
+
+  auto row_offsets = m_row_offsets;
+  auto col_lids    = m_col_lids;
+  auto weights     = m_weights;
+  auto batched     = m_batched;
+  const int col_size = m_batched.size;
+  const int max_nnz  = m_max_row_nnz;
+
+  // If the rows are very long, the col ids/weights may not fit in the (fast) level-0 scratch
+  const int scratch_size = scratch_int_1d::shmem_size(max_nnz)
+                         + scratch_real_1d::shmem_size(max_nnz);
+  const int scratch_level = scratch_size<=32768 ? 0 : 1;
+
+  auto policy = ESU::get_default_team_policy(nrows,col_size);
+  policy.set_scratch_size(scratch_level,Kokkos::PerTeam(scratch_size));
+  Kokkos::parallel_for(policy,
+                       KOKKOS_LAMBDA(const MemberType& team) {
+    const auto row = team.league_rank();
+    const auto beg = row_offsets(row);
+    const auto nnz = row_offsets(row+1) - beg;
+
+    // Load this row sparsity pattern and weights once for all fields
+    scratch_int_1d  row_lids (team.team_scratch(scratch_level),max_nnz);
+    scratch_real_1d row_w    (team.team_scratch(scratch_level),max_nnz);
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nnz),
+                         [&](const int k) {
+      row_lids(k) = col_lids(beg+k);
+      row_w(k)    = weights(beg+k);
+    });
+    team.team_barrier();
+
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,col_size),
+                         [&](const int idx) {
+      int i;
+      const auto& e = batched.entries(batched.find(idx,i));
+
+      // Compute offsets of this entry within a column of x and y
+      const auto& x = e.x;
+      const auto& y = e.y;
+      const long long x_off = x.offset(i,1);
+      const long long y_off = y.offset(i,1);
+      auto x_pack = [&](const int col) -> const Pack& {
+        return *reinterpret_cast<const Pack*>(x.data + col*x.strides[0] + x_off);
+      };
+
+      // Note: same order of operations as in local_mat_vec, for bfb-ness
+      Pack y_val (0);
+      if (nnz>0) {
+        y_val = row_w(0)*x_pack(row_lids(0));
+        for (int k=1; k<nnz; ++k) {
+          y_val += row_w(k)*x_pack(row_lids(k));
+        }
+      }
+      *reinterpret_cast<Pack*>(y.data + row*y.strides[0] + y_off) = y_val;
+    });
+  });
+}
+
 void HorizInterpRemapperBase::clean_up ()
 {
   // Clear all fields
@@ -364,6 +520,8 @@ void HorizInterpRemapperBase::clean_up ()
   m_tgt_fields.clear();
   m_ov_fields.clear();
 
+  m_batched = {};
+
   // Reset the state of the base class
   m_state = RepoState::Clean;
   m_num_fields = 0;
@@ -3,6 +3,7 @@
 
 #include "share/grid/remap/abstract_remapper.hpp"
 #include "share/grid/remap/horiz_interp_remapper_data.hpp"
+#include "share/util/eamxx_fused_index_space.hpp"
 
 namespace scream
 {
@@ -78,12 +79,26 @@ protected:
   // MPI strategy they use (P2P or RMA)
   virtual void setup_mpi_data_structures () = 0;
 
+  // Setup the data structures for the batched mat-vec (see batched_local_mat_vec below)
+  // for the given fields. Derived classes should call this at the end of
+  // setup_mpi_data_structures, passing the fields that do not need special treatment.
+  void setup_batched_mat_vec (const std::vector<int>& field_ids);
+
 #ifdef KOKKOS_ENABLE_CUDA
 public:
 #endif
   template<int N>
   void local_mat_vec (const Field& f_src, const Field& f_tgt) const;
 
+  // Perform the local mat-vec for all the fields passed to setup_batched_mat_vec with
+  // a single kernel launch. Each team handles one row of the matrix: it loads the row
+  // col ids and weights in scratch once, and reuses them for all entries of all fields.
+  // If all fields can be handled with packs (see setup_batched_mat_vec), entries are
+  // processed one pack at a time, like in local_mat_vec<SCREAM_PACK_SIZE>.
+  void batched_local_mat_vec () const;
+  template<int PackSize>
+  void batched_local_mat_vec_impl () const;
+
   // The fine and coarse grids. Depending on m_type, they could be
   // respectively m_src_grid and m_tgt_grid or viceversa
   // Note: coarse grid is non-const, so that we can add geo data later.
@@ -106,10 +121,24 @@ public:
   view_1d<int>    m_row_offsets;
   view_1d<int>    m_col_lids;
   view_1d<Real>   m_weights;
-
-  // Keep track of this, since we need to tell the remap data repo
+  int             m_max_row_nnz;
+
+  // ----- Batched mat-vec data ---- //
+  // The columns of all fields are concatenated in a single index space (see
+  // FusedIndexSpace). The data of x/y is accessed via strides, to handle
+  // padding and subfields. If m_batched_pack_size>1, the last dim of x/y
+  // is stored in packs (i.e., its extent is the number of packs).
+  struct BatchedMatVecEntry {
+    StridedData<const Real> x;
+    StridedData<Real>       y;
+  };
+  FusedIndexSpace<BatchedMatVecEntry>   m_batched;
+  int                                   m_batched_pack_size = 1;
+
+  // Keep track of these, since we need to tell the remap data repo
   // we are releasing the data for our map file.
   std::string     m_map_file;
+  std::string     m_remapper_data_key;
 
   InterpType      m_type;
 
@@ -3,8 +3,20 @@
 #include "share/grid/point_grid.hpp"
 #include "share/grid/grid_import_export.hpp"
 #include "share/io/scream_scorpio_interface.hpp"
-
+#include "share/util/scream_bfbhash.hpp"
+#include "share/util/scream_utils.hpp"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
 #include <numeric>
+#include <sstream>
 
 namespace scream {
 
@@ -20,6 +32,14 @@ build (const std::string& map_file,
   fine_grid = fine_grid_in;
   type = type_in;
 
+  // If we have a valid cached CRS matrix on all ranks, we're done
+  const bool use_cache = get_cache_dir()!="";
+  cache_file = use_cache ? get_cache_file_name(map_file) : "";
+  loaded_from_cache = use_cache and load_from_cache(map_file);
+  if (loaded_from_cache) {
+    return;
+  }
+
   // Gather sparse matrix triplets needed by this rank
   auto my_triplets = get_my_triplets (map_file);
 
@@ -28,6 +48,47 @@ build (const std::string& map_file,
 
   // Create crs matrix
   create_crs_matrix_structures (my_triplets);
+
+  if (use_cache) {
+    write_to_cache (map_file);
+  }
+}
+
+namespace {
+std::string& cache_dir () {
+  static std::string dir;
+  return dir;
+}
+
+// Header of the cache files. Data sections follow, each aligned to 8 bytes:
+//   ov_coarse gids, row_offsets, col_lids, weights
+struct CrsCacheHeader {
+  char          magic[8];
+  std::uint64_t key;
+  int           sizeof_gid;
+  int           sizeof_real;
+  int           num_ov_gids;
+  int           num_rows;
+  int           nnz;
+  int           padding;
+};
+constexpr char crs_cache_magic[8] = {'E','A','M','X','X','C','R','S'};
+
+constexpr size_t align8 (const size_t n) {
+  return (n + 7) & ~size_t(7);
+}
+} // anonymous namespace
+
+void HorizRemapperData::
+set_cache_dir (const std::string& dir)
+{
+  cache_dir() = dir;
+}
+
+const std::string& HorizRemapperData::
+get_cache_dir ()
+{
+  return cache_dir();
 }
 
 auto HorizRemapperData::
@@ -174,19 +235,25 @@ create_coarse_grids (const std::vector<Triplet>& triplets)
   for (const auto& t : triplets) {
     ov_gid2lid.emplace(pickRow ? t.row : t.col,ov_gid2lid.size());
   }
-  int num_ov_gids = ov_gid2lid.size();
+  std::vector<gid_type> ov_gids(ov_gid2lid.size());
+  for (const auto& it : ov_gid2lid) {
+    ov_gids[it.second] = it.first;
+  }
+  std::sort(ov_gids.begin(),ov_gids.end());
+
+  create_coarse_grids (ov_gids);
+}
+
+void HorizRemapperData::
+create_coarse_grids (const std::vector<gid_type>& ov_gids)
+{
+  int num_ov_gids = ov_gids.size();
 
   // Use a temp and then assing, b/c grid_ptr_type is a pointer to const,
   // so you can't modify gids using that pointer
   ov_coarse_grid = std::make_shared<PointGrid>("ov_coarse_grid",num_ov_gids,0,comm);
   auto ov_coarse_gids_h = ov_coarse_grid->get_dofs_gids().get_view<gid_type*,Host>();
-  for (const auto& it : ov_gid2lid) {
-    ov_coarse_gids_h[it.second] = it.first;
-  }
-  auto beg = ov_coarse_gids_h.data();
-  auto end = beg+ov_coarse_gids_h.size();
-  std::sort(beg,end);
-
+  std::copy(ov_gids.begin(),ov_gids.end(),ov_coarse_gids_h.data());
   ov_coarse_grid->get_dofs_gids().sync_to_dev();
 
   // Create the unique coarse grid
@@ -255,4 +322,175 @@ create_crs_matrix_structures (std::vector<Triplet>& triplets)
   Kokkos::deep_copy(row_offsets,row_offsets_h);
 }
 
+std::uint64_t HorizRemapperData::
+compute_cache_key (const std::string& map_file, const bool global) const
+{
+  bfbhash::HashType key = 0;
+
+  // Map file identity. Hashing the whole content would be as expensive as
+  // reading it, so use path, size, and last modification time instead
+  struct stat st;
+  EKAT_REQUIRE_MSG (stat(map_file.c_str(),&st)==0,
+      "Error! Could not stat map file.\n"
+      " - map file: " + map_file + "\n");
+  // Note: std::hash is not guaranteed to be the same across builds/compilers
+  bfbhash::hash(bfbhash::HashType(fnv1a_hash(map_file.data(),map_file.size())),key);
+  bfbhash::hash(bfbhash::HashType(st.st_size),key);
+  bfbhash::hash(bfbhash::HashType(st.st_mtime),key);
+
+  // Interp type, and data types
+  bfbhash::hash(bfbhash::HashType(type==InterpType::Refine ? 1 : 2),key);
+  bfbhash::hash(bfbhash::HashType(sizeof(Real)),key);
+
+  // Fine grid decomposition
+  bfbhash::hash(bfbhash::HashType(comm.size()),key);
+  bfbhash::hash(bfbhash::HashType(fine_grid->get_num_global_dofs()),key);
+  if (not global) {
+    bfbhash::hash(bfbhash::HashType(comm.rank()),key);
+    auto gids_h = fine_grid->get_dofs_gids().get_view<const gid_type*,Host>();
+    for (int i=0; i<fine_grid->get_num_local_dofs(); ++i) {
+      bfbhash::hash(bfbhash::HashType(gids_h(i)),key);
+    }
+  }
+  return key;
+}
+
+std::string HorizRemapperData::
+get_cache_file_name (const std::string& map_file) const
+{
+  // Strip path from the map file name
+  auto pos = map_file.find_last_of('/');
+  auto basename = pos==std::string::npos ? map_file : map_file.substr(pos+1);
+
+  std::stringstream ss;
+  ss << get_cache_dir() << "/" << basename << "."
+     << std::hex << compute_cache_key(map_file,true) << std::dec
+     << ".np" << comm.size() << ".r" << comm.rank() << ".crs";
+  return ss.str();
+}
+
+bool HorizRemapperData::
+load_from_cache (const std::string& map_file)
+{
+  using header_t = CrsCacheHeader;
+  const auto fname = get_cache_file_name(map_file);
+  const auto my_key = compute_cache_key(map_file,false);
+
+  // Map the file in memory, and check header is compatible
+  void* addr = MAP_FAILED;
+  size_t file_size = 0;
+  int fd = open(fname.c_str(),O_RDONLY);
+  if (fd>=0) {
+    struct stat st;
+    if (fstat(fd,&st)==0 and size_t(st.st_size)>=sizeof(header_t)) {
+      file_size = st.st_size;
+      addr = mmap(nullptr,file_size,PROT_READ,MAP_PRIVATE,fd,0);
+    }
+    close(fd);
+  }
+
+  const char* data = reinterpret_cast<const char*>(addr);
+  const header_t* h = nullptr;
+  size_t gids_offset=0, row_offsets_offset=0, col_lids_offset=0, weights_offset=0;
+  bool valid = addr!=MAP_FAILED;
+  if (valid) {
+    h = reinterpret_cast<const header_t*>(data);
+    gids_offset        = align8(sizeof(header_t));
+    row_offsets_offset = gids_offset + align8(h->num_ov_gids*sizeof(gid_type));
+    col_lids_offset    = row_offsets_offset + align8((h->num_rows+1)*sizeof(int));
+    weights_offset     = col_lids_offset + align8(h->nnz*sizeof(int));
+
+    const int num_rows = type==InterpType::Refine ? fine_grid->get_num_local_dofs() : h->num_ov_gids;
+    valid = std::equal(h->magic,h->magic+8,crs_cache_magic) and
+            h->key==my_key and
+            h->sizeof_gid==sizeof(gid_type) and
+            h->sizeof_real==sizeof(Real) and
+            h->num_rows==num_rows and
+            file_size==weights_offset+h->nnz*sizeof(Real);
+  }
+
+  // Some steps below are collective, so we need the cache to be valid on all ranks
+  int all_valid;
+  int my_valid = valid ? 1 : 0;
+  comm.all_reduce(&my_valid,&all_valid,1,MPI_MIN);
+  if (all_valid==0) {
+    if (addr!=MAP_FAILED) {
+      munmap(addr,file_size);
+    }
+    return false;
+  }
+
+  // Create coarse grids
+  auto gids_ptr = reinterpret_cast<const gid_type*>(data+gids_offset);
+  create_coarse_grids (std::vector<gid_type>(gids_ptr,gids_ptr+h->num_ov_gids));
+
+  // Copy crs data straight from the mapped file
+  using host_int_t  = Kokkos::View<const int*, Kokkos::HostSpace,Kokkos::MemoryUnmanaged>;
+  using host_real_t = Kokkos::View<const Real*,Kokkos::HostSpace,Kokkos::MemoryUnmanaged>;
+  host_int_t  row_offsets_h (reinterpret_cast<const int*>(data+row_offsets_offset),h->num_rows+1);
+  host_int_t  col_lids_h    (reinterpret_cast<const int*>(data+col_lids_offset),h->nnz);
+  host_real_t weights_h     (reinterpret_cast<const Real*>(data+weights_offset),h->nnz);
+
+  row_offsets = view_1d<int>("",h->num_rows+1);
+  col_lids    = view_1d<int>("",h->nnz);
+  weights     = view_1d<Real>("",h->nnz);
+  Kokkos::deep_copy(row_offsets,row_offsets_h);
+  Kokkos::deep_copy(col_lids,col_lids_h);
+  Kokkos::deep_copy(weights,weights_h);
+
+  munmap(addr,file_size);
+  return true;
+}
+
+void HorizRemapperData::
+write_to_cache (const std::string& map_file) const
+{
+  using header_t = CrsCacheHeader;
+
+  header_t h;
+  std::copy(crs_cache_magic,crs_cache_magic+8,h.magic);
+  h.key         = compute_cache_key(map_file,false);
+  h.sizeof_gid  = sizeof(gid_type);
+  h.sizeof_real = sizeof(Real);
+  h.num_ov_gids = ov_coarse_grid->get_num_local_dofs();
+  h.num_rows    = row_offsets.size()-1;
+  h.nnz         = col_lids.size();
+  h.padding     = 0;
+
+  auto ov_gids_h     = ov_coarse_grid->get_dofs_gids().get_view<const gid_type*,Host>();
+  auto row_offsets_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),row_offsets);
+  auto col_lids_h    = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),col_lids);
+  auto weights_h     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),weights);
+
+  // Write each section, padding it to a multiple of 8 bytes
+  const char zeros[8] = {0};
+  auto write_section = [&](std::ofstream& ofs, const void* ptr, const size_t nbytes) {
+    ofs.write(reinterpret_cast<const char*>(ptr),nbytes);
+    ofs.write(zeros,align8(nbytes)-nbytes);
+  };
+
+  // Write to a tmp file and then rename it, so that other processes
+  // never see a partially written cache file
+  const auto fname = get_cache_file_name(map_file);
+  const auto tmp_fname = fname + ".tmp";
+  bool success;
+  {
+    std::ofstream ofs (tmp_fname,std::ios::binary);
+    write_section(ofs,&h,sizeof(header_t));
+    write_section(ofs,ov_gids_h.data(),h.num_ov_gids*sizeof(gid_type));
+    write_section(ofs,row_offsets_h.data(),(h.num_rows+1)*sizeof(int));
+    write_section(ofs,col_lids_h.data(),h.nnz*sizeof(int));
+    ofs.write(reinterpret_cast<const char*>(weights_h.data()),h.nnz*sizeof(Real));
+    success = ofs.good();
+  }
+  success = success and std::rename(tmp_fname.c_str(),fname.c_str())==0;
+
+  // Failing to write the cache is not fatal, since the remap data is already built
+  if (not success) {
+    std::remove(tmp_fname.c_str());
+    std::cerr << "WARNING! Could not write horiz remap cache file.\n"
+                 " - cache file: " << fname << "\n";
+  }
+}
+
 } // namespace scream
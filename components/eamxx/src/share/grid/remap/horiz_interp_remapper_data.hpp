@@ -6,6 +6,7 @@
 
 #include <ekat/mpi/ekat_comm.hpp>
 
+#include <cstdint>
 #include <memory>
 #include <map>
 #include <string>
@@ -29,6 +30,13 @@ struct HorizRemapperData {
               const ekat::Comm& comm,
               const InterpType type);
 
+  // If a non-empty folder is set, build will store the partitioned CRS structures
+  // of this rank in a binary file in that folder. Later runs with the same map file
+  // and the same fine grid decomposition will memory-map that file, rather than
+  // reading and redistributing the map file triplets.
+  static void set_cache_dir (const std::string& dir);
+  static const std::string& get_cache_dir ();
+
   // The coarse grid data
   std::shared_ptr<AbstractGrid> coarse_grid;
   std::shared_ptr<AbstractGrid> ov_coarse_grid;
@@ -38,6 +46,11 @@ struct HorizRemapperData {
   view_1d<int>    col_lids;
   view_1d<Real>   weights;
 
+  // If the cache dir is set, the cache file used by build, and whether
+  // the data was loaded from it (rather than built from the map file)
+  std::string cache_file;
+  bool        loaded_from_cache = false;
+
   int num_customers = 0;
 private:
   using gid_type = AbstractGrid::gid_type;
@@ -61,10 +74,23 @@ private:
   get_my_triplets (const std::string& map_file) const;
 
   void create_coarse_grids (const std::vector<Triplet>& triplets);
+  void create_coarse_grids (const std::vector<gid_type>& ov_gids);
 
   // Not a const ref, since we'll sort the triplets according to
   // how row gids appear in the coarse grid
   void create_crs_matrix_structures (std::vector<Triplet>& triplets);
+
+  // ------------- On-disk cache of the CRS structures ------------- //
+
+  // Hash of map file identity, fine grid decomposition, and interp type
+  // The global one is the same on all ranks, and is used in the file name.
+  std::uint64_t compute_cache_key (const std::string& map_file, const bool global) const;
+  std::string get_cache_file_name (const std::string& map_file) const;
+
+  // Returns false (and leaves the object untouched) if the cache file
+  // does not exist, or if it does not match this map file and decomposition.
+  bool load_from_cache (const std::string& map_file);
+  void write_to_cache (const std::string& map_file) const;
 };
 
 } // namespace scream
@@ -40,37 +40,20 @@ void RefiningRemapperP2P::do_remap_fwd ()
   pack_and_send ();
   recv_and_unpack ();
 
-  // Perform local-mat vec
-  // Helpef function, to establish if a field can be handled with packs
-  auto can_pack_field = [](const Field& f) {
-    const auto& ap = f.get_header().get_alloc_properties();
-    return (ap.get_last_extent() % SCREAM_PACK_SIZE) == 0;
-  };
-
-  // Loop over each field, perform mat-vec
+  // Fields without the COL tag are simply copied from src to tgt.
   constexpr auto COL = ShortFieldTagsNames::COL;
   for (int i=0; i<m_num_fields; ++i) {
     auto& f_tgt = m_tgt_fields[i];
-
-    // Allow to register fields that do not have the COL tag
-    // These fields are simply copied from src to tgt.
     if (not f_tgt.get_header().get_identifier().get_layout().has_tag(COL)) {
       f_tgt.deep_copy(m_src_fields[i]);
-      continue;
-    }
-
-    // Perform the local mat-vec. Recall that in these y=Ax products,
-    // x is the overlapped src field, and y is the tgt field.
-    const auto& f_ov = m_ov_fields[i];
-
-    // If possible, dispatch kernel with SCREAM_PACK_SIZE
-    if (can_pack_field(f_ov) and can_pack_field(f_tgt)) {
-      local_mat_vec<SCREAM_PACK_SIZE>(f_ov,f_tgt);
-    } else {
-      local_mat_vec<1>(f_ov,f_tgt);
     }
   }
 
+  // Perform the local mat-vec for all other fields in a single kernel.
+  // Recall that in these y=Ax products, x is the overlapped src field,
+  // and y is the tgt field.
+  batched_local_mat_vec ();
+
   // Wait for all sends to be completed
   if (not m_send_req.empty()) {
     check_mpi_call(MPI_Waitall(m_send_req.size(),m_send_req.data(), MPI_STATUSES_IGNORE),
@@ -156,6 +139,16 @@ void RefiningRemapperP2P::setup_mpi_data_structures ()
                      0, mpi_comm, &req);
     }
   }
+
+  // All fields with the COL tag are handled by the batched mat-vec
+  std::vector<int> batched_fields;
+  for (int i=0; i<m_num_fields; ++i) {
+    const auto& fl = m_tgt_fields[i].get_header().get_identifier().get_layout();
+    if (fl.has_tag(COL)) {
+      batched_fields.push_back(i);
+    }
+  }
+  setup_batched_mat_vec(batched_fields);
 }
 
 void RefiningRemapperP2P::pack_and_send ()
@@ -59,36 +59,20 @@ void RefiningRemapperRMA::do_remap_fwd ()
                    "MPI_Win_complete for field: " + m_ov_fields[i].name());
   }
 
-  // Helpef function, to establish if a field can be handled with packs
-  auto can_pack_field = [](const Field& f) {
-    const auto& ap = f.get_header().get_alloc_properties();
-    return (ap.get_last_extent() % SCREAM_PACK_SIZE) == 0;
-  };
-
-  // Loop over each field, perform mat-vec
+  // Fields without the COL tag are simply copied from src to tgt.
   constexpr auto COL = ShortFieldTagsNames::COL;
   for (int i=0; i<m_num_fields; ++i) {
     auto& f_tgt = m_tgt_fields[i];
-
-    // Allow to register fields that do not have the COL tag
-    // These fields are simply copied from src to tgt.
     if (not f_tgt.get_header().get_identifier().get_layout().has_tag(COL)) {
       f_tgt.deep_copy(m_src_fields[i]);
-      continue;
-    }
-
-    // Perform the local mat-vec. Recall that in these y=Ax products,
-    // x is the overlapped src field, and y is the tgt field.
-    const auto& f_ov_src    = m_ov_fields[i];
-
-    // If possible, dispatch kernel with SCREAM_PACK_SIZE
-    if (can_pack_field(f_ov_src) and can_pack_field(f_tgt)) {
-      local_mat_vec<SCREAM_PACK_SIZE>(f_ov_src,f_tgt);
-    } else {
-      local_mat_vec<1>(f_ov_src,f_tgt);
     }
   }
 
+  // Perform the local mat-vec for all other fields in a single kernel.
+  // Recall that in these y=Ax products, x is the overlapped src field,
+  // and y is the tgt field.
+  batched_local_mat_vec ();
+
   // Close exposure RMA epoch on each field
   for (int i=0; i<m_num_fields; ++i) {
     check_mpi_call(MPI_Win_wait(m_mpi_win[i]),
@@ -146,6 +130,16 @@ void RefiningRemapperRMA::setup_mpi_data_structures ()
                    "[RefiningRemapperRMA::setup_mpi_data_structure] setting MPI_ERRORS_RETURN handler on MPI_Win");
 #endif
   }
+
+  // All fields with the COL tag are handled by the batched mat-vec
+  std::vector<int> batched_fields;
+  for (int i=0; i<m_num_fields; ++i) {
+    const auto& fl = m_tgt_fields[i].get_header().get_identifier().get_layout();
+    if (fl.has_tag(COL)) {
+      batched_fields.push_back(i);
+    }
+  }
+  setup_batched_mat_vec(batched_fields);
 }
 
 void RefiningRemapperRMA::clean_up ()
@@ -217,15 +217,38 @@ void AtmosphereInput::read_variables (const int time_index)
       "Error! Scorpio structures not inited yet. Did you forget to call 'init(..)'?\n");
 
   for (auto const& name : m_fields_names) {
-
-    // Read the data
     auto v1d = m_host_views_1d.at(name);
     scorpio::read_var(m_filename,name,v1d.data(),time_index);
+  }
+  copy_host_data_to_fields();
 
-    // If we have a field manager, make sure the data is correctly
-    // synced to both host and device views of the field.
-    if (m_field_mgr) {
+  auto func_finish = std::chrono::steady_clock::now();
+  if (m_atm_logger) {
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(func_finish - func_start)/1000.0;
+    m_atm_logger->info("  Done! Elapsed time: " + std::to_string(duration.count()) +" seconds");
+  }
+}
+
+std::shared_future<void> AtmosphereInput::enqueue_read_variables (const int time_index)
+{
+  EKAT_REQUIRE_MSG (m_inited_with_views || m_inited_with_fields,
+      "Error! Scorpio structures not inited yet. Did you forget to call 'init(..)'?\n");
 
+  // Jobs are executed in order, so the last read is done when all of them are
+  std::shared_future<void> last;
+  for (auto const& name : m_fields_names) {
+    auto v1d = m_host_views_1d.at(name);
+    last = scorpio::enqueue_read_var(m_filename,name,v1d.data(),time_index);
+  }
+  return last;
+}
+
+void AtmosphereInput::copy_host_data_to_fields ()
+{
+  // If we have a field manager, make sure the data is correctly
+  // synced to both host and device views of the field.
+  if (m_field_mgr) {
+    for (auto const& name : m_fields_names) {
       auto f = m_field_mgr->get_field(name);
       const auto& fh  = f.get_header();
       const auto& fl  = fh.get_identifier().get_layout();
@@ -325,12 +348,7 @@ void AtmosphereInput::read_variables (const int time_index)
       f.sync_to_dev();
     }
   }
-  auto func_finish = std::chrono::steady_clock::now();
-  if (m_atm_logger) {
-    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(func_finish - func_start)/1000.0;
-    m_atm_logger->info("  Done! Elapsed time: " + std::to_string(duration.count()) +" seconds");
-  }
-} 
+}
 
 /* ---------------------------------------------------------- */
 void AtmosphereInput::finalize() 
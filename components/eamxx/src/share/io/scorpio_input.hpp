@@ -7,6 +7,8 @@
 #include "ekat/ekat_parameter_list.hpp"
 #include "ekat/logging/ekat_logger.hpp"
 
+#include <future>
+
 /*  The AtmosphereInput class handles all input streams to SCREAM.
  *  It is important to note that there does not exist an InputManager,
  *  like in the case of output.  So all input streams have to be managed
@@ -92,6 +94,14 @@ public:
   // Read fields that were required via parameter list.
   void read_variables (const int time_index = -1);
 
+  // The two halves of read_variables, for customers that want to read data
+  // asynchronously. The first one enqueues the reads into the host buffers on
+  // the scorpio IO thread (see scorpio::enqueue_read_var), and returns the future
+  // of the last one. Once it is ready, the second one copies the host buffers into
+  // the fields (if any), and syncs them to device.
+  std::shared_future<void> enqueue_read_variables (const int time_index = -1);
+  void copy_host_data_to_fields ();
+
   // Cleans up the class
   void finalize();
 
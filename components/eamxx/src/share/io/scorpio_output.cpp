@@ -10,6 +10,9 @@
 #include "ekat/util/ekat_string_utils.hpp"
 #include "ekat/std_meta/ekat_std_utils.hpp"
 
+#include <cmath>
+#include <cstring>
+#include <limits>
 #include <numeric>
 #include <fstream>
 
@@ -71,6 +74,45 @@ void combine_and_fill (const Real& new_val, Real& curr_val, const OutputAvgType
   }
 }
 
+// Round v to the nearest value (ties to even) with only keepbits mantissa bits.
+// Inf/NaN are left untouched.
+KOKKOS_INLINE_FUNCTION
+Real bit_round (const Real v, const int keepbits)
+{
+  using bits_t = typename std::conditional<sizeof(Real)==8,std::uint64_t,std::uint32_t>::type;
+  constexpr int mantissa_bits = std::numeric_limits<Real>::digits - 1;
+  constexpr bits_t exp_mask = ((bits_t(1) << (8*sizeof(Real)-1-mantissa_bits)) - 1) << mantissa_bits;
+
+  const int shift = mantissa_bits - keepbits;
+  bits_t b;
+  std::memcpy(&b,&v,sizeof(Real));
+  if (shift<=0 or (b & exp_mask)==exp_mask) {
+    return v;
+  }
+  const bits_t half = bits_t(1) << (shift-1);
+  const bits_t ulp  = (b >> shift) & 1;
+  b += half - 1 + ulp;
+  b &= ~((bits_t(1) << shift) - 1);
+
+  Real r;
+  std::memcpy(&r,&b,sizeof(Real));
+  return r;
+}
+
+// Round v to the nearest multiple of step (ties away from zero). Values that
+// are too large to have a fractional part in units of step are left untouched.
+KOKKOS_INLINE_FUNCTION
+Real quantize (const Real v, const Real step)
+{
+  constexpr Real max_q = Real(1ULL << std::numeric_limits<Real>::digits);
+  const Real q = v / step;
+  if (not (q<max_q and q>-max_q)) {
+    return v;
+  }
+  const long long n = q>=0 ? static_cast<long long>(q+Real(0.5)) : -static_cast<long long>(-q+Real(0.5));
+  return n*step;
+}
+
 // This helper function is used to make sure that the list of fields in
 // m_fields_names is a list of unique strings, otherwise throw an error.
 void sort_and_check(std::vector<std::string>& fields)
@@ -210,6 +252,14 @@ AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
   if (params.isParameter("fill_threshold")) {
     m_avg_coeff_threshold = params.get<Real>("fill_threshold");
   }
+  if (params.isParameter("async_write")) {
+    // If MPI does not support multiple threads, we fall back to sync writes (see run)
+    m_async_write_requested = params.get<bool>("async_write");
+    m_async_write = m_async_write_requested and scorpio::async_io_supported();
+  }
+  if (params.isSublist("precision_control")) {
+    set_precision_control(params.sublist("precision_control"));
+  }
 
   // Helper lambda, to copy io string attributes. This will be used if any
   // remapper is created, to ensure atts set by atm_procs are not lost
@@ -386,6 +436,16 @@ run (const std::string& filename,
     if (m_atm_logger) {
       m_atm_logger->info("[EAMxx::scorpio_output] Writing variables to file");
       m_atm_logger->info("  file name: " + filename);
+      if (m_async_write_requested and not m_async_write) {
+        m_atm_logger->warn("  async_write requested, but MPI does not provide MPI_THREAD_MULTIPLE.\n"
+                           "  Falling back to synchronous writes.");
+        m_async_write_requested = false;
+      }
+    }
+    if (m_async_write) {
+      // Make sure the write that used this staging buffer last time is done
+      wait_staging_buffer(m_staging_idx);
+      m_staged_names.clear();
     }
   }
 
@@ -427,50 +487,38 @@ run (const std::string& filename,
     stop_timer("EAMxx::IO::horiz_remap");
   }
 
+  // The fused tables store raw pointers to the field views, which are all
+  // allocated by now, so we can safely build them the first time we get here
+  if (not m_fused_tables_built) {
+    build_fused_tables();
+  }
+
   // Update all of the averaging count views (if needed)
   // The strategy is as follows:
   // For the update to the averaged value for this timestep we need to track if
-  // a point in a specific layout is "filled" or not.  So we create a set of local
-  // temporary views for each layout that are either 0 or 1 depending on if the
-  // value is filled or unfilled.
-  // We then use these values to update the overall average count views for that layout.
-  if (m_track_avg_cnt) {
-    // Note, we assume that all fields that share a layout are also masked/filled in the same
-    // way. If we need to handle a case where only a subset of output variables are expected to
-    // be masked/filled then the recommendation is to request those variables in a separate output
-    // stream.
-    // We cycle through all fields and we
-    //  1. Find the avg_cnt view for this field.
-    //  2. If we already processed the avg_cnt view, go to next field, and start from 1 again.
-    //  3. Add 1 to all entries of avg_cnt where field!=fill_value
-    std::set<std::string> avg_updated;
-    for (const auto& name : m_fields_names) {
-      auto avg_cnt_name = m_field_to_avg_cnt_map.at(name);
-      if (avg_updated.count(avg_cnt_name)==1) {
-        // We updated this avg_cnt by checking another field
-        continue;
+  // a point in a specific layout is "filled" or not. For each avg count view,
+  // we add 1 to all entries where the corresponding entry of the reference field
+  // (the first output field with that layout) is not filled.
+  // Note, we assume that all fields that share a layout are also masked/filled in the same
+  // way. If we need to handle a case where only a subset of output variables are expected to
+  // be masked/filled then the recommendation is to request those variables in a separate output
+  // stream.
+  // All avg count views are updated with a single kernel launch (see build_fused_tables).
+  auto fill_value = m_fill_value;
+  if (m_track_avg_cnt and m_avg_cnt_fused.size>0) {
+    const auto fused = m_avg_cnt_fused;
+    KT::RangePolicy policy(0,fused.size);
+    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
+      int i;
+      const auto& e = fused.entries(fused.find(idx,i));
+      if (e.src.data[e.src.offset(i)]!=fill_value) {
+        e.tgt[i] += 1;
       }
-      auto field = get_field(name,"io");
-      update_avg_cnt_view(field,m_dev_views_1d.at(avg_cnt_name));
-
-      // Make sure we don't double update this avg cnt
-      avg_updated.insert(avg_cnt_name);
-    }
+    });
   }
 
-  // Take care of updating and possibly writing fields.
-  // These are needed inside kernels, so crate local copies
-  auto do_avg_cnt = m_track_avg_cnt;
-  auto avg_type = m_avg_type;
-  auto fill_value = m_fill_value;
-  auto avg_coeff_threshold = m_avg_coeff_threshold;
   for (auto const& name : m_fields_names) {
-    // Get all the info for this field.
-          auto  field = get_field(name,"io");
-    const auto& layout = m_layouts.at(field.name());
-    const auto& dims = layout.dims();
-    const auto  rank = layout.rank();
-
+    auto field = get_field(name,"io");
     if (not field.get_header().get_tracking().get_time_stamp().is_valid()) {
       // Safety check: make sure that the user is ok with this
       if (allow_invalid_fields) {
@@ -480,148 +528,79 @@ run (const std::string& filename,
             "Error! Time-dependent output field '" + name + "' has not been initialized yet\n.");
       }
     }
+  }
 
-    const bool is_diagnostic = (m_diagnostics.find(name) != m_diagnostics.end());
-    const bool is_aliasing_field_view =
-        m_avg_type==OutputAvgType::Instant &&
-        field.get_header().get_alloc_properties().get_padding()==0 &&
-        field.get_header().get_parent().expired() &&
-        not is_diagnostic;
-
-    // Manually update the 'running-tally' views with data from the field,
-    // by combining new data with current avg values.
-    // NOTE: this is skipped for instant output, if IO view is aliasing Field view.
-    auto view_dev = m_dev_views_1d.at(name);
-    auto data = view_dev.data();
-    KT::RangePolicy policy(0,layout.size());
-    const auto extents = layout.extents();
-
-    // If the dev_view_1d is aliasing the field device view (must be Instant output),
-    // then there's no point in copying from the field's view to dev_view
-    if (not is_aliasing_field_view) {
-      switch (rank) {
-        case 1:
-        {
-          // For rank-1 views, we use strided layout, since it helps us
-          // handling a few more scenarios
-          auto new_view_1d = field.get_strided_view<const Real*,Device>();
-          auto avg_view_1d = view_Nd_dev<1>(data,dims[0]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
-            if (do_avg_cnt) {
-              combine_and_fill(new_view_1d(i),avg_view_1d(i),avg_type,fill_value);
-            } else {
-              combine(new_view_1d(i),avg_view_1d(i),avg_type);
-            }
-          });
-          break;
-        }
-        case 2:
-        {
-          auto new_view_2d = field.get_view<const Real**,Device>();
-          auto avg_view_2d = view_Nd_dev<2>(data,dims[0],dims[1]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j;
-            unflatten_idx(idx,extents,i,j);
-            if (do_avg_cnt) {
-              combine_and_fill(new_view_2d(i,j),avg_view_2d(i,j),avg_type,fill_value);
-            } else {
-              combine(new_view_2d(i,j), avg_view_2d(i,j),avg_type);
-            }
-          });
-          break;
-        }
-        case 3:
-        {
-          auto new_view_3d = field.get_view<const Real***,Device>();
-          auto avg_view_3d = view_Nd_dev<3>(data,dims[0],dims[1],dims[2]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k;
-            unflatten_idx(idx,extents,i,j,k);
-            if (do_avg_cnt) {
-              combine_and_fill(new_view_3d(i,j,k),avg_view_3d(i,j,k),avg_type,fill_value);
-            } else {
-              combine(new_view_3d(i,j,k), avg_view_3d(i,j,k),avg_type);
-            }
-          });
-          break;
-        }
-        case 4:
-        {
-          auto new_view_4d = field.get_view<const Real****,Device>();
-          auto avg_view_4d = view_Nd_dev<4>(data,dims[0],dims[1],dims[2],dims[3]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k,l;
-            unflatten_idx(idx,extents,i,j,k,l);
-            if (do_avg_cnt) {
-              combine_and_fill(new_view_4d(i,j,k,l), avg_view_4d(i,j,k,l),avg_type,fill_value);
-            } else {
-              combine(new_view_4d(i,j,k,l), avg_view_4d(i,j,k,l),avg_type);
-            }
-          });
-          break;
-        }
-        case 5:
-        {
-          auto new_view_5d = field.get_view<const Real*****,Device>();
-          auto avg_view_5d = view_Nd_dev<5>(data,dims[0],dims[1],dims[2],dims[3],dims[4]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k,l,m;
-            unflatten_idx(idx,extents,i,j,k,l,m);
-            if (do_avg_cnt) {
-              combine_and_fill(new_view_5d(i,j,k,l,m), avg_view_5d(i,j,k,l,m),avg_type,fill_value);
-            } else {
-              combine(new_view_5d(i,j,k,l,m), avg_view_5d(i,j,k,l,m),avg_type);
-            }
-          });
-          break;
-        }
-        case 6:
-        {
-          auto new_view_6d = field.get_view<const Real******,Device>();
-          auto avg_view_6d = view_Nd_dev<6>(data,dims[0],dims[1],dims[2],dims[3],dims[4],dims[5]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k,l,m,n;
-            unflatten_idx(idx,extents,i,j,k,l,m,n);
-            if (do_avg_cnt) {
-              combine_and_fill(new_view_6d(i,j,k,l,m,n), avg_view_6d(i,j,k,l,m,n), avg_type,fill_value);
-            } else {
-              combine(new_view_6d(i,j,k,l,m,n), avg_view_6d(i,j,k,l,m,n),avg_type);
-            }
-          });
-          break;
-        }
-        default:
-          EKAT_ERROR_MSG ("Error! Field rank (" + std::to_string(rank) + ") not supported by AtmosphereOutput.\n");
+  // Manually update the 'running-tally' views with data from the fields,
+  // by combining new data with current avg values. If this is an output step,
+  // for Average output we also divide by the steps count, since the summation is complete.
+  // All fields are processed in a single kernel launch (see build_fused_tables).
+  // NOTE: fields whose IO view is aliasing the Field view (only possible for Instant
+  //       output) are not in the table, since there's no point in copying.
+  // These are needed inside kernels, so crate local copies
+  auto do_avg_cnt = m_track_avg_cnt;
+  auto avg_type = m_avg_type;
+  auto avg_coeff_threshold = m_avg_coeff_threshold;
+  const bool divide_by_nsteps = output_step and avg_type==OutputAvgType::Average;
+  if (m_combine_fused.size>0) {
+    const auto fused = m_combine_fused;
+    KT::RangePolicy policy(0,fused.size);
+    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
+      int i;
+      const auto& e = fused.entries(fused.find(idx,i));
+      const Real new_val = e.src.data[e.src.offset(i)];
+      Real& curr_val = e.tgt[i];
+      if (do_avg_cnt) {
+        combine_and_fill(new_val,curr_val,avg_type,fill_value);
+      } else {
+        combine(new_val,curr_val,avg_type);
       }
-    }
 
-    if (is_write_step) {
-      if (output_step and avg_type==OutputAvgType::Average) {
+      if (divide_by_nsteps) {
         if (do_avg_cnt) {
-          const auto avg_cnt_lookup = m_field_to_avg_cnt_map.at(name);
-          const auto avg_cnt_view = m_dev_views_1d.at(avg_cnt_lookup);
-          const auto avg_nsteps = avg_cnt_view.data();
-          // Divide by steps count only when the summation is complete
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
-            Real coeff_percentage = Real(avg_nsteps[i])/nsteps_since_last_output;
-            if (data[i] != fill_value && coeff_percentage > avg_coeff_threshold) {
-              data[i] /= avg_nsteps[i];
-            } else {
-              data[i] = fill_value;
-            }
-          });
+          const Real avg_nsteps = e.avg_cnt[i];
+          Real coeff_percentage = avg_nsteps/nsteps_since_last_output;
+          if (curr_val != fill_value && coeff_percentage > avg_coeff_threshold) {
+            curr_val /= avg_nsteps;
+          } else {
+            curr_val = fill_value;
+          }
         } else {
-          // Divide by steps count only when the summation is complete
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
-            data[i] /= nsteps_since_last_output;
-          });
+          curr_val /= nsteps_since_last_output;
         }
       }
-      // Bring data to host
-      auto view_host = m_host_views_1d.at(name);
-      Kokkos::deep_copy (view_host,view_dev);
+    });
+  }
+
+  // Lossy precision control only applies to output snapshots (checkpoints must be exact).
+  // Fields with precision control do not alias the field views, so we can round in place.
+  if (output_step) {
+    for (const auto& it : m_precision_control) {
+      auto v = m_dev_views_1d.at(it.first);
+      const auto& pc = it.second;
+      const int  keepbits = pc.keepbits;
+      const Real step = pc.step;
+      KT::RangePolicy policy(0,v.size());
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
+        if (v(i)!=fill_value) {
+          v(i) = keepbits>=0 ? bit_round(v(i),keepbits) : quantize(v(i),step);
+        }
+      });
+    }
+  }
+
+  if (is_write_step) {
+    for (auto const& name : m_fields_names) {
+      auto view_dev = m_dev_views_1d.at(name);
       auto func_start = std::chrono::steady_clock::now();
-      scorpio::write_var(filename,name,view_host.data());
+      if (m_async_write) {
+        // Snapshot the data, the IO thread will write it (see launch_async_write)
+        stage_var(name);
+      } else {
+        // Bring data to host
+        auto view_host = m_host_views_1d.at(name);
+        Kokkos::deep_copy (view_host,view_dev);
+        scorpio::write_var(filename,name,view_host.data());
+      }
       auto func_finish = std::chrono::steady_clock::now();
       auto duration_loc = std::chrono::duration_cast<std::chrono::milliseconds>(func_finish - func_start);
       duration_write += duration_loc.count();
@@ -630,12 +609,16 @@ run (const std::string& filename,
   // Handle writing the average count variables to file
   if (is_write_step) {
     for (const auto& name : m_avg_cnt_names) {
-      auto& view_dev = m_dev_views_1d.at(name);
-      // Bring data to host
-      auto view_host = m_host_views_1d.at(name);
-      Kokkos::deep_copy (view_host,view_dev);
       auto func_start = std::chrono::steady_clock::now();
-      scorpio::write_var(filename,name,view_host.data());
+      if (m_async_write) {
+        stage_var(name);
+      } else {
+        auto& view_dev = m_dev_views_1d.at(name);
+        // Bring data to host
+        auto view_host = m_host_views_1d.at(name);
+        Kokkos::deep_copy (view_host,view_dev);
+        scorpio::write_var(filename,name,view_host.data());
+      }
       auto func_finish = std::chrono::steady_clock::now();
       auto duration_loc = std::chrono::duration_cast<std::chrono::milliseconds>(func_finish - func_start);
       duration_write += duration_loc.count();
@@ -643,11 +626,124 @@ run (const std::string& filename,
   }
   if (is_write_step) {
     if (m_atm_logger) {
-      m_atm_logger->info("  Done! Elapsed time: " + std::to_string(duration_write/1000.0) +" seconds");
+      if (m_async_write) {
+        m_atm_logger->info("  Done! Data staged for async write in " + std::to_string(duration_write/1000.0) +" seconds");
+      } else {
+        m_atm_logger->info("  Done! Elapsed time: " + std::to_string(duration_write/1000.0) +" seconds");
+      }
     }
   }
 } // run
 
+void AtmosphereOutput::
+build_fused_tables ()
+{
+  // Using the view strides allows to handle padded fields and subfields
+  std::vector<FusedEntry> entries;
+  std::vector<int> sizes;
+  auto add_entry = [&](const Field& f, Real* tgt, const Real* avg_cnt) {
+    FusedEntry e;
+    e.src = get_strided_data<const Real>(f);
+    e.tgt = tgt;
+    e.avg_cnt = avg_cnt;
+    entries.push_back(e);
+    sizes.push_back(e.src.size());
+  };
+
+  // Avg count views: use the first field that maps to each avg count
+  if (m_track_avg_cnt) {
+    std::set<std::string> avg_cnt_set;
+    for (const auto& name : m_fields_names) {
+      const auto& avg_cnt_name = m_field_to_avg_cnt_map.at(name);
+      if (avg_cnt_set.count(avg_cnt_name)==1) {
+        continue;
+      }
+      avg_cnt_set.insert(avg_cnt_name);
+
+      add_entry(get_field(name,"io"),m_dev_views_1d.at(avg_cnt_name).data(),nullptr);
+    }
+  }
+  m_avg_cnt_fused.setup(entries,sizes);
+
+  // Running tallies: skip fields whose IO view is aliasing the field view
+  entries.clear();
+  sizes.clear();
+  for (const auto& name : m_fields_names) {
+    const auto field = get_field(name,"io");
+    auto tgt = m_dev_views_1d.at(name).data();
+    if (tgt==field.get_internal_view_data<const Real,Device>()) {
+      continue;
+    }
+
+    const Real* avg_cnt = nullptr;
+    if (m_track_avg_cnt) {
+      avg_cnt = m_dev_views_1d.at(m_field_to_avg_cnt_map.at(name)).data();
+    }
+    add_entry(field,tgt,avg_cnt);
+  }
+  m_combine_fused.setup(entries,sizes);
+
+  m_fused_tables_built = true;
+}
+
+void AtmosphereOutput::
+stage_var (const std::string& name)
+{
+  auto& view_host = m_staging_views[m_staging_idx].at(name);
+  Kokkos::deep_copy (view_host,m_dev_views_1d.at(name));
+  m_staged_names.push_back(name);
+}
+
+void AtmosphereOutput::
+wait_staging_buffer (const int idx)
+{
+  auto& pending = m_staging_pending[idx];
+  if (pending.size()==0) {
+    return;
+  }
+
+  // Wait through the scorpio interface (rather than on the futures), so that
+  // the time we spend blocked is charged to the jobs
+  for (const auto& job : pending) {
+    scorpio::wait_async_job(job);
+  }
+
+  const auto& timing = *m_staging_timing[idx];
+  m_async_write_time  += timing.run_time;
+  m_async_hidden_time += timing.run_time - timing.blocked_time;
+
+  pending.clear();
+  m_staging_timing[idx] = nullptr;
+}
+
+void AtmosphereOutput::
+launch_async_write (const std::string& filename)
+{
+  if (m_staged_names.size()==0) {
+    // Either not async, or this was not a write step
+    return;
+  }
+
+  // Note: the staging buffer is not touched until wait_staging_buffer(idx) is called
+  const int idx = m_staging_idx;
+  m_staging_timing[idx] = std::make_shared<scorpio::AsyncJobTiming>();
+  for (const auto& name : m_staged_names) {
+    const auto& view = m_staging_views[idx].at(name);
+    m_staging_pending[idx].push_back(scorpio::enqueue_write_var(filename,name,view.data(),m_staging_timing[idx]));
+  }
+
+  // Next snapshot goes in the other buffer
+  m_staged_names.clear();
+  m_staging_idx = 1 - idx;
+}
+
+void AtmosphereOutput::
+finalize_async_writes ()
+{
+  wait_staging_buffer(0);
+  wait_staging_buffer(1);
+}
+
 long long AtmosphereOutput::
 res_dep_memory_footprint () const {
   long long rdmf = 0;
@@ -806,11 +902,15 @@ void AtmosphereOutput::register_views()
     //
     // We also don't want to alias to a diagnostic output since it could share memory
     // with another diagnostic.
+    //
+    // Finally, fields with precision control are rounded in place at output steps,
+    // so they need their own view.
     bool can_alias_field_view =
         m_avg_type==OutputAvgType::Instant &&
         field.get_header().get_alloc_properties().get_padding()==0 &&
         field.get_header().get_parent().expired() &&
-        not is_diagnostic;
+        not is_diagnostic &&
+        m_precision_control.count(name)==0;
 
     const auto layout = m_layouts.at(field.name());
     const auto size = layout.size();
@@ -831,10 +931,71 @@ void AtmosphereOutput::register_views()
     }
   }
 
+  // For async writes, we need separate host buffers, which are not aliasing the fields
+  // (the field data may change before the IO thread writes the snapshot)
+  if (m_async_write) {
+    for (auto& staging : m_staging_views) {
+      for (const auto& name : m_fields_names) {
+        staging.emplace(name,Kokkos::create_mirror(m_dev_views_1d.at(name)));
+      }
+      for (const auto& name : m_avg_cnt_names) {
+        staging.emplace(name,Kokkos::create_mirror(m_dev_views_1d.at(name)));
+      }
+    }
+  }
+
   // Initialize the local views
   reset_dev_views();
 }
 /* ---------------------------------------------------------- */
+void AtmosphereOutput::set_precision_control (const ekat::ParameterList& pl)
+{
+  constexpr int mantissa_bits = std::numeric_limits<Real>::digits - 1;
+
+  auto parse = [&](const ekat::ParameterList& p, PrecisionControl& pc) {
+    const bool has_keepbits = p.isParameter("keepbits");
+    const bool has_max_err  = p.isParameter("max_abs_error");
+    EKAT_REQUIRE_MSG (not (has_keepbits and has_max_err),
+        "Error! Cannot specify both 'keepbits' and 'max_abs_error' in precision_control.\n"
+        "  - sublist name: " + p.name() + "\n");
+    if (has_keepbits) {
+      pc.keepbits = p.get<int>("keepbits");
+      pc.max_abs_error = -1;
+      EKAT_REQUIRE_MSG (pc.keepbits>=0 and pc.keepbits<=mantissa_bits,
+          "Error! Invalid value for 'keepbits' in precision_control.\n"
+          "  - sublist name: " + p.name() + "\n"
+          "  - keepbits: " + std::to_string(pc.keepbits) + "\n"
+          "  - valid range: [0," + std::to_string(mantissa_bits) + "]\n");
+    } else if (has_max_err) {
+      pc.keepbits = -1;
+      pc.max_abs_error = p.get<double>("max_abs_error");
+      EKAT_REQUIRE_MSG (pc.max_abs_error>0,
+          "Error! Invalid value for 'max_abs_error' in precision_control (must be positive).\n"
+          "  - sublist name: " + p.name() + "\n"
+          "  - max_abs_error: " + std::to_string(pc.max_abs_error) + "\n");
+      pc.step = std::exp2(std::floor(std::log2(2*pc.max_abs_error)));
+    }
+  };
+
+  // Field-specific settings override the stream ones
+  PrecisionControl stream_pc;
+  parse(pl,stream_pc);
+  for (auto it=pl.sublists_names_cbegin(); it!=pl.sublists_names_cend(); ++it) {
+    EKAT_REQUIRE_MSG (ekat::contains(m_fields_names,*it),
+        "Error! Found precision_control settings for a field not in the output stream.\n"
+        "  - field name: " + *it + "\n");
+  }
+  for (const auto& name : m_fields_names) {
+    auto pc = stream_pc;
+    if (pl.isSublist(name)) {
+      parse(pl.sublist(name),pc);
+    }
+    if (pc.keepbits>=0 or pc.max_abs_error>0) {
+      m_precision_control[name] = pc;
+    }
+  }
+}
+/* ---------------------------------------------------------- */
 void AtmosphereOutput::set_avg_cnt_tracking(const std::string& name, const FieldLayout& layout)
 {
   // Make sure this field "name" hasn't already been registered with avg_cnt tracking.
@@ -915,7 +1076,8 @@ reset_dev_views()
 void AtmosphereOutput::
 register_variables(const std::string& filename,
                    const std::string& fp_precision,
-                   const scorpio::FileMode mode)
+                   const scorpio::FileMode mode,
+                   const bool is_restart_file)
 {
   using namespace ShortFieldTagsNames;
   using strvec_t = std::vector<std::string>;
@@ -1029,6 +1191,19 @@ register_variables(const std::string& filename,
         scorpio::set_attribute(filename,name,att_name,att_val);
       }
 
+      // Record the lossy precision control applied to this variable (not in restart files,
+      // since checkpoints are written at full precision)
+      if (not is_restart_file and m_precision_control.count(name)==1) {
+        const auto& pc = m_precision_control.at(name);
+        if (pc.keepbits>=0) {
+          scorpio::set_attribute(filename,name,"quantization_algorithm",std::string("bitround"));
+          scorpio::set_attribute(filename,name,"quantization_nsb",pc.keepbits);
+        } else {
+          scorpio::set_attribute(filename,name,"quantization_algorithm",std::string("absolute_error"));
+          scorpio::set_attribute(filename,name,"quantization_maximum_absolute_error",static_cast<double>(pc.max_abs_error));
+        }
+      }
+
       // Gather longname (if not already in the io: string attributes)
       if (str_atts.count("long_name")==0) {
         auto longname = m_longnames.get_longname(name);
@@ -1199,7 +1374,8 @@ void AtmosphereOutput::set_decompositions(const std::string& filename)
 void AtmosphereOutput::
 setup_output_file(const std::string& filename,
                   const std::string& fp_precision,
-                  const scorpio::FileMode mode)
+                  const scorpio::FileMode mode,
+                  const bool is_restart_file)
 {
   // Register dimensions with netCDF file.
   for (auto it : m_dims) {
@@ -1221,7 +1397,7 @@ setup_output_file(const std::string& filename,
   }
 
   // Register variables with netCDF file.  Must come after dimensions are registered.
-  register_variables(filename,fp_precision,mode);
+  register_variables(filename,fp_precision,mode,is_restart_file);
 
   // Set the offsets of the local dofs in the global vector.
   set_decompositions(filename);
@@ -1296,7 +1472,12 @@ void AtmosphereOutput::set_diagnostics()
   const auto sim_field_mgr = get_field_manager("sim");
   // Create all diagnostics
   for (auto& fname : m_fields_names) {
-    if (!sim_field_mgr->has_field(fname)) {
+    if (sim_field_mgr->has_field(fname)) {
+      // Output may use the field on any step (e.g., for averaging), so make sure
+      // the process computing it does not skip it (see declare_field_needed_every)
+      auto f = sim_field_mgr->get_field(fname);
+      declare_field_needed_every(f,"output",1);
+    } else {
       auto diag = create_diagnostic(fname);
       auto diag_fname = diag->get_diagnostic().name();
       m_diagnostics[diag_fname] = diag;
@@ -1315,125 +1496,22 @@ AtmosphereOutput::create_diagnostic (const std::string& diag_field_name) {
   auto& diag_factory = AtmosphereDiagnosticFactory::instance();
 
   // Construct a diagnostic by this name
-  ekat::ParameterList params;
-  std::string diag_name;
-  std::string diag_avg_cnt_name = "";
+  const auto sim_grid_name = get_field_manager("sim")->get_grid()->name();
+  auto diag_info = get_diagnostic_params(diag_field_name,sim_grid_name);
+  const auto& diag_name = diag_info.first;
+  auto& params = diag_info.second;
 
-  if (diag_field_name.find("_at_")!=std::string::npos) {
-    // The diagnostic must be one of
-    //  - ${field_name}_at_lev_${N}     <- interface fields still use "_lev_"
-    //  - ${field_name}_at_model_bot
-    //  - ${field_name}_at_model_top
-    //  - ${field_name}_at_${M}X
-    // where M/N are numbers (N integer), X=Pa, hPa, mb, or m
-    auto tokens = ekat::split(diag_field_name,"_at_");
-    EKAT_REQUIRE_MSG (tokens.size()==2,
-        "Error! Unexpected diagnostic name: " + diag_field_name + "\n");
-
-    const auto& fname = tokens.front();
-    params.set("field_name",fname);
-    params.set("grid_name",get_field_manager("sim")->get_grid()->name());
-
-    params.set("vertical_location", tokens[1]);
+  std::string diag_avg_cnt_name = "";
+  if (diag_name=="FieldAtLevel" or diag_name=="FieldAtPressureLevel" or diag_name=="FieldAtHeight") {
     params.set<double>("mask_value",m_fill_value);
 
-    // Conventions on notation (N=any integer):
-    // FieldAtLevel        : var_at_lev_N, var_at_model_top, var_at_model_bot
-    // FieldAtPressureLevel: var_at_Nx, with x=mb,Pa,hPa
-    // FieldAtHeight       : var_at_Nm_above_Y (Y=sealevel or surface)
-    if (tokens[1].find_first_of("0123456789.")==0) {
-      auto units_start = tokens[1].find_first_not_of("0123456789.");
-      auto units = tokens[1].substr(units_start);
-      if (units.find("_above_") != std::string::npos) {
-        // The field is at a height above a specific reference.
-        // Currently we only support FieldAtHeight above "sealevel" or "surface"
-        auto subtokens = ekat::split(units,"_above_");
-        params.set("surface_reference",subtokens[1]);
-        units = subtokens[0];
-        // Need to reset the vertical location to strip the "_above_" part of the string.
-              params.set("vertical_location", tokens[1].substr(0,units_start)+subtokens[0]);
-        // If the slice is "above_sealevel" then we need to track the avg cnt uniquely.
-        // Note, "above_surface" is expected to never have masking and can thus use
-        // the typical 2d layout avg cnt.
-        if (subtokens[1]=="sealevel") {
-                diag_avg_cnt_name = "_" + tokens[1]; // Set avg_cnt tracking for this specific slice
-                // If we have 2D slices we need to be tracking the average count,
-                // if m_avg_type is not Instant
-                m_track_avg_cnt = m_track_avg_cnt || m_avg_type!=OutputAvgType::Instant;
-        }
-      }
-      if (units=="m") {
-        diag_name = "FieldAtHeight";
-        EKAT_REQUIRE_MSG(params.isParameter("surface_reference"),"Error! Output field request for " + diag_field_name + " is missing a surface reference."
-            "  Please add either '_above_sealevel' or '_above_surface' to the field name");
-      } else if (units=="mb" or units=="Pa" or units=="hPa") {
-        diag_name = "FieldAtPressureLevel";
-        diag_avg_cnt_name = "_" + tokens[1]; // Set avg_cnt tracking for this specific slice
-        // If we have 2D slices we need to be tracking the average count,
-        // if m_avg_type is not Instant
-        m_track_avg_cnt = m_track_avg_cnt || m_avg_type!=OutputAvgType::Instant;
-      } else {
-        EKAT_ERROR_MSG ("Error! Invalid units x for 'field_at_Nx' diagnostic.\n");
-      }
-    } else {
-      diag_name = "FieldAtLevel";
-    }
-  } else if (diag_field_name=="precip_liq_surf_mass_flux" or
-             diag_field_name=="precip_ice_surf_mass_flux" or
-             diag_field_name=="precip_total_surf_mass_flux") {
-    diag_name = "precip_surf_mass_flux";
-    // split will return [X, ''], with X being whatever is before '_surf_mass_flux'
-    auto type = ekat::split(diag_field_name.substr(7),"_surf_mass_flux").front();
-    params.set<std::string>("precip_type",type);
-  } else if (diag_field_name=="IceWaterPath" or
-             diag_field_name=="LiqWaterPath" or
-             diag_field_name=="RainWaterPath" or
-             diag_field_name=="RimeWaterPath" or
-             diag_field_name=="VapWaterPath") {
-    diag_name = "WaterPath";
-    // split will return the list [X, ''], with X being whatever is before 'WaterPath'
-    params.set<std::string>("Water Kind",ekat::split(diag_field_name,"WaterPath").front());
-  } else if (diag_field_name=="IceNumberPath" or
-             diag_field_name=="LiqNumberPath" or
-             diag_field_name=="RainNumberPath") {
-    diag_name = "NumberPath";
-    // split will return the list [X, ''], with X being whatever is before 'NumberPath'
-    params.set<std::string>("Number Kind",ekat::split(diag_field_name,"NumberPath").front());
-  } else if (diag_field_name=="AeroComCldTop" or
-             diag_field_name=="AeroComCldBot") {
-    diag_name = "AeroComCld";
-    // split will return the list ['', X], with X being whatever is after 'AeroComCld'
-    params.set<std::string>("AeroComCld Kind",ekat::split(diag_field_name,"AeroComCld").back());
-  } else if (diag_field_name=="MeridionalVapFlux" or
-             diag_field_name=="ZonalVapFlux") {
-    diag_name = "VaporFlux";
-    // split will return the list [X, ''], with X being whatever is before 'VapFlux'
-    params.set<std::string>("Wind Component",ekat::split(diag_field_name,"VapFlux").front());
-  } else if (diag_field_name.find("_atm_backtend")!=std::string::npos) {
-    diag_name = "AtmBackTendDiag";
-    // Set the grid_name
-    params.set("grid_name",get_field_manager("sim")->get_grid()->name());
-    // split will return [X, ''], with X being whatever is before '_atm_tend'
-    params.set<std::string>("Tendency Name",ekat::split(diag_field_name,"_atm_backtend").front());
-  } else if (diag_field_name=="PotentialTemperature" or
-             diag_field_name=="LiqPotentialTemperature") {
-    diag_name = "PotentialTemperature";
-    if (diag_field_name == "LiqPotentialTemperature") {
-      params.set<std::string>("Temperature Kind", "Liq");
-    } else {
-      params.set<std::string>("Temperature Kind", "Tot");
+    // Slices at a pressure level, or at a height above sea level, may be masked,
+    // so we need to track their avg count separately, if m_avg_type is not Instant
+    if (diag_name=="FieldAtPressureLevel" or
+        (diag_name=="FieldAtHeight" and params.get<std::string>("surface_reference")=="sealevel")) {
+      diag_avg_cnt_name = "_" + ekat::split(diag_field_name,"_at_").back();
+      m_track_avg_cnt = m_track_avg_cnt || m_avg_type!=OutputAvgType::Instant;
     }
-  } else {
-    diag_name = diag_field_name;
-  }
-
-  // These fields are special case of VerticalLayer diagnostic.
-  // The diagnostics requires the name to be given as param value.
-  if (diag_name == "z_int"            or diag_name == "z_mid"            or
-      diag_name == "geopotential_int" or diag_name == "geopotential_mid" or
-      diag_name == "height_int"       or diag_name == "height_mid"     or
-      diag_name == "dz") {
-    params.set<std::string>("diag_name", diag_name);
   }
 
   // Create the diagnostic
@@ -1468,102 +1546,4 @@ AtmosphereOutput::create_diagnostic (const std::string& diag_field_name) {
   return diag;
 }
 
-// Helper function to mark filled points in a specific layout
-void AtmosphereOutput::
-update_avg_cnt_view(const Field& field, view_1d_dev& dev_view) {
-  const auto& name   = field.name();
-  const auto& layout = m_layouts.at(name);
-  const auto& dims   = layout.dims();
-        auto  data   = dev_view.data();
-  const auto fill_value = m_fill_value;
-
-  KT::RangePolicy policy(0,layout.size());
-  const auto extents = layout.extents();
-  switch (layout.rank()) {
-    case 1:
-    {
-      // For rank-1 views, we use strided layout, since it helps us
-      // handling a few more scenarios
-      auto src_view_1d = field.get_strided_view<const Real*,Device>();
-      auto tgt_view_1d = view_Nd_dev<1>(data,dims[0]);
-      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
-        if (src_view_1d(i)!=fill_value) {
-          tgt_view_1d(i) += 1;
-        }
-      });
-      break;
-    }
-    case 2:
-    {
-      auto src_view_2d = field.get_view<const Real**,Device>();
-      auto tgt_view_2d = view_Nd_dev<2>(data,dims[0],dims[1]);
-      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-        int i,j;
-        unflatten_idx(idx,extents,i,j);
-        if (src_view_2d(i,j)!=fill_value) {
-          tgt_view_2d(i,j) += 1;
-        }
-      });
-      break;
-    }
-    case 3:
-    {
-      auto src_view_3d = field.get_view<const Real***,Device>();
-      auto tgt_view_3d = view_Nd_dev<3>(data,dims[0],dims[1],dims[2]);
-      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-        int i,j,k;
-        unflatten_idx(idx,extents,i,j,k);
-        if (src_view_3d(i,j,k)!=fill_value) {
-          tgt_view_3d(i,j,k) += 1;
-        }
-      });
-      break;
-    }
-    case 4:
-    {
-      auto src_view_4d = field.get_view<const Real****,Device>();
-      auto tgt_view_4d = view_Nd_dev<4>(data,dims[0],dims[1],dims[2],dims[3]);
-      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-        int i,j,k,l;
-        unflatten_idx(idx,extents,i,j,k,l);
-        if (src_view_4d(i,j,k,l)!=fill_value) {
-          tgt_view_4d(i,j,k,l) += 1;
-        }
-      });
-      break;
-    }
-    case 5:
-    {
-      auto src_view_5d = field.get_view<const Real*****,Device>();
-      auto tgt_view_5d = view_Nd_dev<5>(data,dims[0],dims[1],dims[2],dims[3],dims[4]);
-      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-        int i,j,k,l,m;
-        unflatten_idx(idx,extents,i,j,k,l,m);
-        if (src_view_5d(i,j,k,l,m)!=fill_value) {
-          tgt_view_5d(i,j,k,l,m) += 1;
-        }
-      });
-      break;
-    }
-    case 6:
-    {
-      auto src_view_6d = field.get_view<const Real******,Device>();
-      auto tgt_view_6d = view_Nd_dev<6>(data,dims[0],dims[1],dims[2],dims[3],dims[4],dims[5]);
-      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-        int i,j,k,l,m,n;
-        unflatten_idx(idx,extents,i,j,k,l,m,n);
-        if (src_view_6d(i,j,k,l,m,n)!=fill_value) {
-          tgt_view_6d(i,j,k,l,m,n) += 1;
-        }
-      });
-      break;
-    }
-    default:
-      EKAT_ERROR_MSG (
-            "Error! Field rank not not supported by AtmosphereOutput.\n"
-          "  - field name:   " + field.name() + "\n"
-          "  - field layout: " + layout.to_string() + "\n");
-  }
-}
-
 } // namespace scream
@@ -7,10 +7,13 @@
 #include "share/grid/abstract_grid.hpp"
 #include "share/grid/grids_manager.hpp"
 #include "share/util//scream_time_stamp.hpp"
+#include "share/util/eamxx_fused_index_space.hpp"
 #include "share/atm_process/atmosphere_diagnostic.hpp"
 
 #include "ekat/ekat_parameter_list.hpp"
 #include "ekat/mpi/ekat_comm.hpp"
+
+#include <array>
 /*  The AtmosphereOutput class handles an output stream in SCREAM.
  *  Typical usage is to register an AtmosphereOutput object with the OutputManager (see scream_output_manager.hpp
  *
@@ -28,6 +31,13 @@
  *  filename_prefix:              STRING
  *  Averaging Type:               STRING
  *  Max Snapshots Per File:       INT                   (default: 1)
+ *  async_write:                  BOOL                  (default: false)
+ *  precision_control:                                  (optional)
+ *    keepbits:                   INT
+ *    max_abs_error:              DOUBLE
+ *    FIELD_NAME:
+ *      keepbits:                 INT
+ *      max_abs_error:            DOUBLE
  *  Fields:
  *     GRID_NAME_1:
  *        Field Names:            ARRAY OF STRINGS
@@ -62,6 +72,25 @@
  *                        SEGrid fields to PointGrid fields on the fly, to save on output size)
  *  - Max Snapshots Per File: the maximum number of snapshots saved per file. After this many
  *    snapshots, the current files is closed and a new file created.
+ *  - async_write: if true, on write steps the output data is only copied into a host staging
+ *    buffer (there are two of them, used alternately), and the actual write is carried out
+ *    by the scorpio IO thread while the time loop proceeds. Requires MPI_THREAD_MULTIPLE;
+ *    if not available, we fall back to synchronous writes. Note: scorpio calls made from
+ *    the main thread that only write data (e.g., the metadata of other output streams)
+ *    are queued after the pending writes, but scorpio calls that need data back from PIO
+ *    (e.g., reading input) or create PIO objects (e.g., opening a new file) first wait
+ *    for the queued writes to complete (see scream_scorpio_interface.hpp).
+ *  - precision_control: lossy compression of the output data, applied to each snapshot
+ *    before it is written (but not to checkpoints, which must be exact). This makes the
+ *    data much more compressible by downstream tools. Options at the top level of the
+ *    sublist apply to all fields, while a FIELD_NAME sublist overrides them for that field.
+ *    Only one between keepbits and max_abs_error can be specified:
+ *     - keepbits: round each value to the nearest value with only this many mantissa bits
+ *       (bit rounding, ties to even). The relative error is at most 2^-(keepbits+1).
+ *     - max_abs_error: round each value to a multiple of the largest power of 2 not exceeding
+ *       2*max_abs_error, so the absolute error is at most max_abs_error.
+ *    Fill values are never altered. The method and its parameter are stored in the
+ *    'quantization_*' attributes of each variable.
  *  - Output: parameters for output control
  *    - Frequency: the frequency of output writes (in the units specified by ${Output frequency_units})
  *    - frequency_units: the units of output frequency (nsteps, nmonths, nyears, nhours, ndays,...)
@@ -137,8 +166,8 @@ public:
   void restart (const std::string& filename);
   void init();
   void reset_dev_views();
-  void update_avg_cnt_view(const Field&, view_1d_dev& dev_view);
-  void setup_output_file (const std::string& filename, const std::string& fp_precision, const scorpio::FileMode mode);
+  void setup_output_file (const std::string& filename, const std::string& fp_precision, const scorpio::FileMode mode,
+                          const bool is_restart_file = false);
 
   void init_timestep (const util::TimeStamp& start_of_step);
   void run (const std::string& filename,
@@ -146,6 +175,17 @@ public:
             const int nsteps_since_last_output,
             const bool allow_invalid_fields = false);
 
+  // Async writes: enqueue the write of the data staged during the last run call,
+  // and wait for all pending writes (collecting their timings) respectively.
+  bool is_async () const { return m_async_write; }
+  void launch_async_write (const std::string& filename);
+  void finalize_async_writes ();
+
+  // Total time spent by the IO thread on this stream's writes, and the part of it
+  // that overlapped with the time loop (i.e., the main thread was not waiting for it)
+  double get_async_write_time () const { return m_async_write_time; }
+  double get_async_hidden_time () const { return m_async_hidden_time; }
+
   long long res_dep_memory_footprint () const;
 
   std::shared_ptr<const AbstractGrid> get_io_grid () const {
@@ -166,7 +206,8 @@ protected:
   std::shared_ptr<const fm_type> get_field_manager (const std::string& mode) const;
 
   void register_dimensions(const std::string& name);
-  void register_variables(const std::string& filename, const std::string& fp_precision, const scorpio::FileMode mode);
+  void register_variables(const std::string& filename, const std::string& fp_precision, const scorpio::FileMode mode,
+                          const bool is_restart_file);
   void set_decompositions(const std::string& filename);
   std::vector<scorpio::offset_t> get_var_dof_offsets (const FieldLayout& layout);
   void register_views();
@@ -176,9 +217,18 @@ protected:
   std::shared_ptr<AtmosphereDiagnostic>
   create_diagnostic (const std::string& diag_name);
 
+  void set_precision_control (const ekat::ParameterList& pl);
+
   // Tracking the averaging of any filled values:
   void set_avg_cnt_tracking(const std::string& name, const FieldLayout& layout);
 
+  // Build the tables driving the fused avg count/accumulation kernels in run
+  void build_fused_tables ();
+
+  // Copy the data of a var into the current staging buffer (async writes only)
+  void stage_var (const std::string& name);
+  void wait_staging_buffer (const int idx);
+
   // --- Internal variables --- //
   ekat::Comm                          m_comm;
 
@@ -222,6 +272,42 @@ protected:
   bool m_add_time_dim;
   bool m_track_avg_cnt = false;
 
+  // Lossy precision control of output snapshots (see precision_control above). Fields
+  // with precision control never alias the field view, so we can round their data in place.
+  struct PrecisionControl {
+    int  keepbits      = -1;
+    Real max_abs_error = -1;
+    Real step          = 0;   // Power of 2 used for max_abs_error rounding
+  };
+  std::map<std::string,PrecisionControl>  m_precision_control;
+
+  // To update the running tallies (and the avg counts) of all fields with a single
+  // kernel launch, we concatenate the index spaces of all fields (see FusedIndexSpace).
+  // The src (field) data is accessed via strides, to handle padding and subfields,
+  // while tgt (and avg_cnt) are the contiguous 1d views in m_dev_views_1d.
+  struct FusedEntry {
+    StridedData<const Real> src;
+    Real*       tgt     = nullptr;
+    const Real* avg_cnt = nullptr;
+  };
+  using FusedTable = FusedIndexSpace<FusedEntry>;
+  FusedTable  m_avg_cnt_fused;
+  FusedTable  m_combine_fused;
+  bool        m_fused_tables_built = false;
+
+  // Async writes. Data is staged in one of the two buffers, and written by the scorpio
+  // IO thread. Before reusing a buffer, we make sure its previous write has completed.
+  using staging_t = std::map<std::string,view_1d_host>;
+  bool                                                    m_async_write = false;
+  bool                                                    m_async_write_requested = false;
+  int                                                     m_staging_idx = 0;
+  std::vector<std::string>                                m_staged_names;
+  std::array<staging_t,2>                                 m_staging_views;
+  std::array<std::vector<std::shared_future<void>>,2>    m_staging_pending;
+  std::array<std::shared_ptr<scorpio::AsyncJobTiming>,2>  m_staging_timing;
+  double                                                  m_async_write_time  = 0;
+  double                                                  m_async_hidden_time = 0;
+
   // The logger to be used throughout the ATM to log message
   std::shared_ptr<ekat::logger::LoggerBase> m_atm_logger;
 };
@@ -0,0 +1,623 @@
+#include "share/io/scream_incremental_restart.hpp"
+
+#include "ekat/ekat_assert.hpp"
+#include "ekat/util/ekat_string_utils.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+
+namespace scream
+{
+
+namespace {
+
+constexpr char magic[8] = {'E','A','M','X','X','C','H','K'};
+constexpr int  version  = 2;
+
+// Zero runs shorter than this are stored as literals
+constexpr long long min_zero_run = 4;
+
+// Mix a (position,value) pair, so that the chunk hash changes if values are moved around
+KOKKOS_INLINE_FUNCTION
+std::uint64_t mix (const std::uint64_t idx, const std::uint32_t word) {
+  std::uint64_t z = idx*0x9E3779B97F4A7C15ULL + word;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+template<typename T>
+void write_pod (std::ostream& os, const T& v) {
+  os.write(reinterpret_cast<const char*>(&v),sizeof(T));
+}
+
+void write_string (std::ostream& os, const std::string& s) {
+  write_pod(os,static_cast<std::int64_t>(s.size()));
+  os.write(s.data(),s.size());
+}
+
+template<typename T>
+T read_pod (std::istream& is, const std::string& fname) {
+  T v;
+  is.read(reinterpret_cast<char*>(&v),sizeof(T));
+  EKAT_REQUIRE_MSG (is.good(),
+      "Error! Could not read from incremental restart file (truncated/corrupted file?).\n"
+      "  - file name: " + fname + "\n");
+  return v;
+}
+
+std::string read_string (std::istream& is, const std::string& fname) {
+  const auto n = read_pod<std::int64_t>(is,fname);
+  std::string s(n,' ');
+  is.read(&s[0],n);
+  EKAT_REQUIRE_MSG (is.good(),
+      "Error! Could not read from incremental restart file (truncated/corrupted file?).\n"
+      "  - file name: " + fname + "\n");
+  return s;
+}
+
+void put_varint (std::vector<char>& out, std::uint64_t v) {
+  while (v>=0x80) {
+    out.push_back(static_cast<char>((v & 0x7F) | 0x80));
+    v >>= 7;
+  }
+  out.push_back(static_cast<char>(v));
+}
+
+std::uint64_t get_varint (const unsigned char* data, const long long nbytes, long long& pos) {
+  std::uint64_t v = 0;
+  int shift = 0;
+  while (true) {
+    EKAT_REQUIRE_MSG (pos<nbytes and shift<64,
+        "Error! Corrupted compressed chunk in incremental restart file.\n");
+    const auto byte = data[pos++];
+    v |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80)==0) {
+      return v;
+    }
+    shift += 7;
+  }
+}
+
+} // anonymous namespace
+
+IncrementalRestart::
+IncrementalRestart (const ekat::Comm& comm,
+                    const std::vector<Field>& fields,
+                    const long long chunk_size,
+                    const int max_chain_length)
+ : m_comm (comm)
+ , m_fields (fields)
+ , m_max_chain_length (max_chain_length)
+{
+  EKAT_REQUIRE_MSG (chunk_size>0,
+      "Error! Invalid chunk size for incremental restart.\n"
+      "  - chunk size: " + std::to_string(chunk_size) + "\n");
+  EKAT_REQUIRE_MSG (max_chain_length>0,
+      "Error! Invalid max chain length for incremental restart.\n"
+      "  - max chain length: " + std::to_string(max_chain_length) + "\n");
+  for (const auto& f : m_fields) {
+    EKAT_REQUIRE_MSG (f.is_allocated(),
+        "Error! Incremental restart fields must be allocated.\n"
+        "  - field name: " + f.name() + "\n");
+  }
+
+  // Chunks must contain a whole number of values of any data type
+  m_chunk_size = (chunk_size+7)/8*8;
+}
+
+std::string IncrementalRestart::
+sidecar_filename (const std::string& restart_filename, const int rank)
+{
+  return restart_filename + ".rank" + std::to_string(rank) + ".chk";
+}
+
+bool IncrementalRestart::is_contiguous (const Field& f)
+{
+  const auto& ap = f.get_header().get_alloc_properties();
+  return not ap.is_subfield() and ap.contiguous();
+}
+
+std::vector<IncrementalRestart::HashType> IncrementalRestart::
+hash_chunks (const Field& f, const long long chunk_size)
+{
+  using KT = KokkosTypes<DefaultDevice>;
+  using word_t = std::uint32_t;
+
+  const long long nbytes = f.get_header().get_alloc_properties().get_alloc_size();
+  const long long nwords = nbytes / sizeof(word_t);
+  const long long chunk_words = chunk_size / sizeof(word_t);
+  const int nchunks = (nbytes + chunk_size - 1) / chunk_size;
+
+  const auto data = reinterpret_cast<const word_t*>(f.get_internal_view_data_unsafe<const char>());
+  KT::view_1d<HashType> hashes("chunk_hashes",nchunks);
+
+  // One team per chunk. Position-dependent terms are summed, so the hash does not
+  // depend on the order of the reduction.
+  using policy_t = KT::TeamPolicy;
+  Kokkos::parallel_for(policy_t(nchunks,Kokkos::AUTO),
+                       KOKKOS_LAMBDA(const KT::MemberType& team) {
+    const int ic = team.league_rank();
+    const long long beg = ic*chunk_words;
+    const long long end = beg+chunk_words<nwords ? beg+chunk_words : nwords;
+    HashType h = 0;
+    Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team,beg,end),
+                            [&](const long long i, HashType& accum) {
+      accum += mix(i,data[i]);
+    },h);
+    Kokkos::single(Kokkos::PerTeam(team),[&]() {
+      hashes(ic) = h;
+    });
+  });
+
+  auto hashes_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),hashes);
+  return std::vector<HashType>(hashes_h.data(),hashes_h.data()+nchunks);
+}
+
+void IncrementalRestart::write (const std::string& restart_filename)
+{
+  using dev_mem_t = typename DefaultDevice::memory_space;
+  using unmanaged = Kokkos::MemoryTraits<Kokkos::Unmanaged>;
+
+  const bool full = m_num_since_full<0 or m_num_since_full+1>=m_max_chain_length;
+  m_num_since_full = full ? 0 : m_num_since_full+1;
+
+  m_bytes_total      = 0;
+  m_bytes_written    = 0;
+  m_bytes_referenced = 0;
+
+  const auto sidecar = sidecar_filename(restart_filename,m_comm.rank());
+  std::ofstream os (sidecar,std::ios::binary | std::ios::trunc);
+  EKAT_REQUIRE_MSG (os.good(),
+      "Error! Could not open incremental restart file for writing.\n"
+      "  - file name: " + sidecar + "\n");
+
+  write_header(os);
+
+  std::map<std::string,FieldEntry> curr;
+  std::vector<char> buf (m_chunk_size);
+  for (const auto& f : m_fields) {
+    const auto src = is_contiguous(f) ? f : f.clone();
+
+    auto& fe = curr[f.name()];
+    fe.name       = f.name();
+    fe.nbytes     = src.get_header().get_alloc_properties().get_alloc_size();
+    fe.chunk_size = m_chunk_size;
+    fe.word_size  = get_type_size(f.data_type());
+    fe.dims       = f.get_header().get_identifier().get_layout().dims();
+    fe.last_extent = src.get_header().get_alloc_properties().get_last_extent();
+
+    const auto hashes = hash_chunks(src,m_chunk_size);
+    const int nchunks = hashes.size();
+
+    // We can only reference the previous checkpoint if the field did not change size
+    auto prev_it = m_prev.find(f.name());
+    const bool has_prev = not full and prev_it!=m_prev.end() and
+                          prev_it->second.nbytes==fe.nbytes and
+                          static_cast<int>(prev_it->second.chunks.size())==nchunks;
+
+    const auto data = src.get_internal_view_data_unsafe<const char>();
+    for (int ic=0; ic<nchunks; ++ic) {
+      const long long beg = ic*m_chunk_size;
+      const long long len = std::min(m_chunk_size,fe.nbytes-beg);
+
+      if (has_prev and prev_it->second.chunks[ic].hash==hashes[ic]) {
+        fe.chunks.push_back(prev_it->second.chunks[ic]);
+        m_bytes_referenced += len;
+        continue;
+      }
+
+      // Only bring the changed chunks to host
+      Kokkos::View<const char*,dev_mem_t,unmanaged> chunk_d (data+beg,len);
+      Kokkos::View<char*,Kokkos::HostSpace,unmanaged> chunk_h (buf.data(),len);
+      Kokkos::deep_copy(chunk_h,chunk_d);
+
+      const auto packed = compress(buf.data(),len,fe.word_size);
+
+      ChunkEntry ce;
+      ce.hash       = hashes[ic];
+      ce.file       = restart_filename;
+      ce.offset     = os.tellp();
+      ce.raw        = len;
+      ce.compressed = static_cast<long long>(packed.size())<len;
+      if (ce.compressed) {
+        ce.stored = packed.size();
+        os.write(packed.data(),packed.size());
+      } else {
+        ce.stored = len;
+        os.write(buf.data(),len);
+      }
+      fe.chunks.push_back(ce);
+      m_bytes_written += ce.stored;
+    }
+    m_bytes_total += fe.nbytes;
+  }
+
+  write_index(os,restart_filename,curr);
+
+  os.close();
+  EKAT_REQUIRE_MSG (not os.fail(),
+      "Error! Something went wrong while writing incremental restart file.\n"
+      "  - file name: " + sidecar + "\n");
+
+  m_prev = std::move(curr);
+  m_last_restart_filename = restart_filename;
+}
+
+void IncrementalRestart::finalize ()
+{
+  // Nothing to do if the last checkpoint is already self-contained
+  if (m_last_restart_filename=="" or last_write_was_full()) {
+    return;
+  }
+
+  // Rewrite the sidecar of the last checkpoint, copying in it the chunks stored
+  // in older checkpoints (as they are, without decompressing them)
+  const auto sidecar = sidecar_filename(m_last_restart_filename,m_comm.rank());
+  const auto tmp_sidecar = sidecar + ".tmp";
+  {
+    std::ofstream os (tmp_sidecar,std::ios::binary | std::ios::trunc);
+    EKAT_REQUIRE_MSG (os.good(),
+        "Error! Could not open incremental restart file for writing.\n"
+        "  - file name: " + tmp_sidecar + "\n");
+
+    write_header(os);
+
+    std::map<std::string,std::unique_ptr<std::ifstream>> files;
+    std::vector<char> buf;
+    for (auto& it : m_prev) {
+      for (auto& ce : it.second.chunks) {
+        auto& is = files[ce.file];
+        if (not is) {
+          const auto sc = sidecar_filename(ce.file,m_comm.rank());
+          is = std::make_unique<std::ifstream>(sc,std::ios::binary);
+          EKAT_REQUIRE_MSG (is->good(),
+              "Error! Could not open a file referenced by an incremental restart checkpoint.\n"
+              "  - checkpoint file: " + sidecar + "\n"
+              "  - referenced file: " + sc + "\n");
+        }
+        buf.resize(ce.stored);
+        is->seekg(ce.offset);
+        is->read(buf.data(),ce.stored);
+        EKAT_REQUIRE_MSG (is->good(),
+            "Error! Could not read chunk from incremental restart file.\n"
+            "  - file name : " + sidecar_filename(ce.file,m_comm.rank()) + "\n"
+            "  - field name: " + it.first + "\n");
+
+        ce.file   = m_last_restart_filename;
+        ce.offset = os.tellp();
+        os.write(buf.data(),ce.stored);
+      }
+    }
+
+    write_index(os,m_last_restart_filename,m_prev);
+
+    os.close();
+    EKAT_REQUIRE_MSG (not os.fail(),
+        "Error! Something went wrong while writing incremental restart file.\n"
+        "  - file name: " + tmp_sidecar + "\n");
+  }
+  EKAT_REQUIRE_MSG (std::rename(tmp_sidecar.c_str(),sidecar.c_str())==0,
+      "Error! Could not replace incremental restart file.\n"
+      "  - file name: " + sidecar + "\n");
+
+  // The next checkpoint can reference this one, which is now a full checkpoint
+  m_num_since_full = 0;
+}
+
+void IncrementalRestart::write_header (std::ostream& os) const
+{
+  os.write(magic,sizeof(magic));
+  write_pod(os,static_cast<std::int32_t>(version));
+  write_pod(os,static_cast<std::int32_t>(m_comm.rank()));
+  write_pod(os,static_cast<std::int32_t>(m_comm.size()));
+  write_pod(os,static_cast<std::int32_t>(SCREAM_PACK_SIZE));
+}
+
+void IncrementalRestart::
+write_index (std::ostream& os, const std::string& restart_filename,
+             const std::map<std::string,FieldEntry>& entries)
+{
+  // Index. Referenced files are stored once, in a table
+  const long long index_offset = os.tellp();
+  std::vector<std::string> files = {restart_filename};
+  std::map<std::string,int> file_idx = {{restart_filename,0}};
+  for (const auto& it : entries) {
+    for (const auto& ce : it.second.chunks) {
+      if (file_idx.count(ce.file)==0) {
+        file_idx[ce.file] = files.size();
+        files.push_back(ce.file);
+      }
+    }
+  }
+  write_pod(os,static_cast<std::int64_t>(files.size()));
+  for (const auto& fn : files) {
+    write_string(os,fn);
+  }
+  write_pod(os,static_cast<std::int64_t>(entries.size()));
+  for (const auto& it : entries) {
+    const auto& fe = it.second;
+    write_string(os,fe.name);
+    write_pod(os,static_cast<std::int64_t>(fe.nbytes));
+    write_pod(os,static_cast<std::int64_t>(fe.chunk_size));
+    write_pod(os,static_cast<std::int32_t>(fe.word_size));
+    write_pod(os,static_cast<std::int32_t>(fe.dims.size()));
+    for (const auto d : fe.dims) {
+      write_pod(os,static_cast<std::int32_t>(d));
+    }
+    write_pod(os,static_cast<std::int32_t>(fe.last_extent));
+    write_pod(os,static_cast<std::int64_t>(fe.chunks.size()));
+    for (const auto& ce : fe.chunks) {
+      write_pod(os,ce.hash);
+      write_pod(os,static_cast<std::int32_t>(file_idx.at(ce.file)));
+      write_pod(os,static_cast<std::int64_t>(ce.offset));
+      write_pod(os,static_cast<std::int64_t>(ce.stored));
+      write_pod(os,static_cast<std::int64_t>(ce.raw));
+      write_pod(os,static_cast<std::int32_t>(ce.compressed));
+    }
+  }
+
+  // Trailer
+  write_pod(os,static_cast<std::int64_t>(index_offset));
+  os.write(magic,sizeof(magic));
+}
+
+void IncrementalRestart::
+read_index (const std::string& sidecar, const ekat::Comm& comm,
+            std::map<std::string,FieldEntry>& entries)
+{
+  std::ifstream is (sidecar,std::ios::binary);
+  EKAT_REQUIRE_MSG (is.good(),
+      "Error! Could not open incremental restart file.\n"
+      "  - file name: " + sidecar + "\n"
+      "Notice that all the files referenced by an incremental restart checkpoint must be available.\n");
+
+  char m[sizeof(magic)];
+  is.read(m,sizeof(magic));
+  EKAT_REQUIRE_MSG (is.good() and std::memcmp(m,magic,sizeof(magic))==0,
+      "Error! File is not an incremental restart file.\n"
+      "  - file name: " + sidecar + "\n");
+  const auto file_version = read_pod<std::int32_t>(is,sidecar);
+  const auto file_rank    = read_pod<std::int32_t>(is,sidecar);
+  const auto file_size    = read_pod<std::int32_t>(is,sidecar);
+  EKAT_REQUIRE_MSG (file_version==version,
+      "Error! Unsupported incremental restart file version.\n"
+      "  - file name: " + sidecar + "\n"
+      "  - file version: " + std::to_string(file_version) + "\n"
+      "  - supported version: " + std::to_string(version) + "\n");
+  EKAT_REQUIRE_MSG (file_rank==comm.rank() and file_size==comm.size(),
+      "Error! Incremental restart files must be read with the same MPI configuration used to write them.\n"
+      "  - file name: " + sidecar + "\n"
+      "  - file rank/size: " + std::to_string(file_rank) + "/" + std::to_string(file_size) + "\n"
+      "  - this rank/size: " + std::to_string(comm.rank()) + "/" + std::to_string(comm.size()) + "\n");
+  const auto file_pack_size = read_pod<std::int32_t>(is,sidecar);
+  EKAT_REQUIRE_MSG (file_pack_size==SCREAM_PACK_SIZE,
+      "Error! Incremental restart files must be read with the same pack size used to write them.\n"
+      "  - file name: " + sidecar + "\n"
+      "  - file pack size: " + std::to_string(file_pack_size) + "\n"
+      "  - this pack size: " + std::to_string(SCREAM_PACK_SIZE) + "\n");
+
+  is.seekg(-static_cast<std::streamoff>(sizeof(std::int64_t)+sizeof(magic)),std::ios::end);
+  const auto index_offset = read_pod<std::int64_t>(is,sidecar);
+  is.read(m,sizeof(magic));
+  EKAT_REQUIRE_MSG (is.good() and std::memcmp(m,magic,sizeof(magic))==0,
+      "Error! Incremental restart file is truncated.\n"
+      "  - file name: " + sidecar + "\n");
+
+  is.seekg(index_offset);
+  const auto nfiles = read_pod<std::int64_t>(is,sidecar);
+  std::vector<std::string> files;
+  for (int i=0; i<nfiles; ++i) {
+    files.push_back(read_string(is,sidecar));
+  }
+  const auto nfields = read_pod<std::int64_t>(is,sidecar);
+  for (int i=0; i<nfields; ++i) {
+    FieldEntry fe;
+    fe.name       = read_string(is,sidecar);
+    fe.nbytes     = read_pod<std::int64_t>(is,sidecar);
+    fe.chunk_size = read_pod<std::int64_t>(is,sidecar);
+    fe.word_size  = read_pod<std::int32_t>(is,sidecar);
+    const auto rank = read_pod<std::int32_t>(is,sidecar);
+    for (int idim=0; idim<rank; ++idim) {
+      fe.dims.push_back(read_pod<std::int32_t>(is,sidecar));
+    }
+    fe.last_extent = read_pod<std::int32_t>(is,sidecar);
+    const auto nchunks = read_pod<std::int64_t>(is,sidecar);
+    for (int ic=0; ic<nchunks; ++ic) {
+      ChunkEntry ce;
+      ce.hash   = read_pod<HashType>(is,sidecar);
+      const auto idx = read_pod<std::int32_t>(is,sidecar);
+      EKAT_REQUIRE_MSG (idx>=0 and idx<nfiles,
+          "Error! Corrupted index in incremental restart file.\n"
+          "  - file name: " + sidecar + "\n");
+      ce.file   = files[idx];
+      ce.offset = read_pod<std::int64_t>(is,sidecar);
+      ce.stored = read_pod<std::int64_t>(is,sidecar);
+      ce.raw    = read_pod<std::int64_t>(is,sidecar);
+      ce.compressed = read_pod<std::int32_t>(is,sidecar)!=0;
+      fe.chunks.push_back(ce);
+    }
+    entries[fe.name] = fe;
+  }
+}
+
+void IncrementalRestart::
+read (const std::string& restart_filename,
+      const std::vector<Field>& fields,
+      const ekat::Comm& comm)
+{
+  const auto sidecar = sidecar_filename(restart_filename,comm.rank());
+  std::map<std::string,FieldEntry> entries;
+  read_index(sidecar,comm,entries);
+
+  // Files in the chain, opened as needed
+  std::map<std::string,std::unique_ptr<std::ifstream>> files;
+  auto get_stream = [&](const std::string& fname) -> std::ifstream& {
+    auto& is = files[fname];
+    if (not is) {
+      const auto sc = sidecar_filename(fname,comm.rank());
+      is = std::make_unique<std::ifstream>(sc,std::ios::binary);
+      EKAT_REQUIRE_MSG (is->good(),
+          "Error! Could not open a file referenced by an incremental restart checkpoint.\n"
+          "  - checkpoint file: " + sidecar + "\n"
+          "  - referenced file: " + sc + "\n");
+    }
+    return *is;
+  };
+
+  std::vector<char> buf;
+  for (const auto& f : fields) {
+    auto it = entries.find(f.name());
+    EKAT_REQUIRE_MSG (it!=entries.end(),
+        "Error! Field not found in incremental restart file.\n"
+        "  - file name : " + sidecar + "\n"
+        "  - field name: " + f.name() + "\n");
+    const auto& fe = it->second;
+
+    const bool contiguous = is_contiguous(f);
+    auto tgt = contiguous ? f : f.clone();
+    const long long nbytes = tgt.get_header().get_alloc_properties().get_alloc_size();
+    EKAT_REQUIRE_MSG (nbytes==fe.nbytes,
+        "Error! Field size does not match the size stored in incremental restart file.\n"
+        "  - file name : " + sidecar + "\n"
+        "  - field name: " + f.name() + "\n"
+        "  - field size (bytes): " + std::to_string(nbytes) + "\n"
+        "  - file size  (bytes): " + std::to_string(fe.nbytes) + "\n");
+    // Same size is not enough: the local layout (and its padding) must match too,
+    // or the data would be silently scrambled
+    const auto& dims = f.get_header().get_identifier().get_layout().dims();
+    const int last_extent = tgt.get_header().get_alloc_properties().get_last_extent();
+    EKAT_REQUIRE_MSG (dims==fe.dims and last_extent==fe.last_extent,
+        "Error! Field local layout does not match the one stored in incremental restart file.\n"
+        "  - file name : " + sidecar + "\n"
+        "  - field name: " + f.name() + "\n"
+        "  - field dims: " + ekat::join(dims,",") + " (alloc last extent: " + std::to_string(last_extent) + ")\n"
+        "  - file dims : " + ekat::join(fe.dims,",") + " (alloc last extent: " + std::to_string(fe.last_extent) + ")\n"
+        "Notice that the domain decomposition and the pack size must not change across incremental restarts.\n");
+
+    auto data = tgt.get_internal_view_data_unsafe<char,Host>();
+    long long beg = 0;
+    for (const auto& ce : fe.chunks) {
+      EKAT_REQUIRE_MSG (beg+ce.raw<=nbytes,
+          "Error! Corrupted index in incremental restart file.\n"
+          "  - file name : " + sidecar + "\n"
+          "  - field name: " + f.name() + "\n");
+      auto& is = get_stream(ce.file);
+      buf.resize(ce.stored);
+      is.seekg(ce.offset);
+      is.read(buf.data(),ce.stored);
+      EKAT_REQUIRE_MSG (is.good(),
+          "Error! Could not read chunk from incremental restart file.\n"
+          "  - file name : " + sidecar_filename(ce.file,comm.rank()) + "\n"
+          "  - field name: " + f.name() + "\n");
+      if (ce.compressed) {
+        decompress(buf.data(),ce.stored,data+beg,ce.raw,fe.word_size);
+      } else {
+        std::memcpy(data+beg,buf.data(),ce.raw);
+      }
+      beg += ce.raw;
+    }
+    EKAT_REQUIRE_MSG (beg==nbytes,
+        "Error! Incremental restart file does not contain all the data of a field.\n"
+        "  - file name : " + sidecar + "\n"
+        "  - field name: " + f.name() + "\n");
+
+    tgt.sync_to_dev();
+    if (not contiguous) {
+      auto f_nc = f;
+      f_nc.deep_copy(tgt);
+    }
+  }
+}
+
+std::vector<char> IncrementalRestart::
+compress (const char* data, const long long nbytes, const int word_size)
+{
+  const int ws = nbytes%word_size==0 ? word_size : 1;
+  const long long nw = nbytes / ws;
+
+  // Xor each value with the previous one, and group bytes by significance
+  const auto src = reinterpret_cast<const unsigned char*>(data);
+  std::vector<unsigned char> tmp (nbytes);
+  for (long long i=0; i<nw; ++i) {
+    for (int b=0; b<ws; ++b) {
+      const unsigned char prev = i>0 ? src[(i-1)*ws+b] : 0;
+      tmp[b*nw+i] = src[i*ws+b] ^ prev;
+    }
+  }
+
+  // Encode as a sequence of zero runs and literals. Each token starts
+  // with a varint storing (length<<1 | is_zero_run)
+  std::vector<char> out;
+  out.reserve(nbytes);
+  long long lit_start = 0;
+  auto flush_literal = [&](const long long end) {
+    if (end>lit_start) {
+      put_varint(out,static_cast<std::uint64_t>(end-lit_start)<<1);
+      out.insert(out.end(),tmp.begin()+lit_start,tmp.begin()+end);
+    }
+  };
+  long long i = 0;
+  while (i<nbytes) {
+    if (tmp[i]!=0) {
+      ++i;
+      continue;
+    }
+    long long j = i;
+    while (j<nbytes and tmp[j]==0) {
+      ++j;
+    }
+    if (j-i>=min_zero_run) {
+      flush_literal(i);
+      put_varint(out,(static_cast<std::uint64_t>(j-i)<<1) | 1);
+      lit_start = j;
+    }
+    i = j;
+  }
+  flush_literal(nbytes);
+
+  return out;
+}
+
+void IncrementalRestart::
+decompress (const char* data, const long long nbytes,
+            char* out, const long long out_nbytes, const int word_size)
+{
+  const int ws = out_nbytes%word_size==0 ? word_size : 1;
+  const long long nw = out_nbytes / ws;
+
+  const auto src = reinterpret_cast<const unsigned char*>(data);
+  std::vector<unsigned char> tmp (out_nbytes);
+  long long pos = 0, n = 0;
+  while (pos<nbytes) {
+    const auto token = get_varint(src,nbytes,pos);
+    const long long len = token >> 1;
+    EKAT_REQUIRE_MSG (n+len<=out_nbytes,
+        "Error! Corrupted compressed chunk in incremental restart file.\n");
+    if (token & 1) {
+      std::fill_n(tmp.begin()+n,len,0);
+    } else {
+      EKAT_REQUIRE_MSG (pos+len<=nbytes,
+          "Error! Corrupted compressed chunk in incremental restart file.\n");
+      std::copy_n(src+pos,len,tmp.begin()+n);
+      pos += len;
+    }
+    n += len;
+  }
+  EKAT_REQUIRE_MSG (n==out_nbytes,
+      "Error! Corrupted compressed chunk in incremental restart file.\n");
+
+  // Undo the byte grouping and the xor with the previous value
+  auto dst = reinterpret_cast<unsigned char*>(out);
+  for (long long i=0; i<nw; ++i) {
+    for (int b=0; b<ws; ++b) {
+      const unsigned char prev = i>0 ? dst[(i-1)*ws+b] : 0;
+      dst[i*ws+b] = tmp[b*nw+i] ^ prev;
+    }
+  }
+}
+
+} // namespace scream
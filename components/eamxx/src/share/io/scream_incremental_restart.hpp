@@ -0,0 +1,157 @@
+#ifndef SCREAM_INCREMENTAL_RESTART_HPP
+#define SCREAM_INCREMENTAL_RESTART_HPP
+
+#include "share/field/field.hpp"
+
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace scream
+{
+
+/*
+ * Incremental (and compressed) model restart checkpoints
+ *
+ * Rather than writing a full snapshot of every restart field in the netcdf
+ * restart file, each rank stores the local data of the restart fields in a
+ * binary sidecar file, named
+ *
+ *   <restart file name>.rank<N>.chk
+ *
+ * The data of each field is split in chunks of fixed size. For each chunk, a
+ * content hash is computed on device, and compared against the hash of the
+ * same chunk at the previous checkpoint:
+ *  - if they match, the chunk is not written: its entry in the index simply
+ *    points to the (previous) file where the chunk data is stored;
+ *  - otherwise, only the chunk is copied to host, compressed (lossless), and
+ *    appended to the sidecar file.
+ * Every max_chain_length checkpoints (as well as at the first checkpoint of
+ * each run) all chunks are written, so that a checkpoint never depends on
+ * more than max_chain_length-1 older checkpoints. Older checkpoints can be
+ * removed once a newer full checkpoint exists.
+ *
+ * At the end of a run segment, the last checkpoint is made self-contained (see
+ * finalize). This is needed by CIME short term archiving, which moves each set
+ * of restart files (sidecars included) to its own folder, and may delete the
+ * older sets. Notice that the intermediate checkpoints of a run segment can
+ * still reference each other, so only the last one of each segment can be
+ * used to restart the model after the files have been archived.
+ *
+ * Compression is done with a shuffle/xor-delta/zero-run-length codec: the
+ * values of a chunk are xor-ed with the previous value, and the bytes are
+ * regrouped by significance, so that the high bytes of slowly varying data
+ * become long runs of zeros. Chunks that do not shrink are stored raw.
+ *
+ * WARNING: the sidecar files store the raw local allocations of the fields,
+ * so a run can only be restarted from them with the same number of MPI ranks,
+ * the same domain decomposition, and the same pack size used to write them.
+ * Rank count, pack size and the local layout of each field are checked at
+ * read time, but a different decomposition with the same local sizes cannot
+ * be detected. The mode is refused by the CIME namelist checks for cases
+ * where the PE layout is expected to change (see eamxx_buildnml.py).
+ *
+ * Layout of a sidecar file:
+ *   header : magic, version, rank, comm size, pack size
+ *   data   : compressed chunks
+ *   index  : table of referenced restart files, and for each field its name,
+ *            size, chunk size, local dims, alloc last extent, and the
+ *            (hash,file,offset,size) of each chunk
+ *   trailer: offset of the index, magic
+ */
+
+class IncrementalRestart
+{
+public:
+  using HashType = std::uint64_t;
+
+  IncrementalRestart (const ekat::Comm& comm,
+                      const std::vector<Field>& fields,
+                      const long long chunk_size,
+                      const int max_chain_length);
+
+  // Write the sidecar file of this rank for the given restart file
+  void write (const std::string& restart_filename);
+
+  // To be called at the end of a run segment: if the last checkpoint references
+  // older ones, copy the referenced chunks in its sidecar file, so that it can be
+  // used to restart the model without any other file
+  void finalize ();
+
+  // Restore the fields from the sidecar file of this rank for the given restart file,
+  // following references to previous checkpoints as needed
+  static void read (const std::string& restart_filename,
+                    const std::vector<Field>& fields,
+                    const ekat::Comm& comm);
+
+  static std::string sidecar_filename (const std::string& restart_filename, const int rank);
+
+  // Stats of the last write call (local to this rank, in bytes)
+  long long get_bytes_total      () const { return m_bytes_total; }
+  long long get_bytes_written    () const { return m_bytes_written; }
+  long long get_bytes_referenced () const { return m_bytes_referenced; }
+  bool last_write_was_full () const { return m_num_since_full==0; }
+
+  // Lossless codec used for the chunks. Exposed mostly for testing purposes.
+  static std::vector<char> compress   (const char* data, const long long nbytes, const int word_size);
+  static void              decompress (const char* data, const long long nbytes,
+                                       char* out, const long long out_nbytes, const int word_size);
+
+#ifndef KOKKOS_ENABLE_CUDA
+protected:
+#endif
+  // Compute the hash of each chunk of the field data on device
+  static std::vector<HashType> hash_chunks (const Field& f, const long long chunk_size);
+
+protected:
+  struct ChunkEntry {
+    HashType    hash;
+    std::string file;       // Restart file whose sidecar stores the chunk data
+    long long   offset;     // Offset of the chunk data in that file
+    long long   stored;     // Number of bytes stored in the file
+    long long   raw;        // Number of bytes of the uncompressed chunk
+    bool        compressed;
+  };
+
+  struct FieldEntry {
+    std::string             name;
+    long long               nbytes;
+    long long               chunk_size;
+    int                     word_size;
+    std::vector<int>        dims;
+    int                     last_extent;
+    std::vector<ChunkEntry> chunks;
+  };
+
+  void write_header (std::ostream& os) const;
+  static void write_index (std::ostream& os, const std::string& restart_filename,
+                           const std::map<std::string,FieldEntry>& entries);
+  static void read_index (const std::string& sidecar, const ekat::Comm& comm,
+                          std::map<std::string,FieldEntry>& entries);
+
+  // Fields are stored as they are in the allocation. Subfields
+  // (which are not contiguous) are cloned before being written.
+  static bool is_contiguous (const Field& f);
+
+  ekat::Comm          m_comm;
+  std::vector<Field>  m_fields;
+  long long           m_chunk_size;
+  int                 m_max_chain_length;
+
+  // Chunks of each field at the last checkpoint
+  std::map<std::string,FieldEntry>  m_prev;
+  int                               m_num_since_full = -1;
+  std::string                       m_last_restart_filename;
+
+  long long m_bytes_total      = 0;
+  long long m_bytes_written    = 0;
+  long long m_bytes_referenced = 0;
+};
+
+} // namespace scream
+
+#endif // SCREAM_INCREMENTAL_RESTART_HPP
@@ -3,6 +3,8 @@
 #include "share/io/scream_scorpio_interface.hpp"
 #include "share/util/scream_utils.hpp"
 
+#include <ekat/ekat_assert.hpp>
+
 #include <fstream>
 
 namespace scream {
@@ -92,4 +94,117 @@ util::TimeStamp read_timestamp (const std::string& filename,
   return ts;
 }
 
+std::pair<std::string,ekat::ParameterList>
+get_diagnostic_params (const std::string& diag_field_name,
+                       const std::string& grid_name)
+{
+  ekat::ParameterList params;
+  std::string diag_name;
+
+  if (diag_field_name.find("_at_")!=std::string::npos) {
+    // The diagnostic must be one of
+    //  - ${field_name}_at_lev_${N}     <- interface fields still use "_lev_"
+    //  - ${field_name}_at_model_bot
+    //  - ${field_name}_at_model_top
+    //  - ${field_name}_at_${M}X
+    // where M/N are numbers (N integer), X=Pa, hPa, mb, or m
+    auto tokens = ekat::split(diag_field_name,"_at_");
+    EKAT_REQUIRE_MSG (tokens.size()==2,
+        "Error! Unexpected diagnostic name: " + diag_field_name + "\n");
+
+    const auto& fname = tokens.front();
+    params.set("field_name",fname);
+    params.set("grid_name",grid_name);
+
+    params.set("vertical_location", tokens[1]);
+
+    // Conventions on notation (N=any integer):
+    // FieldAtLevel        : var_at_lev_N, var_at_model_top, var_at_model_bot
+    // FieldAtPressureLevel: var_at_Nx, with x=mb,Pa,hPa
+    // FieldAtHeight       : var_at_Nm_above_Y (Y=sealevel or surface)
+    if (tokens[1].find_first_of("0123456789.")==0) {
+      auto units_start = tokens[1].find_first_not_of("0123456789.");
+      auto units = tokens[1].substr(units_start);
+      if (units.find("_above_") != std::string::npos) {
+        // The field is at a height above a specific reference.
+        // Currently we only support FieldAtHeight above "sealevel" or "surface"
+        auto subtokens = ekat::split(units,"_above_");
+        params.set("surface_reference",subtokens[1]);
+        units = subtokens[0];
+        // Need to reset the vertical location to strip the "_above_" part of the string.
+        params.set("vertical_location", tokens[1].substr(0,units_start)+subtokens[0]);
+      }
+      if (units=="m") {
+        diag_name = "FieldAtHeight";
+        EKAT_REQUIRE_MSG(params.isParameter("surface_reference"),"Error! Output field request for " + diag_field_name + " is missing a surface reference."
+            "  Please add either '_above_sealevel' or '_above_surface' to the field name");
+      } else if (units=="mb" or units=="Pa" or units=="hPa") {
+        diag_name = "FieldAtPressureLevel";
+      } else {
+        EKAT_ERROR_MSG ("Error! Invalid units x for 'field_at_Nx' diagnostic.\n");
+      }
+    } else {
+      diag_name = "FieldAtLevel";
+    }
+  } else if (diag_field_name=="precip_liq_surf_mass_flux" or
+             diag_field_name=="precip_ice_surf_mass_flux" or
+             diag_field_name=="precip_total_surf_mass_flux") {
+    diag_name = "precip_surf_mass_flux";
+    // split will return [X, ''], with X being whatever is before '_surf_mass_flux'
+    auto type = ekat::split(diag_field_name.substr(7),"_surf_mass_flux").front();
+    params.set<std::string>("precip_type",type);
+  } else if (diag_field_name=="IceWaterPath" or
+             diag_field_name=="LiqWaterPath" or
+             diag_field_name=="RainWaterPath" or
+             diag_field_name=="RimeWaterPath" or
+             diag_field_name=="VapWaterPath") {
+    diag_name = "WaterPath";
+    // split will return the list [X, ''], with X being whatever is before 'WaterPath'
+    params.set<std::string>("Water Kind",ekat::split(diag_field_name,"WaterPath").front());
+  } else if (diag_field_name=="IceNumberPath" or
+             diag_field_name=="LiqNumberPath" or
+             diag_field_name=="RainNumberPath") {
+    diag_name = "NumberPath";
+    // split will return the list [X, ''], with X being whatever is before 'NumberPath'
+    params.set<std::string>("Number Kind",ekat::split(diag_field_name,"NumberPath").front());
+  } else if (diag_field_name=="AeroComCldTop" or
+             diag_field_name=="AeroComCldBot") {
+    diag_name = "AeroComCld";
+    // split will return the list ['', X], with X being whatever is after 'AeroComCld'
+    params.set<std::string>("AeroComCld Kind",ekat::split(diag_field_name,"AeroComCld").back());
+  } else if (diag_field_name=="MeridionalVapFlux" or
+             diag_field_name=="ZonalVapFlux") {
+    diag_name = "VaporFlux";
+    // split will return the list [X, ''], with X being whatever is before 'VapFlux'
+    params.set<std::string>("Wind Component",ekat::split(diag_field_name,"VapFlux").front());
+  } else if (diag_field_name.find("_atm_backtend")!=std::string::npos) {
+    diag_name = "AtmBackTendDiag";
+    // Set the grid_name
+    params.set("grid_name",grid_name);
+    // split will return [X, ''], with X being whatever is before '_atm_tend'
+    params.set<std::string>("Tendency Name",ekat::split(diag_field_name,"_atm_backtend").front());
+  } else if (diag_field_name=="PotentialTemperature" or
+             diag_field_name=="LiqPotentialTemperature") {
+    diag_name = "PotentialTemperature";
+    if (diag_field_name == "LiqPotentialTemperature") {
+      params.set<std::string>("Temperature Kind", "Liq");
+    } else {
+      params.set<std::string>("Temperature Kind", "Tot");
+    }
+  } else {
+    diag_name = diag_field_name;
+  }
+
+  // These fields are special case of VerticalLayer diagnostic.
+  // The diagnostics requires the name to be given as param value.
+  if (diag_name == "z_int"            or diag_name == "z_mid"            or
+      diag_name == "geopotential_int" or diag_name == "geopotential_mid" or
+      diag_name == "height_int"       or diag_name == "height_mid"     or
+      diag_name == "dz") {
+    params.set<std::string>("diag_name", diag_name);
+  }
+
+  return std::make_pair(diag_name,params);
+}
+
 } // namespace scream
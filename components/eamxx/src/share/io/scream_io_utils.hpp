@@ -5,8 +5,10 @@
 
 #include <ekat/util/ekat_string_utils.hpp>
 #include <ekat/mpi/ekat_comm.hpp>
+#include <ekat/ekat_parameter_list.hpp>
 
 #include <string>
+#include <utility>
 
 namespace scream
 {
@@ -94,5 +96,13 @@ util::TimeStamp read_timestamp (const std::string& filename,
                                 const std::string& ts_name,
                                 const bool read_nsteps = false);
 
+// Given the name of a diagnostic output field (e.g., T_mid_at_500mb), return the name
+// of the diagnostic in the AtmosphereDiagnosticFactory (e.g., FieldAtPressureLevel),
+// along with the parameters needed to create it. The grid name is needed by the
+// diagnostics that act on a specific field (e.g., field slices and tendencies).
+std::pair<std::string,ekat::ParameterList>
+get_diagnostic_params (const std::string& diag_field_name,
+                       const std::string& grid_name);
+
 } // namespace scream
 #endif // SCREAM_IO_UTILS_HPP
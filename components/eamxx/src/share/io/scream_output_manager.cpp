@@ -73,7 +73,19 @@ setup (const ekat::Comm& io_comm, const ekat::ParameterList& params,
   }
 
   // For each grid, create a separate output stream.
-  if (field_mgrs.size()==1) {
+  // Incremental model restarts don't need output streams, since the fields
+  // data is not written in the netcdf file.
+  if (m_is_model_restart_output and m_params.get("incremental",false)) {
+    std::vector<Field> fields;
+    for (const auto& it : field_mgrs) {
+      for (const auto& fn : fields_pl.sublist(it.first).get<std::vector<std::string>>("Field Names")) {
+        fields.push_back(it.second->get_field(fn));
+      }
+    }
+    const long long chunk_size = m_params.get<int>("incremental_chunk_size_kb",1024)*1024LL;
+    const int max_chain_length = m_params.get<int>("incremental_max_chain_length",8);
+    m_incremental_restart = std::make_shared<IncrementalRestart>(m_io_comm,fields,chunk_size,max_chain_length);
+  } else if (field_mgrs.size()==1) {
     auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.begin()->second,grids_mgr);
     output->set_logger(m_atm_logger);
     m_output_streams.push_back(output);
@@ -453,14 +465,36 @@ void OutputManager::run(const util::TimeStamp& timestamp)
   stop_timer(timer_root+"::get_new_file");
 
   // Run the output streams
+  // Note: with async writes, the streams only stage the data to be written.
   start_timer(timer_root+"::run_output_streams");
-  const auto& fields_write_filename = is_output_step ? m_output_file_specs.filename : m_checkpoint_file_specs.filename;
+  const auto fields_write_filename = is_output_step ? m_output_file_specs.filename : m_checkpoint_file_specs.filename;
+  bool async_write = false;
   for (auto& it : m_output_streams) {
     // Note: filename only matters if is_output_step || is_full_checkpoint_step=true. In that case, it will definitely point to a valid file name.
     if (m_atm_logger) {
       m_atm_logger->debug("[OutputManager]: writing fields from grid " + it->get_io_grid()->name() + "...\n");
     }
     it->run(fields_write_filename,is_output_step,is_full_checkpoint_step,m_output_control.nsamples_since_last_write,is_t0_output);
+    async_write |= it->is_async();
+  }
+  if (m_incremental_restart and is_output_step) {
+    m_incremental_restart->write(m_output_file_specs.filename);
+
+    // Mark the file, so that restart_model knows where the data is
+    scorpio::set_attribute(m_output_file_specs.filename,"GLOBAL","incremental_restart",1);
+
+    long long bytes[3] = {m_incremental_restart->get_bytes_total(),
+                          m_incremental_restart->get_bytes_written(),
+                          m_incremental_restart->get_bytes_referenced()};
+    long long bytes_glb[3];
+    m_io_comm.all_reduce(bytes,bytes_glb,3,MPI_SUM);
+    if (m_atm_logger) {
+      m_atm_logger->info("[EAMxx::output_manager]      incremental restart (" +
+          std::string(m_incremental_restart->last_write_was_full() ? "full" : "partial") + "): " +
+          std::to_string(bytes_glb[0]) + " bytes of data, " +
+          std::to_string(bytes_glb[1]) + " bytes written, " +
+          std::to_string(bytes_glb[2]) + " bytes referenced from previous checkpoints");
+    }
   }
   stop_timer(timer_root+"::run_output_streams");
 
@@ -546,7 +580,11 @@ void OutputManager::run(const util::TimeStamp& timestamp)
         scorpio::write_var(filespecs.filename, "time_bnds", m_time_bnds.data());
       }
 
-      // Check if we need to flush the output file
+    };
+
+    // Check if we need to flush the output file. With async writes, the flush is
+    // appended to the IO thread queue, after the (already enqueued) field writes.
+    auto flush_if_needed = [&](IOFileSpecs& filespecs) {
       if (filespecs.file_needs_flush()) {
         flush_file (filespecs.filename);
       }
@@ -563,6 +601,21 @@ void OutputManager::run(const util::TimeStamp& timestamp)
       write_global_data(m_checkpoint_control,m_checkpoint_file_specs);
     }
     stop_timer(timer_root+"::update_snapshot_tally");
+
+    // All metadata is written, so we can let the IO thread write the staged fields.
+    // Other scorpio calls that only write data will not wait for these writes to
+    // complete (see the async section in scream_scorpio_interface.hpp).
+    if (async_write) {
+      for (auto& it : m_output_streams) {
+        it->launch_async_write(fields_write_filename);
+      }
+    }
+    if (is_output_step) {
+      flush_if_needed(m_output_file_specs);
+    }
+    if (is_checkpoint_step) {
+      flush_if_needed(m_checkpoint_file_specs);
+    }
     if (is_output_step && m_time_bnds.size()>0) {
       m_time_bnds[0] = m_time_bnds[1];
     }
@@ -574,6 +627,19 @@ void OutputManager::run(const util::TimeStamp& timestamp)
 /*===============================================================================================*/
 void OutputManager::finalize()
 {
+  // Wait for any pending async write, and report how much of it was overlapped with the time loop
+  for (auto& it : m_output_streams) {
+    if (not it->is_async()) {
+      continue;
+    }
+    it->finalize_async_writes();
+    if (m_atm_logger) {
+      m_atm_logger->info("[EAMxx::output_manager] async writes for '" + m_filename_prefix + "' on grid " + it->get_io_grid()->name() + ":");
+      m_atm_logger->info("  - time spent writing: " + std::to_string(it->get_async_write_time()) + " seconds");
+      m_atm_logger->info("  - hidden time       : " + std::to_string(it->get_async_hidden_time()) + " seconds");
+    }
+  }
+
   // Close any output file still open
   if (m_output_file_specs.is_open) {
     scorpio::release_file (m_output_file_specs.filename);
@@ -582,12 +648,19 @@ void OutputManager::finalize()
     scorpio::release_file (m_checkpoint_file_specs.filename);
   }
 
+  // The last incremental restart of the run must not depend on older restart files,
+  // since CIME short term archiving may move/delete them before the next run segment
+  if (m_incremental_restart) {
+    m_incremental_restart->finalize();
+  }
+
   // Reset everything to a default constructed object.
   // NOTE: it's themptying to std::swap(*this,OutputManager()),
   //       but that calls ~OutputManager() on the destructor,
   //       which in turns calls finalize, causing endless recursion.
   m_output_streams = {};
   m_geo_data_streams = {};
+  m_incremental_restart = nullptr;
   m_globals.clear();
   m_io_comm = {};
   m_params  = {};
@@ -852,7 +925,7 @@ setup_file (      IOFileSpecs& filespecs,
 
   // Make all output streams register their dims/vars
   for (auto& it : m_output_streams) {
-    it->setup_output_file(filename,fp_precision,mode);
+    it->setup_output_file(filename,fp_precision,mode,filespecs.is_restart_file());
   }
 
   // If grid data is needed,  also register geo data fields. Skip if file is resumed,
@@ -6,6 +6,7 @@
 #include "share/io/scream_io_utils.hpp"
 #include "share/io/scream_io_file_specs.hpp"
 #include "share/io/scream_io_control.hpp"
+#include "share/io/scream_incremental_restart.hpp"
 
 #include "share/field/field_manager.hpp"
 #include "share/grid/grids_manager.hpp"
@@ -118,6 +119,26 @@ public:
   void finalize();
 
   long long res_dep_memory_footprint () const;
+
+  // True if the output streams write asynchronously (see AtmosphereOutput)
+  bool is_async () const {
+    for (const auto& s : m_output_streams) {
+      if (not s->is_async()) {
+        return false;
+      }
+    }
+    return m_output_streams.size()>0;
+  }
+
+  // Time spent by the async writes of all output streams that was overlapped with the
+  // main thread. Only counts writes that were already waited on (see AtmosphereOutput).
+  double get_async_hidden_time () const {
+    double t = 0;
+    for (const auto& s : m_output_streams) {
+      t += s->get_async_hidden_time();
+    }
+    return t;
+  }
 protected:
 
   std::string compute_filename (const IOControl& control,
@@ -186,6 +207,10 @@ protected:
 
   // If true, we save grid data in output file
   bool m_save_grid_data;
+
+  // For model restart output, if set, field data is written in per-rank incremental
+  // checkpoint files, rather than in the netcdf file (see scream_incremental_restart.hpp)
+  std::shared_ptr<IncrementalRestart> m_incremental_restart;
 };
 
 } // namespace scream
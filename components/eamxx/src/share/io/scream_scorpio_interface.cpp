@@ -8,11 +8,46 @@
 
 #include <pio.h>
 
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
 #include <numeric>
+#include <thread>
+#include <tuple>
 
 namespace scream {
 namespace scorpio {
 
+// Queue of jobs to be executed by the IO thread. See wait_async_jobs
+// and enqueue_async_job for details.
+struct AsyncJobQueue
+{
+  using clock_t = std::chrono::steady_clock;
+
+  // Start/end of the jobs executed since the main thread last waited on (or added to)
+  // the queue, used to figure out how much of their run time was not hidden.
+  struct JobRecord {
+    clock_t::time_point             start;
+    clock_t::time_point             end;
+    std::shared_ptr<AsyncJobTiming> timing;
+  };
+
+  std::thread                             worker;
+  std::mutex                              mutex;
+  std::condition_variable                 cv_job;
+  std::condition_variable                 cv_idle;
+  std::deque<std::packaged_task<void()>>  jobs;
+  std::vector<JobRecord>                  executed;
+  bool                                    busy = false;
+  bool                                    stop = false;
+
+  // First error thrown by a PIO operation appended to the queue by the main
+  // thread (see impl::run_or_enqueue). It is rethrown by the next wait.
+  std::exception_ptr                      error;
+};
+
 // This class is an implementation detail, and therefore it is hidden inside
 // a cpp file. All customers of IO capabilities must use the common interfaces
 // exposed in the header file of this source file.
@@ -50,6 +85,8 @@ public:
 
   ekat::Comm  comm;
 
+  AsyncJobQueue async;
+
 private:
 
   ScorpioSession () = default;
@@ -228,6 +265,28 @@ namespace impl {
 // Note: these utilities are used in this file to retrieve PIO entities,
 //       so that we implement all checks once (rather than in every function)
 
+// Set to true only on the IO thread, so that we can detect async jobs
+// that (incorrectly) call this interface
+thread_local bool is_io_thread = false;
+
+void check_not_io_thread (const std::string& context)
+{
+  EKAT_REQUIRE_MSG (not is_io_thread,
+      "Error! Async jobs cannot call the scorpio interface, since the session\n"
+      "       metadata is not thread safe. Use enqueue_read_var/enqueue_write_var.\n"
+      "Context:\n"
+      " " + context + "\n");
+}
+
+// Run a PIO operation issued by the main thread: right away, if the IO thread
+// is idle, or after all the jobs enqueued so far otherwise (without waiting).
+// Either way, PIO calls happen in the order the main thread issued them, which
+// is the same on all ranks. See the async section in the header for details.
+// NOTE: op must own all the data it needs, and must not access the session
+//       metadata, which the main thread may modify in the meantime.
+bool io_thread_is_idle ();
+void run_or_enqueue (const std::function<void()>& op);
+
 // Small struct that allows to quickly open a file (in Read mode) if it wasn't open.
 // If the file had to be open, when the struct is deleted, it will release the file.
 struct PeekFile {
@@ -260,6 +319,8 @@ struct PeekFile {
 PIOFile& get_file (const std::string& filename,
                    const std::string& context)
 {
+  check_not_io_thread(context);
+
   auto& s = ScorpioSession::instance();
 
   EKAT_REQUIRE_MSG (s.files.count(filename)==1,
@@ -354,6 +415,18 @@ void finalize_subsystem ()
 {
   auto& s = ScorpioSession::instance();
 
+  // Drain the async queue, and shut down the IO thread (if it was ever started)
+  wait_async_jobs();
+  if (s.async.worker.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(s.async.mutex);
+      s.async.stop = true;
+    }
+    s.async.cv_job.notify_one();
+    s.async.worker.join();
+    s.async.stop = false;
+  }
+
   // TODO: should we simply return instead? I think trying to finalize twice
   //       *may* be a sign of possible bugs, though with Catch2 testing
   //       I *think* there may be some issue with how the code is run.
@@ -394,7 +467,13 @@ void register_file (const std::string& filename,
                     const FileMode mode,
                     const IOType iotype)
 {
+  impl::check_not_io_thread("scorpio::register_file");
+
   auto& s = ScorpioSession::instance();
+  if (s.files.count(filename)==0) {
+    // We need to open the file, which requires the IO thread to be done
+    wait_async_jobs();
+  }
   auto& f = s.files[filename];
   EKAT_REQUIRE_MSG (f.mode==Unset || f.mode==mode,
       "Error! File was already opened with a different mode.\n"
@@ -526,17 +605,24 @@ void release_file  (const std::string& filename)
     return;
   }
 
-  int err;
-  if (f.mode & Write) {
-    err = PIOc_sync(f.ncid);
-    check_scorpio_noerr (err,f.name,"release_file","sync");
-  }
+  // Remove the file from the session now, and close it once the IO thread is done with it
+  const int  ncid = f.ncid;
+  const bool sync = f.mode & Write;
+  auto close = [filename,ncid,sync]() {
+    int err;
+    if (sync) {
+      err = PIOc_sync(ncid);
+      check_scorpio_noerr (err,filename,"release_file","sync");
+    }
 
-  err = PIOc_closefile(f.ncid);
-  check_scorpio_noerr (err,f.name,"release_file","closefile");
+    err = PIOc_closefile(ncid);
+    check_scorpio_noerr (err,filename,"release_file","closefile");
+  };
 
   auto& s = ScorpioSession::instance();
   s.files.erase(filename);
+
+  impl::run_or_enqueue(close);
 }
 
 void flush_file (const std::string &filename)
@@ -547,8 +633,11 @@ void flush_file (const std::string &filename)
       "Error! Cannot call sync_file. File is read-only.\n"
       " - filename: " + filename + "\n");
 
-  int err = PIOc_sync(f.ncid);
-  check_scorpio_noerr (err,f.name,"sync_file","sync");
+  const int ncid = f.ncid;
+  impl::run_or_enqueue([filename,ncid]() {
+    int err = PIOc_sync(ncid);
+    check_scorpio_noerr (err,filename,"sync_file","sync");
+  });
 }
 
 void redef(const std::string &filename)
@@ -560,6 +649,7 @@ void redef(const std::string &filename)
       " - filename: " + filename + "\n");
 
   if (f.enddef) {
+    wait_async_jobs();
     int err = PIOc_redef(f.ncid);
     check_scorpio_noerr (err,f.name,"redef","redef");
     f.enddef = false;
@@ -571,6 +661,7 @@ void enddef(const std::string &filename)
   auto& f = impl::get_file(filename,"scorpio::enddef");
 
   if (not f.enddef) {
+    wait_async_jobs();
     int err = PIOc_enddef(f.ncid);
     check_scorpio_noerr (err,f.name,"enddef","enddef");
     f.enddef = true;
@@ -579,6 +670,8 @@ void enddef(const std::string &filename)
 
 bool is_file_open (const std::string& filename, const FileMode mode)
 {
+  impl::check_not_io_thread("scorpio::is_file_open");
+
   auto& s = ScorpioSession::instance();
   auto it = s.files.find(filename);
   if (it==s.files.end()) return false;
@@ -614,6 +707,7 @@ void define_dim (const std::string& filename, const std::string& dimname, const
     dim->unlimited = unlimited;
 
     // Define the dimension in PIO
+    wait_async_jobs();
     int err = PIOc_def_dim(f.ncid,dimname.c_str(),dim->length,&dim->ncid);
     check_scorpio_noerr (err,f.name,"dimension",dimname,"define_dim","def_dim");
   } else {
@@ -825,6 +919,7 @@ void set_var_decomp (PIOVar& var,
     }
 
     // Create PIO decomp
+    wait_async_jobs();
     int maplen = decomp->offsets.size();
     PIO_Offset* compmap = reinterpret_cast<PIO_Offset*>(decomp->offsets.data());
     int err = PIOc_init_decomp(s.pio_sysid,nctype(var.dtype),ndims,gdimlen.data(),
@@ -869,6 +964,7 @@ void set_dim_decomp (const std::string& filename,
         if (s.decomps.at(dn).use_count()==1) {
           auto decomp = s.decomps.at(dn);
           // There is no other customer of this decomposition, so we can safely free it
+          wait_async_jobs();
           int err = PIOc_freedecomp(s.pio_sysid,decomp->ncid);
           check_scorpio_noerr(err,filename,"decomp",dn,"set_dim_decomp","freedecomp");
           s.decomps.erase(dn);
@@ -991,6 +1087,7 @@ void define_var (const std::string& filename, const std::string& varname,
     }
 
     // Define the variable in PIO
+    wait_async_jobs();
     int err = PIOc_def_var(f.ncid,varname.c_str(),nctype(nc_dtype),ndims,dimids.data(),&var->ncid);
     check_scorpio_noerr(err,f.name,"variable",varname,"define_var","def_var");
 
@@ -1127,7 +1224,6 @@ void pretend_dim_is_unlimited (const std::string& filename, const std::string& d
       auto& v = it.second;
       if (v->dims.size()>0 and v->dims[0]->name==dimname) {
         v->dims.erase(v->dims.begin());
-        v->size = -1;
         v->time_dep = true;
       }
     }
@@ -1146,10 +1242,15 @@ void update_time(const std::string &filename, const double time) {
         auto& time_dim = *f.time_dim;
   const auto& var = impl::get_var(filename,time_dim.name,"scorpio::update_time");
 
-  PIO_Offset index = time_dim.length;
-  int err = PIOc_put_var1(f.ncid,var.ncid,&index,&time);
-  check_scorpio_noerr (err,f.name,"update time","put_var1");
+  const PIO_Offset index = time_dim.length;
+  const int ncid = f.ncid;
+  const int varid = var.ncid;
   ++time_dim.length;
+
+  impl::run_or_enqueue([filename,ncid,varid,index,time]() {
+    int err = PIOc_put_var1(ncid,varid,&index,&time);
+    check_scorpio_noerr (err,filename,"update time","put_var1");
+  });
 }
 
 double get_time (const std::string& filename, const int time_index)
@@ -1174,24 +1275,77 @@ std::vector<double> get_all_times (const std::string& filename)
   return times;
 }
 
-// Read variable into user provided buffer.
-// If time dim is present, read given time slice (time_index=-1 means "read last record).
-// If time dim is not present, time_index must be -1 (error out otherwise)
+namespace impl {
+
+// Copy between a buffer of type T and a buffer of the given nc type
 template<typename T>
-void read_var (const std::string &filename, const std::string &varname, T* buf, const int time_index)
+void copy_to_nc_buf (const T* src, void* dst, const std::string& nc_dtype, const int n) {
+  if (nc_dtype=="int") {
+    copy_data(src,reinterpret_cast<int*>(dst),n);
+  } else if (nc_dtype=="int64") {
+    copy_data(src,reinterpret_cast<long long*>(dst),n);
+  } else if (nc_dtype=="float") {
+    copy_data(src,reinterpret_cast<float*>(dst),n);
+  } else if (nc_dtype=="double") {
+    copy_data(src,reinterpret_cast<double*>(dst),n);
+  }
+}
+template<typename T>
+void copy_from_nc_buf (const void* src, T* dst, const std::string& nc_dtype, const int n) {
+  if (nc_dtype=="int") {
+    copy_data(reinterpret_cast<const int*>(src),dst,n);
+  } else if (nc_dtype=="int64") {
+    copy_data(reinterpret_cast<const long long*>(src),dst,n);
+  } else if (nc_dtype=="float") {
+    copy_data(reinterpret_cast<const float*>(src),dst,n);
+  } else if (nc_dtype=="double") {
+    copy_data(reinterpret_cast<const double*>(src),dst,n);
+  }
+}
+
+// Start/count of a time slice of a non-decomposed var
+std::pair<std::vector<PIO_Offset>,std::vector<PIO_Offset>>
+slice_start_count (const PIOVar& var, const int frame)
+{
+  const int ndims = var.dims.size();
+  std::vector<PIO_Offset> start (ndims+1,0), count(ndims+1); // +1 for time
+  start[0] = frame;
+  count[0] = 1;
+  for (int idim=0; idim<ndims; ++idim) {
+    count[idim+1] = var.dims[idim]->length;
+  }
+  return std::make_pair(start,count);
+}
+
+// Product of all (non-time) dims of a var
+int var_size (const PIOVar& var)
+{
+  int size = 1;
+  for (auto d : var.dims) {
+    size *= d->length;
+  }
+  return size;
+}
+
+// The following two functions do all the metadata work of read_var/write_var
+// (checks, data type changes, records count,...) on the calling thread, and return
+// a job that only makes the PIO calls, so that it can run on the IO thread.
+
+template<typename T>
+std::function<void()>
+read_var_job (const std::string &filename, const std::string &varname, T* buf, const int time_index)
 {
   EKAT_REQUIRE_MSG (buf!=nullptr,
       "Error! Cannot read from provided pointer. Invalid buffer pointer.\n"
       " - filename: " + filename + "\n"
       " - varname : " + varname + "\n");
 
-  const auto& f = impl::get_file(filename,"scorpio::read_var");
-        auto& var = impl::get_var(filename,varname,"scorpio::read_var");
+  const auto& f = get_file(filename,"scorpio::read_var");
+        auto& var = get_var(filename,varname,"scorpio::read_var");
 
   // If the input pointer type already matches var.dtype, this is a no-op
   change_var_dtype(var,get_dtype<T>(),filename);
 
-  int err;
   int frame = -1;
   if (var.time_dep) {
     frame = time_index>=0 ? time_index : f.time_dim->length-1;
@@ -1201,8 +1355,6 @@ void read_var (const std::string &filename, const std::string &varname, T* buf,
         " - varname : " + varname + "\n"
         " - time idx: " + std::to_string(time_index) + "\n"
         " - time len: " + std::to_string(f.time_dim->length));
-    err = PIOc_setframe(f.ncid,var.ncid,frame);
-    check_scorpio_noerr (err,f.name,"variable",varname,"read_var","setframe");
   } else if (time_index>=0) {
     // This is a bit of a hacky usage. We want to read a time index of a var,
     // but the time dim is NOT unlimited in the input file. Apparently, SCORPIO
@@ -1218,76 +1370,74 @@ void read_var (const std::string &filename, const std::string &varname, T* buf,
         " - first dim len: " + std::to_string(var.dims[0]->length) + "\n");
   }
 
-  std::string pioc_func;
-  if (var.decomp) {
-    // A decomposed variable, requires read_darray
-    err = PIOc_read_darray(f.ncid,var.ncid,var.decomp->ncid,var.decomp->offsets.size(),buf);
-    pioc_func = "read_darray";
-  } else {
-    // A non-decomposed variable, use PIOc_get_var(a)
-
-    // If nc data type doesn't match the input pointer, we need to use the var internal buffer
-    void* io_buf = buf;
-    if (var.dtype!=var.nc_dtype) {
-      if (var.size==-1) {
-        var.size = 1;
-        for (auto d : var.dims) {
-          var.size *= d->length;
-        }
-        var.buf.resize(var.size*dtype_size(var.nc_dtype));
-      }
-      io_buf = var.buf.data();
+  const int  ncid      = f.ncid;
+  const int  varid     = var.ncid;
+  const bool set_frame = var.time_dep;
+  const auto decomp    = var.decomp;
+
+  // If nc data type doesn't match the input pointer, non-decomposed vars need a tmp buffer
+  const auto nc_dtype = var.nc_dtype;
+  const bool convert  = decomp==nullptr and var.dtype!=var.nc_dtype;
+  const int  size     = var_size(var);
+
+  // Start/count of the time slice (only for non-decomposed vars)
+  std::vector<PIO_Offset> start, count;
+  if (frame>=0 and decomp==nullptr) {
+    std::tie(start,count) = slice_start_count(var,frame);
+  }
+
+  return [=]() {
+    int err;
+    if (set_frame) {
+      err = PIOc_setframe(ncid,varid,frame);
+      check_scorpio_noerr (err,filename,"variable",varname,"read_var","setframe");
     }
 
-    if (frame>=0) {
-      // We need to get the start/count for each dimension
-      int ndims = var.dims.size();
-      std::vector<PIO_Offset> start (ndims+1,0), count(ndims+1); // +1 for time
-      start[0] = frame;
-      count[0] = 1;
-      for (int idim=0; idim<ndims; ++idim) {
-        count[idim+1] = var.dims[idim]->length;
-      }
-      err = PIOc_get_vara(f.ncid,var.ncid,start.data(),count.data(),io_buf);
-      pioc_func = "get_vara";
+    std::string pioc_func;
+    if (decomp) {
+      // A decomposed variable, requires read_darray
+      err = PIOc_read_darray(ncid,varid,decomp->ncid,decomp->offsets.size(),buf);
+      pioc_func = "read_darray";
     } else {
-      err = PIOc_get_var(f.ncid,var.ncid,io_buf);
-      pioc_func = "get_var";
-    }
+      // A non-decomposed variable, use PIOc_get_var(a)
+      std::vector<char> tmp;
+      void* io_buf = buf;
+      if (convert) {
+        tmp.resize(size*dtype_size(nc_dtype));
+        io_buf = tmp.data();
+      }
+
+      if (frame>=0) {
+        err = PIOc_get_vara(ncid,varid,start.data(),count.data(),io_buf);
+        pioc_func = "get_vara";
+      } else {
+        err = PIOc_get_var(ncid,varid,io_buf);
+        pioc_func = "get_var";
+      }
 
-    // If we used the var tmp buffer, copy back into the user-provided pointer
-    if (var.dtype!=var.nc_dtype) {
-      if (var.nc_dtype=="int") {
-        copy_data(reinterpret_cast<int*>(io_buf),buf,var.size);
-      } else if (var.nc_dtype=="int64") {
-        copy_data(reinterpret_cast<long long*>(io_buf),buf,var.size);
-      } else if (var.nc_dtype=="float") {
-        copy_data(reinterpret_cast<float*>(io_buf),buf,var.size);
-      } else if (var.nc_dtype=="double") {
-        copy_data(reinterpret_cast<double*>(io_buf),buf,var.size);
+      // If we used the tmp buffer, copy back into the user-provided pointer
+      if (convert) {
+        copy_from_nc_buf(io_buf,buf,nc_dtype,size);
       }
     }
-  }
-  check_scorpio_noerr (err,f.name,"variable",varname,"read_var",pioc_func);
+    check_scorpio_noerr (err,filename,"variable",varname,"read_var",pioc_func);
+  };
 }
 
-// Write data from user provided buffer into the requested variable
+// NOTE: the job takes the buffer as an argument, so that customers can decide
+//       whether to write from the user buffer or from a copy of it. The number
+//       of entries the job reads from the buffer is returned in buf_size.
 template<typename T>
-void write_var (const std::string &filename, const std::string &varname, const T* buf, const T* fillValue)
+std::function<void(const T*)>
+write_var_job (const std::string &filename, const std::string &varname, const T* fillValue, int& buf_size)
 {
-  EKAT_REQUIRE_MSG (buf!=nullptr,
-      "Error! Cannot write in provided pointer. Invalid buffer pointer.\n"
-      " - filename: " + filename + "\n"
-      " - varname : " + varname + "\n");
-
-  const auto& f = impl::get_file(filename,"scorpio::write_var");
-  auto& var = impl::get_var(filename,varname,"scorpio::write_var");
+  const auto& f = get_file(filename,"scorpio::write_var");
+  auto& var = get_var(filename,varname,"scorpio::write_var");
 
   // If the input pointer type already matches var.dtype, this is a no-op
   change_var_dtype(var,get_dtype<T>(),filename);
 
-  int err;
-
+  int frame = -1;
   if (var.time_dep) {
     ++var.num_records;
     EKAT_REQUIRE_MSG (var.num_records==f.time_dim->length,
@@ -1296,58 +1446,120 @@ void write_var (const std::string &filename, const std::string &varname, const T
         " - varname : " + varname + "\n"
         " - time len: " + std::to_string(f.time_dim->length) + "\n"
         " - nrecords: " + std::to_string(var.num_records) + "\n");
-    err = PIOc_setframe (f.ncid,var.ncid,var.num_records-1);
-    check_scorpio_noerr (err,f.name,"variable",varname,"write_var","setframe");
+    frame = var.num_records-1;
   }
 
-  std::string pioc_func;
-  if (var.decomp) {
-    // A decomposed variable, requires write_darray
-    err = PIOc_write_darray(f.ncid,var.ncid,var.decomp->ncid,var.decomp->offsets.size(),buf,fillValue);
-    pioc_func = "write_darray";
-  } else {
-    // A non-decomposed variable, use PIOc_put_var(a)
-    // If nc data type doesn't match the input pointer, we need to use the var internal buffer
-    const void* io_buf = buf;
-    if (var.dtype!=var.nc_dtype) {
-      if (var.size==-1) {
-        var.size = 1;
-        for (auto d : var.dims) {
-          var.size *= d->length;
-        }
-        var.buf.resize(var.size*dtype_size(var.nc_dtype));
-      }
-      io_buf = var.buf.data();
-      void* var_buf = var.buf.data();
-      if (var.nc_dtype=="int") {
-        copy_data(buf,reinterpret_cast<int*>(var_buf),var.size);
-      } else if (var.nc_dtype=="int64") {
-        copy_data(buf,reinterpret_cast<long long*>(var_buf),var.size);
-      } else if (var.nc_dtype=="float") {
-        copy_data(buf,reinterpret_cast<float*>(var_buf),var.size);
-      } else if (var.nc_dtype=="double") {
-        copy_data(buf,reinterpret_cast<double*>(var_buf),var.size);
-      }
+  const int  ncid   = f.ncid;
+  const int  varid  = var.ncid;
+  const auto decomp = var.decomp;
+
+  // If nc data type doesn't match the input pointer, non-decomposed vars need a tmp buffer
+  const auto nc_dtype = var.nc_dtype;
+  const bool convert  = decomp==nullptr and var.dtype!=var.nc_dtype;
+  const int  size     = var_size(var);
+
+  // Start/count of the time slice (only for non-decomposed vars)
+  std::vector<PIO_Offset> start, count;
+  if (frame>=0 and decomp==nullptr) {
+    std::tie(start,count) = slice_start_count(var,frame);
+  }
+
+  const bool has_fill = fillValue!=nullptr;
+  const T    fill     = has_fill ? *fillValue : T();
+
+  buf_size = decomp ? decomp->offsets.size() : size;
+
+  return [=](const T* buf) {
+    int err;
+    if (frame>=0) {
+      err = PIOc_setframe (ncid,varid,frame);
+      check_scorpio_noerr (err,filename,"variable",varname,"write_var","setframe");
     }
 
-    if (var.time_dep) {
-      // We need to get the start/count for each dimension
-      int ndims = var.dims.size();
-      std::vector<PIO_Offset> start (ndims+1,0), count(ndims+1);
-      start[0] = f.time_dim->length-1;
-      count[0] = 1;
-      for (int idim=0; idim<ndims; ++idim) {
-        count[idim+1] = var.dims[idim]->length;
-      }
-      err = PIOc_put_vara(f.ncid,var.ncid,start.data(),count.data(),io_buf);
-      pioc_func = "put_vara";
+    std::string pioc_func;
+    if (decomp) {
+      // A decomposed variable, requires write_darray
+      err = PIOc_write_darray(ncid,varid,decomp->ncid,decomp->offsets.size(),buf,has_fill ? &fill : nullptr);
+      pioc_func = "write_darray";
     } else {
-      // Easy: just pass the buffer, and write all entries
-      err = PIOc_put_var(f.ncid,var.ncid,io_buf);
-      pioc_func = "put_var";
+      // A non-decomposed variable, use PIOc_put_var(a)
+      std::vector<char> tmp;
+      const void* io_buf = buf;
+      if (convert) {
+        tmp.resize(size*dtype_size(nc_dtype));
+        copy_to_nc_buf(buf,tmp.data(),nc_dtype,size);
+        io_buf = tmp.data();
+      }
+
+      if (frame>=0) {
+        err = PIOc_put_vara(ncid,varid,start.data(),count.data(),io_buf);
+        pioc_func = "put_vara";
+      } else {
+        // Easy: just pass the buffer, and write all entries
+        err = PIOc_put_var(ncid,varid,io_buf);
+        pioc_func = "put_var";
+      }
     }
+    check_scorpio_noerr (err,filename,"variable",varname,"write_var",pioc_func);
+  };
+}
+
+} // namespace impl
+
+// Read variable into user provided buffer.
+// If time dim is present, read given time slice (time_index=-1 means "read last record).
+// If time dim is not present, time_index must be -1 (error out otherwise)
+template<typename T>
+void read_var (const std::string &filename, const std::string &varname, T* buf, const int time_index)
+{
+  auto job = impl::read_var_job(filename,varname,buf,time_index);
+
+  // We need the data now, so we cannot enqueue the read
+  wait_async_jobs();
+  job();
+}
+
+// Write data from user provided buffer into the requested variable
+template<typename T>
+void write_var (const std::string &filename, const std::string &varname, const T* buf, const T* fillValue)
+{
+  EKAT_REQUIRE_MSG (buf!=nullptr,
+      "Error! Cannot write in provided pointer. Invalid buffer pointer.\n"
+      " - filename: " + filename + "\n"
+      " - varname : " + varname + "\n");
+
+  int size;
+  auto job = impl::write_var_job(filename,varname,fillValue,size);
+  if (impl::io_thread_is_idle()) {
+    job(buf);
+  } else {
+    // The customer may change buf as soon as we return, so write from a copy
+    auto data = std::make_shared<std::vector<T>>(buf,buf+size);
+    impl::run_or_enqueue([job,data]() { job(data->data()); });
   }
-  check_scorpio_noerr (err,f.name,"variable",varname,"write_var",pioc_func);
+}
+
+template<typename T>
+std::shared_future<void>
+enqueue_read_var (const std::string &filename, const std::string &varname, T* buf, const int time_index,
+                  const std::shared_ptr<AsyncJobTiming>& timing)
+{
+  return enqueue_async_job(impl::read_var_job(filename,varname,buf,time_index),timing);
+}
+
+template<typename T>
+std::shared_future<void>
+enqueue_write_var (const std::string &filename, const std::string &varname, const T* buf,
+                   const std::shared_ptr<AsyncJobTiming>& timing)
+{
+  EKAT_REQUIRE_MSG (buf!=nullptr,
+      "Error! Cannot write in provided pointer. Invalid buffer pointer.\n"
+      " - filename: " + filename + "\n"
+      " - varname : " + varname + "\n");
+
+  int size;
+  auto job = impl::write_var_job<T>(filename,varname,nullptr,size);
+  return enqueue_async_job([job,buf]() { job(buf); },timing);
 }
 
 // ========================== READ/WRITE ETI ========================== //
@@ -1364,6 +1576,20 @@ template void write_var<float>     (const std::string&, const std::string&, cons
 template void write_var<double>    (const std::string&, const std::string&, const double*,    const double*);
 template void write_var<char>      (const std::string&, const std::string&, const char*,      const char*);
 
+using timing_ptr = std::shared_ptr<AsyncJobTiming>;
+
+template std::shared_future<void> enqueue_read_var<int>       (const std::string&, const std::string&, int*,       const int, const timing_ptr&);
+template std::shared_future<void> enqueue_read_var<long long> (const std::string&, const std::string&, long long*, const int, const timing_ptr&);
+template std::shared_future<void> enqueue_read_var<float>     (const std::string&, const std::string&, float*,     const int, const timing_ptr&);
+template std::shared_future<void> enqueue_read_var<double>    (const std::string&, const std::string&, double*,    const int, const timing_ptr&);
+template std::shared_future<void> enqueue_read_var<char>      (const std::string&, const std::string&, char*,      const int, const timing_ptr&);
+
+template std::shared_future<void> enqueue_write_var<int>       (const std::string&, const std::string&, const int*,       const timing_ptr&);
+template std::shared_future<void> enqueue_write_var<long long> (const std::string&, const std::string&, const long long*, const timing_ptr&);
+template std::shared_future<void> enqueue_write_var<float>     (const std::string&, const std::string&, const float*,     const timing_ptr&);
+template std::shared_future<void> enqueue_write_var<double>    (const std::string&, const std::string&, const double*,    const timing_ptr&);
+template std::shared_future<void> enqueue_write_var<char>      (const std::string&, const std::string&, const char*,      const timing_ptr&);
+
 // =============== Attributes operations ================== //
 
 bool has_global_attribute (const std::string& filename, const std::string& attname)
@@ -1387,7 +1613,8 @@ bool has_attribute (const std::string& filename, const std::string& varname, con
     varid = var.ncid;
   }
 
-  // Get att id
+  // Get att id (we need the answer now, so wait for the IO thread to be done)
+  wait_async_jobs();
   int attid;
   int err = PIOc_inq_attid(ncid,varid,attname.c_str(),&attid);
   if (err==PIO_ENOTATT) {
@@ -1418,6 +1645,9 @@ T get_attribute (const std::string& filename,
     varid = impl::get_var(filename,varname,"scorpio::get_attribute").ncid;
   }
 
+  // We need the answer now, so wait for the IO thread to be done
+  wait_async_jobs();
+
   // If the attribute type does not match T, we need a temporary, since we can't pass T* where pio expects
   // a different type of pointer
   int att_type, err;
@@ -1493,6 +1723,9 @@ std::string get_attribute (const std::string& filename,
     varid = impl::get_var(filename,varname,"scorpio::set_any_attribute").ncid;
   }
 
+  // We need the answer now, so wait for the IO thread to be done
+  wait_async_jobs();
+
   int err;
   PIO_Offset len;
   err = PIOc_inq_attlen(pf.file->ncid,varid,attname.c_str(),&len);
@@ -1521,18 +1754,31 @@ void set_attribute (const std::string& filename,
     varid = impl::get_var(filename,varname,"scorpio::set_any_attribute").ncid;
   }
 
-  // If the file was not in define mode, we must call enddef at the end
+  // If the file was not in define mode, we must call enddef at the end.
+  // Note: we call PIO directly (rather than redef/enddef), since the file
+  //       is back in its current mode by the time we are done.
   const bool needs_redef = f.enddef;
-  if (needs_redef) {
-    redef(filename);
-  }
-  
-  int err = PIOc_put_att(f.ncid,varid,attname.c_str(),nctype<T>(),nclen(att),ncdata(att));
-  check_scorpio_noerr(err,filename,"attribute",attname,"set_attribute","put_att");
+  const int  ncid = f.ncid;
+  EKAT_REQUIRE_MSG (not needs_redef or (f.mode & Write),
+      "Error! Could not set attribute. File is read-only.\n"
+      " - filename: " + filename + "\n"
+      " - attname : " + attname + "\n");
 
-  if (needs_redef) {
-    enddef(filename);
-  }
+  impl::run_or_enqueue([filename,ncid,varid,attname,att,needs_redef]() {
+    int err;
+    if (needs_redef) {
+      err = PIOc_redef(ncid);
+      check_scorpio_noerr (err,filename,"redef","redef");
+    }
+
+    err = PIOc_put_att(ncid,varid,attname.c_str(),nctype<T>(),nclen(att),ncdata(att));
+    check_scorpio_noerr(err,filename,"attribute",attname,"set_attribute","put_att");
+
+    if (needs_redef) {
+      err = PIOc_enddef(ncid);
+      check_scorpio_noerr (err,filename,"enddef","enddef");
+    }
+  });
 }
 
 // Explicit instantiation
@@ -1557,5 +1803,172 @@ template void set_attribute (const std::string& filename,
                              const std::string& attname,
                              const std::string& att);
 
+// ====================== Asynchronous operations ======================= //
+
+namespace impl {
+
+void async_worker_loop (AsyncJobQueue& q)
+{
+  is_io_thread = true;
+  std::unique_lock<std::mutex> lock(q.mutex);
+  while (true) {
+    q.cv_job.wait(lock,[&]{ return q.stop or not q.jobs.empty(); });
+    if (q.jobs.empty()) {
+      // We were asked to stop, and there's nothing left to do
+      break;
+    }
+    auto task = std::move(q.jobs.front());
+    q.jobs.pop_front();
+    q.busy = true;
+    lock.unlock();
+
+    // Note: packaged_task stores any exception in the shared state,
+    //       so that it is rethrown when the customer calls get()
+    task();
+
+    // Release the data captured by the job (e.g., PIO decomps) before
+    // the queue looks idle, since waiting customers may free it
+    task = {};
+
+    lock.lock();
+    q.busy = false;
+    if (q.jobs.empty()) {
+      q.cv_idle.notify_all();
+    }
+  }
+}
+
+bool io_thread_is_idle ()
+{
+  auto& q = ScorpioSession::instance().async;
+  std::lock_guard<std::mutex> lock(q.mutex);
+  return q.jobs.empty() and not q.busy;
+}
+
+void run_or_enqueue (const std::function<void()>& op)
+{
+  if (io_thread_is_idle()) {
+    op();
+    return;
+  }
+
+  // Nobody waits on this job, so store its error (if any), to rethrow it in the next wait
+  auto& q = ScorpioSession::instance().async;
+  enqueue_async_job([op,&q]() {
+    try {
+      op();
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(q.mutex);
+      if (not q.error) {
+        q.error = std::current_exception();
+      }
+    }
+  });
+}
+
+// Charge the time the main thread spent waiting to the jobs that were running in the
+// meantime, and rethrow the error of jobs enqueued via run_or_enqueue (if any).
+// NOTE: must be called with the queue mutex locked
+void end_wait (AsyncJobQueue& q,
+               const AsyncJobQueue::clock_t::time_point wait_start,
+               const AsyncJobQueue::clock_t::time_point wait_end)
+{
+  for (const auto& r : q.executed) {
+    const auto start = std::max(r.start,wait_start);
+    const auto end   = std::min(r.end,wait_end);
+    if (start<end) {
+      std::chrono::duration<double> blocked = end - start;
+      r.timing->blocked_time += blocked.count();
+    }
+  }
+  q.executed.clear();
+
+  if (q.error) {
+    auto error = q.error;
+    q.error = nullptr;
+    std::rethrow_exception(error);
+  }
+}
+
+} // namespace impl
+
+bool async_io_supported ()
+{
+  int provided;
+  MPI_Query_thread(&provided);
+  return provided==MPI_THREAD_MULTIPLE;
+}
+
+std::shared_future<void>
+enqueue_async_job (const std::function<void()>& job,
+                   const std::shared_ptr<AsyncJobTiming>& timing)
+{
+  EKAT_REQUIRE_MSG (not impl::is_io_thread,
+      "Error! Cannot enqueue an async job from within another async job.\n");
+  EKAT_REQUIRE_MSG (async_io_supported(),
+      "Error! Async IO jobs require MPI to be initialized with MPI_THREAD_MULTIPLE.\n");
+
+  auto& q = ScorpioSession::instance().async;
+
+  // Time the job inside the task, so that timing (and the record used to compute
+  // the blocked time) is up to date by the time the future is ready
+  std::packaged_task<void()> task ([job,timing,&q]() {
+    auto start = AsyncJobQueue::clock_t::now();
+    job();
+    auto end = AsyncJobQueue::clock_t::now();
+    if (timing) {
+      std::chrono::duration<double> elapsed = end - start;
+      timing->run_time += elapsed.count();
+
+      std::lock_guard<std::mutex> lock(q.mutex);
+      q.executed.push_back({start,end,timing});
+    }
+  });
+  std::shared_future<void> future = task.get_future().share();
+  {
+    std::lock_guard<std::mutex> lock(q.mutex);
+    if (not q.worker.joinable()) {
+      q.worker = std::thread(impl::async_worker_loop,std::ref(q));
+    }
+    // The main thread is not waiting, so the jobs executed so far can no longer
+    // be charged any blocked time
+    q.executed.clear();
+    q.jobs.push_back(std::move(task));
+  }
+  q.cv_job.notify_one();
+
+  return future;
+}
+
+void wait_async_job (const std::shared_future<void>& job)
+{
+  EKAT_REQUIRE_MSG (not impl::is_io_thread,
+      "Error! Cannot wait for an async job from within another async job.\n");
+
+  auto& q = ScorpioSession::instance().async;
+  auto wait_start = AsyncJobQueue::clock_t::now();
+  job.wait();
+  auto wait_end = AsyncJobQueue::clock_t::now();
+  {
+    std::lock_guard<std::mutex> lock(q.mutex);
+    impl::end_wait(q,wait_start,wait_end);
+  }
+  job.get(); // Rethrows, in case the job failed
+}
+
+void wait_async_jobs ()
+{
+  if (impl::is_io_thread) {
+    return;
+  }
+
+  auto& q = ScorpioSession::instance().async;
+  std::unique_lock<std::mutex> lock(q.mutex);
+  auto wait_start = AsyncJobQueue::clock_t::now();
+  q.cv_idle.wait(lock,[&]{ return q.jobs.empty() and not q.busy; });
+  auto wait_end = AsyncJobQueue::clock_t::now();
+  impl::end_wait(q,wait_start,wait_end);
+}
+
 } // namespace scorpio
 } // namespace scream
@@ -6,6 +6,9 @@
 #include <ekat/mpi/ekat_comm.hpp>
 #include <ekat/ekat_assert.hpp>
 
+#include <functional>
+#include <future>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -235,6 +238,62 @@ inline void set_attribute (const std::string& filename,
   set_attribute<std::string>(filename,varname,attname,att);
 }
 
+// =============== Asynchronous operations ================== //
+
+// Jobs are executed in FIFO order on a single, dedicated IO thread.
+// PIO is not thread safe, and its calls are collective (so all ranks must issue them
+// in the same order). Hence, while the IO thread has work to do, the calls to this
+// interface from the main thread behave as follows:
+//  - calls that only use the file metadata stored in this interface (e.g., has_var,
+//    get_dimlen, is_file_open, register_file for a file already open) do not wait;
+//  - calls that only send data to PIO (write_var, update_time, set_attribute,
+//    flush_file, release_file) update the metadata right away, and append the PIO
+//    calls to the queue (with a copy of the data), without waiting;
+//  - calls that need data back from PIO (e.g., read_var, get_attribute), or that
+//    create PIO objects (e.g., opening files, defining dims/vars/decomps), wait for
+//    the queue to drain.
+// Either way, PIO calls are executed in the order they are issued. Errors in the PIO
+// calls appended to the queue are rethrown by the next wait on the queue.
+// NOTE: the IO thread issues MPI calls concurrently with the rest of the model,
+//       so async jobs can only be used if MPI was initialized with MPI_THREAD_MULTIPLE.
+// NOTE: jobs must not call this interface, since its metadata is not thread safe.
+//       To read/write data on the IO thread, use enqueue_read_var/enqueue_write_var.
+
+struct AsyncJobTiming {
+  double run_time     = 0; // Time spent by the IO thread executing the job (in seconds)
+  double blocked_time = 0; // Part of run_time during which the main thread was waiting for it
+};
+
+bool async_io_supported ();
+
+// Enqueue a job. If timing is not null, it will be updated once the job is executed
+std::shared_future<void>
+enqueue_async_job (const std::function<void()>& job,
+                   const std::shared_ptr<AsyncJobTiming>& timing = nullptr);
+
+// Enqueue the read/write of a variable. The metadata is updated right away (e.g.,
+// the number of records of the var), while the data is read/written by the IO
+// thread. The buffer must stay valid (and, for writes, unchanged) until the
+// returned future is ready.
+// NOTE: ETI in the cpp file for int, long long, float, double, char.
+template<typename T>
+std::shared_future<void>
+enqueue_read_var (const std::string &filename, const std::string &varname, T* buf,
+                  const int time_index = -1,
+                  const std::shared_ptr<AsyncJobTiming>& timing = nullptr);
+
+template<typename T>
+std::shared_future<void>
+enqueue_write_var (const std::string &filename, const std::string &varname, const T* buf,
+                   const std::shared_ptr<AsyncJobTiming>& timing = nullptr);
+
+// Wait until the given job has been executed (rethrowing its error, if any),
+// without waiting for the jobs enqueued after it
+void wait_async_job (const std::shared_future<void>& job);
+
+// Wait until all enqueued jobs have been executed (no-op if called from the IO thread)
+void wait_async_jobs ();
+
 } // namespace scorpio
 } // namespace scream
 
@@ -20,6 +20,7 @@
 #include "ekat/mpi/ekat_comm.hpp"
 #include "ekat/util/ekat_test_utils.hpp"
 
+#include <cmath>
 #include <iomanip>
 #include <memory>
 
@@ -126,7 +127,8 @@ get_fm (const std::shared_ptr<const AbstractGrid>& grid,
 
 // Returns fields after initialization
 void write (const std::string& avg_type, const std::string& freq_units,
-            const int freq, const int seed, const ekat::Comm& comm)
+            const int freq, const int seed, const ekat::Comm& comm,
+            const bool async_write = false, const int num_streams = 1)
 {
   // Create grid
   auto gm = get_gm(comm);
@@ -149,6 +151,7 @@ void write (const std::string& avg_type, const std::string& freq_units,
   om_pl.set("filename_prefix",std::string("io_basic"));
   om_pl.set("Field Names",fnames);
   om_pl.set("Averaging Type", avg_type);
+  om_pl.set("async_write", async_write);
   auto& ctrl_pl = om_pl.sublist("output_control");
   ctrl_pl.set("frequency_units",freq_units);
   ctrl_pl.set("Frequency",freq);
@@ -163,11 +166,27 @@ void write (const std::string& avg_type, const std::string& freq_units,
   om_pl.set("Floating Point Precision",std::string("single"));
   om.setup(comm,om_pl,fm,gm,t0,t0,false);
 
+  // Without MPI_THREAD_MULTIPLE, async writes fall back to sync writes
+  REQUIRE (om.is_async()==(async_write and scorpio::async_io_supported()));
+
+  // Additional streams write the same fields to other files. Their scorpio calls
+  // must not wait for the pending writes of the other streams.
+  std::vector<std::shared_ptr<OutputManager>> other_oms;
+  for (int i=1; i<num_streams; ++i) {
+    auto pl = om_pl;
+    pl.set("filename_prefix",std::string("io_basic_stream"+std::to_string(i)));
+    other_oms.push_back(std::make_shared<OutputManager>());
+    other_oms.back()->setup(comm,pl,fm,gm,t0,t0,false);
+  }
+
   // Time loop: ensure we always hit 3 output steps
   const int nsteps = num_output_steps*freq;
   auto t = t0;
   for (int n=0; n<nsteps; ++n) {
     om.init_timestep(t,dt);
+    for (auto& o : other_oms) {
+      o->init_timestep(t,dt);
+    }
     // Update time
     t += dt;
 
@@ -177,12 +196,27 @@ void write (const std::string& avg_type, const std::string& freq_units,
       add(f,1.0);
     }
 
-    // Run output manager
+    // Run output manager(s)
     om.run (t);
+    for (auto& o : other_oms) {
+      o->run (t);
+    }
+  }
+
+  // With more than one stream, some of the async writes must have been
+  // overlapped with the work of the main thread (including the other streams)
+  if (om.is_async() and num_streams>1) {
+    REQUIRE (om.get_async_hidden_time()>0);
+    for (const auto& o : other_oms) {
+      REQUIRE (o->get_async_hidden_time()>0);
+    }
   }
 
   // Close file and cleanup
   om.finalize();
+  for (auto& o : other_oms) {
+    o->finalize();
+  }
 }
 
 void read (const std::string& avg_type, const std::string& freq_units,
@@ -310,4 +344,145 @@ TEST_CASE ("io_basic") {
   scorpio::finalize_subsystem();
 }
 
+TEST_CASE ("io_basic_async") {
+  std::vector<std::string> avg_type = {
+    "INSTANT",
+    "MAX",
+    "MIN",
+    "AVERAGE"
+  };
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+  scorpio::init_subsystem(comm);
+
+  // If MPI does not provide MPI_THREAD_MULTIPLE, this tests the fallback to sync writes
+  auto seed = get_random_test_seed(&comm);
+
+  const int freq = 5;
+  for (const auto& avg : avg_type) {
+    write(avg,"nsteps",freq,seed,comm,true);
+    read (avg,"nsteps",freq,seed,comm);
+  }
+
+  // Two streams writing concurrently must not corrupt each other's files
+  for (const auto& avg : avg_type) {
+    write(avg,"nsteps",freq,seed,comm,true,2);
+    read (avg,"nsteps",freq,seed,comm);
+  }
+  scorpio::finalize_subsystem();
+}
+
+TEST_CASE ("io_precision_control") {
+  ekat::Comm comm(MPI_COMM_WORLD);
+  scorpio::init_subsystem(comm);
+
+  auto seed = get_random_test_seed(&comm);
+  auto gm = get_gm(comm);
+  auto grid = gm->get_grid("Point Grid");
+  auto t0 = get_t0();
+  const int nsteps = 3;
+
+  // Bit rounding for all fields, except f_1, which uses an absolute error bound
+  const int keepbits = 3;
+  const double max_abs_error = 2.0;
+
+  auto fm = get_fm(grid,t0,seed);
+  std::vector<std::string> fnames;
+  for (auto it : *fm) {
+    fnames.push_back(it.second->name());
+  }
+
+  ekat::ParameterList om_pl;
+  om_pl.set("MPI Ranks in Filename",true);
+  om_pl.set("filename_prefix",std::string("io_precision_control"));
+  om_pl.set("Field Names",fnames);
+  om_pl.set("Averaging Type", std::string("INSTANT"));
+  om_pl.set("Floating Point Precision",std::string("double"));
+  auto& pc_pl = om_pl.sublist("precision_control");
+  pc_pl.set("keepbits",keepbits);
+  pc_pl.sublist("f_1").set("max_abs_error",max_abs_error);
+  auto& ctrl_pl = om_pl.sublist("output_control");
+  ctrl_pl.set("frequency_units",std::string("nsteps"));
+  ctrl_pl.set("Frequency",1);
+  ctrl_pl.set("save_grid_data",false);
+
+  // Specifying both options is an error
+  {
+    auto bad_pl = om_pl;
+    bad_pl.sublist("precision_control").sublist("f_2").set("keepbits",keepbits);
+    bad_pl.sublist("precision_control").sublist("f_2").set("max_abs_error",max_abs_error);
+    OutputManager om;
+    REQUIRE_THROWS (om.setup(comm,bad_pl,fm,gm,t0,t0,false));
+  }
+
+  OutputManager om;
+  om.setup(comm,om_pl,fm,gm,t0,t0,false);
+  auto t = t0;
+  for (int n=0; n<nsteps; ++n) {
+    om.init_timestep(t,1);
+    t += 1;
+    for (const auto& name : fnames) {
+      add(fm->get_field(name),1.0);
+    }
+    om.run(t);
+  }
+  om.finalize();
+
+  // Rounding must not alter the model fields
+  auto fm0 = get_fm(grid,t0,seed);
+  for (const auto& name : fnames) {
+    auto f0 = fm0->get_field(name).clone();
+    add(f0,nsteps);
+    REQUIRE (views_are_equal(fm->get_field(name),f0));
+  }
+
+  // Read back, and check the error bounds
+  auto fm_read = get_fm(grid,t0,-seed-1);
+  const auto filename = "io_precision_control.INSTANT.nsteps_x1.np" + std::to_string(comm.size())
+                      + "." + t0.to_string() + ".nc";
+  ekat::ParameterList reader_pl;
+  reader_pl.set("Filename",filename);
+  reader_pl.set("Field Names",fnames);
+  AtmosphereInput reader(reader_pl,fm_read);
+
+  bool some_rounded = false;
+  for (int n=0; n<=nsteps; ++n) {
+    reader.read_variables(n);
+    for (const auto& name : fnames) {
+      auto f0 = fm0->get_field(name).clone();
+      add(f0,n);
+      auto f = fm_read->get_field(name);
+      f.sync_to_host();
+      auto data  = f.get_internal_view_data<const Real,Host>();
+      auto data0 = f0.get_internal_view_data<const Real,Host>();
+      const auto nscalars = f.get_header().get_alloc_properties().get_num_scalars();
+      for (int i=0; i<nscalars; ++i) {
+        const Real err = std::abs(data[i]-data0[i]);
+        some_rounded |= err>0;
+        if (name=="f_1") {
+          REQUIRE (err<=max_abs_error);
+          REQUIRE (std::fmod(data[i],4)==0);
+        } else {
+          REQUIRE (err<=std::abs(data0[i])*std::pow(2.0,-(keepbits+1)));
+        }
+      }
+    }
+  }
+  REQUIRE (some_rounded);
+
+  // The precision used is recorded in the variables attributes
+  for (const auto& name : fnames) {
+    auto alg = scorpio::get_attribute<std::string>(filename,name,"quantization_algorithm");
+    if (name=="f_1") {
+      REQUIRE (alg=="absolute_error");
+      REQUIRE (scorpio::get_attribute<double>(filename,name,"quantization_maximum_absolute_error")==max_abs_error);
+    } else {
+      REQUIRE (alg=="bitround");
+      REQUIRE (scorpio::get_attribute<int>(filename,name,"quantization_nsb")==keepbits);
+    }
+  }
+
+  scorpio::finalize_subsystem();
+}
+
 } // anonymous namespace
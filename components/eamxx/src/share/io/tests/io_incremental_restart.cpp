@@ -0,0 +1,151 @@
+#include <catch2/catch.hpp>
+
+#include "share/io/scream_incremental_restart.hpp"
+
+#include "share/field/field_utils.hpp"
+#include "share/field/field.hpp"
+#include "share/util/scream_setup_random_test.hpp"
+#include "share/scream_types.hpp"
+
+#include "ekat/util/ekat_units.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace scream {
+
+TEST_CASE ("incremental_restart_codec") {
+  // Smooth data compresses well, and the codec is lossless
+  const int n = 1000;
+  std::vector<double> smooth(n);
+  for (int i=0; i<n; ++i) {
+    smooth[i] = 280 + 10*std::sin(i*0.01);
+  }
+  const auto nbytes = n*sizeof(double);
+  auto packed = IncrementalRestart::compress(reinterpret_cast<const char*>(smooth.data()),nbytes,sizeof(double));
+  REQUIRE (packed.size()<nbytes);
+
+  std::vector<double> unpacked(n);
+  IncrementalRestart::decompress(packed.data(),packed.size(),
+                                 reinterpret_cast<char*>(unpacked.data()),nbytes,sizeof(double));
+  for (int i=0; i<n; ++i) {
+    REQUIRE (unpacked[i]==smooth[i]);
+  }
+
+  // Constant data (e.g., zeros) is mostly zero runs
+  std::vector<double> zeros(n,0);
+  packed = IncrementalRestart::compress(reinterpret_cast<const char*>(zeros.data()),nbytes,sizeof(double));
+  REQUIRE (packed.size()<16);
+  IncrementalRestart::decompress(packed.data(),packed.size(),
+                                 reinterpret_cast<char*>(unpacked.data()),nbytes,sizeof(double));
+  for (int i=0; i<n; ++i) {
+    REQUIRE (unpacked[i]==0);
+  }
+}
+
+TEST_CASE ("incremental_restart") {
+  using namespace ShortFieldTagsNames;
+  using FL  = FieldLayout;
+  using FID = FieldIdentifier;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+  auto engine = setup_random_test(&comm);
+  std::uniform_real_distribution<Real> pdf(0,1);
+
+  const int ncols = 8;
+  const int nlevs = 33;
+  const auto units = ekat::units::Units::nondimensional();
+
+  // A field that changes every step, one that never changes,
+  // and a subfield of a third field (which is not contiguous)
+  Field T (FID("T",FL({COL,LEV},{ncols,nlevs}),units,"grid"));
+  Field phis (FID("phis",FL({COL},{ncols}),units,"grid"));
+  Field Q (FID("Q",FL({COL,CMP,LEV},{ncols,3,nlevs}),units,"grid"));
+  T.get_header().get_alloc_properties().request_allocation(SCREAM_PACK_SIZE);
+  T.allocate_view();
+  phis.allocate_view();
+  Q.allocate_view();
+  auto qv = Q.subfield(1,1);
+  randomize(T,engine,pdf);
+  randomize(phis,engine,pdf);
+  randomize(Q,engine,pdf);
+
+  const std::vector<Field> fields = {T,phis,qv};
+
+  // Small chunks, so that each field spans several chunks
+  const int max_chain = 3;
+  IncrementalRestart ir (comm,fields,256,max_chain);
+
+  const int nckpts = 5;
+  std::vector<std::vector<Field>> snapshots;
+  auto fname = [&](const int i) {
+    return "io_incremental_restart.np" + std::to_string(comm.size()) +
+           ".r" + std::to_string(i) + ".nc";
+  };
+  for (int i=0; i<nckpts; ++i) {
+    if (i>0) {
+      // Only change the first column of T
+      auto T_h = T.get_view<Real**,Host>();
+      T.sync_to_host();
+      for (int k=0; k<nlevs; ++k) {
+        T_h(0,k) += 1;
+      }
+      T.sync_to_dev();
+    }
+    ir.write(fname(i));
+
+    snapshots.push_back({T.clone(),phis.clone(),qv.clone()});
+
+    // Full checkpoints at the start, and every max_chain checkpoints
+    REQUIRE (ir.last_write_was_full()==(i%max_chain==0));
+    if (ir.last_write_was_full()) {
+      REQUIRE (ir.get_bytes_referenced()==0);
+    } else {
+      REQUIRE (ir.get_bytes_referenced()>0);
+      REQUIRE (ir.get_bytes_written()<=ir.get_bytes_total()-ir.get_bytes_referenced());
+    }
+  }
+
+  // Restore each checkpoint, and compare against the snapshot
+  for (int i=0; i<nckpts; ++i) {
+    T.deep_copy(0);
+    phis.deep_copy(0);
+    Q.deep_copy(0);
+    IncrementalRestart::read(fname(i),fields,comm);
+    REQUIRE (views_are_equal(T,snapshots[i][0]));
+    REQUIRE (views_are_equal(phis,snapshots[i][1]));
+    REQUIRE (views_are_equal(qv,snapshots[i][2]));
+  }
+
+  // Missing fields are an error
+  Field bad (FID("bad",FL({COL},{ncols}),units,"grid"));
+  bad.allocate_view();
+  REQUIRE_THROWS (IncrementalRestart::read(fname(0),{bad},comm));
+
+  // Same name and size, but a different local layout (e.g., a different
+  // decomposition) must not be silently accepted
+  Field phis_bad (FID("phis",FL({COL,CMP},{ncols/2,2}),units,"grid"));
+  phis_bad.allocate_view();
+  REQUIRE_THROWS (IncrementalRestart::read(fname(0),{phis_bad},comm));
+
+  // At the end of the run, the last checkpoint (which is partial) must become
+  // self-contained, so that it can be read after all older ones are removed
+  REQUIRE (not ir.last_write_was_full());
+  ir.finalize();
+  REQUIRE (ir.last_write_was_full());
+  for (int i=0; i<nckpts-1; ++i) {
+    std::remove(IncrementalRestart::sidecar_filename(fname(i),comm.rank()).c_str());
+  }
+  T.deep_copy(0);
+  phis.deep_copy(0);
+  Q.deep_copy(0);
+  IncrementalRestart::read(fname(nckpts-1),fields,comm);
+  REQUIRE (views_are_equal(T,snapshots[nckpts-1][0]));
+  REQUIRE (views_are_equal(phis,snapshots[nckpts-1][1]));
+  REQUIRE (views_are_equal(qv,snapshots[nckpts-1][2]));
+  std::remove(IncrementalRestart::sidecar_filename(fname(nckpts-1),comm.rank()).c_str());
+}
+
+} // namespace scream
@@ -0,0 +1,100 @@
+#include "share/property_checks/field_checks_batch.hpp"
+#include "share/property_checks/field_nan_check.hpp"
+#include "share/property_checks/field_within_interval_check.hpp"
+
+#include <ekat/util/ekat_math_utils.hpp>
+
+namespace scream
+{
+
+bool FieldChecksBatch::
+add_check (const std::shared_ptr<const PropertyCheck>& pc)
+{
+  EKAT_REQUIRE_MSG (not m_setup,
+      "Error! Cannot add checks to a FieldChecksBatch after setup was called.\n"
+      "  - Property check name: " + pc->name() + "\n");
+
+  auto nan_check = std::dynamic_pointer_cast<const FieldNaNCheck>(pc);
+  auto int_check = std::dynamic_pointer_cast<const FieldWithinIntervalCheck>(pc);
+  if (not nan_check and not int_check) {
+    return false;
+  }
+
+  const auto& f = pc->fields().front();
+  const auto& layout = f.get_header().get_identifier().get_layout();
+  if (f.data_type()!=get_data_type<Real>() or layout.rank()>MaxRank) {
+    return false;
+  }
+
+  Entry e;
+  e.field = get_strided_data<const Real>(f);
+
+  e.nan_check = nan_check!=nullptr;
+  if (int_check) {
+    e.lb = int_check->lower_bound();
+    e.ub = int_check->upper_bound();
+  }
+
+  m_entries_h.push_back(e);
+  ++m_num_checks;
+  return true;
+}
+
+void FieldChecksBatch::setup ()
+{
+  const int n = m_num_checks;
+  m_fail_bits = view_1d<unsigned>("",(n+BitsPerWord-1)/BitsPerWord);
+  m_fail_bits_h = Kokkos::create_mirror_view(m_fail_bits);
+
+  std::vector<int> sizes;
+  for (const auto& e : m_entries_h) {
+    sizes.push_back(e.field.size());
+  }
+  m_fused.setup(m_entries_h,sizes);
+
+  m_setup = true;
+}
+
+void FieldChecksBatch::run () const
+{
+  EKAT_REQUIRE_MSG (m_setup,
+      "Error! FieldChecksBatch::run called before setup.\n");
+
+  const int n = m_num_checks;
+  if (n==0) {
+    return;
+  }
+
+  Kokkos::deep_copy(m_fail_bits,0);
+
+  auto fused     = m_fused;
+  auto fail_bits = m_fail_bits;
+  constexpr int nbits = BitsPerWord;
+  Kokkos::parallel_for(Kokkos::RangePolicy<typename KT::ExeSpace>(0,fused.size),
+                       KOKKOS_LAMBDA(const int idx) {
+    int loc;
+    const int icheck = fused.find(idx,loc);
+    const auto& e = fused.entries(icheck);
+    const Real v = e.field.data[e.field.offset(loc)];
+
+    // Note: for interval checks, NaN values are flagged as failures as well, so
+    //       that the full check is run on them.
+    const bool fail = e.nan_check ? ekat::is_invalid(v) : not (v>=e.lb && v<=e.ub);
+    if (fail) {
+      Kokkos::atomic_fetch_or(&fail_bits(icheck/nbits),1u<<(icheck%nbits));
+    }
+  });
+  Kokkos::deep_copy(m_fail_bits_h,m_fail_bits);
+}
+
+bool FieldChecksBatch::passed (const int i) const
+{
+  EKAT_REQUIRE_MSG (i>=0 && i<m_num_checks,
+      "Error! Check index out of bounds in FieldChecksBatch.\n"
+      "  - index: " + std::to_string(i) + "\n"
+      "  - num checks: " + std::to_string(m_num_checks) + "\n");
+
+  return (m_fail_bits_h(i/BitsPerWord) & (1u<<(i%BitsPerWord)))==0;
+}
+
+} // namespace scream
@@ -0,0 +1,81 @@
+#ifndef SCREAM_FIELD_CHECKS_BATCH_HPP
+#define SCREAM_FIELD_CHECKS_BATCH_HPP
+
+#include "share/property_checks/property_check.hpp"
+#include "share/util/eamxx_fused_index_space.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace scream
+{
+
+/*
+ * A class to evaluate several pointwise field checks at once
+ *
+ * Each FieldNaNCheck/FieldWithinIntervalCheck runs its own parallel_reduce,
+ * followed by a device-host sync. For an atm process with many checks,
+ * this means many small kernels and round trips per time step. This class
+ * evaluates all the checks added to it in a single kernel, producing a
+ * bitmap with one bit per check, which is then copied to host in one shot.
+ *
+ * The batch only tells whether each check passed or not. For the checks
+ * that did not pass, the caller should run PropertyCheck::check(), which
+ * computes the detailed diagnostics (result, min/max location, etc).
+ *
+ * Only checks on Real fields of rank<=MaxRank can be added to the batch.
+ * add_check returns false for checks that cannot be fused, which must
+ * then be run separately.
+ */
+
+class FieldChecksBatch {
+public:
+  static constexpr int MaxRank = StridedData<const Real>::MaxRank;
+
+  // Add a check to the batch. Return false if the check cannot be batched.
+  // The check index in the batch is given by the number of successful
+  // calls to add_check that preceded this one.
+  bool add_check (const std::shared_ptr<const PropertyCheck>& pc);
+
+  // Create the device data for the checks added so far.
+  // Must be called after all checks are added, and before run().
+  void setup ();
+
+  // Evaluate all checks in one kernel
+  void run () const;
+
+  // Whether the i-th check passed during the last call to run()
+  bool passed (const int i) const;
+
+  int num_checks () const { return m_num_checks; }
+  bool is_setup () const { return m_setup; }
+
+  struct Entry {
+    StridedData<const Real> field;
+
+    // If nan_check=false, this is a within-interval check
+    bool        nan_check = false;
+    double      lb, ub;
+  };
+
+private:
+  using KT = KokkosTypes<DefaultDevice>;
+  template<typename T>
+  using view_1d = typename KT::template view_1d<T>;
+
+  static constexpr int BitsPerWord = 32;
+
+  std::vector<Entry>  m_entries_h;
+
+  // The checks are evaluated over the fused index space of all fields
+  FusedIndexSpace<Entry>  m_fused;
+  view_1d<unsigned>   m_fail_bits;
+  typename view_1d<unsigned>::HostMirror m_fail_bits_h;
+
+  int   m_num_checks = 0;
+  bool  m_setup      = false;
+};
+
+} // namespace scream
+
+#endif // SCREAM_FIELD_CHECKS_BATCH_HPP
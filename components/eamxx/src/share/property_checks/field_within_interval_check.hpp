@@ -39,6 +39,10 @@ public:
 
   PropertyType type () const override { return PropertyType::PointWise; }
 
+  // The bounds outside of which the check does not pass
+  double lower_bound () const { return m_lb; }
+  double upper_bound () const { return m_ub; }
+
   ResultAndMsg check() const override;
 
 // CUDA requires the parent fcn of a KOKKOS_LAMBDA to have public access
@@ -18,6 +18,8 @@
 #include "ekat/ekat_parameter_list.hpp"
 #include "ekat/ekat_scalar_traits.hpp"
 
+#include <fstream>
+
 namespace scream {
 
 ekat::ParameterList create_test_params ()
@@ -276,6 +278,10 @@ public:
 
     add_field<Required>("Temperature",lt,K,m_grid_name);
     add_field<Computed>("Concentration A",lt,kg/pow(m,3),m_grid_name);
+
+    if (m_params.get<bool>("Transient Outputs",false)) {
+      declare_transient_field("Concentration A",m_grid_name);
+    }
   }
 };
 
@@ -326,11 +332,47 @@ public:
   }
 protected:
     void run_impl (const double /* dt */) {
-    auto v = get_field_out("Field A", m_grid_name).get_view<Real*,Host>();
+    auto f = get_field_out("Field A", m_grid_name);
+    f.sync_to_host();
+    auto v = f.get_view<Real*,Host>();
 
     for (int i=0; i<v.extent_int(0); ++i) {
       v[i] += Real(1.0);
     }
+    f.sync_to_dev();
+  }
+};
+
+class TimesTwo : public DummyProcess
+{
+public:
+  TimesTwo (const ekat::Comm& comm,const ekat::ParameterList& params)
+   : DummyProcess(comm,params)
+  {
+    // Nothing to do here
+  }
+
+  // The type of the atm proc
+  AtmosphereProcessType type () const { return AtmosphereProcessType::Physics; }
+
+  void set_grids (const std::shared_ptr<const GridsManager> gm) {
+    using namespace ekat::units;
+
+    const auto grid = gm->get_grid(m_grid_name);
+    const auto lt = grid->get_2d_scalar_layout ();
+
+    add_field<Updated>("Field A",lt,K,m_grid_name);
+  }
+protected:
+    void run_impl (const double /* dt */) {
+    auto f = get_field_out("Field A", m_grid_name);
+    f.sync_to_host();
+    auto v = f.get_view<Real*,Host>();
+
+    for (int i=0; i<v.extent_int(0); ++i) {
+      v[i] *= Real(2.0);
+    }
+    f.sync_to_dev();
   }
 };
 
@@ -459,6 +501,35 @@ TEST_CASE("atm_proc_dag", "") {
 
     REQUIRE (dag.has_unmet_dependencies());
   }
+
+  SECTION ("lifetimes") {
+    auto params = create_test_params ();
+    const std::string gn = "Point Grid";
+
+    for (bool transient : {false, true}) {
+      params.sublist("BarBaz").sublist("Bar").set("Transient Outputs",transient);
+      auto atm_group = std::dynamic_pointer_cast<AtmosphereProcessGroup>(
+          std::shared_ptr<AtmosphereProcess>(factory.create("group",comm,params)));
+      atm_group->set_grids(gm);
+
+      AtmProcDAG dag;
+      const auto lifetimes = dag.compute_field_lifetimes(*atm_group);
+
+      // Foo needs the tendency computed by Baz at the previous step
+      REQUIRE (lifetimes.at(gn).at("Temperature tendency").needed_from_prev_step);
+      // Procs do not declare T transient, so it must persist
+      REQUIRE (not lifetimes.at(gn).at("Temperature").is_transient());
+
+      // Concentration A is computed by Bar and used by Baz: it can share memory
+      // with other fields only if Bar declared that it rewrites it at every step
+      const auto& lt = lifetimes.at(gn).at("Concentration A");
+      REQUIRE (lt.is_transient()==transient);
+      REQUIRE (lt.last==2);
+      if (transient) {
+        REQUIRE (lt.first==1);
+      }
+    }
+  }
 }
 
 TEST_CASE("field_checks", "") {
@@ -580,6 +651,132 @@ TEST_CASE ("subcycling") {
   for (size_t i=0; i<v.size(); ++i) {
     REQUIRE (v_sub[i]==5*v[i]);
   }
+
+  // Time stamps are updated once per run, update counters once per subcycle
+  const auto& track     = ap->get_fields_in().front().get_header().get_tracking();
+  const auto& track_sub = ap_sub->get_fields_in().front().get_header().get_tracking();
+  REQUIRE (track.get_time_stamp()==track_sub.get_time_stamp());
+  REQUIRE (track.get_version()==1);
+  REQUIRE (track_sub.get_version()==5);
+
+  // A repairing post-condition check changes the field, so it must update the counter too
+  auto f = ap->get_fields_out().front();
+  auto lb_check = std::make_shared<FieldLowerBoundCheck>(f,gm->get_grid("Point Grid"),10,true);
+  ap->add_postcondition_check(lb_check);
+  ap->run(dt);
+  REQUIRE (track.get_version()==3);
+}
+
+TEST_CASE ("perf_counters") {
+  using namespace scream;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+  util::TimeStamp t0 ({2022,1,1},{0,0,0});
+  auto gm = create_gm(comm);
+
+  ekat::ParameterList params;
+  params.set<std::string>("Grid Name", "Point Grid");
+  params.set<int>("number_of_subcycles", 2);
+
+  auto ap = std::make_shared<AddOne>(comm,params);
+  ap->set_grids(gm);
+  for(const auto& req : ap->get_required_field_requests()) {
+    Field f(req.fid);
+    f.allocate_view();
+    f.deep_copy(0);
+    f.get_header().get_tracking().update_time_stamp(t0);
+    ap->set_required_field(f.get_const());
+    ap->set_computed_field(f);
+  }
+  ap->initialize(t0,RunType::Initial);
+
+  // Nothing is recorded until perf counters are enabled
+  ap->run(1);
+  REQUIRE (ap->get_perf_record().num_runs==0);
+  REQUIRE (ap->get_perf_record().time_total==0);
+
+  enable_perf_counters();
+  REQUIRE (perf_counters_enabled());
+
+  const int nruns = 3;
+  for (int i=0; i<nruns; ++i) {
+    ap->run(1);
+  }
+
+  const auto& r = ap->get_perf_record();
+  REQUIRE (r.num_runs==nruns);
+  REQUIRE (r.time_run_impl>0);
+  REQUIRE (r.time_total>=r.time_run_impl+r.time_property_checks+
+                         r.time_tendencies+r.time_conservation_checks);
+  REQUIRE (r.counters.kernel_launches>=0);
+  REQUIRE (r.counters.bytes_allocated>=0);
+
+  // The summary files are written and list the process
+  write_perf_summary(*ap,comm,"atm_process_perf");
+  const auto fname = "atm_process_perf.rank" + std::to_string(comm.rank());
+  std::ifstream csv (fname + ".csv");
+  REQUIRE (csv.good());
+  std::string header, line;
+  std::getline(csv,header);
+  std::getline(csv,line);
+  REQUIRE (line.substr(0,line.find(','))==ap->name());
+  REQUIRE (std::ifstream(fname + ".json").good());
+}
+
+TEST_CASE ("parallel_schedule") {
+  using namespace scream;
+  using strvec_t = std::vector<std::string>;
+
+  // A world comm
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // A time stamp
+  util::TimeStamp t0 ({2022,1,1},{0,0,0});
+
+  // Create a grids manager
+  auto gm = create_gm(comm);
+
+  auto& factory = AtmosphereProcessFactory::instance();
+  factory.register_product("AddOne",&create_atmosphere_process<AddOne>);
+  factory.register_product("TimesTwo",&create_atmosphere_process<TimesTwo>);
+
+  // Runs a group with AddOne and TimesTwo on Field A=1, and returns the result
+  auto run_group = [&](const std::string& sched_type) {
+    ekat::ParameterList params ("Group");
+    params.set<std::string>("schedule_type",sched_type);
+    params.set<strvec_t>("atm_procs_list",{"AddOne","TimesTwo"});
+    params.sublist("AddOne").set<std::string>("Grid Name", "Point Grid");
+    params.sublist("TimesTwo").set<std::string>("Grid Name", "Point Grid");
+
+    auto group = std::make_shared<AtmosphereProcessGroup>(comm,params);
+    group->set_grids(gm);
+
+    // Create fields (should be just one) and set it in the group
+    Field f;
+    for(const auto& req : group->get_required_field_requests()) {
+      f = Field(req.fid);
+      f.allocate_view();
+      f.deep_copy(1);
+      f.get_header().get_tracking().update_time_stamp(t0);
+      group->set_required_field(f.get_const());
+      group->set_computed_field(f);
+    }
+
+    group->initialize(t0,RunType::Initial);
+    group->run(1);
+    group->finalize();
+
+    f.sync_to_host();
+    return f.get_view<const Real*,Host>();
+  };
+
+  // Sequential: (1+1)*2=4. Parallel: 1 + (1+1-1) + (1*2-1) = 3
+  auto v_seq = run_group("Sequential");
+  auto v_par = run_group("Parallel");
+  for (int i=0; i<v_seq.extent_int(0); ++i) {
+    REQUIRE (v_seq[i]==4);
+    REQUIRE (v_par[i]==3);
+  }
 }
 
 TEST_CASE ("diagnostics") {
@@ -6,6 +6,9 @@
 #include "share/util/scream_setup_random_test.hpp"
 #include "share/field/field_utils.hpp"
 
+#include <cstdio>
+#include <fstream>
+
 namespace scream {
 
 class CoarseningRemapperTester : public CoarseningRemapper {
@@ -64,6 +67,26 @@ public:
   view_1d<int>::HostMirror get_send_pid_lids_start () const {
     return cmvdc(m_send_pid_lids_start);
   }
+
+  const HorizRemapperData& get_remapper_data () const {
+    return s_remapper_data.at(m_remapper_data_key);
+  }
+
+  const Field& get_ov_field (const int ifield) const {
+    return m_ov_fields[ifield];
+  }
+
+  // Expose the two flavors of the (unmasked) local mat-vec
+  void test_batched_local_mat_vec () const {
+    batched_local_mat_vec();
+  }
+  int get_batched_pack_size () const {
+    return m_batched_pack_size;
+  }
+  template<int N>
+  void test_local_mat_vec (const Field& x, const Field& y) const {
+    local_mat_vec<N>(x,y);
+  }
 };
 
 void root_print (const std::string& msg, const ekat::Comm& comm) {
@@ -228,6 +251,27 @@ Field all_gather_field (const Field& f, const ekat::Comm& comm) {
   }
 }
 
+// Get the k-th entry of column icol of a field of rank 3 to 5 (on host),
+// where k is the flattened index of the non-COL dimensions
+Real get_col_entry (const Field& f, const int icol, int k)
+{
+  const auto& fl = f.get_header().get_identifier().get_layout();
+  int idx[5] = {icol,0,0,0,0};
+  for (int d=fl.rank()-1; d>0; --d) {
+    idx[d] = k % fl.dim(d);
+    k /= fl.dim(d);
+  }
+  EKAT_REQUIRE_MSG (fl.rank()>=3 && fl.rank()<=5,
+      "Unexpected field rank in get_col_entry.\n"
+      "  - field name: " + f.name() + "\n");
+  if (fl.rank()==3) {
+    return f.get_view<const Real***,Host>()(idx[0],idx[1],idx[2]);
+  } else if (fl.rank()==4) {
+    return f.get_view<const Real****,Host>()(idx[0],idx[1],idx[2],idx[3]);
+  }
+  return f.get_view<const Real*****,Host>()(idx[0],idx[1],idx[2],idx[3],idx[4]);
+}
+
 // Helper function to create a remap file
 void create_remap_file(const std::string& filename, const int ngdofs_tgt)
 {
@@ -502,4 +546,199 @@ TEST_CASE("coarsening_remap")
   scorpio::finalize_subsystem();
 }
 
+TEST_CASE ("coarsening_remap_cache") {
+  using gid_type = AbstractGrid::gid_type;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  scorpio::init_subsystem(comm);
+  auto engine = setup_random_test (&comm);
+
+  std::string filename = "cr_cache_tests_map." + std::to_string(comm.size()) + ".nc";
+
+  const int nldofs_tgt = 2;
+  const int ngdofs_tgt = nldofs_tgt*comm.size();
+  create_remap_file(filename, ngdofs_tgt);
+
+  const int ngdofs_src = ngdofs_tgt+1;
+  auto src_grid = build_src_grid(comm, ngdofs_src, engine);
+
+  // Build remapper from map file (this writes the cache), and get a copy of its data.
+  // Note: the remap data is shared among remappers with the same map file and fine grid,
+  //       so we must destroy the remapper, to ensure the 2nd one re-builds the data.
+  HorizRemapperData::set_cache_dir(".");
+  auto remap = std::make_shared<CoarseningRemapperTester>(src_grid,filename);
+  const auto cache_file = remap->get_remapper_data().cache_file;
+  REQUIRE (not remap->get_remapper_data().loaded_from_cache);
+  REQUIRE (std::ifstream(cache_file).good());
+  auto row_offsets = cmvdc(remap->get_row_offsets());
+  auto col_lids    = cmvdc(remap->get_col_lids());
+  auto weights     = cmvdc(remap->get_weights());
+  auto ov_gids     = remap->get_ov_tgt_grid()->get_dofs_gids().get_view<const gid_type*,Host>();
+  remap = nullptr;
+
+  // Build again: data must come from the cache, and match the original one
+  auto remap2 = std::make_shared<CoarseningRemapperTester>(src_grid,filename);
+  REQUIRE (remap2->get_remapper_data().loaded_from_cache);
+  REQUIRE (remap2->get_remapper_data().cache_file==cache_file);
+  auto row_offsets2 = cmvdc(remap2->get_row_offsets());
+  auto col_lids2    = cmvdc(remap2->get_col_lids());
+  auto weights2     = cmvdc(remap2->get_weights());
+  auto ov_gids2     = remap2->get_ov_tgt_grid()->get_dofs_gids().get_view<const gid_type*,Host>();
+
+  REQUIRE (row_offsets2.size()==row_offsets.size());
+  REQUIRE (col_lids2.size()==col_lids.size());
+  REQUIRE (ov_gids2.size()==ov_gids.size());
+  for (size_t i=0; i<row_offsets.size(); ++i) {
+    REQUIRE (row_offsets2(i)==row_offsets(i));
+  }
+  for (size_t i=0; i<col_lids.size(); ++i) {
+    REQUIRE (col_lids2(i)==col_lids(i));
+    REQUIRE (weights2(i)==weights(i));
+  }
+  for (size_t i=0; i<ov_gids.size(); ++i) {
+    REQUIRE (ov_gids2(i)==ov_gids(i));
+  }
+
+  HorizRemapperData::set_cache_dir("");
+
+  // Each rank wrote its own cache file
+  std::remove(cache_file.c_str());
+
+  // Clean up scorpio stuff
+  scorpio::finalize_subsystem();
+}
+
+TEST_CASE ("coarsening_remap_batched") {
+  // Check that the batched mat-vec, which handles all unmasked fields in a single
+  // kernel, gives the same answer as the per-field mat-vec, for fields of rank 3+
+  // (some of which have padding, and all of which can be packed). The per-field mat-vec only handles up to rank 4,
+  // so rank-5 fields are checked against a host computation of y=Ax.
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  scorpio::init_subsystem(comm);
+  auto engine = setup_random_test (&comm);
+
+  std::string filename = "cr_batched_tests_map." + std::to_string(comm.size()) + ".nc";
+
+  const int nldofs_tgt = 2;
+  const int ngdofs_tgt = nldofs_tgt*comm.size();
+  create_remap_file(filename, ngdofs_tgt);
+
+  const int ngdofs_src = ngdofs_tgt+1;
+  auto src_grid = build_src_grid(comm, ngdofs_src, engine);
+  auto remap = std::make_shared<CoarseningRemapperTester>(src_grid,filename);
+  auto tgt_grid = remap->get_coarse_grid();
+
+  // Rank 5 fields are not a standard layout type, so build them by hand
+  const auto u = ekat::units::Units::nondimensional();
+  const std::vector<int> cmp_dims = {2,3,2};
+  auto create_r5_field = [&](const std::string& name, const AbstractGrid& grid, const bool midpoints) {
+    Field f(FieldIdentifier(name,grid.get_3d_tensor_layout(midpoints,cmp_dims),u,grid.name()));
+    f.get_header().get_alloc_properties().request_allocation(SCREAM_PACK_SIZE);
+    f.allocate_view();
+    return f;
+  };
+  auto src_r5_m = create_r5_field("r5_m",*src_grid,true);
+  auto src_r5_i = create_r5_field("r5_i",*src_grid,false);
+
+  // Same values as in create_field, so that all math ops are exact
+  std::discrete_distribution<int> ipdf ({1,1,1,1,1,1,1,1,1,1});
+  auto pdf = [&](decltype(engine)& e) {
+    return Real(std::pow(2,ipdf(e)));
+  };
+  randomize(src_r5_m,engine,pdf);
+  randomize(src_r5_i,engine,pdf);
+
+  std::vector<Field> src_f = {
+    create_field("v3d_m",LayoutType::Vector3D, *src_grid, true,  engine),
+    create_field("v3d_i",LayoutType::Vector3D, *src_grid, false, engine),
+    create_field("t3d_m",LayoutType::Tensor3D, *src_grid, true,  engine),
+    create_field("t3d_i",LayoutType::Tensor3D, *src_grid, false, engine),
+    src_r5_m,
+    src_r5_i
+  };
+  std::vector<Field> tgt_f = {
+    create_field("v3d_m",LayoutType::Vector3D, *tgt_grid, true ),
+    create_field("v3d_i",LayoutType::Vector3D, *tgt_grid, false),
+    create_field("t3d_m",LayoutType::Tensor3D, *tgt_grid, true ),
+    create_field("t3d_i",LayoutType::Tensor3D, *tgt_grid, false),
+    create_r5_field("r5_m",*tgt_grid,true),
+    create_r5_field("r5_i",*tgt_grid,false)
+  };
+
+  remap->registration_begins();
+  for (size_t i=0; i<tgt_f.size(); ++i) {
+    remap->register_field(src_f[i],tgt_f[i]);
+  }
+  remap->registration_ends();
+
+  // All fields have a padded last dim, so the batched mat-vec uses packs
+  REQUIRE (remap->get_batched_pack_size()==SCREAM_PACK_SIZE);
+
+  // Note: we don't call remap(), since the MPI part only handles fields up to rank 4
+  remap->test_batched_local_mat_vec();
+
+  const auto row_offsets = cmvdc(remap->get_row_offsets());
+  const auto col_lids    = cmvdc(remap->get_col_lids());
+  const auto weights     = cmvdc(remap->get_weights());
+  const int  nrows       = row_offsets.size()-1;
+
+  for (size_t i=0; i<src_f.size(); ++i) {
+    const auto& x = src_f[i];
+    const auto& y = remap->get_ov_field(i);
+    const auto& l = x.get_header().get_identifier().get_layout();
+    const int col_size = l.clone().strip_dim(0).size();
+
+    y.sync_to_host();
+    x.sync_to_host();
+
+    // Copy the batched result, since we may overwrite y below
+    std::vector<Real> y_batched;
+    auto copy_to_vec = [&](const Field& f, std::vector<Real>& v) {
+      v.clear();
+      for (int row=0; row<f.get_header().get_identifier().get_layout().dim(0); ++row) {
+        for (int k=0; k<col_size; ++k) {
+          v.push_back(get_col_entry(f,row,k));
+        }
+      }
+    };
+    copy_to_vec(y,y_batched);
+
+    std::vector<Real> y_expected;
+    if (l.rank()<=4) {
+      // Compare against the per-field mat-vec, with and without packs
+      remap->test_local_mat_vec<1>(x,y);
+      y.sync_to_host();
+      copy_to_vec(y,y_expected);
+      REQUIRE (y_batched==y_expected);
+
+      if (SCREAM_PACK_SIZE>1) {
+        remap->test_local_mat_vec<SCREAM_PACK_SIZE>(x,y);
+        y.sync_to_host();
+        copy_to_vec(y,y_expected);
+        REQUIRE (y_batched==y_expected);
+      }
+    } else {
+      // Compute y=Ax on host, with the same order of operations
+      for (int row=0; row<nrows; ++row) {
+        const int beg = row_offsets(row);
+        const int end = row_offsets(row+1);
+        for (int k=0; k<col_size; ++k) {
+          Real y_val = weights(beg)*get_col_entry(x,col_lids(beg),k);
+          for (int icol=beg+1; icol<end; ++icol) {
+            y_val += weights(icol)*get_col_entry(x,col_lids(icol),k);
+          }
+          y_expected.push_back(y_val);
+        }
+      }
+      REQUIRE (y_batched==y_expected);
+    }
+  }
+
+  // Clean up scorpio stuff
+  scorpio::finalize_subsystem();
+}
+
 } // namespace scream
@@ -13,6 +13,9 @@
 #include "share/io/scream_output_manager.hpp"
 
 #include "ekat/ekat_parameter_list.hpp"
+
+#include <chrono>
+#include <future>
 /*-----------------------------------------------------------------------------------------------
  * Test TimeInterpolation class
  *-----------------------------------------------------------------------------------------------*/
@@ -171,16 +174,54 @@ TEST_CASE ("eamxx_time_interpolation_data_from_file") {
   printf(  "Constructing a time interpolation object ...\n");
   util::TimeInterpolation time_interpolator(grid,list_of_files);
   util::TimeInterpolation time_interpolator_deep(grid,list_of_files);
+  // Note: if async IO is not supported, this falls back to synchronous reads
+  util::TimeInterpolation time_interpolator_prefetch(grid,list_of_files,true);
+  REQUIRE(time_interpolator_prefetch.is_prefetching()==scorpio::async_io_supported());
   for (auto name : fnames) {
     auto ff      = fields_man_t0->get_field(name);
     auto ff_deep = fields_man_deep->get_field(name);
     time_interpolator.add_field(ff);
     time_interpolator_deep.add_field(ff_deep,true);
+    time_interpolator_prefetch.add_field(ff);
   }
   time_interpolator.initialize_data_from_files();
   time_interpolator_deep.initialize_data_from_files();
+  time_interpolator_prefetch.initialize_data_from_files();
   printf(  "Constructing a time interpolation object ... DONE\n");
 
+  // Scorpio calls unrelated to the prefetch (here, writing to another file) must not
+  // wait for it. To check this deterministically, hold the IO thread with a job
+  // enqueued after the prefetch reads: if any call drained the queue, that job
+  // would time out (rather than hang the test), and be found ready below.
+  if (time_interpolator_prefetch.is_prefetching()) {
+    printf(  "Checking that unrelated IO does not wait for the prefetch ...\n");
+    const std::string other_file = "time_interpolation_unrelated_np" + std::to_string(comm.size()) + ".nc";
+    scorpio::register_file(other_file,scorpio::Write);
+    scorpio::define_dim(other_file,"dim",2);
+    scorpio::define_time(other_file,"days");
+    scorpio::define_var(other_file,"var",{"dim"},"double",true);
+    scorpio::enddef(other_file);
+
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    auto gate = scorpio::enqueue_async_job([released]() {
+      released.wait_for(std::chrono::seconds(60));
+    });
+
+    std::vector<double> data = {1.0, 2.0};
+    REQUIRE(scorpio::is_file_open(other_file,scorpio::Write));
+    scorpio::update_time(other_file,0.0);
+    scorpio::write_var(other_file,"var",data.data());
+    scorpio::set_attribute(other_file,"GLOBAL","unrelated","yes");
+    scorpio::flush_file(other_file);
+    REQUIRE(gate.wait_for(std::chrono::seconds(0))==std::future_status::timeout);
+
+    release.set_value();
+    scorpio::wait_async_job(gate);
+    scorpio::release_file(other_file);
+    printf(  "Checking that unrelated IO does not wait for the prefetch ... DONE\n");
+  }
+
   // Now check that the interpolator is working as expected.  Should be able to
   // match the interpolated fields against the results of update_field_data at any
   // time between 0 and 10 dt.
@@ -209,6 +250,7 @@ TEST_CASE ("eamxx_time_interpolation_data_from_file") {
     }
     time_interpolator.perform_time_interpolation(ts);
     time_interpolator_deep.perform_time_interpolation(ts);
+    time_interpolator_prefetch.perform_time_interpolation(ts);
     // Now compare the interp_fields to the fields in the field manager which should be updated.
     for (auto name : fnames) {
       auto field      = fields_man_t0->get_field(name);
@@ -219,13 +261,23 @@ TEST_CASE ("eamxx_time_interpolation_data_from_file") {
       REQUIRE(views_are_equal(field_deep,time_interpolator_deep.get_field(name)));
       // Check that the deep and shallow fields match showing that both approaches got the correct answer.
       REQUIRE(views_are_equal(field,field_deep));
+      // Check that prefetching the data does not change the answer
+      REQUIRE(views_are_equal(time_interpolator.get_field(name),time_interpolator_prefetch.get_field(name)));
     }
 
   }
 
+  // Check which mode actually ran: with async IO, every time slice after the
+  // first two comes from the prefetched data, otherwise none does.
+  if (time_interpolator_prefetch.is_prefetching()) {
+    REQUIRE(time_interpolator_prefetch.num_prefetched_slices()>0);
+  } else {
+    REQUIRE(time_interpolator_prefetch.num_prefetched_slices()==0);
+  }
 
   time_interpolator.finalize();
   time_interpolator_deep.finalize();
+  time_interpolator_prefetch.finalize();
   printf("                        ... DONE\n");
 
   // All done with IO
@@ -6,6 +6,7 @@
 #include "share/field/field_header.hpp"
 #include "share/field/field.hpp"
 #include "share/field/field_manager.hpp"
+#include "share/field/field_memory_planner.hpp"
 #include "share/field/field_utils.hpp"
 #include "share/util/scream_setup_random_test.hpp"
 
@@ -106,6 +107,17 @@ TEST_CASE("field_tracking", "") {
 
   // Cannot rewind time (yet)
   REQUIRE_THROWS  (track.update_time_stamp(time1));
+
+  // The update counter is independent of the time stamp, and propagates to children
+  auto parent = create_tracking();
+  auto child  = create_tracking();
+  child->create_parent_child_link(parent);
+  REQUIRE (parent->get_version()==0);
+  parent->increment_version();
+  parent->increment_version();
+  child->increment_version();
+  REQUIRE (parent->get_version()==2);
+  REQUIRE (child->get_version()==3);
 }
 
 TEST_CASE("field", "") {
@@ -528,6 +540,97 @@ TEST_CASE("field_mgr", "") {
   REQUIRE (views_are_equal(f4_sf,f4.get_component(subview_slice)));
 }
 
+TEST_CASE("field_memory_planner", "") {
+  using namespace scream;
+  using namespace ekat::units;
+  using namespace ShortFieldTagsNames;
+
+  SECTION ("planner") {
+    FieldMemoryPlanner mp(16);
+
+    // Lifetimes: a=[0,1], b=[1,2], c=[2,3], d=[3,3]
+    mp.add_transient_field("a",64,0,1);
+    mp.add_transient_field("b",32,1,2);
+    mp.add_transient_field("c",64,2,3);
+    mp.add_transient_field("d",20,3,3);
+    mp.add_persistent_field("p",100);
+    REQUIRE_THROWS (mp.add_persistent_field("a",10)); // Already added
+    REQUIRE_THROWS (mp.add_transient_field("e",10,2,1)); // Invalid lifetime
+    REQUIRE_THROWS (mp.get_offset("a"));  // Not planned yet
+
+    mp.plan();
+    REQUIRE_THROWS (mp.add_transient_field("e",10,0,1));
+    REQUIRE_THROWS (mp.get_offset("p")); // Not transient
+
+    // Largest first: a and c can share, b goes after a, d after c
+    REQUIRE (mp.get_offset("a")==0);
+    REQUIRE (mp.get_offset("c")==0);
+    REQUIRE (mp.get_offset("b")==64);
+    REQUIRE (mp.get_offset("d")==64);
+    REQUIRE (mp.arena_bytes()==96);
+
+    REQUIRE (mp.peak_bytes_before()==280);
+    REQUIRE (mp.peak_bytes_after()==196);
+  }
+
+  SECTION ("field_mgr") {
+    const int ncols = 4;
+    const int nlevs = 7;
+
+    ekat::Comm comm(MPI_COMM_WORLD);
+    auto pg = create_point_grid("phys",ncols*comm.size(),nlevs,comm);
+    const auto layout = pg->get_3d_scalar_layout(true);
+
+    FieldIdentifier fid1("f1",layout,m/s,"phys");
+    FieldIdentifier fid2("f2",layout,m/s,"phys");
+    FieldIdentifier fid3("f3",layout,m/s,"phys");
+    FieldIdentifier fid4("f4",layout,m/s,"phys");
+    FieldIdentifier fid5("f5",layout,m/s,"phys");
+
+    FieldManager fm(pg);
+    REQUIRE_THROWS (fm.set_field_lifetimes({}));  // Registration not open
+    fm.registration_begins();
+    fm.register_field(FieldRequest(fid1));
+    fm.register_field(FieldRequest(fid2));
+    fm.register_field(FieldRequest(fid3));
+    fm.register_field(FieldRequest(fid4));
+    fm.register_field(FieldRequest(fid5,"group"));
+
+    std::map<std::string,FieldLifetime> lifetimes;
+    lifetimes["f1"] = {0,1,false};
+    lifetimes["f2"] = {2,3,false};
+    lifetimes["f3"] = {-1,3,true};  // Needed from prev step
+    lifetimes["f4"] = {2,3,false};
+    lifetimes["f5"] = {0,1,false};  // In a group
+    fm.set_field_lifetimes(lifetimes,{"f4"});
+    fm.registration_ends();
+
+    const auto& mp = fm.get_memory_planner();
+    REQUIRE (mp.is_planned());
+    REQUIRE (mp.is_transient("f1"));
+    REQUIRE (mp.is_transient("f2"));
+    REQUIRE (not mp.is_transient("f3"));
+    REQUIRE (not mp.is_transient("f4"));
+    REQUIRE (not mp.is_transient("f5"));
+
+    auto f1 = fm.get_field("f1");
+    auto f2 = fm.get_field("f2");
+    auto f3 = fm.get_field("f3");
+    REQUIRE (f1.get_internal_view_data<Real>()==f2.get_internal_view_data<Real>());
+    REQUIRE (f1.get_internal_view_data<Real>()!=f3.get_internal_view_data<Real>());
+    REQUIRE (mp.peak_bytes_after()<mp.peak_bytes_before());
+
+    // Transient fields are regular fields otherwise
+    f1.deep_copy(1.0);
+    f2.deep_copy(2.0);
+    f3.deep_copy(3.0);
+    f1.sync_to_host();
+    REQUIRE (f1.get_view<Real**,Host>()(0,0)==2.0);
+    f3.sync_to_host();
+    REQUIRE (f3.get_view<Real**,Host>()(0,0)==3.0);
+  }
+}
+
 TEST_CASE("tracers_bundle", "") {
   using namespace scream;
   using namespace ekat::units;
@@ -279,6 +279,32 @@ TEST_CASE("utils") {
     REQUIRE_THROWS(field_sum<wrong_real>(f1));
     REQUIRE_THROWS(frobenius_norm<wrong_real>(f1));
   }
+
+  SECTION ("needed_every") {
+    // No declarations: always needed
+    REQUIRE (is_field_needed(f1,0));
+    REQUIRE (is_field_needed(f1,7));
+
+    REQUIRE_THROWS (declare_field_needed_every(f1,"a",0));
+
+    // Declarations are shared by copies of the field
+    auto f1_copy = f1;
+    declare_field_needed_every(f1_copy,"a",4);
+    declare_field_needed_every(f1,"b",6);
+    for (int n=0; n<24; ++n) {
+      REQUIRE (is_field_needed(f1,n)==(n%4==0 or n%6==0));
+    }
+
+    // A consumer can override its own declaration, but not the other ones
+    declare_field_needed_every(f1,"a",1);
+    for (int n=0; n<24; ++n) {
+      REQUIRE (is_field_needed(f1,n));
+    }
+    declare_field_needed_every(f1,"a",8);
+    for (int n=0; n<24; ++n) {
+      REQUIRE (is_field_needed(f1,n)==(n%8==0 or n%6==0));
+    }
+  }
 }
 
 TEST_CASE ("print_field_hyperslab") {
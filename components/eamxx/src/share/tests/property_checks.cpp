@@ -5,6 +5,7 @@
 #include "share/property_checks/field_lower_bound_check.hpp"
 #include "share/property_checks/field_upper_bound_check.hpp"
 #include "share/property_checks/field_nan_check.hpp"
+#include "share/property_checks/field_checks_batch.hpp"
 #include "share/util/scream_setup_random_test.hpp"
 #include "share/grid/point_grid.hpp"
 #include "share/field/field_utils.hpp"
@@ -311,6 +312,63 @@ TEST_CASE("property_checks", "") {
       REQUIRE(f_data[i] == 1.0);
     }
   }
+
+  // Check that fused checks give the same result as the individual ones
+  SECTION ("field_checks_batch") {
+    auto nan_check = std::make_shared<FieldNaNCheck>(f,grid);
+    auto interval_check = std::make_shared<FieldWithinIntervalCheck>(f, grid, 0, 1, true);
+    auto lb_check = std::make_shared<FieldLowerBoundCheck>(data,grid,0,false);
+    auto ub_check = std::make_shared<FieldUpperBoundCheck>(data,grid,0.5,false);
+
+    FieldChecksBatch batch;
+    REQUIRE (batch.add_check(nan_check));
+    REQUIRE (batch.add_check(interval_check));
+    REQUIRE (batch.add_check(lb_check));
+    REQUIRE (batch.add_check(ub_check));
+    REQUIRE_THROWS (batch.run());
+    batch.setup();
+    REQUIRE (batch.num_checks()==4);
+    REQUIRE_THROWS (batch.add_check(nan_check));
+
+    auto check_batch = [&]() {
+      batch.run();
+      REQUIRE (batch.passed(0)==(nan_check->check().result==CheckResult::Pass));
+      REQUIRE (batch.passed(1)==(interval_check->check().result==CheckResult::Pass));
+      REQUIRE (batch.passed(2)==(lb_check->check().result==CheckResult::Pass));
+      REQUIRE (batch.passed(3)==(ub_check->check().result==CheckResult::Pass));
+    };
+
+    // All pass, except the upper bound check on data (which is 1.0)
+    f.deep_copy(0.5);
+    check_batch();
+    REQUIRE (not batch.passed(3));
+
+    // One out-of-bounds value
+    auto f_view = f.get_strided_view<Real***,Host>();
+    f_view(1,2,3) = 2.0;
+    f.sync_to_dev();
+    check_batch();
+    REQUIRE (batch.passed(0));
+    REQUIRE (not batch.passed(1));
+
+    // A NaN value. Note: the batch flags NaN as out of bounds too, so that the
+    // full interval check is run on the field
+    f_view(0,1,2) = std::numeric_limits<Real>::quiet_NaN();
+    f.sync_to_dev();
+    batch.run();
+    REQUIRE (not batch.passed(0));
+    REQUIRE (not batch.passed(1));
+    REQUIRE (nan_check->check().result==CheckResult::Fail);
+
+    // Fix the data field
+    f.deep_copy(0.5);
+    data.deep_copy(0.25);
+    check_batch();
+    REQUIRE (batch.passed(0));
+    REQUIRE (batch.passed(1));
+    REQUIRE (batch.passed(2));
+    REQUIRE (batch.passed(3));
+  }
 }
 
 } // anonymous namespace
@@ -1,6 +1,7 @@
 #include <catch2/catch.hpp>
 
 #include "share/util/scream_array_utils.hpp"
+#include "share/util/eamxx_fused_index_space.hpp"
 #include "share/util/scream_universal_constants.hpp"
 #include "share/util/scream_utils.hpp"
 #include "share/util/scream_time_stamp.hpp"
@@ -250,3 +251,50 @@ TEST_CASE ("array_utils") {
     }
   }
 }
+
+TEST_CASE ("find_segment") {
+  using namespace scream;
+
+  // Segments of sizes 3, 0, 2, 0, 0, 4 (empty segments must never be returned)
+  std::vector<int> offsets = {0, 3, 3, 5, 5, 5, 9};
+  const int nsegs = offsets.size()-1;
+  std::vector<int> expected = {0,0,0, 2,2, 5,5,5,5};
+  for (int idx=0; idx<offsets.back(); ++idx) {
+    REQUIRE (find_segment(offsets.data(),nsegs,idx)==expected[idx]);
+  }
+}
+
+TEST_CASE ("strided_data") {
+  using namespace scream;
+
+  // A 2x3x4 array, padded to 5 along the last dim
+  StridedData<const Real> sd;
+  sd.rank = 3;
+  sd.extents[0] = 2; sd.extents[1] = 3; sd.extents[2] = 4;
+  sd.strides[0] = 15; sd.strides[1] = 5; sd.strides[2] = 1;
+
+  REQUIRE (sd.size()==24);
+  REQUIRE (sd.size(1)==12);
+  for (int i=0; i<2; ++i) {
+    for (int j=0; j<3; ++j) {
+      for (int k=0; k<4; ++k) {
+        REQUIRE (sd.offset(i*12+j*4+k)==i*15+j*5+k);
+        REQUIRE (sd.offset(j*4+k,1)==j*5+k);
+      }
+    }
+  }
+}
+
+TEST_CASE ("fnv1a_hash") {
+  using namespace scream;
+
+  // Reference values of the 64-bit FNV-1a hash
+  const std::string a = "a", foobar = "foobar";
+  REQUIRE (fnv1a_hash(nullptr,0)==0xcbf29ce484222325ULL);
+  REQUIRE (fnv1a_hash(a.data(),a.size())==0xaf63dc4c8601ec8cULL);
+  REQUIRE (fnv1a_hash(foobar.data(),foobar.size())==0x85944171f73967e8ULL);
+
+  // Hashing in chunks is the same as hashing all at once
+  REQUIRE (fnv1a_hash(foobar.data()+3,3,fnv1a_hash(foobar.data(),3))==
+           fnv1a_hash(foobar.data(),foobar.size()));
+}
@@ -0,0 +1,134 @@
+#ifndef EAMXX_FUSED_INDEX_SPACE_HPP
+#define EAMXX_FUSED_INDEX_SPACE_HPP
+
+#include "share/field/field.hpp"
+#include "share/util/scream_array_utils.hpp"
+#include "share/scream_types.hpp"
+
+#include <ekat/ekat_assert.hpp>
+
+#include <vector>
+
+namespace scream {
+
+/*
+ * Utilities for kernels that process several fields (of different sizes) at once
+ *
+ * Instead of launching one kernel per field, we concatenate the index spaces
+ * of all fields in a single "fused" index space, where entry i covers the
+ * indices [offsets(i),offsets(i+1)), and launch one kernel over it. Inside the
+ * kernel, find_segment (see scream_array_utils.hpp) gives the entry to process.
+ *
+ * The field data is accessed via the view strides (rather than assuming it is
+ * contiguous), to handle padded fields and subfields.
+ */
+
+// Pointer and strides of a field view, to access its data as a flat array
+template<typename ST>
+struct StridedData {
+  static constexpr int MaxRank = 6;
+
+  ST*         data = nullptr;
+  int         rank = 0;
+  int         extents[MaxRank];
+  long long   strides[MaxRank];
+
+  // Number of entries spanned by the dims [first_dim,rank)
+  KOKKOS_INLINE_FUNCTION
+  int size (const int first_dim = 0) const {
+    int s = 1;
+    for (int d=first_dim; d<rank; ++d) {
+      s *= extents[d];
+    }
+    return s;
+  }
+
+  // Offset in data of the i-th entry (in LayoutRight order) of the dims [first_dim,rank)
+  KOKKOS_INLINE_FUNCTION
+  long long offset (int i, const int first_dim = 0) const {
+    long long off = 0;
+    for (int d=rank-1; d>=first_dim; --d) {
+      off += (i % extents[d])*strides[d];
+      i /= extents[d];
+    }
+    return off;
+  }
+};
+
+// Get pointer and strides of the device view of a field (of Real data, and rank<=6).
+// Note: rank-1 fields use get_strided_view, to allow them to be
+//       subfields of a 2d field along the 2nd dimension.
+template<typename ST>
+StridedData<ST> get_strided_data (const Field& f)
+{
+  const auto& layout = f.get_header().get_identifier().get_layout();
+  EKAT_REQUIRE_MSG (layout.rank()<=StridedData<ST>::MaxRank,
+      "Error! Field rank not supported by get_strided_data.\n"
+      "  - field name: " + f.name() + "\n"
+      "  - field rank: " + std::to_string(layout.rank()) + "\n");
+
+  StridedData<ST> sd;
+  sd.rank = layout.rank();
+  auto set_ptr_and_strides = [&](const auto& v) {
+    for (int d=0; d<sd.rank; ++d) {
+      sd.extents[d] = layout.dim(d);
+      sd.strides[d] = v.stride(d);
+    }
+    sd.data = v.data();
+  };
+  switch (sd.rank) {
+    case 0: sd.data = f.get_internal_view_data<ST>();           break;
+    case 1: set_ptr_and_strides(f.get_strided_view<ST*>());     break;
+    case 2: set_ptr_and_strides(f.get_view<ST**>());            break;
+    case 3: set_ptr_and_strides(f.get_view<ST***>());           break;
+    case 4: set_ptr_and_strides(f.get_view<ST****>());          break;
+    case 5: set_ptr_and_strides(f.get_view<ST*****>());         break;
+    case 6: set_ptr_and_strides(f.get_view<ST******>());        break;
+  }
+  return sd;
+}
+
+// The concatenation of the index spaces of a list of entries
+template<typename EntryType>
+struct FusedIndexSpace {
+  using KT = KokkosTypes<DefaultDevice>;
+
+  typename KT::template view_1d<EntryType>  entries;
+  typename KT::template view_1d<int>        offsets;
+  int                                       size = 0;
+
+  // Copy entries to device, and compute the offsets of each entry in the fused index space
+  void setup (const std::vector<EntryType>& entries_in, const std::vector<int>& sizes) {
+    EKAT_REQUIRE_MSG (entries_in.size()==sizes.size(),
+        "Error! Number of entries and sizes do not match in FusedIndexSpace::setup.\n");
+
+    const int n = entries_in.size();
+    entries = decltype(entries)("",n);
+    offsets = decltype(offsets)("",n+1);
+    auto entries_h = Kokkos::create_mirror_view(entries);
+    auto offsets_h = Kokkos::create_mirror_view(offsets);
+    offsets_h(0) = 0;
+    for (int i=0; i<n; ++i) {
+      entries_h(i) = entries_in[i];
+      offsets_h(i+1) = offsets_h(i) + sizes[i];
+    }
+    Kokkos::deep_copy(entries,entries_h);
+    Kokkos::deep_copy(offsets,offsets_h);
+    size = offsets_h(n);
+  }
+
+  int num_entries () const { return entries.extent(0); }
+
+  // Get the index of the entry covering the given index of the fused index space,
+  // as well as the index local to that entry
+  KOKKOS_INLINE_FUNCTION
+  int find (const int idx, int& local_idx) const {
+    const int ie = find_segment(offsets.data(),entries.extent(0),idx);
+    local_idx = idx - offsets(ie);
+    return ie;
+  }
+};
+
+} // namespace scream
+
+#endif // EAMXX_FUSED_INDEX_SPACE_HPP
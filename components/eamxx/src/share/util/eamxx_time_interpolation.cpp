@@ -22,16 +22,32 @@ TimeInterpolation::TimeInterpolation(
 /*-----------------------------------------------------------------------------------------------*/
 TimeInterpolation::TimeInterpolation(
   const grid_ptr_type& grid, 
-  const vos_type& list_of_files
+  const vos_type& list_of_files,
+  const bool prefetch
 ) : TimeInterpolation(grid)
 {
   set_file_data_triplets(list_of_files);
   m_is_data_from_file = true;
+
+  // Prefetching relies on the scorpio IO thread. If async IO is not available,
+  // simply read data synchronously.
+  m_prefetch = prefetch and scorpio::async_io_supported();
+  if (m_prefetch) {
+    m_fm_prefetch = std::make_shared<FieldManager>(grid);
+    m_fm_prefetch->registration_begins();
+    m_fm_prefetch->registration_ends();
+  }
 }
 /*-----------------------------------------------------------------------------------------------*/
 void TimeInterpolation::finalize()
 {
   if (m_is_data_from_file) {
+    // Make sure no read is still in flight
+    if (m_prefetch_pending.valid()) {
+      scorpio::wait_async_job(m_prefetch_pending);
+      m_prefetch_pending = {};
+    }
+    m_prefetch_atm_input = nullptr;
     m_file_data_atm_input = nullptr;
     m_is_data_from_file = false;
   }
@@ -98,6 +114,9 @@ void TimeInterpolation::add_field(const Field& field_in, const bool store_shallo
   auto field1 = field_in.clone();
   m_fm_time0->add_field(field0);
   m_fm_time1->add_field(field1);
+  if (m_prefetch) {
+    m_fm_prefetch->add_field(field_in.clone());
+  }
   if (store_shallow_copy) {
     // Then we want to store the actual field_in and override it when interpolating
     m_interp_fields.emplace(name,field_in);
@@ -348,39 +367,126 @@ void TimeInterpolation::set_file_data_triplets(const vos_type& list_of_files) {
 void TimeInterpolation::read_data()
 {
   const auto triplet_curr = m_file_data_triplets[m_triplet_idx];
-  if (not m_file_data_atm_input or triplet_curr.filename != m_file_data_atm_input->get_filename()) {
-    // Then we need to close this input stream and open a new one
+  if (not finish_prefetch()) {
+    if (not m_file_data_atm_input or triplet_curr.filename != m_file_data_atm_input->get_filename()) {
+      // Then we need to close this input stream and open a new one
+      ekat::ParameterList input_params;
+      input_params.set("Field Names",m_field_names);
+      input_params.set("Filename",triplet_curr.filename);
+      m_file_data_atm_input = std::make_shared<AtmosphereInput>(input_params,m_fm_time1);
+      m_file_data_atm_input->set_logger(m_logger);
+      // Also determine the FillValue, if used
+      set_fill_values(m_fm_time1,triplet_curr.filename);
+    }
+
+    if (m_logger) {
+      m_logger->info(m_header);
+      m_logger->info("[EAMxx:time_interpolation] Reading data at time " + triplet_curr.timestamp.to_string());
+    }
+    m_file_data_atm_input->read_variables(triplet_curr.time_idx);
+  }
+  m_time1 = triplet_curr.timestamp;
+
+  // Start reading the next time slice, while the model uses the current interval
+  if (m_prefetch) {
+    start_prefetch(m_triplet_idx+1);
+  }
+}
+/*-----------------------------------------------------------------------------------------------*/
+/* Function to set the mask value of all fields in a field manager, using the FillValue
+ * attribute of the corresponding variables in the given file.
+ */
+void TimeInterpolation::set_fill_values(const fm_type& fm, const std::string& filename)
+{
+  // TODO: Should we make it possible to check if FillValue is in the metadata and only assign mask_value if it is?
+  for (auto& name : m_field_names) {
+    auto& field = fm->get_field(name);
+    const auto dt = field.data_type();
+    if (dt==DataType::FloatType) {
+      auto var_fill_value = scorpio::get_attribute<float>(filename,name,"_FillValue");
+      field.get_header().set_extra_data("mask_value",var_fill_value);
+    } else if (dt==DataType::DoubleType) {
+      auto var_fill_value = scorpio::get_attribute<double>(filename,name,"_FillValue");
+      field.get_header().set_extra_data("mask_value",var_fill_value);
+    } else {
+      EKAT_ERROR_MSG (
+          "[TimeInterpolation] Unexpected/unsupported field data type.\n"
+          " - field name: " + field.name() + "\n"
+          " - data type : " + e2str(dt) + "\n");
+    }
+  }
+}
+/*-----------------------------------------------------------------------------------------------*/
+/* Function to start reading the data of a DataFromFileTriplet in the background, in the
+ * prefetch fields. Only host buffers are filled by the IO thread. The copy to the fields
+ * (and device) happens in finish_prefetch, on the main thread.
+ * Input:
+ *   triplet_idx - The index of the triplet to prefetch. Nothing is done if out of bounds.
+ */
+void TimeInterpolation::start_prefetch(const int triplet_idx)
+{
+  if (triplet_idx>=static_cast<int>(m_file_data_triplets.size())) {
+    return;
+  }
+
+  const auto& triplet = m_file_data_triplets[triplet_idx];
+  if (not m_prefetch_atm_input or triplet.filename != m_prefetch_atm_input->get_filename()) {
     ekat::ParameterList input_params;
     input_params.set("Field Names",m_field_names);
-    input_params.set("Filename",triplet_curr.filename);
-    m_file_data_atm_input = std::make_shared<AtmosphereInput>(input_params,m_fm_time1);
-    m_file_data_atm_input->set_logger(m_logger);
-    // Also determine the FillValue, if used
-    // TODO: Should we make it possible to check if FillValue is in the metadata and only assign mask_value if it is?
-    for (auto& name : m_field_names) {
-      auto& field = m_fm_time1->get_field(name);
-      const auto dt = field.data_type();
-      if (dt==DataType::FloatType) {
-        auto var_fill_value = scorpio::get_attribute<float>(triplet_curr.filename,name,"_FillValue");
-        field.get_header().set_extra_data("mask_value",var_fill_value);
-      } else if (dt==DataType::DoubleType) {
-        auto var_fill_value = scorpio::get_attribute<double>(triplet_curr.filename,name,"_FillValue");
-        field.get_header().set_extra_data("mask_value",var_fill_value);
-      } else {
-        EKAT_ERROR_MSG (
-            "[TimeInterpolation] Unexpected/unsupported field data type.\n"
-            " - field name: " + field.name() + "\n"
-            " - data type : " + e2str(dt) + "\n");
-      }
-    }
+    input_params.set("Filename",triplet.filename);
+    m_prefetch_atm_input = std::make_shared<AtmosphereInput>(input_params,m_fm_prefetch);
+    m_prefetch_atm_input->set_logger(m_logger);
   }
+  // The prefetch fields were swapped in from time1 (possibly from another file), so
+  // always reset their FillValue
+  set_fill_values(m_fm_prefetch,triplet.filename);
 
   if (m_logger) {
     m_logger->info(m_header);
-    m_logger->info("[EAMxx:time_interpolation] Reading data at time " + triplet_curr.timestamp.to_string());
+    m_logger->info("[EAMxx:time_interpolation] Prefetching data at time " + triplet.timestamp.to_string());
   }
-  m_file_data_atm_input->read_variables(triplet_curr.time_idx);
-  m_time1 = triplet_curr.timestamp;
+
+  m_prefetch_pending = m_prefetch_atm_input->enqueue_read_variables(triplet.time_idx);
+  m_prefetch_triplet_idx = triplet_idx;
+}
+/*-----------------------------------------------------------------------------------------------*/
+/* Function to complete a pending prefetch (blocking only if the read is not done yet).
+ * If the prefetched triplet is the current one, the prefetched data is swapped into time1.
+ * Output:
+ *   true if the prefetched data was used, false otherwise (e.g., no prefetch was pending,
+ *   or the model jumped past the prefetched triplet, in which case the data is discarded).
+ */
+bool TimeInterpolation::finish_prefetch()
+{
+  if (not m_prefetch_pending.valid()) {
+    return false;
+  }
+
+  // Only wait for the prefetch reads, not for other jobs enqueued after them
+  scorpio::wait_async_job(m_prefetch_pending);
+  m_prefetch_pending = {};
+
+  if (m_prefetch_triplet_idx!=m_triplet_idx) {
+    return false;
+  }
+
+  m_prefetch_atm_input->copy_host_data_to_fields();
+  for (const auto& name : m_field_names) {
+    auto& field1 = m_fm_time1->get_field(name);
+    auto& fieldp = m_fm_prefetch->get_field(name);
+    std::swap(field1,fieldp);
+  }
+  // Both input streams store views of their fields, which were just swapped
+  m_prefetch_atm_input->set_field_manager(m_fm_prefetch);
+  m_file_data_atm_input->set_field_manager(m_fm_time1);
+  ++m_num_prefetched_slices;
+
+  if (m_logger) {
+    m_logger->info(m_header);
+    m_logger->info("[EAMxx:time_interpolation] Using prefetched data at time "
+                   + m_file_data_triplets[m_triplet_idx].timestamp.to_string());
+  }
+  return true;
 }
 /*-----------------------------------------------------------------------------------------------*/
 /* Function to check the current set of interpolation data against a timestamp and, if needed,
@@ -10,6 +10,8 @@
 
 #include "share/io/scorpio_input.hpp"
 
+#include <future>
+
 namespace scream{
 namespace util {
 
@@ -22,7 +24,11 @@ public:
   // Constructors & Destructor
   TimeInterpolation() = default;
   TimeInterpolation(const grid_ptr_type& grid);
-  TimeInterpolation(const grid_ptr_type& grid, const vos_type& list_of_files);
+  // If prefetch=true, the next time slice is read in the background (on the IO thread)
+  // while the current data interval is being used, and it is swapped in when the model
+  // crosses into the next interval. Requires scorpio::async_io_supported().
+  TimeInterpolation(const grid_ptr_type& grid, const vos_type& list_of_files,
+                    const bool prefetch = false);
   ~TimeInterpolation () = default;
 
   // Running the interpolation
@@ -44,6 +50,10 @@ public:
 
   // Informational
   void print();
+  // Whether the next time slice is prefetched (false if async IO is not supported),
+  // and how many time slices were taken from prefetched data so far
+  bool is_prefetching () const { return m_prefetch; }
+  int num_prefetched_slices () const { return m_num_prefetched_slices; }
 
   // Option to add a logger
   void set_logger(const std::shared_ptr<ekat::logger::LoggerBase>& logger,
@@ -75,6 +85,11 @@ protected:
   void set_file_data_triplets(const vos_type& list_of_files);
   void read_data();
   void check_and_update_data(const TimeStamp& ts_in);
+  void set_fill_values(const fm_type& fm, const std::string& filename);
+
+  // For the case where the next time slice is prefetched
+  void start_prefetch(const int triplet_idx);
+  bool finish_prefetch();
 
   // Local field managers used to store two time snaps of data for interpolation
   fm_type  m_fm_time0;
@@ -92,6 +107,15 @@ protected:
   std::shared_ptr<AtmosphereInput>           m_file_data_atm_input;
   bool                                       m_is_data_from_file=false;
 
+  // Variables related to the prefetch of the next time slice. The prefetched data
+  // is read in a third set of fields, which is swapped with time1 at the boundary.
+  bool                                       m_prefetch=false;
+  fm_type                                    m_fm_prefetch;
+  std::shared_ptr<AtmosphereInput>           m_prefetch_atm_input;
+  int                                        m_prefetch_triplet_idx=-1;
+  std::shared_future<void>                   m_prefetch_pending;
+  int                                        m_num_prefetched_slices=0;
+
   std::shared_ptr<ekat::logger::LoggerBase>  m_logger;
   std::string                                m_header;
 }; // class TimeInterpolation
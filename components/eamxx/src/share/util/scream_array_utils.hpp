@@ -173,6 +173,30 @@ void unflatten_idx (const int idx, const Kokkos::View<int*,Kokkos::LayoutRight,P
   }
 }
 
+// Given the offsets of N consecutive segments of a 1d index space (so that segment
+// i covers [offsets[i],offsets[i+1])), find the segment containing the index idx.
+// Useful for kernels that process several arrays (of different sizes) at once
+// (see FusedIndexSpace in eamxx_fused_index_space.hpp).
+// NOTE: empty segments (offsets[i]==offsets[i+1]) are never returned.
+KOKKOS_INLINE_FUNCTION
+int find_segment (const int* offsets, const int nsegments, const int idx)
+{
+  EKAT_KERNEL_ASSERT_MSG (idx>=offsets[0] && idx<offsets[nsegments],
+      "Error! Index out of bounds in find_segment.\n");
+
+  int lo = 0;
+  int hi = nsegments;
+  while (hi-lo>1) {
+    const int mid = (lo+hi)/2;
+    if (offsets[mid]<=idx) {
+      lo = mid;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
 } // namespace scream
 
 #endif // SCREAM_ARRAY_UTILS_HPP
@@ -7,6 +7,7 @@
 #include <ekat/kokkos/ekat_kokkos_types.hpp>
 #include <ekat/mpi/ekat_comm.hpp>
 
+#include <cstdint>
 #include <iterator>
 #include <list>
 #include <algorithm>
@@ -56,6 +57,21 @@ inline void broadcast_string (std::string& s, const ekat::Comm& comm, const int
   comm.broadcast(&s.front(),size,root);
 }
 
+// 64-bit FNV-1a hash of a sequence of bytes. Unlike std::hash, the result does not
+// depend on the platform/compiler, so it can be stored in files (e.g., as a checksum).
+// To hash several buffers, pass the hash of the previous ones as seed.
+inline std::uint64_t fnv1a_hash (const void* data, const std::size_t nbytes,
+                                 const std::uint64_t seed = 14695981039346656037ULL)
+{
+  auto bytes = reinterpret_cast<const unsigned char*>(data);
+  std::uint64_t h = seed;
+  for (std::size_t i=0; i<nbytes; ++i) {
+    h ^= bytes[i];
+    h *= 1099511628211ULL;
+  }
+  return h;
+}
+
 // Utility function, to work around a funcky gcc8+cuda10 issue,
 // where calling sort() on a length-2 list returns a length-1 list.
 template<typename T>
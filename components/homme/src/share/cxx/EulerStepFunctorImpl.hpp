@@ -113,6 +113,16 @@ class EulerStepFunctorImpl {
   std::shared_ptr<BoundaryExchange> m_mm_be, m_mmqb_be;
   Kokkos::Array<std::shared_ptr<BoundaryExchange>, 3*Q_NUM_TIME_LEVELS> m_bes;
 
+  // If true, advect_and_limit is run first on the elements with connections on other
+  // ranks, then on the interior ones, overlapping the latter with the DSS messages.
+  // m_elems is the list of elements processed by the kernel being launched (empty means all).
+  // The overlap can be disabled via SimulationParams::overlap_bndry_exchange (m_overlap_allowed).
+  bool                          m_overlap_allowed;
+  bool                          m_overlap_exchange;
+  ExecViewUnmanaged<const int*> m_boundary_elems;
+  ExecViewUnmanaged<const int*> m_interior_elems;
+  ExecViewUnmanaged<const int*> m_elems;
+
   enum { m_mem_per_team = 2 * NP * NP * sizeof(Real) };
 
 public:
@@ -130,6 +140,8 @@ public:
    , m_tu_ne_qsize   (Homme::get_default_team_policy<ExecSpace>(1))
    , m_prev_num_elems(0)
    , m_prev_qsize    (0)
+   , m_overlap_allowed(true)
+   , m_overlap_exchange(false)
   {
     m_kernel_will_run_limiters = false;
     m_tpref.prefer_larger_team = true;
@@ -142,6 +154,8 @@ public:
     , m_tu_ne_qsize   (Homme::get_default_team_policy<ExecSpace>(1))
     , m_prev_num_elems(0)
     , m_prev_qsize    (0)
+    , m_overlap_allowed(true)
+    , m_overlap_exchange(false)
   {}
 
   void setup ()
@@ -165,6 +179,7 @@ public:
     m_data.nu_p = params.nu_p;
     m_data.nu_q = params.nu_q;
     m_data.consthv = (params.hypervis_scaling == 0);
+    m_overlap_allowed = params.overlap_bndry_exchange;
 
     if (m_data.limiter_option == 4) {
       std::string msg = "[EulerStepFunctorImpl::reset]:";
@@ -271,8 +286,19 @@ public:
       be.register_min_max_fields(m_tracers.qlim, m_data.qsize, 0);
       be.registration_completed();
     }
+
+    // Overlapping the DSS with advect_and_limit only pays off if there are both
+    // boundary and interior elements
+    const auto& connectivity = *m_bes[0]->get_connectivity();
+    m_boundary_elems = connectivity.get_d_boundary_elements();
+    m_interior_elems = connectivity.get_d_interior_elements();
+    m_overlap_exchange = connectivity.get_num_boundary_elements()>0 &&
+                         connectivity.get_num_interior_elements()>0;
   }
 
+  // Whether euler_step overlaps the qdp DSS with the interior elements computation
+  bool overlaps_exchange () const { return m_overlap_allowed && m_overlap_exchange; }
+
   static size_t limiter_team_shmem_size (const int team_size) {
     return Memory<ExecSpace>::on_gpu ?
       (team_size * m_mem_per_team) :
@@ -434,15 +460,43 @@ public:
     profiling_pause();
   }
 
+  // Same as advect_and_limit, but only on the elements in elems
+  void advect_and_limit (const ExecViewUnmanaged<const int*>& elems) {
+    profiling_resume();
+    run_on_elements<AALSetupPhase>(elems, 1);
+    Kokkos::fence();
+    m_kernel_will_run_limiters = true;
+    run_on_elements<AALTracerPhase>(elems, m_data.qsize);
+    Kokkos::fence();
+    m_kernel_will_run_limiters = false;
+    profiling_pause();
+  }
+
+  // Launch the kernel Tag on the elements in elems (with num_per_elem teams per element),
+  // using the same team/vector sizes of a launch over all the elements, since the team
+  // utils (and the scratch buffers) were sized for those
+  template<typename Tag>
+  void run_on_elements (const ExecViewUnmanaged<const int*>& elems, const int num_per_elem) {
+    const auto full_policy = Homme::get_default_team_policy<ExecSpace, Tag>(
+        m_geometry.num_elems() * num_per_elem, m_tpref);
+    Kokkos::TeamPolicy<ExecSpace, Tag> policy(elems.extent_int(0) * num_per_elem,
+                                              full_policy.team_size(),
+                                              full_policy.impl_vector_length());
+    policy.set_chunk_size(1);
+    auto functor = *this;
+    functor.m_elems = elems;
+    Kokkos::parallel_for(policy, functor);
+  }
+
   KOKKOS_INLINE_FUNCTION
   void operator() (const AALSetupPhase&, const TeamMember& team) const {
-    KernelVariables kv(team, m_tu_ne);
+    KernelVariables kv(team, m_elems, m_tu_ne);
     run_setup_phase(kv);
   }
 
   KOKKOS_INLINE_FUNCTION
   void operator() (const AALTracerPhase&, const TeamMember& team) const {
-    KernelVariables kv(team, m_data.qsize, m_tu_ne_qsize);
+    KernelVariables kv(team, m_data.qsize, m_elems, m_tu_ne_qsize);
     run_tracer_phase(kv);
   }
 
@@ -607,6 +661,25 @@ public:
     GPTLstop("eus_bexch");
   }
 
+  // Advect and limit the boundary elements, send their data, then advect and
+  // limit the interior elements while messages are in flight, and finally unpack
+  void advect_and_limit_and_exchange_overlapped () {
+    const int idx = 3*m_data.np1_qdp + static_cast<int>(m_data.DSSopt);
+    auto& be = *m_bes[idx];
+
+    advect_and_limit(m_boundary_elems);
+
+    GPTLstart("eus_bexch");
+    be.pack_and_send_shared();
+    GPTLstop("eus_bexch");
+
+    advect_and_limit(m_interior_elems);
+
+    GPTLstart("eus_bexch");
+    be.recv_and_unpack(m_geometry.m_rspheremp);
+    GPTLstop("eus_bexch");
+  }
+
   void euler_step(const int np1_qdp, const int n0_qdp, const Real dt,
                   const Real rhs_multiplier, const DSSOption DSSopt) {
 
@@ -652,8 +725,12 @@ public:
         minmax_and_biharmonic();
       }
     }
-    advect_and_limit();
-    exchange_qdp_dss_var();
+    if (overlaps_exchange()) {
+      advect_and_limit_and_exchange_overlapped();
+    } else {
+      advect_and_limit();
+      exchange_qdp_dss_var();
+    }
   }
 
 private:
@@ -106,6 +106,29 @@ public:
     // Nothing to be done here
   }
 
+  // Same as the two constructors above, but the league rank is mapped to an element
+  // via the list elems, so that a kernel can be launched on a subset of the elements
+  // (e.g., the boundary or interior ones). If elems is empty, all elements are processed.
+  KOKKOS_INLINE_FUNCTION
+  KernelVariables(const TeamMember &team_in, const ExecViewUnmanaged<const int*>& elems,
+                  const TeamUtils<ExecSpace>& utils)
+      : KernelVariables(team_in, utils)
+  {
+    if (elems.size()>0) {
+      ie = elems(ie);
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  KernelVariables(const TeamMember &team_in, const int qsize, const ExecViewUnmanaged<const int*>& elems,
+                  const TeamUtils<ExecSpace>& utils)
+      : KernelVariables(team_in, qsize, utils)
+  {
+    if (elems.size()>0) {
+      ie = elems(ie);
+    }
+  }
+
 #ifdef HOMMEXX_CUDA_SHARE_BUFFER
   KOKKOS_INLINE_FUNCTION
   ~KernelVariables() {
@@ -8,6 +8,7 @@
 #define HOMMEXX_SIMULATION_PARAMS_HPP
 
 #include "HommexxEnums.hpp"
+#include "mpi/MpiHelpers.hpp"
 
 #include <iostream>
 
@@ -69,6 +70,13 @@ struct SimulationParams
   // to >0 for diagnostics.
   int       internal_diagnostics_level = 0;
 
+  // How the boundary exchanges communicate (see MpiExchangeMode)
+  MpiExchangeMode bndry_exchange_mpi_mode = MpiExchangeMode::PERSISTENT;
+
+  // Whether HV and EulerStep may overlap their boundary exchanges with the
+  // computation on the interior elements. Does not change answers.
+  bool      overlap_bndry_exchange = true;
+
   // Use this member to check whether the struct has been initialized
   bool      params_set = false;
 };
@@ -113,6 +121,8 @@ inline void SimulationParams::print (std::ostream& out) {
   out << "   dp3d_thresh: " << dp3d_thresh << "\n";
   out << "   vtheta_thresh: " << vtheta_thresh << "\n";
   out << "   internal_diagnostics_level: " << internal_diagnostics_level << "\n";
+  out << "   bndry_exchange_mpi_mode: " << (bndry_exchange_mpi_mode==MpiExchangeMode::NEIGHBOR ? "neighbor" : "persistent") << "\n";
+  out << "   overlap_bndry_exchange: " << (overlap_bndry_exchange ? "yes" : "no") << "\n";
   out << "\n**********************************************************\n";
 }
 
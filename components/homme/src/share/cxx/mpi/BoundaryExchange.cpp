@@ -36,6 +36,9 @@ static void alloc3d (A& a, B& b, int ne, int a2, int b2) {
   b = ExecViewManaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV_P]>**>("3d interface fields", ne, b2);
 }
 
+// The mpi mode of newly created BoundaryExchange objects
+static MpiExchangeMode s_default_mpi_mode = MpiExchangeMode::PERSISTENT;
+
 BoundaryExchange::BoundaryExchange()
 {
   m_num_1d_fields = 0;
@@ -59,6 +62,11 @@ BoundaryExchange::BoundaryExchange()
   m_cleaned_up = true;
   m_send_pending = false;
   m_recv_pending = false;
+  m_local_pack_pending = false;
+
+  m_mpi_mode = s_default_mpi_mode;
+  m_neighbor_comm = MPI_COMM_NULL;
+  m_neighbor_request = MPI_REQUEST_NULL;
 
   m_diagnostics_level = 0;
 }
@@ -90,6 +98,26 @@ void BoundaryExchange::set_label (const std::string& label) { m_label = label; }
 const std::string& BoundaryExchange::get_label () const { return m_label; }
 void BoundaryExchange::set_diagnostics_level (const int level) { m_diagnostics_level = level; }
 
+void BoundaryExchange::set_default_mpi_mode (const MpiExchangeMode mode) { s_default_mpi_mode = mode; }
+
+void BoundaryExchange::set_mpi_mode (const MpiExchangeMode mode)
+{
+  // Can't switch in the middle of an exchange
+  assert (!m_send_pending && !m_recv_pending);
+
+  if (mode==m_mpi_mode) {
+    return;
+  }
+  m_mpi_mode = mode;
+
+  // Rebuild the requests for the new mode. If registration is not completed yet,
+  // this will happen in registration_completed.
+  clear_buffer_views_and_requests();
+  if (m_registration_completed) {
+    build_buffer_views_and_requests();
+  }
+}
+
 void BoundaryExchange::set_connectivity (std::shared_ptr<Connectivity> connectivity)
 {
   // Functionality only available before registration starts
@@ -301,9 +329,7 @@ void BoundaryExchange::exchange (const ExecViewUnmanaged<const Real * [NP][NP]>*
 #endif
 
   // Hey, if some process can already send me stuff while I'm still packing, that's ok
-  if ( ! m_recv_requests.empty())
-    HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_recv_requests.size(), m_recv_requests.data()),
-                            m_connectivity->get_comm().mpi_comm());
+  start_recv();
   m_recv_pending = true;
 
   // ---- Pack and send ---- //
@@ -343,9 +369,7 @@ void BoundaryExchange::exchange_min_max ()
 #endif
 
   // Hey, if some process can already send me stuff while I'm still packing, that's ok
-  if ( ! m_recv_requests.empty())
-    HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_recv_requests.size(), m_recv_requests.data()),
-                            m_connectivity->get_comm().mpi_comm());
+  start_recv();
   m_recv_pending = true;
 
   // ---- Pack and send ---- //
@@ -360,12 +384,22 @@ void BoundaryExchange::exchange_min_max ()
 #endif
 }
 
+// Which connections are packed by a call to pack: all of them, only the ones
+// shared with other ranks (which need MPI), or only the on-rank ones (local and missing).
+enum : int { PACK_ALL = 0, PACK_SHARED = 1, PACK_NON_SHARED = 2 };
+
+KOKKOS_INLINE_FUNCTION
+static bool pack_connection (const int scope, const std::uint8_t sharing) {
+  return scope==PACK_ALL ||
+         (scope==PACK_SHARED) == (sharing==etoi(ConnectionSharing::SHARED));
+}
+
 static void
 pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> ucon,
       const ExecViewUnmanaged<const int*> ucon_ptr,
       const ExecViewUnmanaged<ExecViewManaged<Real[NP][NP]>**> fields_2d,
       const ExecViewUnmanaged<ExecViewUnmanaged<Real*>**> send_2d_buffers,
-      const int num_elems, const int num_2d_fields) {
+      const int num_elems, const int num_2d_fields, const int scope) {
   HOMMEXX_STATIC const ConnectionHelpers helpers;
   const int nconn = ucon.extent_int(0);
   Kokkos::parallel_for(
@@ -374,6 +408,7 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
       const int iconn = it / num_2d_fields;
       const int ifield = it % num_2d_fields;
       const auto& info = ucon(iconn);
+      if (!pack_connection(scope, info.sharing)) return;
       const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                 info.sharing_local_remote_iconn :
                                 iconn);
@@ -391,7 +426,7 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
       const ExecViewUnmanaged<const int*> ucon_ptr,
       const ExecViewUnmanaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV_PACKS]>**> fields_3d,
       const ExecViewUnmanaged<ExecViewUnmanaged<Scalar**>**> send_3d_buffers,
-      const int num_elems, const int num_3d_fields,
+      const int num_elems, const int num_3d_fields, const int scope,
       ExecViewManaged<int*>* nlev_packs_ = nullptr) {
   assert(partial_column == (nlev_packs_ != nullptr));
   if (partial_column) assert(nlev_packs_->extent_int(0) == num_3d_fields);
@@ -411,6 +446,7 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
         }
         const int iconn = it / (num_3d_fields*NUM_LEV_PACKS);
         const auto& info = ucon(iconn);
+        if (!pack_connection(scope, info.sharing)) return;
         const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                   info.sharing_local_remote_iconn :
                                   iconn);
@@ -442,6 +478,7 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
         for (int iconn = ucon_ptr(ie); iconn < iconn_end; ++iconn) {
           const auto& info = ucon(iconn);
           assert(info.kind != etoi(ConnectionSharing::MISSING));
+          if (!pack_connection(scope, info.sharing)) continue;
           const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                     info.sharing_local_remote_iconn :
                                     iconn);
@@ -462,6 +499,40 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
 }
 
 void BoundaryExchange::pack_and_send ()
+{
+  pack_and_send_impl(false);
+}
+
+void BoundaryExchange::pack_and_send_shared ()
+{
+  pack_and_send_impl(true);
+}
+
+void BoundaryExchange::pack_fields (const int scope)
+{
+  const auto& ucon = m_connectivity->get_d_ucon();
+  const auto& ucon_ptr = m_connectivity->get_d_ucon_ptr();
+  // First, pack 2d fields (if any)...
+  if (m_num_2d_fields > 0)
+    pack(ucon, ucon_ptr, m_2d_fields, m_send_2d_buffers, m_num_elems,
+         m_num_2d_fields, scope);
+  // ...then pack 3d fields (if any)...
+  if (m_num_3d_fields > 0) {
+    if (m_3d_nlev_pack_d.size() > 0)
+      pack<NUM_LEV, true>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
+                          m_num_elems, m_num_3d_fields, scope, &m_3d_nlev_pack_d);
+    else
+      pack<NUM_LEV>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
+                    m_num_elems, m_num_3d_fields, scope);
+  }
+  // ...then pack 3d interface fields (if any)
+  if (m_num_3d_int_fields > 0)
+    pack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_send_3d_int_buffers,
+                    m_num_elems, m_num_3d_int_fields, scope);
+  Kokkos::fence();
+}
+
+void BoundaryExchange::pack_and_send_impl (const bool shared_only)
 {
   tstart("be pack_and_send");
   // The registration MUST be completed by now
@@ -489,36 +560,25 @@ void BoundaryExchange::pack_and_send ()
     tstop("be build_buffer_views_and_requests");
   }
 
-  // ---- Pack ---- //
-  const auto& ucon = m_connectivity->get_d_ucon();
-  const auto& ucon_ptr = m_connectivity->get_d_ucon_ptr();
-  // First, pack 2d fields (if any)...
-  if (m_num_2d_fields > 0)
-    pack(ucon, ucon_ptr, m_2d_fields, m_send_2d_buffers, m_num_elems,
-         m_num_2d_fields);
-  // ...then pack 3d fields (if any)...
-  if (m_num_3d_fields > 0) {
-    if (m_3d_nlev_pack_d.size() > 0)
-      pack<NUM_LEV, true>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
-                          m_num_elems, m_num_3d_fields, &m_3d_nlev_pack_d);
-    else
-      pack<NUM_LEV>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
-                    m_num_elems, m_num_3d_fields);
+  // In overlapped mode, the caller is going to do some work before recv_and_unpack,
+  // so post the receives now, so that neighbors can start sending right away
+  if (shared_only && !m_recv_pending) {
+    start_recv();
+    m_recv_pending = true;
   }
-  // ...then pack 3d interface fields (if any)
-  if (m_num_3d_int_fields > 0)
-    pack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_send_3d_int_buffers,
-                    m_num_elems, m_num_3d_int_fields);
-  Kokkos::fence();
+
+  // ---- Pack ---- //
+  // In overlapped mode, only pack what goes to other ranks; the on-rank connections
+  // are packed in recv_and_unpack, once the caller is done with the interior elements
+  pack_fields(shared_only ? PACK_SHARED : PACK_ALL);
+  m_local_pack_pending = shared_only;
 
   // ---- Send ---- //
   tstart("be sync_send_buffer");
   m_buffers_manager->sync_send_buffer(this); // Deep copy send_buffer into mpi_send_buffer (no op if MPI is on device)
   tstop("be sync_send_buffer");
   tstart("be send");
-  if ( ! m_send_requests.empty())
-    HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_send_requests.size(), m_send_requests.data()),
-                            m_connectivity->get_comm().mpi_comm());
+  start_send();
 
   // Notify a send is ongoing
   m_send_pending = true;
@@ -529,6 +589,10 @@ void BoundaryExchange::recv_and_unpack () {
   recv_and_unpack(nullptr);
 }
 
+void BoundaryExchange::recv_and_unpack (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp) {
+  recv_and_unpack(&rspheremp);
+}
+
 // assume:conn-edges-snwe
 static void
 unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> ucon,
@@ -701,18 +765,23 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
     // else you'll be stuck waiting later on
     assert (m_send_pending);
 
-    if ( ! m_recv_requests.empty())
-      HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_recv_requests.size(), m_recv_requests.data()),
-                              m_connectivity->get_comm().mpi_comm());
+    start_recv();
     m_recv_pending = true;
   }
   tstop("be recv_and_unpack book");
 
+  // If we only sent the shared connections, pack the on-rank ones now,
+  // while the remote data is (hopefully) still arriving
+  if (m_local_pack_pending) {
+    tstart("be pack local");
+    pack_fields(PACK_NON_SHARED);
+    m_local_pack_pending = false;
+    tstop("be pack local");
+  }
+
   // ---- Recv ---- //
   tstart("be recv waitall");
-  if ( ! m_recv_requests.empty())
-    HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(m_recv_requests.size(), m_recv_requests.data(), MPI_STATUSES_IGNORE),
-                            m_connectivity->get_comm().mpi_comm()); // Wait for all data to arrive
+  wait_recv();
   m_recv_pending = false;
   tstop("be recv waitall");
 
@@ -749,10 +818,7 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
   // reusable.
 
   tstart("be waitall 2");
-  if ( ! m_send_requests.empty())
-    HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(m_send_requests.size(), m_send_requests.data(),
-                                        MPI_STATUSES_IGNORE),
-                            m_connectivity->get_comm().mpi_comm()); // Wait for all data to arrive
+  wait_send();
   tstop("be waitall 2");
 
   tstart("be recv_and_unpack book");
@@ -863,9 +929,7 @@ void BoundaryExchange::pack_and_send_min_max ()
 
   // ---- Send ---- //
   m_buffers_manager->sync_send_buffer(this);
-  if ( ! m_send_requests.empty())
-    HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_send_requests.size(), m_send_requests.data()),
-                            m_connectivity->get_comm().mpi_comm());
+  start_send();
 
   // Mark send buffer as busy
   m_send_pending = true;
@@ -958,16 +1022,12 @@ void BoundaryExchange::recv_and_unpack_min_max ()
     // else you'll be stuck waiting later on
     assert (m_send_pending);
 
-    if ( ! m_recv_requests.empty())
-      HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_recv_requests.size(), m_recv_requests.data()),
-                              m_connectivity->get_comm().mpi_comm());
+    start_recv();
     m_recv_pending = true;
   }
 
   // ---- Recv ---- //
-  if ( ! m_recv_requests.empty())
-    HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(m_recv_requests.size(), m_recv_requests.data(), MPI_STATUSES_IGNORE),
-                            m_connectivity->get_comm().mpi_comm()); // Wait for all data to arrive
+  wait_recv();
 
   m_buffers_manager->sync_recv_buffer(this); // Deep copy mpi_recv_buffer into recv_buffer (no op if MPI is on device)
 
@@ -979,9 +1039,7 @@ void BoundaryExchange::recv_and_unpack_min_max ()
   // this object has finished its send requests, and may erroneously reuse the
   // buffers. Therefore, we must ensure that, upon return, all buffers are
   // reusable.
-  if ( ! m_send_requests.empty())
-    HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(m_send_requests.size(), m_send_requests.data(), MPI_STATUSES_IGNORE),
-                            m_connectivity->get_comm().mpi_comm()); // Wait for all data to arrive
+  wait_send();
 
   // Release the send/recv buffers
   m_buffers_manager->unlock_buffers();
@@ -1146,8 +1204,17 @@ void BoundaryExchange::build_buffer_views_and_requests()
     const auto mpi_comm = m_connectivity->get_comm().mpi_comm();
     const size_t npids = pids.size();
     free_requests();
-    m_send_requests.resize(npids);
-    m_recv_requests.resize(npids);
+    const bool neighbor = m_mpi_mode==MpiExchangeMode::NEIGHBOR;
+    if (neighbor) {
+      // The neighbor comm orders the neighbors as pids (both are sorted)
+      assert (pids==m_connectivity->get_neighbor_pids());
+      m_neighbor_comm = m_connectivity->get_neighbor_comm();
+      m_neighbor_counts.resize(npids);
+      m_neighbor_displs.resize(npids);
+    } else {
+      m_send_requests.resize(npids);
+      m_recv_requests.resize(npids);
+    }
     MPIViewManaged<Real*>::pointer_type send_ptr = buffers_manager->get_mpi_send_buffer().data();
     MPIViewManaged<Real*>::pointer_type recv_ptr = buffers_manager->get_mpi_recv_buffer().data();
     int offset = 0;
@@ -1158,14 +1225,19 @@ void BoundaryExchange::build_buffer_views_and_requests()
         const auto& info = ucon(i);
         count += m_elem_buf_size[info.kind];
       }
-      HOMMEXX_MPI_CHECK_ERROR(MPI_Send_init(send_ptr + offset, count, MPI_DOUBLE,
-                                            pids[ip], m_exchange_type, mpi_comm,
-                                            &m_send_requests[ip]),
-                              m_connectivity->get_comm().mpi_comm());
-      HOMMEXX_MPI_CHECK_ERROR(MPI_Recv_init(recv_ptr + offset, count, MPI_DOUBLE,
-                                            pids[ip], m_exchange_type, mpi_comm,
-                                            &m_recv_requests[ip]),
-                              m_connectivity->get_comm().mpi_comm());
+      if (neighbor) {
+        m_neighbor_counts[ip] = count;
+        m_neighbor_displs[ip] = offset;
+      } else {
+        HOMMEXX_MPI_CHECK_ERROR(MPI_Send_init(send_ptr + offset, count, MPI_DOUBLE,
+                                              pids[ip], m_exchange_type, mpi_comm,
+                                              &m_send_requests[ip]),
+                                m_connectivity->get_comm().mpi_comm());
+        HOMMEXX_MPI_CHECK_ERROR(MPI_Recv_init(recv_ptr + offset, count, MPI_DOUBLE,
+                                              pids[ip], m_exchange_type, mpi_comm,
+                                              &m_recv_requests[ip]),
+                                m_connectivity->get_comm().mpi_comm());
+      }
       offset += count;
     }
   }
@@ -1184,6 +1256,51 @@ void BoundaryExchange
     HOMMEXX_MPI_CHECK_ERROR(MPI_Request_free(&m_recv_requests[i]),
                             m_connectivity->get_comm().mpi_comm());
   m_recv_requests.clear();
+  m_neighbor_counts.clear();
+  m_neighbor_displs.clear();
+}
+
+void BoundaryExchange::start_recv ()
+{
+  // In NEIGHBOR mode, recvs are posted together with the sends, in start_send
+  if (m_mpi_mode==MpiExchangeMode::PERSISTENT && ! m_recv_requests.empty())
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_recv_requests.size(), m_recv_requests.data()),
+                            m_connectivity->get_comm().mpi_comm());
+}
+
+void BoundaryExchange::start_send ()
+{
+  if (m_mpi_mode==MpiExchangeMode::NEIGHBOR) {
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Ineighbor_alltoallv(
+                              m_buffers_manager->get_mpi_send_buffer().data(),
+                              m_neighbor_counts.data(), m_neighbor_displs.data(), MPI_DOUBLE,
+                              m_buffers_manager->get_mpi_recv_buffer().data(),
+                              m_neighbor_counts.data(), m_neighbor_displs.data(), MPI_DOUBLE,
+                              m_neighbor_comm, &m_neighbor_request),
+                            m_connectivity->get_comm().mpi_comm());
+  } else if ( ! m_send_requests.empty()) {
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_send_requests.size(), m_send_requests.data()),
+                            m_connectivity->get_comm().mpi_comm());
+  }
+}
+
+void BoundaryExchange::wait_recv ()
+{
+  if (m_mpi_mode==MpiExchangeMode::NEIGHBOR) {
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Wait(&m_neighbor_request, MPI_STATUS_IGNORE),
+                            m_connectivity->get_comm().mpi_comm());
+  } else if ( ! m_recv_requests.empty()) {
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(m_recv_requests.size(), m_recv_requests.data(), MPI_STATUSES_IGNORE),
+                            m_connectivity->get_comm().mpi_comm()); // Wait for all data to arrive
+  }
+}
+
+void BoundaryExchange::wait_send ()
+{
+  // In NEIGHBOR mode, the send buffer is reusable once the collective completes in wait_recv
+  if (m_mpi_mode==MpiExchangeMode::PERSISTENT && ! m_send_requests.empty())
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(m_send_requests.size(), m_send_requests.data(), MPI_STATUSES_IGNORE),
+                            m_connectivity->get_comm().mpi_comm());
 }
 
 // A slot is the space in a communication buffer for an (element, connection)
@@ -1292,12 +1409,8 @@ void BoundaryExchange::waitall()
   // Safety check
   assert (m_buffers_manager->are_buffers_busy());
 
-  if ( ! m_send_requests.empty())
-    HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(m_send_requests.size(), m_send_requests.data(), MPI_STATUSES_IGNORE),
-                            m_connectivity->get_comm().mpi_comm());
-  if ( ! m_recv_requests.empty())
-    HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(m_recv_requests.size(), m_recv_requests.data(), MPI_STATUSES_IGNORE),
-                            m_connectivity->get_comm().mpi_comm());
+  wait_send();
+  wait_recv();
 
   m_buffers_manager->unlock_buffers();
 }
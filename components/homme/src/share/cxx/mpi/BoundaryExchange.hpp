@@ -103,9 +103,22 @@ public:
   // Set the connectivity if default constructor was used
   void set_connectivity (std::shared_ptr<Connectivity> connectivity);
 
+  // Get the connectivity (may be null, if not yet set)
+  std::shared_ptr<Connectivity> get_connectivity () const { return m_connectivity; }
+
   // Set the buffers manager (registration must not be completed)
   void set_buffers_manager (std::shared_ptr<MpiBuffersManager> buffers_manager);
 
+  // Set how the MPI communication is performed (see MpiExchangeMode). Can be changed
+  // at any time, as long as no exchange is ongoing. The mode of newly created objects
+  // is the default mode, which is PERSISTENT, unless changed via set_default_mpi_mode
+  // (which init_simulation_params_c does, based on the bndry_exchange_mpi_mode namelist option).
+  // NOTE: in NEIGHBOR mode, each exchange is a (neighborhood) collective, so all ranks
+  //       must call exchange on the BE objects in the same order.
+  void set_mpi_mode (const MpiExchangeMode mode);
+  MpiExchangeMode get_mpi_mode () const { return m_mpi_mode; }
+  static void set_default_mpi_mode (const MpiExchangeMode mode);
+
   // These number refers to *scalar* fields. A 2-vector field counts as 2 fields.
   void set_num_fields (const int num_1d_fields, const int num_2d_fields, const int num_3d_fields, const int num_3d_int_fields = 0);
 
@@ -218,6 +231,18 @@ public:
   // Perform the pack_and_send and recv_and_unpack for boundary exchange of 2d/3d fields
   void pack_and_send ();
   void recv_and_unpack ();
+  void recv_and_unpack (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp);
+
+  // Overlapped version of pack_and_send: start the receives, then pack and send only
+  // the connections shared with other ranks. The remaining (on-rank) connections
+  // are packed at the beginning of recv_and_unpack. This allows the caller to
+  // compute the fields on the boundary elements (see Connectivity), call this
+  // method, and then compute the interior elements while messages are in flight:
+  //   <compute boundary elements>
+  //   be.pack_and_send_shared();
+  //   <compute interior elements>
+  //   be.recv_and_unpack();
+  void pack_and_send_shared ();
 
   // Perform the pack_and_send and recv_and_unpack for min/max boundary exchange of 1d fields
   void pack_and_send_min_max ();
@@ -248,9 +273,19 @@ private:
 
   int                       m_elem_buf_size[2];
 
+  MpiExchangeMode           m_mpi_mode;
+
+  // Used in PERSISTENT mode
   std::vector<MPI_Request>  m_send_requests;
   std::vector<MPI_Request>  m_recv_requests;
 
+  // Used in NEIGHBOR mode. Counts/displacements are in the order of the connectivity
+  // neighbor pids, and are the same for send and recv.
+  MPI_Comm                  m_neighbor_comm;
+  std::vector<int>          m_neighbor_counts;
+  std::vector<int>          m_neighbor_displs;
+  MPI_Request               m_neighbor_request;
+
   ExecViewManaged<ExecViewManaged<Scalar[2][NUM_LEV]>**>            m_1d_fields;
   ExecViewManaged<ExecViewManaged<Real[NP][NP]>**>                  m_2d_fields;
   ExecViewManaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV]>**>       m_3d_fields;
@@ -301,6 +336,7 @@ private:
   bool        m_cleaned_up;
   bool        m_send_pending;
   bool        m_recv_pending;
+  bool        m_local_pack_pending;
 
   int         m_num_elems;
 
@@ -311,6 +347,13 @@ private:
     std::vector<int>& h_slot_idx_to_elem_conn_pair,
     std::vector<int>& pids, std::vector<int>& pids_os);
   void free_requests();
+  // Start/complete the MPI communication, depending on m_mpi_mode
+  void start_recv ();
+  void start_send ();
+  void wait_recv ();
+  void wait_send ();
+  void pack_and_send_impl (const bool shared_only);
+  void pack_fields (const int scope);
   // Only the impl knows about the raw pointer.
   void exchange(const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
 public: // This is semantically private but must be public for nvcc.
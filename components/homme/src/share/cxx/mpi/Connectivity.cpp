@@ -6,9 +6,11 @@
 
 #include "Connectivity.hpp"
 #include "ErrorDefs.hpp"
+#include "Hommexx_Debug.hpp"
 
 #include <array>
 #include <algorithm>
+#include <vector>
 
 namespace Homme
 {
@@ -136,6 +138,7 @@ void Connectivity::finalize(const bool sanity_check)
   }
 
   setup_ucon();
+  setup_boundary_interior_elements();
 
   m_finalized = true;
 }
@@ -313,6 +316,66 @@ void Connectivity::setup_ucon () {
   }
 }
 
+void Connectivity::setup_boundary_interior_elements () {
+  std::vector<int> boundary, interior;
+  for (int ie = 0; ie < m_num_local_elements; ++ie) {
+    bool is_boundary = false;
+    for (int k = h_ucon_ptr(ie); k < h_ucon_ptr(ie+1); ++k) {
+      if (h_ucon(k).sharing == etoi(ConnectionSharing::SHARED)) {
+        is_boundary = true;
+        break;
+      }
+    }
+    (is_boundary ? boundary : interior).push_back(ie);
+  }
+
+  // Collect the (sorted) list of ranks we share connections with
+  m_neighbor_pids.clear();
+  for (int k = 0; k < h_ucon.extent_int(0); ++k) {
+    if (h_ucon(k).sharing == etoi(ConnectionSharing::SHARED)) {
+      m_neighbor_pids.push_back(h_ucon(k).remote_pid);
+    }
+  }
+  std::sort(m_neighbor_pids.begin(), m_neighbor_pids.end());
+  m_neighbor_pids.erase(std::unique(m_neighbor_pids.begin(), m_neighbor_pids.end()),
+                        m_neighbor_pids.end());
+
+  d_boundary_elems = decltype(d_boundary_elems)("Boundary elements", boundary.size());
+  d_interior_elems = decltype(d_interior_elems)("Interior elements", interior.size());
+  Kokkos::deep_copy(d_boundary_elems, HostViewUnmanaged<const int*>(boundary.data(), boundary.size()));
+  Kokkos::deep_copy(d_interior_elems, HostViewUnmanaged<const int*>(interior.data(), interior.size()));
+}
+
+MPI_Comm Connectivity::get_neighbor_comm ()
+{
+  assert (m_finalized);
+
+  if (!m_neighbor_comm) {
+    // The graph is symmetric: we receive from the same ranks we send to.
+    // Don't let MPI reorder ranks, since pids in the connections refer to m_comm.
+    const int nnbr = m_neighbor_pids.size();
+    MPI_Comm graph_comm;
+    HOMMEXX_MPI_CHECK_ERROR(
+      MPI_Dist_graph_create_adjacent(m_comm.mpi_comm(),
+                                     nnbr, m_neighbor_pids.data(), MPI_UNWEIGHTED,
+                                     nnbr, m_neighbor_pids.data(), MPI_UNWEIGHTED,
+                                     MPI_INFO_NULL, 0, &graph_comm),
+      m_comm.mpi_comm());
+
+    // Copies of this Connectivity share the comm, so free it when the last one goes away
+    m_neighbor_comm = std::shared_ptr<MPI_Comm>(
+      new MPI_Comm(graph_comm),
+      [](MPI_Comm* c) {
+        int finalized;
+        MPI_Finalized(&finalized);
+        if (!finalized) MPI_Comm_free(c);
+        delete c;
+      });
+  }
+
+  return *m_neighbor_comm;
+}
+
 void Connectivity::clean_up()
 {
   // Cleaning the elements counter
@@ -322,6 +385,11 @@ void Connectivity::clean_up()
   h_ucon = decltype(h_ucon)("", 0);
   d_ucon_ptr = decltype(d_ucon_ptr)("", 0);
   h_ucon_ptr = decltype(h_ucon_ptr)("", 0);
+  d_boundary_elems = decltype(d_boundary_elems)("", 0);
+  d_interior_elems = decltype(d_interior_elems)("", 0);
+
+  m_neighbor_pids.clear();
+  m_neighbor_comm = nullptr;
 
   m_initialized = false;
   m_finalized   = false;
@@ -11,6 +11,9 @@
 #include "Comm.hpp"
 #include "Types.hpp"
 
+#include <memory>
+#include <vector>
+
 namespace Homme
 {
 struct LidGidPos
@@ -122,6 +125,15 @@ public:
   KOKKOS_INLINE_FUNCTION
   int get_num_local_connections  () const { return get_num_connections<MemSpace>(ConnectionSharing::LOCAL, ConnectionKind::ANY); }
 
+  // Local IDs of the elements with (boundary) and without (interior) at least one
+  // connection shared with another process. Kernels feeding a boundary exchange can
+  // process the boundary elements first, so that MPI messages can be sent while
+  // the interior elements are processed (see BoundaryExchange::pack_and_send_shared).
+  ExecViewUnmanaged<const int*> get_d_boundary_elements () const { return d_boundary_elems; }
+  ExecViewUnmanaged<const int*> get_d_interior_elements () const { return d_interior_elems; }
+  int get_num_boundary_elements  () const { return d_boundary_elems.extent_int(0); }
+  int get_num_interior_elements  () const { return d_interior_elems.extent_int(0); }
+
   int get_num_local_elements     () const { return m_num_local_elements;  }
   int get_max_corner_elements    () const { return m_max_corner_elements; }
 
@@ -129,6 +141,14 @@ public:
   bool is_finalized   () const { return m_finalized;   }
 
   const Comm& get_comm () const { return m_comm; }
+
+  // Ranks owning the remote side of at least one shared connection, in ascending order
+  const std::vector<int>& get_neighbor_pids () const { return m_neighbor_pids; }
+
+  // A distributed-graph communicator, whose sources and destinations are the
+  // neighbor pids (in the same order), to be used with MPI neighbor collectives.
+  // It is created at the first call, which must be collective on get_comm().
+  MPI_Comm get_neighbor_comm ();
   //@}
 
 private:
@@ -156,6 +176,11 @@ private:
   ExecViewManaged<int*>::HostMirror h_ucon_ptr;
   ExecViewManaged<int*>             d_ucon_dir_ptr;
   ExecViewManaged<int*>::HostMirror h_ucon_dir_ptr;
+  ExecViewManaged<int*>             d_boundary_elems;
+  ExecViewManaged<int*>             d_interior_elems;
+
+  std::vector<int>                  m_neighbor_pids;
+  std::shared_ptr<MPI_Comm>         m_neighbor_comm;
   // Helper used to accumulate connections during add_connection phase. Emptied
   // in finalize. l_ is local; r_ is remote.
   struct UConInfo {
@@ -167,6 +192,8 @@ private:
   // In finalize call, construct the unstructured connectivity data using
   // ucon_info.
   void setup_ucon();
+  // Split the local elements in boundary and interior ones.
+  void setup_boundary_interior_elements();
 };
 
 } // namespace Homme
@@ -19,6 +19,16 @@ enum ExchangeType : short int {
   MPI_EXCHANGE_MIN_MAX = 2000
 };
 
+// How the BoundaryExchange communicates with the neighboring ranks:
+//  - PERSISTENT: persistent point-to-point requests (MPI_Send_init/MPI_Recv_init),
+//    started with MPI_Startall at each exchange.
+//  - NEIGHBOR: a single MPI_Ineighbor_alltoallv on the distributed-graph
+//    communicator built from the connectivity (see Connectivity::get_neighbor_comm).
+enum class MpiExchangeMode : int {
+  PERSISTENT = 0,
+  NEIGHBOR   = 1
+};
+
 // For min/max exchange, we store the two values in a single array, and often need to access it
 // to retrieve the max or the min. Instead of hard-coding 0/1, we use a wordy name
 enum MinMaxId : int {
@@ -37,6 +37,8 @@ HyperviscosityFunctorImpl (const SimulationParams&     params,
  , m_policy_nutop_laplace (Homme::get_default_team_policy<ExecSpace, TagNutopLaplace>(m_num_elems))
  , m_policy_nutop_update_states (Homme::get_default_team_policy<ExecSpace,TagNutopUpdateStates>(m_num_elems))
  , m_tu(m_policy_update_states)
+ , m_overlap_allowed(true)
+ , m_overlap_exchange(false)
 {
   init_params(params);
 
@@ -57,6 +59,8 @@ HyperviscosityFunctorImpl (const int num_elems, const SimulationParams &params)
   , m_policy_nutop_laplace (Homme::get_default_team_policy<ExecSpace, TagNutopLaplace>(m_num_elems))
   , m_policy_nutop_update_states (Homme::get_default_team_policy<ExecSpace,TagNutopUpdateStates>(m_num_elems))
   , m_tu(m_policy_update_states)
+  , m_overlap_allowed(true)
+  , m_overlap_exchange(false)
 {
   init_params(params);
 }
@@ -66,6 +70,8 @@ void HyperviscosityFunctorImpl::init_params(const SimulationParams& params)
   // Sanity check
   assert(params.params_set);
 
+  m_overlap_allowed = params.overlap_bndry_exchange;
+
   if (m_data.nu_top>0) {
 
     m_nu_scale_top = ExecViewManaged<Scalar[NUM_LEV]>("nu_scale_top");
@@ -224,6 +230,16 @@ void HyperviscosityFunctorImpl::init_boundary_exchanges () {
     be->register_field(m_buffers.vtens, 2, 0, nlev);
     be->registration_completed();
   }
+
+  // Overlapping exchanges with computations only pays off if there are both
+  // boundary elements (whose data goes to other ranks) and interior elements
+  // (whose computation can hide the messages latency).
+  const auto& connectivity = *m_be->get_connectivity();
+  m_boundary_elems = connectivity.get_d_boundary_elements();
+  m_interior_elems = connectivity.get_d_interior_elements();
+  m_overlap_exchange = m_overlap_allowed &&
+                       connectivity.get_num_boundary_elements()>0 &&
+                       connectivity.get_num_interior_elements()>0;
 }//initBE
 
 void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real eta_ave_w)
@@ -267,18 +283,45 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
   Kokkos::fence();
 
   for (int icycle = 0; icycle < m_data.hypervis_subcycle; ++icycle) {
-    GPTLstart("hvf-bhwk");
-    biharmonic_wk_theta ();
-    GPTLstop("hvf-bhwk");
+    if (m_overlap_exchange) {
+      GPTLstart("hvf-bhwk");
+      first_laplace_and_exchange ();
+
+      // Compute second laplacian and pre-exchange update on boundary elements first,
+      // send their data, and then process interior elements while messages are in flight
+      second_laplace(m_boundary_elems);
+      run_on_elements<TagHyperPreExchange>(m_boundary_elems);
+      Kokkos::fence();
+      GPTLstop("hvf-bhwk");
 
-    Kokkos::parallel_for(m_policy_pre_exchange, *this);
-    Kokkos::fence();
+      assert (m_be->is_registration_completed());
+      GPTLstart("hvf-bexch");
+      m_be->pack_and_send_shared();
+      GPTLstop("hvf-bexch");
 
-    // Exchange
-    assert (m_be->is_registration_completed());
-    GPTLstart("hvf-bexch");
-    m_be->exchange();
-    GPTLstop("hvf-bexch");
+      GPTLstart("hvf-bhwk");
+      second_laplace(m_interior_elems);
+      run_on_elements<TagHyperPreExchange>(m_interior_elems);
+      Kokkos::fence();
+      GPTLstop("hvf-bhwk");
+
+      GPTLstart("hvf-bexch");
+      m_be->recv_and_unpack();
+      GPTLstop("hvf-bexch");
+    } else {
+      GPTLstart("hvf-bhwk");
+      biharmonic_wk_theta ();
+      GPTLstop("hvf-bhwk");
+
+      Kokkos::parallel_for(m_policy_pre_exchange, *this);
+      Kokkos::fence();
+
+      // Exchange
+      assert (m_be->is_registration_completed());
+      GPTLstart("hvf-bexch");
+      m_be->exchange();
+      GPTLstop("hvf-bexch");
+    }
 
     // Update states
     Kokkos::parallel_for(m_policy_update_states, *this);
@@ -334,15 +377,29 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
   // sponge layer 
   if (m_data.nu_top > 0) {
     for (int icycle = 0; icycle < m_data.hypervis_subcycle_tom; ++icycle) {
-      // laplace(fields) --> ttens, etc.
-      Kokkos::parallel_for(m_policy_nutop_laplace, *this);
-      Kokkos::fence();
-
       // exchange is done on ttens, dptens, vtens, etc.
-      assert (m_be->is_registration_completed());
-      GPTLstart("hvf-bexch");
-      m_be_tom->exchange();
-      GPTLstop("hvf-bexch");
+      assert (m_be_tom->is_registration_completed());
+      if (m_overlap_exchange) {
+        // laplace(fields) --> ttens, etc., on boundary elements first
+        run_on_elements<TagNutopLaplace>(m_boundary_elems);
+        Kokkos::fence();
+        GPTLstart("hvf-bexch");
+        m_be_tom->pack_and_send_shared();
+        GPTLstop("hvf-bexch");
+        run_on_elements<TagNutopLaplace>(m_interior_elems);
+        Kokkos::fence();
+        GPTLstart("hvf-bexch");
+        m_be_tom->recv_and_unpack();
+        GPTLstop("hvf-bexch");
+      } else {
+        // laplace(fields) --> ttens, etc.
+        Kokkos::parallel_for(m_policy_nutop_laplace, *this);
+        Kokkos::fence();
+
+        GPTLstart("hvf-bexch");
+        m_be_tom->exchange();
+        GPTLstop("hvf-bexch");
+      }
 
       Kokkos::parallel_for(m_policy_nutop_update_states, *this);
       Kokkos::fence();
@@ -352,17 +409,7 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
 
 void HyperviscosityFunctorImpl::biharmonic_wk_theta() const
 {
-  // For the first laplacian we use a differnt kernel, which uses directly the states
-  // at timelevel np1 as inputs, and subtracts the reference states.
-  // This way we avoid copying the states to *tens buffers.
-  Kokkos::parallel_for(m_policy_first_laplace, *this);
-  Kokkos::fence();
-
-  // Exchange
-  assert (m_be->is_registration_completed());
-  GPTLstart("hvf-bexch");
-  m_be->exchange(m_geometry.m_rspheremp);
-  GPTLstop("hvf-bexch");
+  first_laplace_and_exchange();
 
   // Compute second laplacian, tensor or const hv
   const int ne = m_geometry.num_elems();
@@ -376,10 +423,61 @@ void HyperviscosityFunctorImpl::biharmonic_wk_theta() const
   Kokkos::fence();
 } //biharmonic
 
+void HyperviscosityFunctorImpl::first_laplace_and_exchange() const
+{
+  // For the first laplacian we use a differnt kernel, which uses directly the states
+  // at timelevel np1 as inputs, and subtracts the reference states.
+  // This way we avoid copying the states to *tens buffers.
+  assert (m_be->is_registration_completed());
+  if (m_overlap_exchange) {
+    run_on_elements<TagFirstLaplaceHV>(m_boundary_elems);
+    Kokkos::fence();
+    GPTLstart("hvf-bexch");
+    m_be->pack_and_send_shared();
+    GPTLstop("hvf-bexch");
+    run_on_elements<TagFirstLaplaceHV>(m_interior_elems);
+    Kokkos::fence();
+    GPTLstart("hvf-bexch");
+    m_be->recv_and_unpack(m_geometry.m_rspheremp);
+    GPTLstop("hvf-bexch");
+  } else {
+    Kokkos::parallel_for(m_policy_first_laplace, *this);
+    Kokkos::fence();
+
+    // Exchange
+    GPTLstart("hvf-bexch");
+    m_be->exchange(m_geometry.m_rspheremp);
+    GPTLstop("hvf-bexch");
+  }
+}
+
+void HyperviscosityFunctorImpl::second_laplace(const ExecViewUnmanaged<const int*>& elems) const
+{
+  if ( m_data.consthv ) {
+    run_on_elements<TagSecondLaplaceConstHV>(elems);
+  }else{
+    run_on_elements<TagSecondLaplaceTensorHV>(elems);
+  }
+}
+
+template<typename Tag>
+void HyperviscosityFunctorImpl::run_on_elements(const ExecViewUnmanaged<const int*>& elems) const
+{
+  // Use the same team/vector sizes as the full policies, since the
+  // team utils (and the scratch buffers) were sized for those
+  Kokkos::TeamPolicy<ExecSpace,Tag> policy(elems.extent_int(0),
+                                           m_policy_update_states.team_size(),
+                                           m_policy_update_states.impl_vector_length());
+  policy.set_chunk_size(1);
+  auto functor = *this;
+  functor.m_elems = elems;
+  Kokkos::parallel_for(policy, functor);
+}
+
 // Laplace for nu_top
 KOKKOS_INLINE_FUNCTION
 void HyperviscosityFunctorImpl::operator() (const TagNutopLaplace&, const TeamMember& team) const {
-  KernelVariables kv(team, m_tu);
+  KernelVariables kv(team, m_elems, m_tu);
 
   using MidColumn = decltype(Homme::subview(m_buffers.wtens,0,0,0));
 
@@ -107,12 +107,25 @@ public:
 
   void biharmonic_wk_theta () const;
 
+  // Whether run() overlaps the boundary exchanges with the interior elements computation
+  bool overlaps_exchange () const { return m_overlap_exchange; }
+
+protected:
+
+  // Helpers for the overlap of the boundary exchanges with the element computations
+  void first_laplace_and_exchange () const;
+  void second_laplace (const ExecViewUnmanaged<const int*>& elems) const;
+  template<typename Tag>
+  void run_on_elements (const ExecViewUnmanaged<const int*>& elems) const;
+
+public:
+
   // first iter of laplace, const hv
   KOKKOS_INLINE_FUNCTION
   void operator() (const TagFirstLaplaceHV&, const TeamMember& team) const {
      using IntColumn = decltype(Homme::subview(m_state.m_w_i,0,0,0,0));
 
-    KernelVariables kv(team, m_tu);
+    KernelVariables kv(team, m_elems, m_tu);
     // Subtract the reference states from the states
     Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team,NP*NP),
                          [&](const int idx) {
@@ -193,7 +206,7 @@ public:
   //second iter of laplace, const hv
   KOKKOS_INLINE_FUNCTION
   void operator() (const TagSecondLaplaceConstHV&, const TeamMember& team) const {
-    KernelVariables kv(team, m_tu);
+    KernelVariables kv(team, m_elems, m_tu);
     // Laplacian of layers thickness
     m_sphere_ops.laplace_simple(kv,
                    Homme::subview(m_buffers.dptens,kv.ie),
@@ -222,7 +235,7 @@ public:
   //second iter of laplace, tensor hv
   KOKKOS_INLINE_FUNCTION
   void operator() (const TagSecondLaplaceTensorHV&, const TeamMember& team) const {
-    KernelVariables kv(team, m_tu);
+    KernelVariables kv(team, m_elems, m_tu);
     // Laplacian of layers thickness
     m_sphere_ops.laplace_tensor(kv,
                    Homme::subview(m_geometry.m_tensorvisc,kv.ie),
@@ -315,7 +328,7 @@ public:
   void operator()(const TagHyperPreExchange, const TeamMember &team) const {
     using IntColumn = decltype(Homme::subview(m_state.m_w_i,0,0,0,0));
 
-    KernelVariables kv(team, m_tu);
+    KernelVariables kv(team, m_elems, m_tu);
     Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, NP * NP),
                          [&](const int &point_idx) {
       const int igp = point_idx / NP;
@@ -411,6 +424,17 @@ protected:
 
   std::shared_ptr<BoundaryExchange> m_be, m_be_tom;
 
+  // If true, kernels feeding a boundary exchange are run first on the boundary elements,
+  // then on the interior ones, overlapping the latter with the MPI messages. The elements
+  // lists come from the Connectivity. m_elems is the list of elements processed by the
+  // kernel being launched (empty means all of them). The overlap can be disabled via
+  // SimulationParams::overlap_bndry_exchange (m_overlap_allowed).
+  bool m_overlap_allowed;
+  bool m_overlap_exchange;
+  ExecViewUnmanaged<const int*> m_boundary_elems;
+  ExecViewUnmanaged<const int*> m_interior_elems;
+  ExecViewUnmanaged<const int*> m_elems;
+
   ExecViewManaged<Scalar[NUM_LEV]> m_nu_scale_top;
   int m_nu_scale_top_ilev_pack_lim;
 }; //HVfunctorImpl
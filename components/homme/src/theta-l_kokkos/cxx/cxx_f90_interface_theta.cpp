@@ -47,7 +47,8 @@ void init_simulation_params_c (const int& remap_alg, const int& limiter_option,
                                const bool& use_cpstar, const int& transport_alg, const bool& theta_hydrostatic_mode, const char** test_case,
                                const int& dt_remap_factor, const int& dt_tracer_factor,
                                const double& scale_factor, const double& laplacian_rigid_factor, const int& nsplit, const bool& pgrad_correction,
-                               const double& dp3d_thresh, const double& vtheta_thresh, const int& internal_diagnostics_level)
+                               const double& dp3d_thresh, const double& vtheta_thresh, const int& internal_diagnostics_level,
+                               const int& bndry_exchange_mpi_mode, const bool& overlap_bndry_exchange)
 {
   // Check that the simulation options are supported. This helps us in the future, since we
   // are currently 'assuming' some option have/not have certain values. As we support for more
@@ -58,6 +59,7 @@ void init_simulation_params_c (const int& remap_alg, const int& limiter_option,
   Errors::check_option("init_simulation_params_c","time_step_type",time_step_type,{1,4,5,6,7,9,10});
   Errors::check_option("init_simulation_params_c","qsize",qsize,0,Errors::ComparisonOp::GE);
   Errors::check_option("init_simulation_params_c","qsize",qsize,QSIZE_D,Errors::ComparisonOp::LE);
+  Errors::check_option("init_simulation_params_c","bndry_exchange_mpi_mode",bndry_exchange_mpi_mode,{0,1});
   if (qsize > 0) {
     // limiter_option is irrelevant if qsize = 0.
     Errors::check_option("init_simulation_params_c","limiter_option",limiter_option,{8,9});
@@ -124,6 +126,11 @@ void init_simulation_params_c (const int& remap_alg, const int& limiter_option,
   params.dp3d_thresh                   = dp3d_thresh;
   params.vtheta_thresh                 = vtheta_thresh;
   params.internal_diagnostics_level    = internal_diagnostics_level;
+  params.bndry_exchange_mpi_mode       = static_cast<MpiExchangeMode>(bndry_exchange_mpi_mode);
+  params.overlap_bndry_exchange        = overlap_bndry_exchange;
+
+  // All boundary exchanges are created after this point, so set the mode they start with
+  BoundaryExchange::set_default_mpi_mode(params.bndry_exchange_mpi_mode);
 
   if (time_step_type==5) {
     //5 stage, 3rd order, explicit
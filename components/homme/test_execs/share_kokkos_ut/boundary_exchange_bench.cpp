@@ -0,0 +1,149 @@
+#include <catch2/catch.hpp>
+
+#include "Context.hpp"
+#include "mpi/MpiBuffersManager.hpp"
+#include "mpi/BoundaryExchange.hpp"
+#include "mpi/Connectivity.hpp"
+#include "Types.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace Homme;
+
+extern int hommexx_catch2_argc;
+extern char** hommexx_catch2_argv;
+
+extern "C" {
+
+void initmp_f90 ();
+void init_cube_geometry_f90 (const int& ne);
+void init_connectivity_f90 ();
+void cleanup_geometry_f90 ();
+
+} // extern "C"
+
+namespace {
+
+// Fill the fields with a value that depends only on the global element id,
+// so that results do not depend on the order in which modes are run.
+void init_fields (const Connectivity& connectivity,
+                  const ExecViewManaged<Scalar**[NP][NP][NUM_LEV]>& fields)
+{
+  const auto h_fields = Kokkos::create_mirror_view(fields);
+  const auto h_ucon = connectivity.get_h_ucon();
+  const int num_fields = fields.extent(1);
+  for (int ic=0; ic<h_ucon.extent_int(0); ++ic) {
+    const int ie  = h_ucon(ic).local.lid;
+    const int gid = h_ucon(ic).local.gid;
+    for (int ifield=0; ifield<num_fields; ++ifield) {
+      for (int igp=0; igp<NP; ++igp) {
+        for (int jgp=0; jgp<NP; ++jgp) {
+          for (int ilev=0; ilev<NUM_LEV; ++ilev) {
+            h_fields(ie,ifield,igp,jgp,ilev) = gid + 0.25*ifield + 0.01*(igp*NP+jgp);
+    }}}}
+  }
+  Kokkos::deep_copy(fields,h_fields);
+}
+
+} // anonymous namespace
+
+// Reports the latency of a BoundaryExchange of 3d fields, for different field
+// counts, for each MpiExchangeMode. Run at different rank counts to see how
+// the two modes scale. Options (after "hommexx" on the command line):
+//   -ne <n>      : number of elements per cube face edge (default 4)
+//   -nsteps <n>  : number of timed exchanges per field count (default 20)
+TEST_CASE ("Boundary Exchange Bench", "Timing the boundary exchange mpi modes")
+{
+  int ne = 4;
+  int nsteps = 20;
+  for (int i=0; i<hommexx_catch2_argc; ++i) {
+    const std::string tok(hommexx_catch2_argv[i]);
+    if (tok=="-ne" && i+1<hommexx_catch2_argc) {
+      ne = std::atoi(hommexx_catch2_argv[++i]);
+    } else if (tok=="-nsteps" && i+1<hommexx_catch2_argc) {
+      nsteps = std::atoi(hommexx_catch2_argv[++i]);
+    }
+  }
+  ne = std::max(2,ne);
+  nsteps = std::max(1,nsteps);
+  constexpr int nwarmup = 2;
+
+  initmp_f90();
+  init_cube_geometry_f90(ne);
+  init_connectivity_f90();
+
+  std::shared_ptr<Connectivity> connectivity = Context::singleton().get_ptr<Connectivity>();
+  const Comm& comm = connectivity->get_comm();
+  const int num_elements = connectivity->get_num_local_elements();
+
+  Context::singleton().create<MpiBuffersManagerMap>();
+  std::shared_ptr<MpiBuffersManager> buffers_manager = Context::singleton().get<MpiBuffersManagerMap>()[MPI_EXCHANGE];
+
+  const std::vector<int> field_counts = {1, 4, 16, 40};
+  const std::vector<MpiExchangeMode> modes = {MpiExchangeMode::PERSISTENT, MpiExchangeMode::NEIGHBOR};
+  const char* mode_names[] = {"persistent", "neighbor"};
+
+  if (comm.root()) {
+    std::printf("be_bench> ranks %d ne %d nsteps %d neighbors(rank 0) %d\n",
+                comm.size(), ne, nsteps, (int)connectivity->get_neighbor_pids().size());
+    std::printf("be_bench> %10s %8s %14s %14s\n", "mode", "nfields", "mean [us]", "max mean [us]");
+  }
+
+  for (const int num_fields : field_counts) {
+    ExecViewManaged<Scalar**[NP][NP][NUM_LEV]> fields("fields", num_elements, num_fields);
+    std::vector<ExecViewManaged<Scalar**[NP][NP][NUM_LEV]>::HostMirror> results;
+
+    for (size_t imode=0; imode<modes.size(); ++imode) {
+      BoundaryExchange be(connectivity,buffers_manager);
+      be.set_mpi_mode(modes[imode]);
+      be.set_num_fields(0,0,num_fields);
+      be.register_field(fields,num_fields,0);
+      be.registration_completed();
+
+      // One exchange from the same initial state in each mode: results must match
+      init_fields(*connectivity,fields);
+      be.exchange();
+      Kokkos::fence();
+      results.push_back(Kokkos::create_mirror_view(fields));
+      Kokkos::deep_copy(results.back(),fields);
+
+      for (int i=0; i<nwarmup; ++i) {
+        be.exchange();
+      }
+      Kokkos::fence();
+      MPI_Barrier(comm.mpi_comm());
+
+      const double start = MPI_Wtime();
+      for (int i=0; i<nsteps; ++i) {
+        be.exchange();
+      }
+      Kokkos::fence();
+      const double mean = (MPI_Wtime()-start)/nsteps;
+
+      double max_mean;
+      MPI_Reduce(&mean,&max_mean,1,MPI_DOUBLE,MPI_MAX,0,comm.mpi_comm());
+      if (comm.root()) {
+        std::printf("be_bench> %10s %8d %14.2f %14.2f\n",
+                    mode_names[imode], num_fields, 1e6*mean, 1e6*max_mean);
+      }
+
+      be.clean_up();
+    }
+
+    // Both modes only differ in how the buffers are moved: answers are bfb
+    for (int ie=0; ie<num_elements; ++ie) {
+      for (int ifield=0; ifield<num_fields; ++ifield) {
+        for (int igp=0; igp<NP; ++igp) {
+          for (int jgp=0; jgp<NP; ++jgp) {
+            for (int ilev=0; ilev<NUM_LEV; ++ilev) {
+              for (int iv=0; iv<VECTOR_SIZE; ++iv) {
+                REQUIRE(results[0](ie,ifield,igp,jgp,ilev)[iv]==results[1](ie,ifield,igp,jgp,ilev)[iv]);
+    }}}}}}
+  }
+
+  cleanup_geometry_f90();
+}
@@ -12,6 +12,7 @@
 #include <random>
 #include <iomanip>
 #include <iostream>
+#include <vector>
 
 using namespace Homme;
 
@@ -81,6 +82,9 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
   int num_elements = connectivity->get_num_local_elements();
   int rank = connectivity->get_comm().rank();
 
+  // Boundary and interior elements must partition the local elements
+  REQUIRE(connectivity->get_num_boundary_elements()+connectivity->get_num_interior_elements()==num_elements);
+
   // Create input data arrays
   HostViewManaged<Real*[num_min_max_fields_1d][NUM_PHYSICAL_LEV]> field_min_1d_f90("", num_elements);
   HostViewManaged<Real*[num_min_max_fields_1d][NUM_PHYSICAL_LEV]> field_max_1d_f90("", num_elements);
@@ -132,8 +136,19 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
   be3->register_min_max_fields(field_1d_cxx,num_min_max_fields_1d,0);
   be3->registration_completed();
 
-  for (int itest=0; itest<num_tests; ++itest)
+  // Run the tests with each MpiExchangeMode. Both must match the f90 exchange.
+  const std::vector<MpiExchangeMode> modes = {MpiExchangeMode::PERSISTENT, MpiExchangeMode::NEIGHBOR};
+  const int num_modes = modes.size();
+  for (int itest=0; itest<num_tests*num_modes; ++itest)
   {
+    const auto mode = modes[itest % num_modes];
+    be1->set_mpi_mode(mode);
+    be2->set_mpi_mode(mode);
+    be3->set_mpi_mode(mode);
+    if (rank==0) {
+      std::cout << "mpi mode: " << (mode==MpiExchangeMode::NEIGHBOR ? "neighbor" : "persistent") << "\n";
+    }
+
     // Whether the neighbor min/max should be done as a whole or with two separate calls (start/pack_and_send and finish/recv_and_unpack)
     int minmax_split = dint(engine);
 
@@ -213,7 +228,8 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
       be3->pack_and_send_min_max();
       be1->pack_and_send();
       be1->recv_and_unpack();
-      be2->pack_and_send();
+      // Use the overlapped version for be2, to test packing shared and local connections separately
+      be2->pack_and_send_shared();
       be2->recv_and_unpack();
       be3->recv_and_unpack_min_max();
     }
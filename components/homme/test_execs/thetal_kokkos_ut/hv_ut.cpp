@@ -10,8 +10,10 @@
 #include "FunctorsBuffersManager.hpp"
 #include "HybridVCoord.hpp"
 #include "HyperviscosityFunctorImpl.hpp"
+#include "EulerStepFunctorImpl.hpp"
 #include "SimulationParams.hpp"
 #include "SphereOperators.hpp"
+#include "Tracers.hpp"
 #include "mpi/MpiBuffersManager.hpp"
 #include "mpi/Connectivity.hpp"
 #include "PhysicalConstants.hpp"
@@ -580,6 +582,20 @@ TEST_CASE("hvf", "biharmonic") {
         // Set the viscosity params
         hvf.set_hv_data(hv_scaling,params.nu_ratio1,params.nu_ratio2);
 
+        // Save the input state, to re-run the cxx functor below with blocking exchanges
+        decltype(state.m_v)         v0      ("",num_elems);
+        decltype(state.m_w_i)       w0      ("",num_elems);
+        decltype(state.m_vtheta_dp) vtheta0 ("",num_elems);
+        decltype(state.m_dp3d)      dp0     ("",num_elems);
+        decltype(state.m_phinh_i)   phinh0  ("",num_elems);
+        decltype(state.m_ps_v)      ps0     ("",num_elems);
+        Kokkos::deep_copy(v0,      state.m_v);
+        Kokkos::deep_copy(w0,      state.m_w_i);
+        Kokkos::deep_copy(vtheta0, state.m_vtheta_dp);
+        Kokkos::deep_copy(dp0,     state.m_dp3d);
+        Kokkos::deep_copy(phinh0,  state.m_phinh_i);
+        Kokkos::deep_copy(ps0,     state.m_ps_v);
+
         // Run the cxx functor
         hvf.run(np1,dt,eta_ave_w);
 
@@ -676,6 +692,151 @@ TEST_CASE("hvf", "biharmonic") {
             }
           }
         }
+
+        // Overlapping the exchanges with the interior elements computation must not
+        // change answers: re-run the cxx functor with blocking exchanges, and compare
+        // bit for bit. Whether the overlap happens depends on the partition, since a
+        // rank needs both boundary and interior elements.
+        std::cout << "     overlapped exchanges: " << (hvf.overlaps_exchange() ? "yes" : "no") << "\n";
+        Kokkos::deep_copy(state.m_v,         v0);
+        Kokkos::deep_copy(state.m_w_i,       w0);
+        Kokkos::deep_copy(state.m_vtheta_dp, vtheta0);
+        Kokkos::deep_copy(state.m_dp3d,      dp0);
+        Kokkos::deep_copy(state.m_phinh_i,   phinh0);
+        Kokkos::deep_copy(state.m_ps_v,      ps0);
+
+        params.overlap_bndry_exchange = false;
+        HVFTester hvf_blocking(params,geo,state,derived);
+        params.overlap_bndry_exchange = true;
+
+        FunctorsBuffersManager fbm_blocking;
+        fbm_blocking.request_size( hvf_blocking.requested_buffer_size() );
+        fbm_blocking.allocate();
+        hvf_blocking.init_buffers(fbm_blocking);
+        hvf_blocking.set_timestep_data(np1,dt,eta_ave_w);
+        hvf_blocking.init_boundary_exchanges();
+        hvf_blocking.set_hv_data(hv_scaling,params.nu_ratio1,params.nu_ratio2);
+        REQUIRE (not hvf_blocking.overlaps_exchange());
+
+        hvf_blocking.run(np1,dt,eta_ave_w);
+
+        auto v_blk      = Kokkos::create_mirror_view(state.m_v);
+        auto w_blk      = Kokkos::create_mirror_view(state.m_w_i);
+        auto vtheta_blk = Kokkos::create_mirror_view(state.m_vtheta_dp);
+        auto dp_blk     = Kokkos::create_mirror_view(state.m_dp3d);
+        auto phinh_blk  = Kokkos::create_mirror_view(state.m_phinh_i);
+        Kokkos::deep_copy(v_blk,      state.m_v);
+        Kokkos::deep_copy(w_blk,      state.m_w_i);
+        Kokkos::deep_copy(vtheta_blk, state.m_vtheta_dp);
+        Kokkos::deep_copy(dp_blk,     state.m_dp3d);
+        Kokkos::deep_copy(phinh_blk,  state.m_phinh_i);
+
+        for (int ie=0; ie<num_elems; ++ie) {
+          for (int igp=0; igp<NP; ++igp) {
+            for (int jgp=0; jgp<NP; ++jgp) {
+              for (int k=0; k<NUM_PHYSICAL_LEV; ++k) {
+                const int ilev = k / VECTOR_SIZE;
+                const int ivec = k % VECTOR_SIZE;
+                REQUIRE (v_blk(ie,np1,0,igp,jgp,ilev)[ivec]==v_cxx(ie,np1,0,igp,jgp,ilev)[ivec]);
+                REQUIRE (v_blk(ie,np1,1,igp,jgp,ilev)[ivec]==v_cxx(ie,np1,1,igp,jgp,ilev)[ivec]);
+                REQUIRE (dp_blk(ie,np1,igp,jgp,ilev)[ivec]==dp_cxx(ie,np1,igp,jgp,ilev)[ivec]);
+                REQUIRE (vtheta_blk(ie,np1,igp,jgp,ilev)[ivec]==vtheta_cxx(ie,np1,igp,jgp,ilev)[ivec]);
+              }
+              if (hvf.process_nh_vars()) {
+                for (int k=0; k<NUM_INTERFACE_LEV; ++k) {
+                  const int ilev = k / VECTOR_SIZE;
+                  const int ivec = k % VECTOR_SIZE;
+                  REQUIRE (w_blk(ie,np1,igp,jgp,ilev)[ivec]==w_cxx(ie,np1,igp,jgp,ilev)[ivec]);
+                  REQUIRE (phinh_blk(ie,np1,igp,jgp,ilev)[ivec]==phinh_cxx(ie,np1,igp,jgp,ilev)[ivec]);
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  SECTION ("euler_step_overlap") {
+    std::cout << "EulerStep overlap test:\n";
+
+    // Overlapping the qdp DSS with the interior elements computation must not
+    // change answers: run one euler step with and without overlap, and compare
+    // bit for bit. Whether the overlap happens depends on the partition, since a
+    // rank needs both boundary and interior elements.
+    auto& tracers = c.create<Tracers>();
+    tracers.init(num_elems,QSIZE_D);
+    tracers.randomize(seed,0.1,1.0);
+
+    // The limiter divides by dp, which derived.randomize leaves at zero
+    genRandArray(derived.m_dp,engine,RPDF(0.1,1.0));
+    genRandArray(derived.m_divdp_proj,engine,RPDF(-1e-3,1e-3));
+
+    params.qsize          = QSIZE_D;
+    params.limiter_option = 8;
+    params.nu_q           = params.nu;
+
+    const Real dt = RPDF(1e-5,1e-3)(engine);
+    constexpr int n0_qdp  = 0;
+    constexpr int np1_qdp = 1;
+
+    // The qdp and the DSS'd derived quantity are updated in place
+    decltype(tracers.qdp)            qdp0 ("",num_elems);
+    decltype(derived.m_eta_dot_dpdn) eta0 ("",num_elems);
+    Kokkos::deep_copy(qdp0,tracers.qdp);
+    Kokkos::deep_copy(eta0,derived.m_eta_dot_dpdn);
+
+    using QdpHost = decltype(Kokkos::create_mirror_view(tracers.qdp));
+    using EtaHost = decltype(Kokkos::create_mirror_view(derived.m_eta_dot_dpdn));
+    auto run_euler_step = [&](const bool overlap, QdpHost& qdp_h, EtaHost& eta_h) {
+      Kokkos::deep_copy(tracers.qdp,qdp0);
+      Kokkos::deep_copy(derived.m_eta_dot_dpdn,eta0);
+
+      params.overlap_bndry_exchange = overlap;
+      EulerStepFunctorImpl esf;
+      esf.reset(params);
+
+      FunctorsBuffersManager fbm;
+      fbm.request_size( esf.requested_buffer_size() );
+      fbm.allocate();
+      esf.init_buffers(fbm);
+      esf.init_boundary_exchanges();
+      if (not overlap) {
+        REQUIRE (not esf.overlaps_exchange());
+      } else {
+        std::cout << " -> overlapped exchanges: " << (esf.overlaps_exchange() ? "yes" : "no") << "\n";
+      }
+
+      esf.euler_step(np1_qdp,n0_qdp,dt,0.0,DSSOption::ETA);
+
+      qdp_h = Kokkos::create_mirror_view(tracers.qdp);
+      eta_h = Kokkos::create_mirror_view(derived.m_eta_dot_dpdn);
+      Kokkos::deep_copy(qdp_h,tracers.qdp);
+      Kokkos::deep_copy(eta_h,derived.m_eta_dot_dpdn);
+    };
+
+    QdpHost qdp_ovl, qdp_blk;
+    EtaHost eta_ovl, eta_blk;
+    run_euler_step(true, qdp_ovl,eta_ovl);
+    run_euler_step(false,qdp_blk,eta_blk);
+    params.overlap_bndry_exchange = true;
+
+    for (int ie=0; ie<num_elems; ++ie) {
+      for (int igp=0; igp<NP; ++igp) {
+        for (int jgp=0; jgp<NP; ++jgp) {
+          for (int k=0; k<NUM_PHYSICAL_LEV; ++k) {
+            const int ilev = k / VECTOR_SIZE;
+            const int ivec = k % VECTOR_SIZE;
+            for (int iq=0; iq<QSIZE_D; ++iq) {
+              REQUIRE (qdp_ovl(ie,np1_qdp,iq,igp,jgp,ilev)[ivec]==qdp_blk(ie,np1_qdp,iq,igp,jgp,ilev)[ivec]);
+            }
+          }
+          for (int k=0; k<NUM_INTERFACE_LEV; ++k) {
+            const int ilev = k / VECTOR_SIZE;
+            const int ivec = k % VECTOR_SIZE;
+            REQUIRE (eta_ovl(ie,igp,jgp,ilev)[ivec]==eta_blk(ie,igp,jgp,ilev)[ivec]);
+          }
+        }
       }
     }
   }